@@ -0,0 +1,120 @@
+//standard template library
+#include <vector>
+#include <algorithm>
+
+//external libraries
+#include <cmore.h>
+#include <memcry.h>
+
+//local headers
+#include "scancry.h"
+#include "addr_index.hh"
+
+
+
+      /* =============== * 
+ ===== *  C++ INTERFACE  * =====
+       * =============== */
+
+/*
+ *  --- [ADDRESS INDEX | PRIVATE] ---
+ */
+
+void sc::_addr_index::build(const cm_lst & lst, const bool objs) {
+
+    cm_lst_node * node;
+    mc_vm_obj * obj;
+    mc_vm_area * area;
+
+
+    //fetch the range of every node
+    this->entries.clear();
+    this->entries.reserve(lst.len);
+
+    node = lst.head;
+    for (int i = 0; i < lst.len; ++i) {
+
+        if (objs == true) {
+            obj = MC_GET_NODE_OBJ(node);
+            this->entries.push_back({obj->start_addr, obj->end_addr, node});
+        } else {
+            area = MC_GET_NODE_AREA(node);
+            this->entries.push_back({area->start_addr, area->end_addr, node});
+        }
+
+        node = node->next;
+    }
+
+    //sort ranges by their start address
+    std::sort(this->entries.begin(), this->entries.end(),
+              [](const struct _addr_index_entry & a,
+                 const struct _addr_index_entry & b) {
+        return a.start_addr < b.start_addr;
+    });
+
+    return;
+}
+
+
+
+/*
+ *  --- [ADDRESS INDEX | PUBLIC] ---
+ */
+
+void sc::_addr_index::build_objs(const mc_vm_map & map) {
+
+    this->build(map.vm_objs, true);
+    return;
+}
+
+
+void sc::_addr_index::build_areas(const mc_vm_map & map) {
+
+    this->build(map.vm_areas, false);
+    return;
+}
+
+
+void sc::_addr_index::clear() {
+
+    this->entries.clear();
+    this->entries.shrink_to_fit();
+    return;
+}
+
+
+[[nodiscard]] const struct sc::_addr_index_entry *
+    sc::_addr_index::find_preceding(const uintptr_t addr) const {
+
+    //find the first range starting after the address
+    auto iter = std::upper_bound(this->entries.begin(), this->entries.end(),
+                                 addr, [](const uintptr_t addr,
+                                          const struct _addr_index_entry & e) {
+        return addr < e.start_addr;
+    });
+
+    //the range before it is the last to start at or below the address
+    if (iter == this->entries.begin()) return nullptr;
+    return &*(iter - 1);
+}
+
+
+[[nodiscard]] const struct sc::_addr_index_entry *
+    sc::_addr_index::find_containing(const uintptr_t addr) const {
+
+    const struct _addr_index_entry * entry;
+
+
+    //the preceding range must also extend past the address
+    entry = this->find_preceding(addr);
+    if (entry == nullptr || addr >= entry->end_addr) return nullptr;
+
+    return entry;
+}
+
+
+[[nodiscard]] const std::vector<struct sc::_addr_index_entry> &
+    sc::_addr_index::get_entries() const noexcept {
+
+    return this->entries;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+//standard template library
+#include <vector>
+
+//external libraries
+#include <cmore.h>
+#include <memcry.h>
+
+//local headers
+#include "scancry.h"
+
+
+
+namespace sc {
+
+//a single address range of the index
+struct _addr_index_entry {
+
+    //[members]
+    uintptr_t start_addr;
+    uintptr_t end_addr;
+    const cm_lst_node * node;
+};
+
+
+/*
+ *  NOTE: The address index is a sorted array of MemCry object (or area)
+ *        ranges. It replaces walks of MemCry's lists with a binary
+ *        search when many addresses must be resolved at once.
+ *
+ *        `find_preceding()` mirrors MemCry's `last_obj_node_p`: an
+ *        address that lies in an anonymous area following an object is
+ *        attributed to that object.
+ */
+
+class _addr_index {
+
+    _SC_DBG_PRIVATE:
+        //[attributes]
+        std::vector<struct _addr_index_entry> entries;
+
+        //[methods]
+        void build(const cm_lst & lst, const bool objs);
+
+    public:
+        //[methods]
+        //populate the index
+        void build_objs(const mc_vm_map & map);
+        void build_areas(const mc_vm_map & map);
+        void clear();
+
+        //lookups, return `nullptr` if no entry matches
+        [[nodiscard]] const struct _addr_index_entry *
+            find_containing(const uintptr_t addr) const;
+        [[nodiscard]] const struct _addr_index_entry *
+            find_preceding(const uintptr_t addr) const;
+
+        //getters & setters
+        [[nodiscard]] const std::vector<struct _addr_index_entry> &
+            get_entries() const noexcept;
+};
+
+
+}; //namespace sc
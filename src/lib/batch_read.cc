@@ -0,0 +1,273 @@
+//standard template library
+#include <optional>
+#include <vector>
+#include <functional>
+#include <numeric>
+#include <algorithm>
+
+//C standard library
+#include <cstring>
+#include <climits>
+#include <cerrno>
+
+//system headers
+#include <sys/uio.h>
+
+//external libraries
+#include <cmore.h>
+#include <memcry.h>
+
+//local headers
+#include "scancry.h"
+#include "batch_read.hh"
+
+
+
+      /* =============== * 
+ ===== *  C++ INTERFACE  * =====
+       * =============== */
+
+/*
+ *  --- [BATCH READER | PRIVATE] ---
+ */
+
+//bytes of a request to extract, at most `max_sz`
+[[nodiscard]] size_t sc::_batch_reader::get_req_sz(
+    const size_t idx, const size_t max_sz) const noexcept {
+
+    if (this->szs[idx] == 0) return max_sz;
+    return std::min(this->szs[idx], max_sz);
+}
+
+
+void sc::_batch_reader::make_groups(const size_t page_size,
+                                    const size_t ptr_sz) {
+
+    size_t group_end, buf_sz = 0;
+    uintptr_t page_end, span_start, span_end;
+
+
+    //end of a request, pointers are queued without a size
+    auto req_end = [this, ptr_sz](const size_t idx) {
+        return this->addrs[idx]
+               + ((this->szs[idx] == 0) ? ptr_sz : this->szs[idx]);
+    };
+
+    //sort requests by address
+    this->order.resize(this->addrs.size());
+    std::iota(this->order.begin(), this->order.end(), 0);
+    std::sort(this->order.begin(), this->order.end(),
+              [this](size_t a, size_t b) {
+        return this->addrs[a] < this->addrs[b];
+    });
+
+    //for every group of requests inside the same page
+    this->groups.clear();
+    for (size_t i = 0; i < this->order.size(); i = group_end) {
+
+        span_start = this->addrs[this->order[i]];
+        span_end = req_end(this->order[i]);
+        page_end = span_start - (span_start % page_size) + page_size;
+
+        //extend the group while requests end inside the same page
+        group_end = i + 1;
+        while (group_end < this->order.size() && span_end <= page_end
+               && req_end(this->order[group_end]) <= page_end) {
+
+            span_end = std::max(span_end, req_end(this->order[group_end]));
+            ++group_end;
+        }
+
+        this->groups.push_back({span_start, span_end - span_start,
+                                buf_sz, i, group_end});
+        buf_sz += span_end - span_start;
+    }
+
+    //every group has its own span of the buffer
+    this->buf.resize(buf_sz);
+    this->group_ok.assign(this->groups.size(), false);
+
+    return;
+}
+
+
+[[nodiscard]] size_t sc::_batch_reader::read_vectored() {
+
+    ssize_t read_sz;
+    size_t iovs_num, next;
+    struct iovec local_iov;
+
+
+    for (size_t i = 0; i < this->groups.size(); i = next) {
+
+        //describe up to IOV_MAX groups, read into one span of the buffer
+        iovs_num = std::min(this->groups.size() - i, (size_t) IOV_MAX);
+        this->iovs.resize(iovs_num);
+        for (size_t j = 0; j < iovs_num; ++j) {
+            this->iovs[j].iov_base = (void *) this->groups[i + j].addr;
+            this->iovs[j].iov_len = this->groups[i + j].sz;
+        }
+
+        const struct _batch_group & last = this->groups[i + iovs_num - 1];
+        local_iov.iov_base = this->buf.data() + this->groups[i].buf_off;
+        local_iov.iov_len = last.buf_off + last.sz - this->groups[i].buf_off;
+
+        read_sz = process_vm_readv(this->pid.value(), &local_iov, 1,
+                                   this->iovs.data(), iovs_num, 0);
+        if (read_sz == -1) {
+
+            //the first group is not mapped, resume after it
+            if (errno == EFAULT) {
+                next = i + 1;
+                continue;
+            }
+
+            //the target can not be read this way
+            return i;
+        }
+
+        //every group read in full succeeded
+        next = i;
+        while (next < i + iovs_num
+               && (size_t) read_sz >= this->groups[next].sz) {
+
+            read_sz -= this->groups[next].sz;
+            this->group_ok[next] = true;
+            ++next;
+        }
+
+        //the read stopped at a group that is not mapped
+        if (next < i + iovs_num) ++next;
+    }
+
+    return this->groups.size();
+}
+
+
+void sc::_batch_reader::read_each(const mc_session * session,
+                                  const size_t first) {
+
+    int ret;
+
+
+    for (size_t i = first; i < this->groups.size(); ++i) {
+
+        const struct _batch_group & group = this->groups[i];
+
+        ret = mc_read(session, group.addr,
+                      this->buf.data() + group.buf_off, group.sz);
+        this->group_ok[i] = (ret == 0);
+    }
+
+    return;
+}
+
+
+void sc::_batch_reader::read_groups(
+    const mc_session * session, const size_t ptr_sz,
+    std::vector<cm_byte> & ok,
+    const std::function<void(const size_t, const cm_byte *)> & extract) {
+
+    size_t first = 0;
+
+
+    ok.assign(this->addrs.size(), false);
+    this->make_groups(session->page_size, ptr_sz);
+
+    //read every group at once if possible, otherwise one by one
+    if (this->pid.has_value() == true) first = this->read_vectored();
+    this->read_each(session, first);
+
+    //extract every request of every group that was read
+    for (size_t i = 0; i < this->groups.size(); ++i) {
+
+        if (this->group_ok[i] == false) continue;
+
+        const struct _batch_group & group = this->groups[i];
+        for (size_t j = group.begin; j < group.end; ++j) {
+
+            extract(this->order[j], this->buf.data() + group.buf_off
+                    + (this->addrs[this->order[j]] - group.addr));
+            ok[this->order[j]] = true;
+        }
+    }
+
+    return;
+}
+
+
+
+/*
+ *  --- [BATCH READER | PUBLIC] ---
+ */
+
+size_t sc::_batch_reader::add(const uintptr_t addr) {
+
+    this->addrs.push_back(addr);
+    this->szs.push_back(0);
+    return this->addrs.size() - 1;
+}
+
+
+size_t sc::_batch_reader::add(const uintptr_t addr, const size_t sz) {
+
+    this->addrs.push_back(addr);
+    this->szs.push_back(sz);
+    return this->addrs.size() - 1;
+}
+
+
+void sc::_batch_reader::read_ptrs(const mc_session * session,
+                                  const enum addr_width addr_width,
+                                  std::vector<uintptr_t> & values,
+                                  std::vector<cm_byte> & ok) {
+
+    //values are zero extended if the address width is smaller
+    values.assign(this->addrs.size(), 0);
+
+    this->read_groups(session, addr_width, ok,
+                      [this, &values, addr_width](const size_t idx,
+                                                  const cm_byte * src) {
+        std::memcpy(&values[idx], src, this->get_req_sz(idx, addr_width));
+    });
+
+    return;
+}
+
+
+void sc::_batch_reader::read(const mc_session * session, const size_t stride,
+                             std::vector<cm_byte> & bytes,
+                             std::vector<cm_byte> & ok) {
+
+    bytes.assign(this->addrs.size() * stride, 0);
+
+    this->read_groups(session, stride, ok,
+                      [this, &bytes, stride](const size_t idx,
+                                             const cm_byte * src) {
+        std::memcpy(bytes.data() + (idx * stride), src,
+                    this->get_req_sz(idx, stride));
+    });
+
+    return;
+}
+
+
+void sc::_batch_reader::clear() {
+
+    this->addrs.clear();
+    this->szs.clear();
+    return;
+}
+
+
+void sc::_batch_reader::set_pid(const std::optional<pid_t> pid) noexcept {
+
+    this->pid = pid;
+    return;
+}
+
+
+[[nodiscard]] size_t sc::_batch_reader::get_size() const noexcept {
+
+    return this->addrs.size();
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+//standard template library
+#include <optional>
+#include <vector>
+#include <functional>
+
+//system headers
+#include <sys/uio.h>
+
+//external libraries
+#include <cmore.h>
+#include <memcry.h>
+
+//local headers
+#include "scancry.h"
+
+
+
+namespace sc {
+
+/*
+ *  NOTE: The batch reader collects many small reads (typically one
+ *        pointer per chain at a single depth level) and services them
+ *        with as few reads as possible. Requests are sorted by address
+ *        and every run of requests that falls inside the same page is
+ *        read as a single group. A page is either mapped or it is not,
+ *        so grouping never causes a valid request to fail.
+ *
+ *        If the PID of the target is known, groups are read with
+ *        `process_vm_readv()`, up to IOV_MAX groups per call. A call
+ *        stops at the first group that can not be read, so the next
+ *        call resumes after it. Otherwise, or if the target can not
+ *        be read this way, every group is read through MemCry; for
+ *        procfs sessions each group then costs one pread().
+ *
+ *        Requests queued with a size are read with `read()`, otherwise
+ *        they are pointers read with `read_ptrs()`. A request that
+ *        crosses into the next page is read in a group of its own.
+ */
+
+//a run of requests serviced by a single read
+struct _batch_group {
+
+    //[attributes]
+    uintptr_t addr;
+    size_t sz;
+    size_t buf_off;
+
+    //requests of the group, indeces into `order`
+    size_t begin;
+    size_t end;
+};
+
+
+class _batch_reader {
+
+    _SC_DBG_PRIVATE:
+        //[attributes]
+        std::optional<pid_t> pid;
+
+        std::vector<uintptr_t> addrs;
+        std::vector<size_t> szs;
+        std::vector<size_t> order;
+        std::vector<struct _batch_group> groups;
+        std::vector<cm_byte> group_ok;
+        std::vector<struct iovec> iovs;
+        std::vector<cm_byte> buf;
+
+        //[methods]
+        [[nodiscard]] size_t get_req_sz(const size_t idx,
+                                        const size_t max_sz) const noexcept;
+
+        void make_groups(const size_t page_size, const size_t ptr_sz);
+        [[nodiscard]] size_t read_vectored();
+        void read_each(const mc_session * session, const size_t first);
+
+        //read every group of requests, `extract` copies each request
+        //out of the bytes read for its group
+        void read_groups(const mc_session * session, const size_t ptr_sz,
+                         std::vector<cm_byte> & ok,
+                         const std::function<void(const size_t,
+                                                  const cm_byte *)> & extract);
+
+    public:
+        //[methods]
+        //queue an address for reading, returns its index
+        size_t add(const uintptr_t addr);
+        size_t add(const uintptr_t addr, const size_t sz);
+
+        //read `addr_width` bytes at every queued address
+        void read_ptrs(const mc_session * session,
+                       const enum addr_width addr_width,
+                       std::vector<uintptr_t> & values,
+                       std::vector<cm_byte> & ok);
+
+        //read the bytes of every queued request, `stride` bytes apart
+        void read(const mc_session * session, const size_t stride,
+                  std::vector<cm_byte> & bytes, std::vector<cm_byte> & ok);
+
+        //empty the queue
+        void clear();
+
+        //getters & setters
+        void set_pid(const std::optional<pid_t> pid) noexcept;
+        [[nodiscard]] size_t get_size() const noexcept;
+};
+
+
+}; //namespace sc
@@ -109,6 +109,30 @@ void sc_perror(const char * prefix) {
             std::fprintf(stderr, "%s: %s", prefix, SC_ERR_VERSION_FILE_MSG);
             break;
 
+        case SC_ERR_OPT_VALUE:
+            std::fprintf(stderr, "%s: %s", prefix, SC_ERR_OPT_VALUE_MSG);
+            break;
+
+        case SC_ERR_OPT_PATTERN:
+            std::fprintf(stderr, "%s: %s", prefix, SC_ERR_OPT_PATTERN_MSG);
+            break;
+
+        case SC_ERR_OPT_STRING:
+            std::fprintf(stderr, "%s: %s", prefix, SC_ERR_OPT_STRING_MSG);
+            break;
+
+        case SC_ERR_OPT_STRUCT:
+            std::fprintf(stderr, "%s: %s", prefix, SC_ERR_OPT_STRUCT_MSG);
+            break;
+
+        case SC_ERR_OPT_INTERVAL:
+            std::fprintf(stderr, "%s: %s", prefix, SC_ERR_OPT_INTERVAL_MSG);
+            break;
+
+        case SC_ERR_WATCH_ENTRY:
+            std::fprintf(stderr, "%s: %s", prefix, SC_ERR_WATCH_ENTRY_MSG);
+            break;
+
         // 2XX - internal errors
         case SC_ERR_CMORE:
             std::fprintf(stderr, "%s: %s", prefix, SC_ERR_CMORE_MSG);
@@ -204,6 +228,24 @@ const char * sc_strerror(const int sc_errnum) {
         case SC_ERR_VERSION_FILE:
             return SC_ERR_VERSION_FILE_MSG;
 
+        case SC_ERR_OPT_VALUE:
+            return SC_ERR_OPT_VALUE_MSG;
+
+        case SC_ERR_OPT_PATTERN:
+            return SC_ERR_OPT_PATTERN_MSG;
+
+        case SC_ERR_OPT_STRING:
+            return SC_ERR_OPT_STRING_MSG;
+
+        case SC_ERR_OPT_STRUCT:
+            return SC_ERR_OPT_STRUCT_MSG;
+
+        case SC_ERR_OPT_INTERVAL:
+            return SC_ERR_OPT_INTERVAL_MSG;
+
+        case SC_ERR_WATCH_ENTRY:
+            return SC_ERR_WATCH_ENTRY_MSG;
+
         // 2XX - internal errors
         case SC_ERR_CMORE:
             return SC_ERR_CMORE_MSG;
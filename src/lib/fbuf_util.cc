@@ -13,6 +13,7 @@
 //local headers
 #include "scancry.h"
 #include "fbuf_util.hh"
+#include "valscan.hh"
 #include "scancry_impl.h"
 
 
@@ -67,6 +68,31 @@ template int fbuf_util::pack_type<sc::ptr_file_hdr>(
     const std::vector<cm_byte> & buf,
     off_t & buf_off, const sc::ptr_file_hdr & type);
 
+//explicit instantiation - `sc::val_file_hdr`
+template int fbuf_util::pack_type<sc::val_file_hdr>(
+    const std::vector<cm_byte> & buf,
+    off_t & buf_off, const sc::val_file_hdr & type);
+
+//explicit instantiation - `sc::_val_chunk_hdr`
+template int fbuf_util::pack_type<sc::_val_chunk_hdr>(
+    const std::vector<cm_byte> & buf,
+    off_t & buf_off, const sc::_val_chunk_hdr & type);
+
+//explicit instantiation - `sc::ptn_file_hdr`
+template int fbuf_util::pack_type<sc::ptn_file_hdr>(
+    const std::vector<cm_byte> & buf,
+    off_t & buf_off, const sc::ptn_file_hdr & type);
+
+//explicit instantiation - `sc::str_file_hdr`
+template int fbuf_util::pack_type<sc::str_file_hdr>(
+    const std::vector<cm_byte> & buf,
+    off_t & buf_off, const sc::str_file_hdr & type);
+
+//explicit instantiation - `uint64_t`
+template int fbuf_util::pack_type<uint64_t>(
+    const std::vector<cm_byte> & buf,
+    off_t & buf_off, const uint64_t & type);
+
 //explicit instantiation - `uint32_t`
 template int fbuf_util::pack_type<uint32_t>(
     const std::vector<cm_byte> & buf,
@@ -115,12 +141,33 @@ template int fbuf_util::pack_type_array<uint32_t>(
     const std::vector<cm_byte> & buf,
     off_t & buf_off, const std::vector<uint32_t> & type_arr);
 
+//explicit instantiation - `int64_t`
+template int fbuf_util::pack_type_array<int64_t>(
+    const std::vector<cm_byte> & buf,
+    off_t & buf_off, const std::vector<int64_t> & type_arr);
+
 //explicit instantiation - `cm_byte`
 template int fbuf_util::pack_type_array<cm_byte>(
     const std::vector<cm_byte> & buf,
     off_t & buf_off, const std::vector<cm_byte> & type_arr);
 
 
+//write a run of bytes of a known size to a file buffer
+int fbuf_util::pack_bytes(
+    const std::vector<cm_byte> & buf,
+    off_t & buf_off, const void * bytes, const size_t sz) {
+
+    cm_byte * cur_byte = (cm_byte *) buf.data() + buf_off;
+    ssize_t buf_left = buf.size() - buf_off;
+
+    _CHECK_BUF(sz, -1);
+    if (sz != 0) std::memcpy(cur_byte, bytes, sz);
+    _UPDATE(sz);
+
+    return 0;
+}
+
+
 //read an arbitrary length string from a file buffer
 std::optional<std::string> fbuf_util::unpack_string(
     const std::vector<cm_byte> & buf, off_t & buf_off) {
@@ -180,7 +227,7 @@ _SC_DBG_INLINE std::optional<T> fbuf_util::unpack_type(
     if (buf_left >= sizeof(T)) {
 
         //read an instance of type T
-        type = *((T *) cur_byte);
+        std::memcpy(&type, cur_byte, sizeof(T));
         end = false;
         _UPDATE(sizeof(T));
     }
@@ -193,6 +240,31 @@ template std::optional<sc::ptr_file_hdr>
     fbuf_util::unpack_type<sc::ptr_file_hdr>(
     const std::vector<cm_byte> & buf, off_t & buf_off);
 
+//explicit instantiation - `sc::val_file_hdr`
+template std::optional<sc::val_file_hdr>
+    fbuf_util::unpack_type<sc::val_file_hdr>(
+    const std::vector<cm_byte> & buf, off_t & buf_off);
+
+//explicit instantiation - `sc::_val_chunk_hdr`
+template std::optional<sc::_val_chunk_hdr>
+    fbuf_util::unpack_type<sc::_val_chunk_hdr>(
+    const std::vector<cm_byte> & buf, off_t & buf_off);
+
+//explicit instantiation - `sc::ptn_file_hdr`
+template std::optional<sc::ptn_file_hdr>
+    fbuf_util::unpack_type<sc::ptn_file_hdr>(
+    const std::vector<cm_byte> & buf, off_t & buf_off);
+
+//explicit instantiation - `sc::str_file_hdr`
+template std::optional<sc::str_file_hdr>
+    fbuf_util::unpack_type<sc::str_file_hdr>(
+    const std::vector<cm_byte> & buf, off_t & buf_off);
+
+//explicit instantiation - `uint64_t`
+template std::optional<uint64_t>
+    fbuf_util::unpack_type<uint64_t>(
+    const std::vector<cm_byte> & buf, off_t & buf_off);
+
 //explicit instantiation - `sc::_ptrscan_file_hdr`
 template std::optional<uint32_t>
     fbuf_util::unpack_type<uint32_t>(
@@ -251,3 +323,24 @@ _SC_DBG_INLINE std::optional<std::vector<T>> fbuf_util::unpack_type_array(
 template std::optional<std::vector<uint32_t>>
     fbuf_util::unpack_type_array<uint32_t>(
         const std::vector<cm_byte> & buf, off_t & buf_off);
+
+//explicit instantiation - `int64_t`
+template std::optional<std::vector<int64_t>>
+    fbuf_util::unpack_type_array<int64_t>(
+        const std::vector<cm_byte> & buf, off_t & buf_off);
+
+
+//read a run of bytes of a known size from a file buffer
+int fbuf_util::unpack_bytes(
+    const std::vector<cm_byte> & buf,
+    off_t & buf_off, void * bytes, const size_t sz) {
+
+    cm_byte * cur_byte = (cm_byte *) buf.data() + buf_off;
+    ssize_t buf_left = buf.size() - buf_off;
+
+    _CHECK_BUF(sz, -1);
+    if (sz != 0) std::memcpy(bytes, cur_byte, sz);
+    _UPDATE(sz);
+
+    return 0;
+}
@@ -35,6 +35,10 @@ int pack_type_array(
     const std::vector<cm_byte> & buf,
     off_t & buf_off, const std::vector<T> & type_arr);
 
+int pack_bytes(
+    const std::vector<cm_byte> & buf,
+    off_t & buf_off, const void * bytes, const size_t sz);
+
 
 //file buffer unpacking
 std::optional<std::string> unpack_string(
@@ -48,4 +52,8 @@ template <typename T>
 std::optional<std::vector<T>> unpack_type_array(
     const std::vector<cm_byte> & buf, off_t & buf_off);
 
+int unpack_bytes(
+    const std::vector<cm_byte> & buf,
+    off_t & buf_off, void * bytes, const size_t sz);
+
 }
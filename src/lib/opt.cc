@@ -37,6 +37,17 @@
 sc::_opt_scan::~_opt_scan() {}
 
 
+//convert a hex digit to its value
+[[nodiscard]] _SC_DBG_STATIC _SC_DBG_INLINE int _hex_nibble(const char c) {
+
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return (c - 'a') + 0xA;
+    if (c >= 'A' && c <= 'F') return (c - 'A') + 0xA;
+
+    return -1;
+}
+
+
 
       /* =============== * 
  ===== *  C++ INTERFACE  * =====
@@ -58,6 +69,7 @@ sc::opt::opt(const opt & opts)
    file_path_in(opts.file_path_in),
    sessions(opts.sessions),
    map(opts.map),
+   pid(opts.pid),
    omit_areas(opts.omit_areas),
    omit_objs(opts.omit_objs),
    exclusive_areas(opts.exclusive_areas),
@@ -74,6 +86,7 @@ sc::opt::opt(const opt && opts)
    file_path_in(opts.file_path_in),
    sessions(opts.sessions),
    map(opts.map),
+   pid(opts.pid),
    omit_areas(opts.omit_areas),
    omit_objs(opts.omit_objs),
    exclusive_areas(opts.exclusive_areas),
@@ -97,6 +110,7 @@ sc::opt::opt(const opt && opts)
     this->omit_addr_ranges = std::nullopt;
     this->exclusive_addr_ranges = std::nullopt;
     this->access = std::nullopt;
+    this->pid = std::nullopt;
     _UNLOCK(-1)
 
     return 0;
@@ -302,6 +316,22 @@ sc::opt::opt(const opt && opts)
 }
 
 
+[[nodiscard]] int sc::opt::set_pid(const std::optional<pid_t> pid) noexcept {
+
+    _LOCK(-1)
+    this->pid = pid;
+    _UNLOCK(-1)
+
+    return 0;
+}
+
+
+[[nodiscard]] std::optional<pid_t> sc::opt::get_pid() const noexcept {
+
+    return this->pid;
+}
+
+
 
 /*
  *  --- [OPT_PTR | PUBLIC] ---
@@ -309,7 +339,9 @@ sc::opt::opt(const opt && opts)
 
 sc::opt_ptr::opt_ptr()
  : _opt_scan(),
-   smart_scan(true) {}
+   smart_scan(true),
+   bidirectional(false),
+   prefer_static(false) {}
 
 
 sc::opt_ptr::opt_ptr(const opt_ptr & opts_ptr)
@@ -320,7 +352,17 @@ sc::opt_ptr::opt_ptr(const opt_ptr & opts_ptr)
    max_depth(opts_ptr.max_depth),
    static_areas(opts_ptr.static_areas),
    preset_offsets(opts_ptr.preset_offsets),
-   smart_scan(opts_ptr.smart_scan) {}
+   smart_scan(opts_ptr.smart_scan),
+   target_addrs(opts_ptr.target_addrs),
+   max_chains(opts_ptr.max_chains),
+   max_level_nodes(opts_ptr.max_level_nodes),
+   max_children(opts_ptr.max_children),
+   bidirectional(opts_ptr.bidirectional),
+   checkpoint_path(opts_ptr.checkpoint_path),
+   spill_path(opts_ptr.spill_path),
+   max_neg_off(opts_ptr.max_neg_off),
+   prefer_static(opts_ptr.prefer_static),
+   max_array_run(opts_ptr.max_array_run) {}
 
 
 sc::opt_ptr::opt_ptr(const opt_ptr && opts_ptr)
@@ -331,7 +373,17 @@ sc::opt_ptr::opt_ptr(const opt_ptr && opts_ptr)
    max_depth(opts_ptr.max_depth),
    static_areas(opts_ptr.static_areas),
    preset_offsets(opts_ptr.preset_offsets),
-   smart_scan(opts_ptr.smart_scan) {}
+   smart_scan(opts_ptr.smart_scan),
+   target_addrs(opts_ptr.target_addrs),
+   max_chains(opts_ptr.max_chains),
+   max_level_nodes(opts_ptr.max_level_nodes),
+   max_children(opts_ptr.max_children),
+   bidirectional(opts_ptr.bidirectional),
+   checkpoint_path(opts_ptr.checkpoint_path),
+   spill_path(opts_ptr.spill_path),
+   max_neg_off(opts_ptr.max_neg_off),
+   prefer_static(opts_ptr.prefer_static),
+   max_array_run(opts_ptr.max_array_run) {}
 
 
 [[nodiscard]] int sc::opt_ptr::reset() {
@@ -344,6 +396,16 @@ sc::opt_ptr::opt_ptr(const opt_ptr && opts_ptr)
     this->static_areas = std::nullopt;
     this->preset_offsets = std::nullopt;
     this->smart_scan = true;
+    this->target_addrs = std::nullopt;
+    this->max_chains = std::nullopt;
+    this->max_level_nodes = std::nullopt;
+    this->max_children = std::nullopt;
+    this->bidirectional = false;
+    this->checkpoint_path = std::nullopt;
+    this->spill_path = std::nullopt;
+    this->max_neg_off = std::nullopt;
+    this->prefer_static = false;
+    this->max_array_run = std::nullopt;
     _UNLOCK(-1)
 
     return 0;
@@ -482,258 +544,1972 @@ sc::opt_ptr::opt_ptr(const opt_ptr && opts_ptr)
 }
 
 
+[[nodiscard]] int sc::opt_ptr::set_target_addrs(
+    const std::optional<std::vector<uintptr_t>> & target_addrs) {
 
-      /* ============= * 
- ===== *  C INTERFACE  * =====
-       * ============= */
+    _LOCK(-1)
+    this->target_addrs = target_addrs;
+    _UNLOCK(-1)
 
-/*
- *  --- [INTERNAL] ---
- */
+    return 0;
+}
 
-//wrapper for setting a STL vector in C
-template <typename O, typename T, typename T_c>
-[[nodiscard]] _SC_DBG_STATIC int _vector_setter(
-                    void * opts_X, const cm_vct * cmore_vct,
-                    int (O::*set)(const std::optional<std::vector<T>> &),
-                    std::optional<std::function<int(T *, T_c *)>> convert_cb) {
 
-    int ret;
+[[nodiscard]] const std::optional<std::vector<uintptr_t>>
+    & sc::opt_ptr::get_target_addrs() const {
 
-    
-    //cast opaque handle into class
-    O * o = static_cast<O *>(opts_X);
+    return this->target_addrs;
+}
 
-    //call the setter with the STL vector
-    try {
-        if (cmore_vct == nullptr) {
-            (o->*set)(std::nullopt);
-            
-        } else {
-            //create a STL vector
-            std::vector<T> stl_vct;
-            ret = c_iface::vct_from_cmore_vct<T, T_c>(
-                cmore_vct, stl_vct, convert_cb);
-            if (ret != 0) return -1;
 
-            //perform the set
-            (o->*set)(stl_vct);
-        }
-        return 0;
+[[nodiscard]] int sc::opt_ptr::set_max_chains(
+    const std::optional<size_t> max_chains) noexcept {
 
-    } catch (const std::exception & excp) {
-        exception_sc_errno(excp);
-        return -1;
-    }
-}
+    _LOCK(-1)
+    this->max_chains = max_chains;
+    _UNLOCK(-1)
 
+    return 0;
+}
 
-//wrapper for getting a STL vector in C
-template <typename O, typename T, typename T_c>
-_SC_DBG_STATIC int _vector_getter(
-                    void * opts_X, cm_vct * cmore_vct,
-                    const std::optional<std::vector<T>> & (O::*get)() const,
-                    std::optional<std::function<int(T_c *, T *)>> convert_cb) {
 
-    int ret;
+[[nodiscard]] std::optional<size_t>
+    sc::opt_ptr::get_max_chains() const noexcept {
 
-    
-    //cast opaque handle into class
-    O * o = static_cast<O *>(opts_X);
+    return this->max_chains;
+}
 
-    //copy contents of the STL vector into the CMore vector.
-    try {
-        //get the STL vector
-        const std::optional<std::vector<T>> & stl_vct = (o->*get)();
 
-        //if this constraint doesn't have a value, fail
-        if (stl_vct.has_value() == false) {
-            sc_errno = SC_ERR_OPT_EMPTY;
-            return -1;
-        }
+[[nodiscard]] int sc::opt_ptr::set_max_level_nodes(
+    const std::optional<size_t> max_level_nodes) noexcept {
 
-        //perform the copy
-        ret = c_iface::vct_to_cmore_vct<T, T_c>(
-            cmore_vct, stl_vct.value(), convert_cb);
-        if (ret != 0) return -1;
+    _LOCK(-1)
+    this->max_level_nodes = max_level_nodes;
+    _UNLOCK(-1)
 
-        return 0;
-        
-    } catch (const std::exception & excp) {
-        exception_sc_errno(excp);
-        return -1;
-    }
+    return 0;
 }
 
 
+[[nodiscard]] std::optional<size_t>
+    sc::opt_ptr::get_max_level_nodes() const noexcept {
 
-//generic getter of constraints
-template <typename O, typename T, typename T_c>
-_SC_DBG_STATIC int _unordered_set_getter(
-                void * opts_X, cm_vct * cmore_vct,
-                const std::optional<std::unordered_set<T>> & (O::*get)() const,
-                std::optional<std::function<int(T_c *, T *)>> convert_cb) {
+    return this->max_level_nodes;
+}
 
-    int ret;
 
-    
-    //cast opaque handle into class
-    O * o = static_cast<O *>(opts_X);
+[[nodiscard]] int sc::opt_ptr::set_max_children(
+    const std::optional<size_t> max_children) noexcept {
 
-    //copy contents of the STL vector into the CMore vector.
-    try {
-        //get the STL unordered set
-        const std::optional<std::unordered_set<T>> & stl_uset = (o->*get)();
+    _LOCK(-1)
+    this->max_children = max_children;
+    _UNLOCK(-1)
 
-        //if this constraint doesn't have a value, fail
-        if (stl_uset.has_value() == false) {
-            sc_errno = SC_ERR_OPT_EMPTY;
-            return -1;
-        }
+    return 0;
+}
 
-        //perform the copy
-        ret = c_iface::uset_to_cmore_vct<T, T_c>(
-            cmore_vct, stl_uset.value(), convert_cb);
-        if (ret != 0) return -1;
 
-        return 0;
-        
-    } catch (const std::exception & excp) {
-        exception_sc_errno(excp);
-        return -1;
-    }
+[[nodiscard]] std::optional<size_t>
+    sc::opt_ptr::get_max_children() const noexcept {
+
+    return this->max_children;
 }
 
 
+[[nodiscard]] int
+    sc::opt_ptr::set_bidirectional(const bool enable) noexcept {
 
-/*
- *  --- [OPT | EXTERNAL] ---
- */
+    _LOCK(-1)
+    this->bidirectional = enable;
+    _UNLOCK(-1)
 
-//new class opt
-sc_opt sc_new_opt(const enum sc_addr_width addr_width) {
+    return 0;
+}
 
-    //convert C enum to C++
-    enum sc::addr_width width = (addr_width == AW64) ? sc::AW64 : sc::AW32;
 
-    try {
-        return new sc::opt(width);
+[[nodiscard]] bool
+    sc::opt_ptr::get_bidirectional() const noexcept {
 
-    } catch (const std::exception & excp) {
-        exception_sc_errno(excp);
-        return nullptr;
-    }
-};
+    return this->bidirectional;
+}
 
 
-sc_opt sc_copy_opt(const sc_opt opts) {
+[[nodiscard]] int sc::opt_ptr::set_checkpoint_path(
+    const std::optional<std::string> & checkpoint_path) {
 
-    //cast opaque handle into class
-    sc::opt * o = static_cast<sc::opt *>(opts);
+    _LOCK(-1)
+    this->checkpoint_path = checkpoint_path;
+    _UNLOCK(-1)
 
-    try {
-        return new sc::opt(*o);
-        
-    } catch (const std::exception & excp) {
-        exception_sc_errno(excp);
-        return nullptr;
-    }
+    return 0;
 }
 
 
-//delete class opt
-int sc_del_opt(sc_opt opts) {
+[[nodiscard]] const std::optional<std::string> &
+    sc::opt_ptr::get_checkpoint_path() const {
 
-    //cast opaque handle into class
-    sc::opt * o = static_cast<sc::opt *>(opts);
+    return this->checkpoint_path;
+}
 
-    try {
-        delete o;
-        return 0;
-        
-    } catch (const std::exception & excp) {
-        exception_sc_errno(excp);
-        return -1;
-    }
+
+[[nodiscard]] int sc::opt_ptr::set_spill_path(
+    const std::optional<std::string> & spill_path) {
+
+    _LOCK(-1)
+    this->spill_path = spill_path;
+    _UNLOCK(-1)
+
+    return 0;
 }
 
 
-//reset class opt
-int sc_opt_reset(sc_opt opts) {
+[[nodiscard]] const std::optional<std::string> &
+    sc::opt_ptr::get_spill_path() const {
 
-    int ret;
+    return this->spill_path;
+}
 
-    
-    //cast opaque handle into class
-    sc::opt * o = static_cast<sc::opt *>(opts);
 
-    try {
-        ret = o->reset();
-        return (ret != 0) ? -1 : 0;
-        
-    } catch (const std::exception & excp) {
-        exception_sc_errno(excp);
-        return -1;
-    }
+[[nodiscard]] int sc::opt_ptr::set_max_neg_off(
+    const std::optional<off_t> max_neg_off) noexcept {
+
+    _LOCK(-1)
+    this->max_neg_off = max_neg_off;
+    _UNLOCK(-1)
+
+    return 0;
 }
 
 
-//set class opt->file_path_out
-int sc_opt_set_file_path_out(sc_opt opts, const char * path) {
+[[nodiscard]] std::optional<off_t>
+    sc::opt_ptr::get_max_neg_off() const noexcept {
 
-    int ret;
+    return this->max_neg_off;
+}
 
 
-    //cast opaque handle into class
-    sc::opt * o = static_cast<sc::opt *>(opts);
+[[nodiscard]] int
+    sc::opt_ptr::set_prefer_static(const bool enable) noexcept {
 
-    try {
-        if (path == nullptr) ret = o->set_file_path_out(std::nullopt);
-        else ret = o->set_file_path_out(path);
-        return (ret != 0) ? -1 : 0;
-        
-    } catch (const std::exception & excp) {
-        exception_sc_errno(excp);
-        return -1;
-    }
+    _LOCK(-1)
+    this->prefer_static = enable;
+    _UNLOCK(-1)
+
+    return 0;
 }
 
 
-const char * sc_opt_get_file_path_out(const sc_opt opts) {
+[[nodiscard]] bool
+    sc::opt_ptr::get_prefer_static() const noexcept {
 
-    //cast opaque handle into class
-    sc::opt * o = static_cast<sc::opt *>(opts);
+    return this->prefer_static;
+}
 
-    //return NULL if optional is not set or there is an error
-    try {
-        const std::optional<std::string> & file_path_out
-            = o->get_file_path_out();
 
-        if (file_path_out.has_value() && !file_path_out.value().empty()) {
-            return file_path_out.value().c_str();
-        } else {
-            sc_errno = SC_ERR_OPT_EMPTY;
-            return nullptr;
-        }
-        
-    } catch (const std::exception & excp) {
-        exception_sc_errno(excp);
-        return nullptr;
-    }
+[[nodiscard]] int sc::opt_ptr::set_max_array_run(
+    const std::optional<size_t> max_array_run) noexcept {
+
+    _LOCK(-1)
+    this->max_array_run = max_array_run;
+    _UNLOCK(-1)
+
+    return 0;
 }
 
 
-int sc_opt_set_file_path_in(sc_opt opts, const char * path) {
+[[nodiscard]] std::optional<size_t>
+    sc::opt_ptr::get_max_array_run() const noexcept {
 
-    int ret;
+    return this->max_array_run;
+}
 
 
-    //cast opaque handle into class
-    sc::opt * o = static_cast<sc::opt *>(opts);
+[[nodiscard]] std::vector<uintptr_t> sc::opt_ptr::get_targets() const {
+
+    //multiple targets take priority over a single target
+    if (this->target_addrs.has_value() == true) return *this->target_addrs;
+    if (this->target_addr.has_value() == true) return {*this->target_addr};
+
+    return {};
+}
+
+
+
+/*
+ *  --- [OPT_VAL | PUBLIC] ---
+ */
+
+sc::opt_val::opt_val()
+ : _opt_scan(),
+   predicate(VP_EQ),
+   round(VR_NONE) {}
+
+
+sc::opt_val::opt_val(const opt_val & opts_val)
+ : _opt_scan(),
+   type(opts_val.type),
+   alignment(opts_val.alignment),
+   value(opts_val.value),
+   predicate(opts_val.predicate),
+   value_hi(opts_val.value_hi),
+   round(opts_val.round),
+   epsilon(opts_val.epsilon) {}
+
+
+sc::opt_val::opt_val(const opt_val && opts_val)
+ : _opt_scan(),
+   type(opts_val.type),
+   alignment(opts_val.alignment),
+   value(opts_val.value),
+   predicate(opts_val.predicate),
+   value_hi(opts_val.value_hi),
+   round(opts_val.round),
+   epsilon(opts_val.epsilon) {}
+
+
+[[nodiscard]] int sc::opt_val::reset() {
+
+    _LOCK(-1)
+    this->type = std::nullopt;
+    this->alignment = std::nullopt;
+    this->value = std::nullopt;
+    this->predicate = VP_EQ;
+    this->value_hi = std::nullopt;
+    this->round = VR_NONE;
+    this->epsilon = std::nullopt;
+    _UNLOCK(-1)
+
+    return 0;
+}
+
+
+//getters & setters
+[[nodiscard]] int sc::opt_val::set_type(
+    const std::optional<enum val_type> type) noexcept {
+
+    _LOCK(-1)
+    this->type = type;
+    _UNLOCK(-1)
+
+    return 0;
+}
+
+
+[[nodiscard]] std::optional<enum sc::val_type>
+    sc::opt_val::get_type() const noexcept {
+
+    return this->type;
+}
+
+
+[[nodiscard]] int sc::opt_val::set_alignment(
+    const std::optional<off_t> alignment) noexcept {
+
+    _LOCK(-1)
+    this->alignment = alignment;
+    _UNLOCK(-1)
+
+    return 0;
+}
+
+
+[[nodiscard]] std::optional<off_t>
+    sc::opt_val::get_alignment() const noexcept {
+
+    return this->alignment;
+}
+
+
+[[nodiscard]] int sc::opt_val::set_value(
+    const std::optional<std::vector<cm_byte>> & value) {
+
+    _LOCK(-1)
+    this->value = value;
+    _UNLOCK(-1)
+
+    return 0;
+}
+
+
+[[nodiscard]] const std::optional<std::vector<cm_byte>>
+    & sc::opt_val::get_value() const {
+
+    return this->value;
+}
+
+
+[[nodiscard]] int
+    sc::opt_val::set_predicate(const enum val_pred predicate) noexcept {
+
+    _LOCK(-1)
+    this->predicate = predicate;
+    _UNLOCK(-1)
+
+    return 0;
+}
+
+
+[[nodiscard]] enum sc::val_pred
+    sc::opt_val::get_predicate() const noexcept {
+
+    return this->predicate;
+}
+
+
+[[nodiscard]] int sc::opt_val::set_value_hi(
+    const std::optional<std::vector<cm_byte>> & value_hi) {
+
+    _LOCK(-1)
+    this->value_hi = value_hi;
+    _UNLOCK(-1)
+
+    return 0;
+}
+
+
+[[nodiscard]] const std::optional<std::vector<cm_byte>>
+    & sc::opt_val::get_value_hi() const {
+
+    return this->value_hi;
+}
+
+
+[[nodiscard]] int
+    sc::opt_val::set_round(const enum val_round round) noexcept {
+
+    _LOCK(-1)
+    this->round = round;
+    _UNLOCK(-1)
+
+    return 0;
+}
+
+
+[[nodiscard]] enum sc::val_round
+    sc::opt_val::get_round() const noexcept {
+
+    return this->round;
+}
+
+
+[[nodiscard]] int sc::opt_val::set_epsilon(
+    const std::optional<double> epsilon) noexcept {
+
+    _LOCK(-1)
+    this->epsilon = epsilon;
+    _UNLOCK(-1)
+
+    return 0;
+}
+
+
+[[nodiscard]] std::optional<double>
+    sc::opt_val::get_epsilon() const noexcept {
+
+    return this->epsilon;
+}
+
+
+
+/*
+ *  --- [OPT_PTN | PUBLIC] ---
+ */
+
+sc::opt_ptn::opt_ptn()
+ : _opt_scan(),
+   signatures(nullptr) {}
+
+
+sc::opt_ptn::opt_ptn(const opt_ptn & opts_ptn)
+ : _opt_scan(),
+   pattern(opts_ptn.pattern),
+   mask(opts_ptn.mask),
+   signatures(opts_ptn.signatures) {}
+
+
+sc::opt_ptn::opt_ptn(const opt_ptn && opts_ptn)
+ : _opt_scan(),
+   pattern(opts_ptn.pattern),
+   mask(opts_ptn.mask),
+   signatures(opts_ptn.signatures) {}
+
+
+[[nodiscard]] int sc::opt_ptn::reset() {
+
+    _LOCK(-1)
+    this->pattern = std::nullopt;
+    this->mask = std::nullopt;
+    this->signatures = nullptr;
+    _UNLOCK(-1)
+
+    return 0;
+}
+
+
+//getters & setters
+[[nodiscard]] int sc::opt_ptn::set_pattern(
+    const std::optional<std::vector<cm_byte>> & pattern) {
+
+    _LOCK(-1)
+    this->pattern = pattern;
+    _UNLOCK(-1)
+
+    return 0;
+}
+
+
+[[nodiscard]] const std::optional<std::vector<cm_byte>>
+    & sc::opt_ptn::get_pattern() const {
+
+    return this->pattern;
+}
+
+
+[[nodiscard]] int sc::opt_ptn::set_mask(
+    const std::optional<std::vector<cm_byte>> & mask) {
+
+    _LOCK(-1)
+    this->mask = mask;
+    _UNLOCK(-1)
+
+    return 0;
+}
+
+
+[[nodiscard]] const std::optional<std::vector<cm_byte>>
+    & sc::opt_ptn::get_mask() const {
+
+    return this->mask;
+}
+
+
+[[nodiscard]] int sc::opt_ptn::set_pattern_str(
+    const std::string & pattern_str) {
+
+    int nibble;
+    size_t pos, end;
+    cm_byte byte, byte_mask;
+
+    std::vector<cm_byte> new_pattern, new_mask;
+
+
+    //parse every space separated byte
+    pos = 0;
+    while (true) {
+
+        pos = pattern_str.find_first_not_of(" \t", pos);
+        if (pos == std::string::npos) break;
+
+        end = pattern_str.find_first_of(" \t", pos);
+        if (end == std::string::npos) end = pattern_str.size();
+
+        byte = byte_mask = 0;
+
+        //a lone `?` matches any byte
+        if ((end - pos) == 1 && pattern_str[pos] == '?') {
+            /* byte & mask stay zero */
+
+        //otherwise expect two digits, each a hex digit or `?`
+        } else if ((end - pos) == 2) {
+
+            for (size_t i = pos; i < end; ++i) {
+
+                byte <<= 4;
+                byte_mask <<= 4;
+                if (pattern_str[i] == '?') continue;
+
+                nibble = _hex_nibble(pattern_str[i]);
+                if (nibble == -1) goto _set_pattern_str_fail;
+                byte |= nibble;
+                byte_mask |= 0xF;
+            }
+
+        } else {
+            goto _set_pattern_str_fail;
+        }
+
+        new_pattern.push_back(byte);
+        new_mask.push_back(byte_mask);
+        pos = end;
+    }
+
+    //an empty pattern is malformed
+    if (new_pattern.empty() == true) goto _set_pattern_str_fail;
+
+    _LOCK(-1)
+    this->pattern = std::move(new_pattern);
+    this->mask = std::move(new_mask);
+    _UNLOCK(-1)
+
+    return 0;
+
+    _set_pattern_str_fail:
+    sc_errno = SC_ERR_OPT_PATTERN;
+    return -1;
+}
+
+
+[[nodiscard]] int sc::opt_ptn::set_signatures(
+    const ptn_set * signatures) noexcept {
+
+    _LOCK(-1)
+    this->signatures = (ptn_set *) signatures;
+    _UNLOCK(-1)
+
+    return 0;
+}
+
+
+[[nodiscard]] sc::ptn_set * sc::opt_ptn::get_signatures() const noexcept {
+
+    return this->signatures;
+}
+
+
+
+/*
+ *  --- [OPT_STR | PUBLIC] ---
+ */
+
+sc::opt_str::opt_str()
+ : _opt_scan(),
+   encodings(sc::SE_UTF8 | sc::SE_UTF16LE),
+   case_insensitive(false),
+   null_term(false) {}
+
+
+sc::opt_str::opt_str(const opt_str & opts_str)
+ : _opt_scan(),
+   str(opts_str.str),
+   encodings(opts_str.encodings),
+   case_insensitive(opts_str.case_insensitive),
+   null_term(opts_str.null_term) {}
+
+
+sc::opt_str::opt_str(const opt_str && opts_str)
+ : _opt_scan(),
+   str(opts_str.str),
+   encodings(opts_str.encodings),
+   case_insensitive(opts_str.case_insensitive),
+   null_term(opts_str.null_term) {}
+
+
+[[nodiscard]] int sc::opt_str::reset() {
+
+    _LOCK(-1)
+    this->str = std::nullopt;
+    this->encodings = sc::SE_UTF8 | sc::SE_UTF16LE;
+    this->case_insensitive = false;
+    this->null_term = false;
+    _UNLOCK(-1)
+
+    return 0;
+}
+
+
+//getters & setters
+[[nodiscard]] int sc::opt_str::set_str(
+    const std::optional<std::string> & str) {
+
+    _LOCK(-1)
+    this->str = str;
+    _UNLOCK(-1)
+
+    return 0;
+}
+
+
+[[nodiscard]] const std::optional<std::string>
+    & sc::opt_str::get_str() const {
+
+    return this->str;
+}
+
+
+[[nodiscard]] int
+    sc::opt_str::set_encodings(const cm_byte encodings) noexcept {
+
+    _LOCK(-1)
+    this->encodings = encodings;
+    _UNLOCK(-1)
+
+    return 0;
+}
+
+
+[[nodiscard]] cm_byte sc::opt_str::get_encodings() const noexcept {
+
+    return this->encodings;
+}
+
+
+[[nodiscard]] int
+    sc::opt_str::set_case_insensitive(const bool enable) noexcept {
+
+    _LOCK(-1)
+    this->case_insensitive = enable;
+    _UNLOCK(-1)
+
+    return 0;
+}
+
+
+[[nodiscard]] bool sc::opt_str::get_case_insensitive() const noexcept {
+
+    return this->case_insensitive;
+}
+
+
+[[nodiscard]] int sc::opt_str::set_null_term(const bool enable) noexcept {
+
+    _LOCK(-1)
+    this->null_term = enable;
+    _UNLOCK(-1)
+
+    return 0;
+}
+
+
+[[nodiscard]] bool sc::opt_str::get_null_term() const noexcept {
+
+    return this->null_term;
+}
+
+
+
+/*
+ *  --- [OPT_STRUCT | PUBLIC] ---
+ */
+
+sc::opt_struct::opt_struct() : _opt_scan() {}
+
+
+sc::opt_struct::opt_struct(const opt_struct & opts_struct)
+ : _opt_scan(),
+   fields(opts_struct.fields),
+   alignment(opts_struct.alignment) {}
+
+
+sc::opt_struct::opt_struct(const opt_struct && opts_struct)
+ : _opt_scan(),
+   fields(opts_struct.fields),
+   alignment(opts_struct.alignment) {}
+
+
+[[nodiscard]] int sc::opt_struct::reset() {
+
+    _LOCK(-1)
+    this->fields.clear();
+    this->alignment = std::nullopt;
+    _UNLOCK(-1)
+
+    return 0;
+}
+
+
+//getters & setters
+[[nodiscard]] int sc::opt_struct::set_fields(
+    const std::vector<struct struct_field> & fields) {
+
+    _LOCK(-1)
+    this->fields = fields;
+    _UNLOCK(-1)
+
+    return 0;
+}
+
+
+[[nodiscard]] const std::vector<struct sc::struct_field> &
+    sc::opt_struct::get_fields() const {
+
+    return this->fields;
+}
+
+
+[[nodiscard]] int sc::opt_struct::set_alignment(
+    const std::optional<off_t> alignment) noexcept {
+
+    _LOCK(-1)
+    this->alignment = alignment;
+    _UNLOCK(-1)
+
+    return 0;
+}
+
+
+[[nodiscard]] std::optional<off_t>
+    sc::opt_struct::get_alignment() const noexcept {
+
+    return this->alignment;
+}
+
+
+
+      /* ============= * 
+ ===== *  C INTERFACE  * =====
+       * ============= */
+
+/*
+ *  --- [INTERNAL] ---
+ */
+
+//wrapper for setting a STL vector in C
+template <typename O, typename T, typename T_c>
+[[nodiscard]] _SC_DBG_STATIC int _vector_setter(
+                    void * opts_X, const cm_vct * cmore_vct,
+                    int (O::*set)(const std::optional<std::vector<T>> &),
+                    std::optional<std::function<int(T *, T_c *)>> convert_cb) {
+
+    int ret;
+
+    
+    //cast opaque handle into class
+    O * o = static_cast<O *>(opts_X);
+
+    //call the setter with the STL vector
+    try {
+        if (cmore_vct == nullptr) {
+            (o->*set)(std::nullopt);
+            
+        } else {
+            //create a STL vector
+            std::vector<T> stl_vct;
+            ret = c_iface::vct_from_cmore_vct<T, T_c>(
+                cmore_vct, stl_vct, convert_cb);
+            if (ret != 0) return -1;
+
+            //perform the set
+            (o->*set)(stl_vct);
+        }
+        return 0;
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+//wrapper for getting a STL vector in C
+template <typename O, typename T, typename T_c>
+_SC_DBG_STATIC int _vector_getter(
+                    void * opts_X, cm_vct * cmore_vct,
+                    const std::optional<std::vector<T>> & (O::*get)() const,
+                    std::optional<std::function<int(T_c *, T *)>> convert_cb) {
+
+    int ret;
+
+    
+    //cast opaque handle into class
+    O * o = static_cast<O *>(opts_X);
+
+    //copy contents of the STL vector into the CMore vector.
+    try {
+        //get the STL vector
+        const std::optional<std::vector<T>> & stl_vct = (o->*get)();
+
+        //if this constraint doesn't have a value, fail
+        if (stl_vct.has_value() == false) {
+            sc_errno = SC_ERR_OPT_EMPTY;
+            return -1;
+        }
+
+        //perform the copy
+        ret = c_iface::vct_to_cmore_vct<T, T_c>(
+            cmore_vct, stl_vct.value(), convert_cb);
+        if (ret != 0) return -1;
+
+        return 0;
+        
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+
+//generic getter of constraints
+template <typename O, typename T, typename T_c>
+_SC_DBG_STATIC int _unordered_set_getter(
+                void * opts_X, cm_vct * cmore_vct,
+                const std::optional<std::unordered_set<T>> & (O::*get)() const,
+                std::optional<std::function<int(T_c *, T *)>> convert_cb) {
+
+    int ret;
+
+    
+    //cast opaque handle into class
+    O * o = static_cast<O *>(opts_X);
+
+    //copy contents of the STL vector into the CMore vector.
+    try {
+        //get the STL unordered set
+        const std::optional<std::unordered_set<T>> & stl_uset = (o->*get)();
+
+        //if this constraint doesn't have a value, fail
+        if (stl_uset.has_value() == false) {
+            sc_errno = SC_ERR_OPT_EMPTY;
+            return -1;
+        }
+
+        //perform the copy
+        ret = c_iface::uset_to_cmore_vct<T, T_c>(
+            cmore_vct, stl_uset.value(), convert_cb);
+        if (ret != 0) return -1;
+
+        return 0;
+        
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+
+/*
+ *  --- [OPT | EXTERNAL] ---
+ */
+
+//new class opt
+sc_opt sc_new_opt(const enum sc_addr_width addr_width) {
+
+    //convert C enum to C++
+    enum sc::addr_width width = (addr_width == AW64) ? sc::AW64 : sc::AW32;
+
+    try {
+        return new sc::opt(width);
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return nullptr;
+    }
+};
+
+
+sc_opt sc_copy_opt(const sc_opt opts) {
+
+    //cast opaque handle into class
+    sc::opt * o = static_cast<sc::opt *>(opts);
+
+    try {
+        return new sc::opt(*o);
+        
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return nullptr;
+    }
+}
+
+
+//delete class opt
+int sc_del_opt(sc_opt opts) {
+
+    //cast opaque handle into class
+    sc::opt * o = static_cast<sc::opt *>(opts);
+
+    try {
+        delete o;
+        return 0;
+        
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+//reset class opt
+int sc_opt_reset(sc_opt opts) {
+
+    int ret;
+
+    
+    //cast opaque handle into class
+    sc::opt * o = static_cast<sc::opt *>(opts);
+
+    try {
+        ret = o->reset();
+        return (ret != 0) ? -1 : 0;
+        
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+//set class opt->file_path_out
+int sc_opt_set_file_path_out(sc_opt opts, const char * path) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::opt * o = static_cast<sc::opt *>(opts);
+
+    try {
+        if (path == nullptr) ret = o->set_file_path_out(std::nullopt);
+        else ret = o->set_file_path_out(path);
+        return (ret != 0) ? -1 : 0;
+        
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+const char * sc_opt_get_file_path_out(const sc_opt opts) {
+
+    //cast opaque handle into class
+    sc::opt * o = static_cast<sc::opt *>(opts);
+
+    //return NULL if optional is not set or there is an error
+    try {
+        const std::optional<std::string> & file_path_out
+            = o->get_file_path_out();
+
+        if (file_path_out.has_value() && !file_path_out.value().empty()) {
+            return file_path_out.value().c_str();
+        } else {
+            sc_errno = SC_ERR_OPT_EMPTY;
+            return nullptr;
+        }
+        
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return nullptr;
+    }
+}
+
+
+int sc_opt_set_file_path_in(sc_opt opts, const char * path) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::opt * o = static_cast<sc::opt *>(opts);
+    
+    try {
+        if (path == nullptr) ret = o->set_file_path_in(std::nullopt);
+        else ret = o->set_file_path_in(path);
+        return (ret != 0) ? -1 : 0;
+        
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+const char * sc_opt_get_file_path_in(const sc_opt opts) {
+    
+    //cast opaque handle into class
+    sc::opt * o = static_cast<sc::opt *>(opts);
+
+    //return NULL if optional is not set or there is an error
+    try {
+        const std::optional<std::string> & file_path_in
+            = o->get_file_path_in();
+
+        if (file_path_in.has_value() && !file_path_in.value().empty()) {
+            return file_path_in.value().c_str();
+        } else {
+            sc_errno = SC_ERR_OPT_EMPTY;
+            return nullptr;
+        }
+        
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return nullptr;
+    }
+}
+
+
+int sc_opt_set_sessions(sc_opt opts, const cm_vct * sessions) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::opt * o = static_cast<sc::opt *>(opts);
+
+    //create a STL vector
+    std::vector<const mc_session *> v;
+    v.resize(sessions->len);
+    std::memcpy(v.data(), sessions->data,
+                sessions->data_sz * sessions->len);
+
+    //call the setter with the STL vector
+    try {
+        ret = o->set_sessions(v);
+        return (ret != 0) ? -1 : 0; 
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+int sc_opt_get_sessions(const sc_opt opts, cm_vct * sessions) {
+    
+    //cast opaque handle into class
+    sc::opt * o = static_cast<sc::opt *>(opts);
+
+    //initialise the CMore vector
+    int ret = cm_new_vct(sessions, sizeof(cm_lst_node *));
+    if (ret != 0) {
+        sc_errno = SC_ERR_CMORE;
+        return -1;
+    }
+
+    //copy contents of the STL vector into the CMore vector.
+    try {
+        //get the STL vector
+        const std::vector<const mc_session *> & v = o->get_sessions();
+
+        //copy the STL vector into the CMore vector
+        ret = cm_vct_rsz(sessions, v.size());
+        if (ret != 0) {
+            sc_errno = SC_ERR_CMORE;
+            return -1;
+        }
+        std::memcpy(sessions->data, v.data(),
+                    v.size() * sizeof(cm_lst_node *));
+        return 0;
+        
+    } catch (const std::exception & excp) {
+        cm_del_vct(sessions);
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+int sc_opt_set_map(sc_opt opts, const mc_vm_map * map) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::opt * o = static_cast<sc::opt *>(opts);
+
+    ret = o->set_map(map);
+    return (ret != 0) ? -1 : 0;
+}
+
+
+mc_vm_map * sc_opt_get_map(const sc_opt opts) {
+
+    //cast opaque handle into class
+    sc::opt * o = static_cast<sc::opt *>(opts);
+
+    return o->get_map();
+}
+
+
+enum sc_addr_width sc_opt_get_addr_width(const sc_opt opts) {
+
+    //cast opaque handle into class
+    sc::opt * o = static_cast<sc::opt *>(opts);
+
+    //convert C++ enum to C
+    return (o->addr_width == sc::AW64) ? AW64 : AW32;
+}
+
+
+/*
+ *  NOTE: In these setter functions, the C++ setter is passed a STL vector
+ *        constructed from a CMore vector
+ */
+
+int sc_opt_set_omit_areas(sc_opt opts, const cm_vct * omit_areas) {
+
+    //call generic setter
+    return _vector_setter<sc::opt, const cm_lst_node *, const cm_lst_node *>(
+        opts, omit_areas, &sc::opt::set_omit_areas, std::nullopt);
+}
+
+
+int sc_opt_get_omit_areas(const sc_opt opts, cm_vct * omit_areas) {
+
+    //call generic getter
+    return _vector_getter<sc::opt, const cm_lst_node *, const cm_lst_node *>(
+        opts, omit_areas, &sc::opt::get_omit_areas, std::nullopt);
+}
+
+
+int sc_opt_set_omit_objs(sc_opt opts, const cm_vct * omit_objs) {
+
+    //call generic setter
+    return _vector_setter<sc::opt, const cm_lst_node *, const cm_lst_node *>(
+        opts, omit_objs, &sc::opt::set_omit_objs, std::nullopt);
+}
+
+
+int sc_opt_get_omit_objs(const sc_opt opts, cm_vct * omit_objs) {
+
+    //call generic getter
+    return _vector_getter<sc::opt, const cm_lst_node *, const cm_lst_node *>(
+        opts, omit_objs, &sc::opt::get_omit_objs, std::nullopt);
+}
+
+
+int sc_opt_set_exclusive_areas(sc_opt opts, const cm_vct * exclusive_areas) {
+
+    //call generic setter
+    return _vector_setter<sc::opt, const cm_lst_node *, const cm_lst_node *>(
+        opts, exclusive_areas, &sc::opt::set_exclusive_areas, std::nullopt);
+}
+
+
+int sc_opt_get_exclusive_areas(const sc_opt opts, cm_vct * exclusive_areas) {
+    
+    //call generic getter
+    return _vector_getter<sc::opt, const cm_lst_node *, const cm_lst_node *>(
+        opts, exclusive_areas, &sc::opt::get_exclusive_areas, std::nullopt);
+}
+
+
+int sc_opt_set_exclusive_objs(sc_opt opts, const cm_vct * exclusive_objs) {
+
+    //call generic setter
+    return _vector_setter<sc::opt, const cm_lst_node *, const cm_lst_node *>(
+        opts, exclusive_objs, &sc::opt::set_exclusive_objs, std::nullopt);
+}
+
+
+int sc_opt_get_exclusive_objs(const sc_opt opts, cm_vct * exclusive_objs) {
+
+    //call generic getter
+    return _vector_getter<sc::opt, const cm_lst_node *, const cm_lst_node *>(
+        opts, exclusive_objs, &sc::opt::get_exclusive_objs, std::nullopt);
+}
+
+
+int sc_opt_set_omit_addr_ranges(
+        sc_opt opts, const cm_vct * addr_ranges) {
+
+    //call generic setter
+    return _vector_setter<sc::opt,
+                          std::pair<uintptr_t, uintptr_t>,
+                          sc_addr_range>(
+        opts, addr_ranges, &sc::opt::set_omit_addr_ranges,
+            //start lambda
+            [](std::pair<uintptr_t, uintptr_t> * cc_addr_range,
+            sc_addr_range * c_addr_range) -> int {
+
+                *cc_addr_range = std::pair<uintptr_t, uintptr_t>(
+                    c_addr_range->min, c_addr_range->max);
+                return 0;
+        }); //end lambda
+}
+
+
+int sc_opt_get_omit_addr_ranges(
+        const sc_opt opts, cm_vct * addr_ranges) {
+
+    //call generic getter
+    return _vector_getter<sc::opt,
+                          std::pair<uintptr_t, uintptr_t>,
+                          sc_addr_range>(
+        opts, addr_ranges, &sc::opt::get_omit_addr_ranges,
+            //start lambda
+            [](sc_addr_range * c_addr_range,
+            std::pair<uintptr_t, uintptr_t> * cc_addr_range) -> int {
+
+                c_addr_range->min = cc_addr_range->first;
+                c_addr_range->max = cc_addr_range->second;
+                return 0;
+        }); //end lambda
+}
+
+
+int sc_opt_set_exclusive_addr_ranges(
+        sc_opt opts, const cm_vct * addr_ranges) {
+
+    //call generic setter
+    return _vector_setter<sc::opt,
+                          std::pair<uintptr_t, uintptr_t>,
+                          sc_addr_range>(
+        opts, addr_ranges, &sc::opt::set_exclusive_addr_ranges,
+            //start lambda
+            [](std::pair<uintptr_t, uintptr_t> * cc_addr_range,
+            sc_addr_range * c_addr_range) -> int {
+
+                *cc_addr_range = std::pair<uintptr_t, uintptr_t>(
+                    c_addr_range->min, c_addr_range->max);
+                return 0;
+        }); //end lambda
+}
+
+
+int sc_opt_get_exclusive_addr_ranges(
+        const sc_opt opts, cm_vct * addr_ranges) {
+
+    //call generic getter
+    return _vector_getter<sc::opt,
+                          std::pair<uintptr_t, uintptr_t>,
+                          sc_addr_range>(
+        opts, addr_ranges, &sc::opt::get_exclusive_addr_ranges,
+            //start lambda
+            [](sc_addr_range * c_addr_range,
+            std::pair<uintptr_t, uintptr_t> * cc_addr_range) -> int {
+
+                c_addr_range->min = cc_addr_range->first;
+                c_addr_range->max = cc_addr_range->second;
+                return 0;
+        }); //end lambda
+}
+
+
+int sc_opt_set_access(sc_opt opts, const cm_byte access) {
+
+    int ret;
+
+    
+    //cast opaque handle into class
+    sc::opt * o = static_cast<sc::opt *>(opts);
+
+    //perform the set
+    if (access == (cm_byte) -1) ret =  o->set_access(std::nullopt);
+    else ret = o->set_access(access);
+    return (ret != 0) ? -1 : 0;
+}
+
+    
+cm_byte sc_opt_get_access(const sc_opt opts) {
+
+    //cast opaque handle into class
+    sc::opt * o = static_cast<sc::opt *>(opts);
+
+    //return NULL if optional is not set or there is an error
+    std::optional<cm_byte> access = o->get_access();
+
+    if (access.has_value()) {
+        return access.value();
+    } else {
+        sc_errno = SC_ERR_OPT_EMPTY;
+        return -1;
+    }
+}
+
+
+int sc_opt_set_pid(sc_opt opts, const pid_t pid) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::opt * o = static_cast<sc::opt *>(opts);
+
+    //perform the set
+    if (pid == -1) ret = o->set_pid(std::nullopt);
+    else ret = o->set_pid(pid);
+    return (ret != 0) ? -1 : 0;
+}
+
+
+pid_t sc_opt_get_pid(const sc_opt opts) {
+
+    //cast opaque handle into class
+    sc::opt * o = static_cast<sc::opt *>(opts);
+
+    //return -1 if optional is not set
+    std::optional<pid_t> pid = o->get_pid();
+
+    if (pid.has_value()) {
+        return pid.value();
+    } else {
+        sc_errno = SC_ERR_OPT_EMPTY;
+        return -1;
+    }
+}
+
+
+
+/*
+ *  --- [OPT_PTR | EXTERNAL] ---
+ */
+
+//new class opt_ptr
+sc_opt_ptr sc_new_opt_ptr() {
+
+    try {
+        return new sc::opt_ptr();
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return nullptr;
+    }
+}
+
+
+sc_opt_ptr sc_copy_opt_ptr(const sc_opt_ptr opts_ptr) {
+
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+
+    try {
+        return new sc::opt_ptr(*o);
+        
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return nullptr;
+    }
+}
+
+
+//delete class opt
+int sc_del_opt_ptr(sc_opt_ptr opts_ptr) {
+
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+
+    try {
+        delete o;
+        return 0;
+        
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+//reset class opt_ptr
+int sc_opt_ptr_reset(sc_opt_ptr opts_ptr) {
+
+    int ret;
+
+    
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+
+    try {
+        ret = o->reset();
+        return (ret != 0) ? -1 : 0;
+        
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+int sc_opt_ptr_set_target_addr(sc_opt_ptr opts_ptr,
+                                   const uintptr_t target_addr) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+
+    //perform the set
+    if (target_addr == 0x0) ret = o->set_target_addr(std::nullopt);
+    else ret = o->set_target_addr(target_addr);
+    return (ret != 0) ? -1 : 0;
+}
+
+
+uintptr_t sc_opt_ptr_get_target_addr(const sc_opt_ptr opts_ptr) {
+    
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+
+    //return NULL if optional is not set or there is an error
+    const std::optional<uintptr_t> & target_addr
+        = o->get_target_addr();
+
+    if (target_addr.has_value()) {
+        return target_addr.value();
+    } else {
+        sc_errno = SC_ERR_OPT_EMPTY;
+        return 0x0;
+    }
+}
+
+
+int sc_opt_ptr_set_alignment(sc_opt_ptr opts_ptr,
+                                 const off_t alignment) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+
+    //perform the set
+    if (alignment == 0x0) ret = o->set_alignment(std::nullopt);
+    else ret = o->set_alignment(alignment);
+    return (ret != 0) ? -1 : 0;
+}
+
+
+off_t sc_opt_ptr_get_alignment(const sc_opt_ptr opts_ptr) {
+    
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+
+    //return NULL if optional is not set or there is an error
+    const std::optional<off_t> & alignment
+        = o->get_alignment();
+
+    if (alignment.has_value()) {
+        return alignment.value();
+    } else {
+        sc_errno = SC_ERR_OPT_EMPTY;
+        return 0x0;
+    }
+}
+
+
+int sc_opt_ptr_set_max_obj_sz(sc_opt_ptr opts_ptr,
+                                  const off_t max_obj_sz) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+    
+    //perform the set
+    if (max_obj_sz == 0x0) ret = o->set_max_obj_sz(std::nullopt);
+    else ret = o->set_max_obj_sz(max_obj_sz);
+    return (ret != 0) ? -1 : 0;
+}
+
+
+off_t sc_opt_ptr_get_max_obj_sz(const sc_opt_ptr opts_ptr) {
+    
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+
+    //return NULL if optional is not set or there is an error
+    const std::optional<off_t> & max_obj_sz
+        = o->get_max_obj_sz();
+
+    if (max_obj_sz.has_value()) {
+        return max_obj_sz.value();
+    } else {
+        sc_errno = SC_ERR_OPT_EMPTY;
+        return 0x0;
+    }
+}
+
+
+int sc_opt_ptr_set_max_depth(sc_opt_ptr opts_ptr,
+                                  const int max_depth) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+    
+    //perform the set
+    if (max_depth == 0x0) ret = o->set_max_depth(std::nullopt);
+    else ret = o->set_max_depth(max_depth);
+    return (ret != 0) ? -1 : 0;
+}
+
+
+int sc_opt_ptr_get_max_depth(const sc_opt_ptr opts_ptr) {
+    
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+
+    //return NULL if optional is not set or there is an error
+    const std::optional<int> & max_depth
+        = o->get_max_depth();
+
+    if (max_depth.has_value()) {
+        return max_depth.value();
+    } else {
+        sc_errno = SC_ERR_OPT_EMPTY;
+        return 0x0;
+    }
+}
+
+
+int sc_opt_ptr_set_static_areas(sc_opt_ptr opts_ptr,
+                                    const cm_vct * static_areas) {
+
+    //call generic setter
+    return _vector_setter<sc::opt_ptr,
+                          const cm_lst_node *,
+                          const cm_lst_node *>(
+        opts_ptr, static_areas,
+        &sc::opt_ptr::set_static_areas, std::nullopt);
+}
+
+
+int sc_opt_ptr_get_static_areas(const sc_opt_ptr opts_ptr,
+                                    cm_vct * static_areas) {
+
+    /*
+     *  NOTE: C++ returns a std::unordered_set. It only returns an
+     *        unordered set because that is the container used by the
+     *        internal implementation. Since we can't simply memcpy()
+     *        the container and must move it an element at a time, it
+     *        makes sense to move it to a more appropriate container.
+     */
+
+    int ret;
+
+    //call generic setter
+    ret = _unordered_set_getter<sc::opt_ptr,
+                                const cm_lst_node *,
+                                const cm_lst_node *>(
+        opts_ptr, static_areas,
+        &sc::opt_ptr::get_static_areas, std::nullopt);
+    if (ret != 0) return -1;
+
+    //sort the returned vector
+    try {
+        c_iface::sort_area_vct(static_areas);
+    } catch (const std::exception & excp) {
+        cm_del_vct(static_areas);
+        exception_sc_errno(excp);
+        return -1;
+    }
+
+    return 0;
+}
+
+
+int sc_opt_ptr_set_preset_offsets(sc_opt_ptr opts_ptr,
+                                      const cm_vct * preset_offsets) {
+
+    //call generic setter
+    return _vector_setter<sc::opt_ptr, off_t, off_t>(
+        opts_ptr, preset_offsets,
+        &sc::opt_ptr::set_preset_offsets, std::nullopt);
+}
+
+
+int sc_opt_ptr_get_preset_offsets(const sc_opt_ptr opts_ptr,
+                                      cm_vct * preset_offsets) {
+
+    //call generic getter
+    return _vector_getter<sc::opt_ptr, off_t, off_t>(
+        opts_ptr, preset_offsets,
+        &sc::opt_ptr::get_preset_offsets, std::nullopt);        
+}
+
+
+int sc_opt_ptr_set_smart_scan(sc_opt_ptr opts_ptr,
+                                  const bool enable) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+
+    //perform the set
+    ret = o->set_smart_scan(enable);
+    return (ret != 0) ? -1 : 0;
+}
+
+
+bool sc_opt_ptr_get_smart_scan(const sc_opt_ptr opts_ptr) {
+
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+
+    //call getter
+    return o->get_smart_scan();
+}
+
+
+int sc_opt_ptr_set_target_addrs(sc_opt_ptr opts_ptr,
+                                    const cm_vct * target_addrs) {
+
+    //call generic setter
+    return _vector_setter<sc::opt_ptr, uintptr_t, uintptr_t>(
+        opts_ptr, target_addrs,
+        &sc::opt_ptr::set_target_addrs, std::nullopt);
+}
+
+
+int sc_opt_ptr_get_target_addrs(const sc_opt_ptr opts_ptr,
+                                    cm_vct * target_addrs) {
+
+    //call generic getter
+    return _vector_getter<sc::opt_ptr, uintptr_t, uintptr_t>(
+        opts_ptr, target_addrs,
+        &sc::opt_ptr::get_target_addrs, std::nullopt);
+}
+
+int sc_opt_ptr_set_max_chains(sc_opt_ptr opts_ptr,
+                                  const size_t max_chains) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+    
+    //perform the set
+    if (max_chains == 0x0) ret = o->set_max_chains(std::nullopt);
+    else ret = o->set_max_chains(max_chains);
+    return (ret != 0) ? -1 : 0;
+}
+
+
+size_t sc_opt_ptr_get_max_chains(const sc_opt_ptr opts_ptr) {
+    
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+
+    //return 0x0 if optional is not set
+    const std::optional<size_t> & max_chains
+        = o->get_max_chains();
+
+    if (max_chains.has_value()) {
+        return max_chains.value();
+    } else {
+        sc_errno = SC_ERR_OPT_EMPTY;
+        return 0x0;
+    }
+}
+
+int sc_opt_ptr_set_max_level_nodes(sc_opt_ptr opts_ptr,
+                                       const size_t max_level_nodes) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+    
+    //perform the set
+    if (max_level_nodes == 0x0) ret = o->set_max_level_nodes(std::nullopt);
+    else ret = o->set_max_level_nodes(max_level_nodes);
+    return (ret != 0) ? -1 : 0;
+}
+
+
+size_t sc_opt_ptr_get_max_level_nodes(const sc_opt_ptr opts_ptr) {
+    
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+
+    //return 0x0 if optional is not set
+    const std::optional<size_t> & max_level_nodes
+        = o->get_max_level_nodes();
+
+    if (max_level_nodes.has_value()) {
+        return max_level_nodes.value();
+    } else {
+        sc_errno = SC_ERR_OPT_EMPTY;
+        return 0x0;
+    }
+}
+
+int sc_opt_ptr_set_max_children(sc_opt_ptr opts_ptr,
+                                    const size_t max_children) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+    
+    //perform the set
+    if (max_children == 0x0) ret = o->set_max_children(std::nullopt);
+    else ret = o->set_max_children(max_children);
+    return (ret != 0) ? -1 : 0;
+}
+
+
+size_t sc_opt_ptr_get_max_children(const sc_opt_ptr opts_ptr) {
+    
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+
+    //return 0x0 if optional is not set
+    const std::optional<size_t> & max_children
+        = o->get_max_children();
+
+    if (max_children.has_value()) {
+        return max_children.value();
+    } else {
+        sc_errno = SC_ERR_OPT_EMPTY;
+        return 0x0;
+    }
+}
+
+int sc_opt_ptr_set_bidirectional(sc_opt_ptr opts_ptr,
+                                     const bool enable) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+
+    //perform the set
+    ret = o->set_bidirectional(enable);
+    return (ret != 0) ? -1 : 0;
+}
+
+
+bool sc_opt_ptr_get_bidirectional(const sc_opt_ptr opts_ptr) {
+
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+
+    //call getter
+    return o->get_bidirectional();
+}
+
+
+int sc_opt_ptr_set_checkpoint_path(sc_opt_ptr opts_ptr, const char * path) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+
+    try {
+        if (path == nullptr) ret = o->set_checkpoint_path(std::nullopt);
+        else ret = o->set_checkpoint_path(path);
+        return (ret != 0) ? -1 : 0;
+        
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+const char * sc_opt_ptr_get_checkpoint_path(const sc_opt_ptr opts_ptr) {
+
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+
+    //return NULL if optional is not set or there is an error
+    try {
+        const std::optional<std::string> & checkpoint_path
+            = o->get_checkpoint_path();
+
+        if (checkpoint_path.has_value() && !checkpoint_path.value().empty()) {
+            return checkpoint_path.value().c_str();
+        } else {
+            sc_errno = SC_ERR_OPT_EMPTY;
+            return nullptr;
+        }
+        
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return nullptr;
+    }
+}
+
+
+int sc_opt_ptr_set_spill_path(sc_opt_ptr opts_ptr, const char * path) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+
+    try {
+        if (path == nullptr) ret = o->set_spill_path(std::nullopt);
+        else ret = o->set_spill_path(path);
+        return (ret != 0) ? -1 : 0;
+        
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+const char * sc_opt_ptr_get_spill_path(const sc_opt_ptr opts_ptr) {
+
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+
+    //return NULL if optional is not set or there is an error
+    try {
+        const std::optional<std::string> & spill_path
+            = o->get_spill_path();
+
+        if (spill_path.has_value() && !spill_path.value().empty()) {
+            return spill_path.value().c_str();
+        } else {
+            sc_errno = SC_ERR_OPT_EMPTY;
+            return nullptr;
+        }
+        
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return nullptr;
+    }
+}
+
+int sc_opt_ptr_set_max_neg_off(sc_opt_ptr opts_ptr,
+                                   const off_t max_neg_off) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+    
+    //perform the set
+    if (max_neg_off == 0x0) ret = o->set_max_neg_off(std::nullopt);
+    else ret = o->set_max_neg_off(max_neg_off);
+    return (ret != 0) ? -1 : 0;
+}
+
+
+off_t sc_opt_ptr_get_max_neg_off(const sc_opt_ptr opts_ptr) {
+    
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+
+    //return 0x0 if optional is not set
+    const std::optional<off_t> & max_neg_off
+        = o->get_max_neg_off();
+
+    if (max_neg_off.has_value()) {
+        return max_neg_off.value();
+    } else {
+        sc_errno = SC_ERR_OPT_EMPTY;
+        return 0x0;
+    }
+}
+
+int sc_opt_ptr_set_prefer_static(sc_opt_ptr opts_ptr,
+                                     const bool enable) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+
+    //perform the set
+    ret = o->set_prefer_static(enable);
+    return (ret != 0) ? -1 : 0;
+}
+
+
+bool sc_opt_ptr_get_prefer_static(const sc_opt_ptr opts_ptr) {
+
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+
+    //call getter
+    return o->get_prefer_static();
+}
+
+int sc_opt_ptr_set_max_array_run(sc_opt_ptr opts_ptr,
+                                     const size_t max_array_run) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+    
+    //perform the set
+    if (max_array_run == 0x0) ret = o->set_max_array_run(std::nullopt);
+    else ret = o->set_max_array_run(max_array_run);
+    return (ret != 0) ? -1 : 0;
+}
+
+
+size_t sc_opt_ptr_get_max_array_run(const sc_opt_ptr opts_ptr) {
     
+    //cast opaque handle into class
+    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+
+    //return 0x0 if optional is not set
+    const std::optional<size_t> & max_array_run
+        = o->get_max_array_run();
+
+    if (max_array_run.has_value()) {
+        return max_array_run.value();
+    } else {
+        sc_errno = SC_ERR_OPT_EMPTY;
+        return 0x0;
+    }
+}
+
+
+
+/*
+ *  --- [OPT_VAL | EXTERNAL] ---
+ */
+
+//new class opt_val
+sc_opt_val sc_new_opt_val() {
+
     try {
-        if (path == nullptr) ret = o->set_file_path_in(std::nullopt);
-        else ret = o->set_file_path_in(path);
+        return new sc::opt_val();
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return nullptr;
+    }
+}
+
+
+sc_opt_val sc_copy_opt_val(const sc_opt_val opts_val) {
+
+    //cast opaque handle into class
+    sc::opt_val * o = static_cast<sc::opt_val *>(opts_val);
+
+    try {
+        return new sc::opt_val(*o);
+        
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return nullptr;
+    }
+}
+
+
+//delete class opt_val
+int sc_del_opt_val(sc_opt_val opts_val) {
+
+    //cast opaque handle into class
+    sc::opt_val * o = static_cast<sc::opt_val *>(opts_val);
+
+    try {
+        delete o;
+        return 0;
+        
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+//reset class opt_val
+int sc_opt_val_reset(sc_opt_val opts_val) {
+
+    int ret;
+
+    
+    //cast opaque handle into class
+    sc::opt_val * o = static_cast<sc::opt_val *>(opts_val);
+
+    try {
+        ret = o->reset();
         return (ret != 0) ? -1 : 0;
         
     } catch (const std::exception & excp) {
@@ -743,310 +2519,347 @@ int sc_opt_set_file_path_in(sc_opt opts, const char * path) {
 }
 
 
-const char * sc_opt_get_file_path_in(const sc_opt opts) {
-    
-    //cast opaque handle into class
-    sc::opt * o = static_cast<sc::opt *>(opts);
+int sc_opt_val_set_type(sc_opt_val opts_val,
+                        const enum sc_val_type type) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::opt_val * o = static_cast<sc::opt_val *>(opts_val);
+
+    //convert C enum to C++ & perform the set
+    ret = o->set_type(static_cast<enum sc::val_type>(type));
+    return (ret != 0) ? -1 : 0;
+}
+
+
+int sc_opt_val_get_type(const sc_opt_val opts_val) {
+
+    //cast opaque handle into class
+    sc::opt_val * o = static_cast<sc::opt_val *>(opts_val);
+
+    //return -1 if optional is not set
+    const std::optional<enum sc::val_type> type = o->get_type();
+
+    if (type.has_value()) {
+        return static_cast<int>(type.value());
+    } else {
+        sc_errno = SC_ERR_OPT_EMPTY;
+        return -1;
+    }
+}
+
+
+int sc_opt_val_set_alignment(sc_opt_val opts_val,
+                             const off_t alignment) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::opt_val * o = static_cast<sc::opt_val *>(opts_val);
+
+    //perform the set
+    if (alignment == 0x0) ret = o->set_alignment(std::nullopt);
+    else ret = o->set_alignment(alignment);
+    return (ret != 0) ? -1 : 0;
+}
+
+
+off_t sc_opt_val_get_alignment(const sc_opt_val opts_val) {
+    
+    //cast opaque handle into class
+    sc::opt_val * o = static_cast<sc::opt_val *>(opts_val);
+
+    //return NULL if optional is not set or there is an error
+    const std::optional<off_t> & alignment
+        = o->get_alignment();
+
+    if (alignment.has_value()) {
+        return alignment.value();
+    } else {
+        sc_errno = SC_ERR_OPT_EMPTY;
+        return 0x0;
+    }
+}
+
+
+int sc_opt_val_set_value(sc_opt_val opts_val, const cm_vct * value) {
 
-    //return NULL if optional is not set or there is an error
-    try {
-        const std::optional<std::string> & file_path_in
-            = o->get_file_path_in();
+    //call generic setter
+    return _vector_setter<sc::opt_val, cm_byte, cm_byte>(
+        opts_val, value, &sc::opt_val::set_value, std::nullopt);
+}
 
-        if (file_path_in.has_value() && !file_path_in.value().empty()) {
-            return file_path_in.value().c_str();
-        } else {
-            sc_errno = SC_ERR_OPT_EMPTY;
-            return nullptr;
-        }
-        
-    } catch (const std::exception & excp) {
-        exception_sc_errno(excp);
-        return nullptr;
-    }
+
+int sc_opt_val_get_value(const sc_opt_val opts_val, cm_vct * value) {
+
+    //call generic getter
+    return _vector_getter<sc::opt_val, cm_byte, cm_byte>(
+        opts_val, value, &sc::opt_val::get_value, std::nullopt);
 }
 
 
-int sc_opt_set_sessions(sc_opt opts, const cm_vct * sessions) {
+int sc_opt_val_set_predicate(sc_opt_val opts_val,
+                             const enum sc_val_pred predicate) {
 
     int ret;
 
 
     //cast opaque handle into class
-    sc::opt * o = static_cast<sc::opt *>(opts);
+    sc::opt_val * o = static_cast<sc::opt_val *>(opts_val);
 
-    //create a STL vector
-    std::vector<const mc_session *> v;
-    v.resize(sessions->len);
-    std::memcpy(v.data(), sessions->data,
-                sessions->data_sz * sessions->len);
+    //convert C enum to C++ & perform the set
+    ret = o->set_predicate(static_cast<enum sc::val_pred>(predicate));
+    return (ret != 0) ? -1 : 0;
+}
 
-    //call the setter with the STL vector
-    try {
-        ret = o->set_sessions(v);
-        return (ret != 0) ? -1 : 0; 
 
-    } catch (const std::exception & excp) {
-        exception_sc_errno(excp);
-        return -1;
-    }
+enum sc_val_pred sc_opt_val_get_predicate(const sc_opt_val opts_val) {
+
+    //cast opaque handle into class
+    sc::opt_val * o = static_cast<sc::opt_val *>(opts_val);
+
+    //convert C++ enum to C
+    return static_cast<enum sc_val_pred>(o->get_predicate());
 }
 
 
-int sc_opt_get_sessions(const sc_opt opts, cm_vct * sessions) {
-    
-    //cast opaque handle into class
-    sc::opt * o = static_cast<sc::opt *>(opts);
+int sc_opt_val_set_value_hi(sc_opt_val opts_val, const cm_vct * value_hi) {
 
-    //initialise the CMore vector
-    int ret = cm_new_vct(sessions, sizeof(cm_lst_node *));
-    if (ret != 0) {
-        sc_errno = SC_ERR_CMORE;
-        return -1;
-    }
+    //call generic setter
+    return _vector_setter<sc::opt_val, cm_byte, cm_byte>(
+        opts_val, value_hi, &sc::opt_val::set_value_hi, std::nullopt);
+}
 
-    //copy contents of the STL vector into the CMore vector.
-    try {
-        //get the STL vector
-        const std::vector<const mc_session *> & v = o->get_sessions();
 
-        //copy the STL vector into the CMore vector
-        ret = cm_vct_rsz(sessions, v.size());
-        if (ret != 0) {
-            sc_errno = SC_ERR_CMORE;
-            return -1;
-        }
-        std::memcpy(sessions->data, v.data(),
-                    v.size() * sizeof(cm_lst_node *));
-        return 0;
-        
-    } catch (const std::exception & excp) {
-        cm_del_vct(sessions);
-        exception_sc_errno(excp);
-        return -1;
-    }
+int sc_opt_val_get_value_hi(const sc_opt_val opts_val, cm_vct * value_hi) {
+
+    //call generic getter
+    return _vector_getter<sc::opt_val, cm_byte, cm_byte>(
+        opts_val, value_hi, &sc::opt_val::get_value_hi, std::nullopt);
 }
 
 
-int sc_opt_set_map(sc_opt opts, const mc_vm_map * map) {
+int sc_opt_val_set_round(sc_opt_val opts_val,
+                         const enum sc_val_round round) {
 
     int ret;
 
 
     //cast opaque handle into class
-    sc::opt * o = static_cast<sc::opt *>(opts);
+    sc::opt_val * o = static_cast<sc::opt_val *>(opts_val);
 
-    ret = o->set_map(map);
+    //convert C enum to C++ & perform the set
+    ret = o->set_round(static_cast<enum sc::val_round>(round));
     return (ret != 0) ? -1 : 0;
 }
 
 
-mc_vm_map * sc_opt_get_map(const sc_opt opts) {
+enum sc_val_round sc_opt_val_get_round(const sc_opt_val opts_val) {
 
     //cast opaque handle into class
-    sc::opt * o = static_cast<sc::opt *>(opts);
+    sc::opt_val * o = static_cast<sc::opt_val *>(opts_val);
 
-    return o->get_map();
+    //convert C++ enum to C
+    return static_cast<enum sc_val_round>(o->get_round());
 }
 
 
-enum sc_addr_width sc_opt_get_addr_width(const sc_opt opts) {
+int sc_opt_val_set_epsilon(sc_opt_val opts_val, const double epsilon) {
+
+    int ret;
+
 
     //cast opaque handle into class
-    sc::opt * o = static_cast<sc::opt *>(opts);
+    sc::opt_val * o = static_cast<sc::opt_val *>(opts_val);
 
-    //convert C++ enum to C
-    return (o->addr_width == sc::AW64) ? AW64 : AW32;
+    //perform the set
+    if (epsilon == 0.0) ret = o->set_epsilon(std::nullopt);
+    else ret = o->set_epsilon(epsilon);
+    return (ret != 0) ? -1 : 0;
 }
 
 
-/*
- *  NOTE: In these setter functions, the C++ setter is passed a STL vector
- *        constructed from a CMore vector
- */
+double sc_opt_val_get_epsilon(const sc_opt_val opts_val) {
 
-int sc_opt_set_omit_areas(sc_opt opts, const cm_vct * omit_areas) {
+    //cast opaque handle into class
+    sc::opt_val * o = static_cast<sc::opt_val *>(opts_val);
 
-    //call generic setter
-    return _vector_setter<sc::opt, const cm_lst_node *, const cm_lst_node *>(
-        opts, omit_areas, &sc::opt::set_omit_areas, std::nullopt);
+    //return 0.0 if optional is not set
+    const std::optional<double> epsilon = o->get_epsilon();
+
+    if (epsilon.has_value()) {
+        return epsilon.value();
+    } else {
+        sc_errno = SC_ERR_OPT_EMPTY;
+        return 0.0;
+    }
 }
 
 
-int sc_opt_get_omit_areas(const sc_opt opts, cm_vct * omit_areas) {
 
-    //call generic getter
-    return _vector_getter<sc::opt, const cm_lst_node *, const cm_lst_node *>(
-        opts, omit_areas, &sc::opt::get_omit_areas, std::nullopt);
-}
+/*
+ *  --- [OPT_PTN | EXTERNAL] ---
+ */
 
+//new class opt_ptn
+sc_opt_ptn sc_new_opt_ptn() {
 
-int sc_opt_set_omit_objs(sc_opt opts, const cm_vct * omit_objs) {
+    try {
+        return new sc::opt_ptn();
 
-    //call generic setter
-    return _vector_setter<sc::opt, const cm_lst_node *, const cm_lst_node *>(
-        opts, omit_objs, &sc::opt::set_omit_objs, std::nullopt);
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return nullptr;
+    }
 }
 
 
-int sc_opt_get_omit_objs(const sc_opt opts, cm_vct * omit_objs) {
+sc_opt_ptn sc_copy_opt_ptn(const sc_opt_ptn opts_ptn) {
 
-    //call generic getter
-    return _vector_getter<sc::opt, const cm_lst_node *, const cm_lst_node *>(
-        opts, omit_objs, &sc::opt::get_omit_objs, std::nullopt);
+    //cast opaque handle into class
+    sc::opt_ptn * o = static_cast<sc::opt_ptn *>(opts_ptn);
+
+    try {
+        return new sc::opt_ptn(*o);
+        
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return nullptr;
+    }
 }
 
 
-int sc_opt_set_exclusive_areas(sc_opt opts, const cm_vct * exclusive_areas) {
+//delete class opt_ptn
+int sc_del_opt_ptn(sc_opt_ptn opts_ptn) {
 
-    //call generic setter
-    return _vector_setter<sc::opt, const cm_lst_node *, const cm_lst_node *>(
-        opts, exclusive_areas, &sc::opt::set_exclusive_areas, std::nullopt);
+    //cast opaque handle into class
+    sc::opt_ptn * o = static_cast<sc::opt_ptn *>(opts_ptn);
+
+    try {
+        delete o;
+        return 0;
+        
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
 }
 
 
-int sc_opt_get_exclusive_areas(const sc_opt opts, cm_vct * exclusive_areas) {
+//reset class opt_ptn
+int sc_opt_ptn_reset(sc_opt_ptn opts_ptn) {
+
+    int ret;
+
     
-    //call generic getter
-    return _vector_getter<sc::opt, const cm_lst_node *, const cm_lst_node *>(
-        opts, exclusive_areas, &sc::opt::get_exclusive_areas, std::nullopt);
+    //cast opaque handle into class
+    sc::opt_ptn * o = static_cast<sc::opt_ptn *>(opts_ptn);
+
+    try {
+        ret = o->reset();
+        return (ret != 0) ? -1 : 0;
+        
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
 }
 
 
-int sc_opt_set_exclusive_objs(sc_opt opts, const cm_vct * exclusive_objs) {
+int sc_opt_ptn_set_pattern(sc_opt_ptn opts_ptn, const cm_vct * pattern) {
 
     //call generic setter
-    return _vector_setter<sc::opt, const cm_lst_node *, const cm_lst_node *>(
-        opts, exclusive_objs, &sc::opt::set_exclusive_objs, std::nullopt);
+    return _vector_setter<sc::opt_ptn, cm_byte, cm_byte>(
+        opts_ptn, pattern, &sc::opt_ptn::set_pattern, std::nullopt);
 }
 
 
-int sc_opt_get_exclusive_objs(const sc_opt opts, cm_vct * exclusive_objs) {
+int sc_opt_ptn_get_pattern(const sc_opt_ptn opts_ptn, cm_vct * pattern) {
 
     //call generic getter
-    return _vector_getter<sc::opt, const cm_lst_node *, const cm_lst_node *>(
-        opts, exclusive_objs, &sc::opt::get_exclusive_objs, std::nullopt);
+    return _vector_getter<sc::opt_ptn, cm_byte, cm_byte>(
+        opts_ptn, pattern, &sc::opt_ptn::get_pattern, std::nullopt);
 }
 
 
-int sc_opt_set_omit_addr_ranges(
-        sc_opt opts, const cm_vct * addr_ranges) {
+int sc_opt_ptn_set_mask(sc_opt_ptn opts_ptn, const cm_vct * mask) {
 
     //call generic setter
-    return _vector_setter<sc::opt,
-                          std::pair<uintptr_t, uintptr_t>,
-                          sc_addr_range>(
-        opts, addr_ranges, &sc::opt::set_omit_addr_ranges,
-            //start lambda
-            [](std::pair<uintptr_t, uintptr_t> * cc_addr_range,
-            sc_addr_range * c_addr_range) -> int {
-
-                *cc_addr_range = std::pair<uintptr_t, uintptr_t>(
-                    c_addr_range->min, c_addr_range->max);
-                return 0;
-        }); //end lambda
+    return _vector_setter<sc::opt_ptn, cm_byte, cm_byte>(
+        opts_ptn, mask, &sc::opt_ptn::set_mask, std::nullopt);
 }
 
 
-int sc_opt_get_omit_addr_ranges(
-        const sc_opt opts, cm_vct * addr_ranges) {
+int sc_opt_ptn_get_mask(const sc_opt_ptn opts_ptn, cm_vct * mask) {
 
     //call generic getter
-    return _vector_getter<sc::opt,
-                          std::pair<uintptr_t, uintptr_t>,
-                          sc_addr_range>(
-        opts, addr_ranges, &sc::opt::get_omit_addr_ranges,
-            //start lambda
-            [](sc_addr_range * c_addr_range,
-            std::pair<uintptr_t, uintptr_t> * cc_addr_range) -> int {
-
-                c_addr_range->min = cc_addr_range->first;
-                c_addr_range->max = cc_addr_range->second;
-                return 0;
-        }); //end lambda
+    return _vector_getter<sc::opt_ptn, cm_byte, cm_byte>(
+        opts_ptn, mask, &sc::opt_ptn::get_mask, std::nullopt);
 }
 
 
-int sc_opt_set_exclusive_addr_ranges(
-        sc_opt opts, const cm_vct * addr_ranges) {
-
-    //call generic setter
-    return _vector_setter<sc::opt,
-                          std::pair<uintptr_t, uintptr_t>,
-                          sc_addr_range>(
-        opts, addr_ranges, &sc::opt::set_exclusive_addr_ranges,
-            //start lambda
-            [](std::pair<uintptr_t, uintptr_t> * cc_addr_range,
-            sc_addr_range * c_addr_range) -> int {
+int sc_opt_ptn_set_pattern_str(sc_opt_ptn opts_ptn,
+                               const char * pattern_str) {
 
-                *cc_addr_range = std::pair<uintptr_t, uintptr_t>(
-                    c_addr_range->min, c_addr_range->max);
-                return 0;
-        }); //end lambda
-}
+    int ret;
 
 
-int sc_opt_get_exclusive_addr_ranges(
-        const sc_opt opts, cm_vct * addr_ranges) {
+    //cast opaque handle into class
+    sc::opt_ptn * o = static_cast<sc::opt_ptn *>(opts_ptn);
 
-    //call generic getter
-    return _vector_getter<sc::opt,
-                          std::pair<uintptr_t, uintptr_t>,
-                          sc_addr_range>(
-        opts, addr_ranges, &sc::opt::get_exclusive_addr_ranges,
-            //start lambda
-            [](sc_addr_range * c_addr_range,
-            std::pair<uintptr_t, uintptr_t> * cc_addr_range) -> int {
+    try {
+        if (pattern_str == nullptr) {
+            sc_errno = SC_ERR_OPT_PATTERN;
+            return -1;
+        }
 
-                c_addr_range->min = cc_addr_range->first;
-                c_addr_range->max = cc_addr_range->second;
-                return 0;
-        }); //end lambda
+        ret = o->set_pattern_str(pattern_str);
+        return (ret != 0) ? -1 : 0;
+        
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
 }
 
 
-int sc_opt_set_access(sc_opt opts, const cm_byte access) {
+int sc_opt_ptn_set_signatures(sc_opt_ptn opts_ptn,
+                              const sc_ptn_set signatures) {
 
     int ret;
 
-    
-    //cast opaque handle into class
-    sc::opt * o = static_cast<sc::opt *>(opts);
 
-    //perform the set
-    if (access == (cm_byte) -1) ret =  o->set_access(std::nullopt);
-    else ret = o->set_access(access);
+    //cast opaque handles into classes
+    sc::opt_ptn * o = static_cast<sc::opt_ptn *>(opts_ptn);
+    sc::ptn_set * p = static_cast<sc::ptn_set *>(signatures);
+
+    ret = o->set_signatures(p);
     return (ret != 0) ? -1 : 0;
 }
 
-    
-cm_byte sc_opt_get_access(const sc_opt opts) {
 
-    //cast opaque handle into class
-    sc::opt * o = static_cast<sc::opt *>(opts);
+sc_ptn_set sc_opt_ptn_get_signatures(const sc_opt_ptn opts_ptn) {
 
-    //return NULL if optional is not set or there is an error
-    std::optional<cm_byte> access = o->get_access();
+    //cast opaque handle into class
+    sc::opt_ptn * o = static_cast<sc::opt_ptn *>(opts_ptn);
 
-    if (access.has_value()) {
-        return access.value();
-    } else {
-        sc_errno = SC_ERR_OPT_EMPTY;
-        return -1;
-    }
+    return o->get_signatures();
 }
 
 
 
 /*
- *  --- [OPT_PTR | EXTERNAL] ---
+ *  --- [OPT_STR | EXTERNAL] ---
  */
 
-//new class opt_ptr
-sc_opt_ptr sc_new_opt_ptr() {
+//new class opt_str
+sc_opt_str sc_new_opt_str() {
 
     try {
-        return new sc::opt_ptr();
+        return new sc::opt_str();
 
     } catch (const std::exception & excp) {
         exception_sc_errno(excp);
@@ -1055,14 +2868,14 @@ sc_opt_ptr sc_new_opt_ptr() {
 }
 
 
-sc_opt_ptr sc_copy_opt_ptr(const sc_opt_ptr opts_ptr) {
+sc_opt_str sc_copy_opt_str(const sc_opt_str opts_str) {
 
     //cast opaque handle into class
-    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+    sc::opt_str * o = static_cast<sc::opt_str *>(opts_str);
 
     try {
-        return new sc::opt_ptr(*o);
-        
+        return new sc::opt_str(*o);
+
     } catch (const std::exception & excp) {
         exception_sc_errno(excp);
         return nullptr;
@@ -1070,16 +2883,16 @@ sc_opt_ptr sc_copy_opt_ptr(const sc_opt_ptr opts_ptr) {
 }
 
 
-//delete class opt
-int sc_del_opt_ptr(sc_opt_ptr opts_ptr) {
+//delete class opt_str
+int sc_del_opt_str(sc_opt_str opts_str) {
 
     //cast opaque handle into class
-    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+    sc::opt_str * o = static_cast<sc::opt_str *>(opts_str);
 
     try {
         delete o;
         return 0;
-        
+
     } catch (const std::exception & excp) {
         exception_sc_errno(excp);
         return -1;
@@ -1087,19 +2900,19 @@ int sc_del_opt_ptr(sc_opt_ptr opts_ptr) {
 }
 
 
-//reset class opt_ptr
-int sc_opt_ptr_reset(sc_opt_ptr opts_ptr) {
+//reset class opt_str
+int sc_opt_str_reset(sc_opt_str opts_str) {
 
     int ret;
 
-    
+
     //cast opaque handle into class
-    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+    sc::opt_str * o = static_cast<sc::opt_str *>(opts_str);
 
     try {
         ret = o->reset();
         return (ret != 0) ? -1 : 0;
-        
+
     } catch (const std::exception & excp) {
         exception_sc_errno(excp);
         return -1;
@@ -1107,228 +2920,304 @@ int sc_opt_ptr_reset(sc_opt_ptr opts_ptr) {
 }
 
 
-int sc_opt_ptr_set_target_addr(sc_opt_ptr opts_ptr,
-                                   const uintptr_t target_addr) {
+int sc_opt_str_set_str(sc_opt_str opts_str, const char * str) {
 
     int ret;
 
 
     //cast opaque handle into class
-    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+    sc::opt_str * o = static_cast<sc::opt_str *>(opts_str);
 
-    //perform the set
-    if (target_addr == 0x0) ret = o->set_target_addr(std::nullopt);
-    else ret = o->set_target_addr(target_addr);
-    return (ret != 0) ? -1 : 0;
+    try {
+        if (str == nullptr) ret = o->set_str(std::nullopt);
+        else ret = o->set_str(str);
+        return (ret != 0) ? -1 : 0;
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
 }
 
 
-uintptr_t sc_opt_ptr_get_target_addr(const sc_opt_ptr opts_ptr) {
-    
+const char * sc_opt_str_get_str(const sc_opt_str opts_str) {
+
     //cast opaque handle into class
-    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+    sc::opt_str * o = static_cast<sc::opt_str *>(opts_str);
 
     //return NULL if optional is not set or there is an error
-    const std::optional<uintptr_t> & target_addr
-        = o->get_target_addr();
+    try {
+        const std::optional<std::string> & str = o->get_str();
 
-    if (target_addr.has_value()) {
-        return target_addr.value();
-    } else {
-        sc_errno = SC_ERR_OPT_EMPTY;
-        return 0x0;
+        if (str.has_value() && !str.value().empty()) {
+            return str.value().c_str();
+        } else {
+            sc_errno = SC_ERR_OPT_EMPTY;
+            return nullptr;
+        }
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return nullptr;
     }
 }
 
 
-int sc_opt_ptr_set_alignment(sc_opt_ptr opts_ptr,
-                                 const off_t alignment) {
+int sc_opt_str_set_encodings(sc_opt_str opts_str, const cm_byte encodings) {
 
     int ret;
 
 
     //cast opaque handle into class
-    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+    sc::opt_str * o = static_cast<sc::opt_str *>(opts_str);
 
     //perform the set
-    if (alignment == 0x0) ret = o->set_alignment(std::nullopt);
-    else ret = o->set_alignment(alignment);
+    ret = o->set_encodings(encodings);
     return (ret != 0) ? -1 : 0;
 }
 
 
-off_t sc_opt_ptr_get_alignment(const sc_opt_ptr opts_ptr) {
-    
-    //cast opaque handle into class
-    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+cm_byte sc_opt_str_get_encodings(const sc_opt_str opts_str) {
 
-    //return NULL if optional is not set or there is an error
-    const std::optional<off_t> & alignment
-        = o->get_alignment();
+    //cast opaque handle into class
+    sc::opt_str * o = static_cast<sc::opt_str *>(opts_str);
 
-    if (alignment.has_value()) {
-        return alignment.value();
-    } else {
-        sc_errno = SC_ERR_OPT_EMPTY;
-        return 0x0;
-    }
+    //call getter
+    return o->get_encodings();
 }
 
 
-int sc_opt_ptr_set_max_obj_sz(sc_opt_ptr opts_ptr,
-                                  const off_t max_obj_sz) {
+int sc_opt_str_set_case_insensitive(sc_opt_str opts_str, const bool enable) {
 
     int ret;
 
 
     //cast opaque handle into class
-    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
-    
+    sc::opt_str * o = static_cast<sc::opt_str *>(opts_str);
+
     //perform the set
-    if (max_obj_sz == 0x0) ret = o->set_max_obj_sz(std::nullopt);
-    else ret = o->set_max_obj_sz(max_obj_sz);
+    ret = o->set_case_insensitive(enable);
     return (ret != 0) ? -1 : 0;
 }
 
 
-off_t sc_opt_ptr_get_max_obj_sz(const sc_opt_ptr opts_ptr) {
-    
-    //cast opaque handle into class
-    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+bool sc_opt_str_get_case_insensitive(const sc_opt_str opts_str) {
 
-    //return NULL if optional is not set or there is an error
-    const std::optional<off_t> & max_obj_sz
-        = o->get_max_obj_sz();
+    //cast opaque handle into class
+    sc::opt_str * o = static_cast<sc::opt_str *>(opts_str);
 
-    if (max_obj_sz.has_value()) {
-        return max_obj_sz.value();
-    } else {
-        sc_errno = SC_ERR_OPT_EMPTY;
-        return 0x0;
-    }
+    //call getter
+    return o->get_case_insensitive();
 }
 
 
-int sc_opt_ptr_set_max_depth(sc_opt_ptr opts_ptr,
-                                  const int max_depth) {
+int sc_opt_str_set_null_term(sc_opt_str opts_str, const bool enable) {
 
     int ret;
 
 
     //cast opaque handle into class
-    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
-    
+    sc::opt_str * o = static_cast<sc::opt_str *>(opts_str);
+
     //perform the set
-    if (max_depth == 0x0) ret = o->set_max_depth(std::nullopt);
-    else ret = o->set_max_depth(max_depth);
+    ret = o->set_null_term(enable);
     return (ret != 0) ? -1 : 0;
 }
 
 
-int sc_opt_ptr_get_max_depth(const sc_opt_ptr opts_ptr) {
-    
+bool sc_opt_str_get_null_term(const sc_opt_str opts_str) {
+
     //cast opaque handle into class
-    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+    sc::opt_str * o = static_cast<sc::opt_str *>(opts_str);
 
-    //return NULL if optional is not set or there is an error
-    const std::optional<int> & max_depth
-        = o->get_max_depth();
+    //call getter
+    return o->get_null_term();
+}
 
-    if (max_depth.has_value()) {
-        return max_depth.value();
-    } else {
-        sc_errno = SC_ERR_OPT_EMPTY;
-        return 0x0;
+
+
+/*
+ *  --- [OPT_STRUCT | EXTERNAL] ---
+ */
+
+//new class opt_struct
+sc_opt_struct sc_new_opt_struct() {
+
+    try {
+        return new sc::opt_struct();
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return nullptr;
     }
 }
 
 
-int sc_opt_ptr_set_static_areas(sc_opt_ptr opts_ptr,
-                                    const cm_vct * static_areas) {
+sc_opt_struct sc_copy_opt_struct(const sc_opt_struct opts_struct) {
 
-    //call generic setter
-    return _vector_setter<sc::opt_ptr,
-                          const cm_lst_node *,
-                          const cm_lst_node *>(
-        opts_ptr, static_areas,
-        &sc::opt_ptr::set_static_areas, std::nullopt);
+    //cast opaque handle into class
+    sc::opt_struct * o = static_cast<sc::opt_struct *>(opts_struct);
+
+    try {
+        return new sc::opt_struct(*o);
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return nullptr;
+    }
 }
 
 
-int sc_opt_ptr_get_static_areas(const sc_opt_ptr opts_ptr,
-                                    cm_vct * static_areas) {
+//delete class opt_struct
+int sc_del_opt_struct(sc_opt_struct opts_struct) {
+
+    //cast opaque handle into class
+    sc::opt_struct * o = static_cast<sc::opt_struct *>(opts_struct);
+
+    try {
+        delete o;
+        return 0;
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
 
-    /*
-     *  NOTE: C++ returns a std::unordered_set. It only returns an
-     *        unordered set because that is the container used by the
-     *        internal implementation. Since we can't simply memcpy()
-     *        the container and must move it an element at a time, it
-     *        makes sense to move it to a more appropriate container.
-     */
+
+//reset class opt_struct
+int sc_opt_struct_reset(sc_opt_struct opts_struct) {
 
     int ret;
 
-    //call generic setter
-    ret = _unordered_set_getter<sc::opt_ptr,
-                                const cm_lst_node *,
-                                const cm_lst_node *>(
-        opts_ptr, static_areas,
-        &sc::opt_ptr::get_static_areas, std::nullopt);
-    if (ret != 0) return -1;
 
-    //sort the returned vector
+    //cast opaque handle into class
+    sc::opt_struct * o = static_cast<sc::opt_struct *>(opts_struct);
+
     try {
-        c_iface::sort_area_vct(static_areas);
+        ret = o->reset();
+        return (ret != 0) ? -1 : 0;
+
     } catch (const std::exception & excp) {
-        cm_del_vct(static_areas);
         exception_sc_errno(excp);
         return -1;
     }
+}
 
-    return 0;
+
+int sc_opt_struct_add_val_field(sc_opt_struct opts_struct,
+                                const off_t off,
+                                const enum sc_val_type type,
+                                const enum sc_val_pred predicate,
+                                const cm_vct * value,
+                                const cm_vct * value_hi) {
+
+    int ret;
+    struct sc::struct_field field;
+
+
+    //cast opaque handle into class
+    sc::opt_struct * o = static_cast<sc::opt_struct *>(opts_struct);
+
+    try {
+        //convert the C field to C++
+        field.off = off;
+        field.kind = sc::SF_VALUE;
+        field.type = static_cast<enum sc::val_type>(type);
+        field.predicate = static_cast<enum sc::val_pred>(predicate);
+
+        ret = c_iface::vct_from_cmore_vct<cm_byte, cm_byte>(
+            value, field.value, std::nullopt);
+        if (ret != 0) return -1;
+
+        if (value_hi != nullptr) {
+            ret = c_iface::vct_from_cmore_vct<cm_byte, cm_byte>(
+                value_hi, field.value_hi, std::nullopt);
+            if (ret != 0) return -1;
+        }
+
+        //append the field
+        std::vector<struct sc::struct_field> fields = o->get_fields();
+        fields.push_back(field);
+
+        ret = o->set_fields(fields);
+        return (ret != 0) ? -1 : 0;
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
 }
 
 
-int sc_opt_ptr_set_preset_offsets(sc_opt_ptr opts_ptr,
-                                      const cm_vct * preset_offsets) {
+int sc_opt_struct_add_ptr_field(sc_opt_struct opts_struct, const off_t off) {
 
-    //call generic setter
-    return _vector_setter<sc::opt_ptr, off_t, off_t>(
-        opts_ptr, preset_offsets,
-        &sc::opt_ptr::set_preset_offsets, std::nullopt);
+    int ret;
+    struct sc::struct_field field;
+
+
+    //cast opaque handle into class
+    sc::opt_struct * o = static_cast<sc::opt_struct *>(opts_struct);
+
+    try {
+        //only the offset of a pointer field is used
+        field.off = off;
+        field.kind = sc::SF_PTR;
+        field.type = sc::VT_U64;
+        field.predicate = sc::VP_EQ;
+
+        //append the field
+        std::vector<struct sc::struct_field> fields = o->get_fields();
+        fields.push_back(field);
+
+        ret = o->set_fields(fields);
+        return (ret != 0) ? -1 : 0;
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
 }
 
 
-int sc_opt_ptr_get_preset_offsets(const sc_opt_ptr opts_ptr,
-                                      cm_vct * preset_offsets) {
+size_t sc_opt_struct_get_fields_num(const sc_opt_struct opts_struct) {
 
-    //call generic getter
-    return _vector_getter<sc::opt_ptr, off_t, off_t>(
-        opts_ptr, preset_offsets,
-        &sc::opt_ptr::get_preset_offsets, std::nullopt);        
+    //cast opaque handle into class
+    sc::opt_struct * o = static_cast<sc::opt_struct *>(opts_struct);
+
+    //call getter
+    return o->get_fields().size();
 }
 
 
-int sc_opt_ptr_set_smart_scan(sc_opt_ptr opts_ptr,
-                                  const bool enable) {
+int sc_opt_struct_set_alignment(sc_opt_struct opts_struct,
+                                const off_t alignment) {
 
     int ret;
 
 
     //cast opaque handle into class
-    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+    sc::opt_struct * o = static_cast<sc::opt_struct *>(opts_struct);
 
     //perform the set
-    ret = o->set_smart_scan(enable);
+    if (alignment == 0x0) ret = o->set_alignment(std::nullopt);
+    else ret = o->set_alignment(alignment);
     return (ret != 0) ? -1 : 0;
 }
 
 
-bool sc_opt_ptr_get_smart_scan(const sc_opt_ptr opts_ptr) {
+off_t sc_opt_struct_get_alignment(const sc_opt_struct opts_struct) {
 
     //cast opaque handle into class
-    sc::opt_ptr * o = static_cast<sc::opt_ptr *>(opts_ptr);
+    sc::opt_struct * o = static_cast<sc::opt_struct *>(opts_struct);
 
-    //call getter
-    return o->get_smart_scan();
+    //return 0x0 if optional is not set
+    const std::optional<off_t> alignment = o->get_alignment();
+
+    if (alignment.has_value()) {
+        return alignment.value();
+    } else {
+        sc_errno = SC_ERR_OPT_EMPTY;
+        return 0x0;
+    }
 }
@@ -91,4 +91,134 @@ int sc_opt_ptr_set_smart_scan(sc_opt_ptr opts_ptr,
                                   const bool enable);
 bool sc_opt_ptr_get_smart_scan(const sc_opt_ptr opts_ptr);
 
+int sc_opt_ptr_set_target_addrs(sc_opt_ptr opts_ptr,
+                                    const cm_vct * target_addrs);
+int sc_opt_ptr_get_target_addrs(const sc_opt_ptr opts_ptr,
+                                    cm_vct * target_addrs);
+
+int sc_opt_ptr_set_max_chains(sc_opt_ptr opts_ptr,
+                                  const size_t max_chains);
+size_t sc_opt_ptr_get_max_chains(const sc_opt_ptr opts_ptr);
+
+int sc_opt_ptr_set_max_level_nodes(sc_opt_ptr opts_ptr,
+                                       const size_t max_level_nodes);
+size_t sc_opt_ptr_get_max_level_nodes(const sc_opt_ptr opts_ptr);
+
+int sc_opt_ptr_set_max_children(sc_opt_ptr opts_ptr,
+                                    const size_t max_children);
+size_t sc_opt_ptr_get_max_children(const sc_opt_ptr opts_ptr);
+
+int sc_opt_ptr_set_bidirectional(sc_opt_ptr opts_ptr,
+                                     const bool enable);
+bool sc_opt_ptr_get_bidirectional(const sc_opt_ptr opts_ptr);
+
+int sc_opt_ptr_set_checkpoint_path(sc_opt_ptr opts_ptr, const char * path);
+const char * sc_opt_ptr_get_checkpoint_path(const sc_opt_ptr opts_ptr);
+
+int sc_opt_ptr_set_spill_path(sc_opt_ptr opts_ptr, const char * path);
+const char * sc_opt_ptr_get_spill_path(const sc_opt_ptr opts_ptr);
+
+int sc_opt_ptr_set_max_neg_off(sc_opt_ptr opts_ptr,
+                                   const off_t max_neg_off);
+off_t sc_opt_ptr_get_max_neg_off(const sc_opt_ptr opts_ptr);
+
+int sc_opt_ptr_set_prefer_static(sc_opt_ptr opts_ptr,
+                                     const bool enable);
+bool sc_opt_ptr_get_prefer_static(const sc_opt_ptr opts_ptr);
+
+int sc_opt_ptr_set_max_array_run(sc_opt_ptr opts_ptr,
+                                     const size_t max_array_run);
+size_t sc_opt_ptr_get_max_array_run(const sc_opt_ptr opts_ptr);
+
+
+//sc_opt_val - external
+sc_opt_val sc_new_opt_val();
+sc_opt_val sc_copy_opt_val(const sc_opt_val opts_val);
+int sc_del_opt_val(sc_opt_val opts_val);
+int sc_opt_val_reset(sc_opt_val opts_val);
+
+int sc_opt_val_set_type(sc_opt_val opts_val,
+                        const enum sc_val_type type);
+int sc_opt_val_get_type(const sc_opt_val opts_val);
+
+int sc_opt_val_set_alignment(sc_opt_val opts_val,
+                             const off_t alignment);
+off_t sc_opt_val_get_alignment(const sc_opt_val opts_val);
+
+int sc_opt_val_set_value(sc_opt_val opts_val, const cm_vct * value);
+int sc_opt_val_get_value(const sc_opt_val opts_val, cm_vct * value);
+
+int sc_opt_val_set_predicate(sc_opt_val opts_val,
+                             const enum sc_val_pred predicate);
+enum sc_val_pred sc_opt_val_get_predicate(const sc_opt_val opts_val);
+
+int sc_opt_val_set_value_hi(sc_opt_val opts_val, const cm_vct * value_hi);
+int sc_opt_val_get_value_hi(const sc_opt_val opts_val, cm_vct * value_hi);
+
+int sc_opt_val_set_round(sc_opt_val opts_val,
+                         const enum sc_val_round round);
+enum sc_val_round sc_opt_val_get_round(const sc_opt_val opts_val);
+
+int sc_opt_val_set_epsilon(sc_opt_val opts_val, const double epsilon);
+double sc_opt_val_get_epsilon(const sc_opt_val opts_val);
+
+
+//sc_opt_ptn - external
+sc_opt_ptn sc_new_opt_ptn();
+sc_opt_ptn sc_copy_opt_ptn(const sc_opt_ptn opts_ptn);
+int sc_del_opt_ptn(sc_opt_ptn opts_ptn);
+int sc_opt_ptn_reset(sc_opt_ptn opts_ptn);
+
+int sc_opt_ptn_set_pattern(sc_opt_ptn opts_ptn, const cm_vct * pattern);
+int sc_opt_ptn_get_pattern(const sc_opt_ptn opts_ptn, cm_vct * pattern);
+
+int sc_opt_ptn_set_mask(sc_opt_ptn opts_ptn, const cm_vct * mask);
+int sc_opt_ptn_get_mask(const sc_opt_ptn opts_ptn, cm_vct * mask);
+
+int sc_opt_ptn_set_pattern_str(sc_opt_ptn opts_ptn,
+                               const char * pattern_str);
+
+int sc_opt_ptn_set_signatures(sc_opt_ptn opts_ptn,
+                              const sc_ptn_set signatures);
+sc_ptn_set sc_opt_ptn_get_signatures(const sc_opt_ptn opts_ptn);
+
+
+//sc_opt_str - external
+sc_opt_str sc_new_opt_str();
+sc_opt_str sc_copy_opt_str(const sc_opt_str opts_str);
+int sc_del_opt_str(sc_opt_str opts_str);
+int sc_opt_str_reset(sc_opt_str opts_str);
+
+int sc_opt_str_set_str(sc_opt_str opts_str, const char * str);
+const char * sc_opt_str_get_str(const sc_opt_str opts_str);
+
+int sc_opt_str_set_encodings(sc_opt_str opts_str, const cm_byte encodings);
+cm_byte sc_opt_str_get_encodings(const sc_opt_str opts_str);
+
+int sc_opt_str_set_case_insensitive(sc_opt_str opts_str, const bool enable);
+bool sc_opt_str_get_case_insensitive(const sc_opt_str opts_str);
+
+int sc_opt_str_set_null_term(sc_opt_str opts_str, const bool enable);
+bool sc_opt_str_get_null_term(const sc_opt_str opts_str);
+
+
+//sc_opt_struct - external
+sc_opt_struct sc_new_opt_struct();
+sc_opt_struct sc_copy_opt_struct(const sc_opt_struct opts_struct);
+int sc_del_opt_struct(sc_opt_struct opts_struct);
+int sc_opt_struct_reset(sc_opt_struct opts_struct);
+
+int sc_opt_struct_add_val_field(sc_opt_struct opts_struct,
+                                const off_t off,
+                                const enum sc_val_type type,
+                                const enum sc_val_pred predicate,
+                                const cm_vct * value,
+                                const cm_vct * value_hi);
+int sc_opt_struct_add_ptr_field(sc_opt_struct opts_struct, const off_t off);
+size_t sc_opt_struct_get_fields_num(const sc_opt_struct opts_struct);
+
+int sc_opt_struct_set_alignment(sc_opt_struct opts_struct,
+                                const off_t alignment);
+off_t sc_opt_struct_get_alignment(const sc_opt_struct opts_struct);
+
 } //extern "C"
@@ -0,0 +1,1611 @@
+//standard template library
+#include <optional>
+#include <memory>
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <algorithm>
+#include <iterator>
+#include <fstream>
+
+//C standard library
+#include <cstring>
+#include <cstdio>
+
+//external libraries
+#include <cmore.h>
+#include <memcry.h>
+
+//local headers
+#include "scancry.h"
+#include "ptnscan.hh"
+#include "fbuf_util.hh"
+#include "error.hh"
+
+
+
+      /* =============== *
+ ===== *  C++ INTERFACE  * =====
+       * =============== */
+
+/*
+ *  --- [INTERNAL] ---
+ */
+
+//positions compared by a single filter iteration, see `valscan.cc`
+#ifdef __AVX2__
+const constexpr size_t _ptn_vec_sz = 32;
+#else
+const constexpr size_t _ptn_vec_sz = 16;
+#endif
+
+
+//test if any lane of a block compare matched
+template <typename M>
+[[nodiscard]] _SC_DBG_STATIC _SC_DBG_INLINE bool _any_lane(const M found) {
+
+    uint64_t any = 0;
+
+
+    for (size_t i = 0; i < sizeof(M) / sizeof(uint64_t); ++i) any |= found[i];
+
+    return any != 0;
+}
+
+
+//bytes common in code & data, most common first
+const constexpr cm_byte _common_bytes[] = {
+    0x00, 0xFF, 0x48, 0x8B, 0x89, 0x0F, 0x24, 0x01, 0x20, 0x83,
+    0xE8, 0x4C, 0x8D, 0x44, 0x45, 0x85, 0x74, 0x75, 0xC0, 0x08,
+    0x10, 0x02, 0x04, 0x41, 0x65, 0xCC, 0x90, 0xC3, 0x0A, 0x80
+};
+
+
+//estimate how common a byte is in memory, lower is rarer
+[[nodiscard]] _SC_DBG_STATIC _SC_DBG_INLINE size_t _byte_rank(const cm_byte b) {
+
+    const size_t common_num = sizeof(_common_bytes) / sizeof(_common_bytes[0]);
+
+
+    for (size_t i = 0; i < common_num; ++i) {
+        if (_common_bytes[i] == b) return common_num - i;
+    }
+
+    return 0;
+}
+
+
+//find the rarest run of `sz` whole bytes of a pattern
+[[nodiscard]] _SC_DBG_STATIC bool _find_literal(
+                    const std::vector<cm_byte> & bytes,
+                    const std::vector<cm_byte> & mask,
+                    const size_t sz, size_t & lit_off) {
+
+    size_t rank, best_rank = SIZE_MAX;
+
+
+    for (size_t i = 0; i + sz <= bytes.size(); ++i) {
+
+        rank = 0;
+        for (size_t j = 0; j < sz; ++j) {
+
+            if (mask[i + j] != 0xFF) {
+                rank = SIZE_MAX;
+                break;
+            }
+            rank += _byte_rank(bytes[i + j]);
+        }
+
+        if (rank < best_rank) {
+            best_rank = rank;
+            lit_off = i;
+        }
+    }
+
+    return best_rank != SIZE_MAX;
+}
+
+
+//add a candidate for every literal filed under `key`
+_SC_DBG_STATIC void _add_cands(
+                    const std::vector<struct sc::_ptn_lit> & lits,
+                    const uint32_t key, const uintptr_t addr,
+                    const uintptr_t area_start,
+                    std::vector<std::pair<uintptr_t, uint32_t>> & cands) {
+
+    auto iter = std::lower_bound(lits.begin(), lits.end(), key,
+                                 [](const struct sc::_ptn_lit & lit,
+                                    const uint32_t key) {
+                                     return lit.key < key;
+                                 });
+
+    for (; iter != lits.end() && iter->key == key; ++iter) {
+
+        //skip patterns that would start before their area
+        if ((addr - area_start) < iter->lit_off) continue;
+        cands.emplace_back(addr - iter->lit_off, iter->ptn_idx);
+    }
+
+    return;
+}
+
+
+//append an array to the contents of a file
+template <typename T>
+_SC_DBG_STATIC void _put_array(std::vector<cm_byte> & buf,
+                               const T * src, const size_t num) {
+
+    const size_t off = buf.size();
+
+
+    if (num == 0) return;
+    buf.resize(off + (sizeof(T) * num));
+    std::memcpy(buf.data() + off, src, sizeof(T) * num);
+
+    return;
+}
+
+
+//read an array from the contents of a file
+template <typename T>
+[[nodiscard]] _SC_DBG_STATIC int _get_array(const std::vector<cm_byte> & buf,
+                                            size_t & off,
+                                            T * dst, const size_t num) {
+
+    if (num > ((buf.size() - off) / sizeof(T))) {
+        sc_errno = SC_ERR_INVALID_FILE;
+        return -1;
+    }
+
+    if (num == 0) return 0;
+    std::memcpy(dst, buf.data() + off, sizeof(T) * num);
+    off += sizeof(T) * num;
+
+    return 0;
+}
+
+
+//verify a candidate whose bytes may start in the previous buffer
+[[nodiscard]] _SC_DBG_STATIC _SC_DBG_INLINE bool _verify_cand(
+                    const sc::_ptn_filter & flt,
+                    const uint32_t ptn_idx, const uintptr_t start,
+                    const struct sc::_scan_arg & arg,
+                    const std::vector<cm_byte> & tail,
+                    std::vector<cm_byte> & window) {
+
+    size_t head_sz;
+
+
+    //the candidate lies inside this buffer
+    if (start >= arg.addr)
+        return flt.verify(ptn_idx, arg.cur_byte + (start - arg.addr));
+
+    //otherwise join the end of the tail to the start of this buffer
+    head_sz = arg.addr - start;
+    window.assign(tail.end() - head_sz, tail.end());
+    window.insert(window.end(), arg.cur_byte,
+                  arg.cur_byte + (flt.get_ptn_size(ptn_idx) - head_sz));
+
+    return flt.verify(ptn_idx, window.data());
+}
+
+
+
+/*
+ *  --- [PTN_MATCHER | PRIVATE] ---
+ */
+
+[[nodiscard]] bool sc::_ptn_matcher::verify(
+                        const cm_byte * pos) const noexcept {
+
+    if (this->exact == true)
+        return std::memcmp(pos, this->bytes.data(), this->bytes.size()) == 0;
+
+    for (size_t i = 0; i < this->bytes.size(); ++i) {
+        if (((pos[i] | this->fold[i]) & this->mask[i]) != this->bytes[i])
+            return false;
+    }
+
+    return true;
+}
+
+
+
+/*
+ *  --- [PTN_MATCHER | PUBLIC] ---
+ */
+
+sc::_ptn_matcher::_ptn_matcher()
+ : exact(true),
+   anchored(false),
+   anchors{0, 0} {}
+
+
+void sc::_ptn_matcher::compile(
+                    const std::vector<cm_byte> & pattern,
+                    const std::optional<std::vector<cm_byte>> & mask,
+                    const std::optional<std::vector<cm_byte>> & fold) {
+
+    size_t rank, best_rank[2] = {SIZE_MAX, SIZE_MAX};
+
+
+    //without a mask every bit must match, without a fold nothing folds
+    this->mask = mask.value_or(std::vector<cm_byte>(pattern.size(), 0xFF));
+    this->fold = fold.value_or(std::vector<cm_byte>(pattern.size(), 0x00));
+    this->bytes.resize(pattern.size());
+    this->exact = true;
+    for (size_t i = 0; i < pattern.size(); ++i) {
+
+        this->bytes[i] = (pattern[i] | this->fold[i]) & this->mask[i];
+        if (this->mask[i] != 0xFF || this->fold[i] != 0x00)
+            this->exact = false;
+    }
+
+    //pick the two rarest whole bytes as anchors
+    this->anchored = false;
+    for (size_t i = 0; i < pattern.size(); ++i) {
+
+        if (this->mask[i] != 0xFF) continue;
+        rank = _byte_rank(this->bytes[i]);
+
+        if (rank < best_rank[0]) {
+            best_rank[1] = best_rank[0];
+            this->anchors[1] = this->anchors[0];
+            best_rank[0] = rank;
+            this->anchors[0] = i;
+
+        } else if (rank < best_rank[1]) {
+            best_rank[1] = rank;
+            this->anchors[1] = i;
+        }
+        this->anchored = true;
+    }
+
+    //a single whole byte anchors twice
+    if (this->anchored == true && best_rank[1] == SIZE_MAX)
+        this->anchors[1] = this->anchors[0];
+
+    return;
+}
+
+
+void sc::_ptn_matcher::find(const cm_byte * buf, const size_t start_num,
+                            const uintptr_t addr,
+                            std::vector<uintptr_t> & matches) const {
+
+    typedef cm_byte _vec __attribute__((vector_size(_ptn_vec_sz)));
+    typedef int8_t _hits __attribute__((vector_size(_ptn_vec_sz)));
+    typedef uint64_t _mask __attribute__((vector_size(_ptn_vec_sz)));
+
+    size_t i = 0;
+
+
+    //filter blocks of positions on both anchors
+    if (this->anchored == true) {
+
+        const size_t a_0 = this->anchors[0];
+        const size_t a_1 = this->anchors[1];
+        const _vec needle_0 = (_vec){} + this->bytes[a_0];
+        const _vec needle_1 = (_vec){} + this->bytes[a_1];
+        const _vec fold_0 = (_vec){} + this->fold[a_0];
+        const _vec fold_1 = (_vec){} + this->fold[a_1];
+
+        _vec block_0, block_1;
+        _hits hits;
+        _mask found;
+
+        for (; i + _ptn_vec_sz <= start_num; i += _ptn_vec_sz) {
+
+            std::memcpy(&block_0, buf + i + a_0, sizeof(block_0));
+            std::memcpy(&block_1, buf + i + a_1, sizeof(block_1));
+            hits = ((block_0 | fold_0) == needle_0)
+                   & ((block_1 | fold_1) == needle_1);
+            found = (_mask) hits;
+            if (_any_lane(found) == false) continue;
+
+            for (size_t j = 0; j < _ptn_vec_sz; ++j) {
+                if (hits[j] == 0) continue;
+                if (this->verify(buf + i + j) == true)
+                    matches.push_back(addr + i + j);
+            }
+        }
+    }
+
+    //verify the remaining positions one at a time
+    for (; i < start_num; ++i) {
+
+        if (this->anchored == true
+            && (buf[i + this->anchors[0]] | this->fold[this->anchors[0]])
+               != this->bytes[this->anchors[0]])
+            continue;
+        if (this->verify(buf + i) == true) matches.push_back(addr + i);
+    }
+
+    return;
+}
+
+
+void sc::_ptn_matcher::search(const cm_byte * cur_byte, const uintptr_t addr,
+                              const size_t avail, const size_t adv,
+                              const bool area_end, std::vector<cm_byte> & tail,
+                              std::vector<uintptr_t> & matches) const {
+
+    size_t seam_sz, tail_sz, start_num;
+
+    const size_t ptn_sz = this->bytes.size();
+
+
+    //finish the positions left over by the previous buffer
+    if (tail.empty() == false) {
+
+        tail_sz = tail.size();
+        seam_sz = std::min(ptn_sz - 1, avail);
+        tail.insert(tail.end(), cur_byte, cur_byte + seam_sz);
+
+        if (tail.size() >= ptn_sz) {
+            this->find(tail.data(), std::min(tail_sz, tail.size() - ptn_sz + 1),
+                       addr - tail_sz, matches);
+        }
+        tail.clear();
+    }
+
+    //search the positions whose match fits inside this buffer
+    start_num = (avail < ptn_sz) ? 0 : std::min(adv, avail - ptn_sz + 1);
+    if (start_num != 0) this->find(cur_byte, start_num, addr, matches);
+
+    //keep the other positions for the next buffer
+    if (start_num < adv && area_end == false)
+        tail.assign(cur_byte + start_num, cur_byte + adv);
+
+    return;
+}
+
+
+[[nodiscard]] size_t sc::_ptn_matcher::get_size() const noexcept {
+
+    return this->bytes.size();
+}
+
+
+
+/*
+ *  --- [PTN_FILTER | PRIVATE] ---
+ */
+
+void sc::_ptn_filter::fill_bitmaps() {
+
+    uint32_t key;
+
+
+    this->gram_bitmap.assign(((size_t) 1 << this->hash_bits) / 64, 0);
+    for (auto iter = this->gram_lits.cbegin();
+         iter != this->gram_lits.cend(); ++iter) {
+
+        key = iter->key;
+        this->gram_bitmap[key / 64] |= (uint64_t) 1 << (key % 64);
+    }
+
+    std::memset(this->byte_bitmap, 0, sizeof(this->byte_bitmap));
+    for (auto iter = this->byte_lits.cbegin();
+         iter != this->byte_lits.cend(); ++iter) {
+
+        key = iter->key;
+        this->byte_bitmap[key / 64] |= (uint64_t) 1 << (key % 64);
+    }
+
+    return;
+}
+
+
+
+/*
+ *  --- [PTN_FILTER | PUBLIC] ---
+ */
+
+sc::_ptn_filter::_ptn_filter()
+ : max_sz(0),
+   hash_bits(sc::_ptn_hash_bits_min),
+   byte_bitmap{0, 0, 0, 0},
+   compiled(false) {}
+
+
+void sc::_ptn_filter::clear() {
+
+    this->bytes.clear();
+    this->masks.clear();
+    this->max_sz = 0;
+
+    this->hash_bits = sc::_ptn_hash_bits_min;
+    this->gram_bitmap.clear();
+    this->gram_lits.clear();
+    std::memset(this->byte_bitmap, 0, sizeof(this->byte_bitmap));
+    this->byte_lits.clear();
+    this->unanchored.clear();
+    this->compiled = false;
+
+    return;
+}
+
+
+[[nodiscard]] size_t sc::_ptn_filter::add(
+                    const std::vector<cm_byte> & pattern,
+                    const std::optional<std::vector<cm_byte>> & mask) {
+
+    //without a mask every bit must match
+    this->masks.push_back(
+        mask.value_or(std::vector<cm_byte>(pattern.size(), 0xFF)));
+    this->bytes.push_back(pattern);
+    for (size_t i = 0; i < pattern.size(); ++i)
+        this->bytes.back()[i] &= this->masks.back()[i];
+
+    this->max_sz = std::max(this->max_sz, pattern.size());
+    this->compiled = false;
+
+    return this->bytes.size() - 1;
+}
+
+
+void sc::_ptn_filter::compile() {
+
+    size_t lit_off;
+
+
+    this->gram_lits.clear();
+    this->byte_lits.clear();
+    this->unanchored.clear();
+
+    //pick the literal of every pattern
+    for (uint32_t i = 0; i < this->bytes.size(); ++i) {
+
+        lit_off = 0;
+        if (_find_literal(this->bytes[i], this->masks[i],
+                          sc::_ptn_gram_sz, lit_off) == true) {
+            this->gram_lits.push_back({0, i, (uint32_t) lit_off});
+
+        } else if (_find_literal(this->bytes[i], this->masks[i],
+                                 1, lit_off) == true) {
+            this->byte_lits.push_back(
+                {this->bytes[i][lit_off], i, (uint32_t) lit_off});
+
+        } else {
+            this->unanchored.push_back(i);
+        }
+    }
+
+    //keep the bitmap sparse so few positions are false candidates
+    this->hash_bits = sc::_ptn_hash_bits_min;
+    while (this->hash_bits < sc::_ptn_hash_bits_max
+           && ((size_t) 1 << this->hash_bits) < this->gram_lits.size() * 512)
+        ++this->hash_bits;
+
+    for (auto iter = this->gram_lits.begin();
+         iter != this->gram_lits.end(); ++iter) {
+        iter->key = this->hash(this->bytes[iter->ptn_idx].data()
+                               + iter->lit_off);
+    }
+
+    //file the literals by their key
+    std::sort(this->gram_lits.begin(), this->gram_lits.end(),
+              [](const struct _ptn_lit & a, const struct _ptn_lit & b) {
+                  return a.key < b.key;
+              });
+    std::sort(this->byte_lits.begin(), this->byte_lits.end(),
+              [](const struct _ptn_lit & a, const struct _ptn_lit & b) {
+                  return a.key < b.key;
+              });
+
+    this->fill_bitmaps();
+    this->compiled = true;
+
+    return;
+}
+
+
+[[nodiscard]] uint32_t sc::_ptn_filter::hash(
+                        const cm_byte * pos) const noexcept {
+
+    uint32_t gram;
+
+
+    std::memcpy(&gram, pos, sizeof(gram));
+    return (gram * (uint32_t) 0x9E3779B1) >> (32 - this->hash_bits);
+}
+
+
+[[nodiscard]] bool sc::_ptn_filter::verify(
+                        const uint32_t ptn_idx,
+                        const cm_byte * pos) const noexcept {
+
+    const std::vector<cm_byte> & ptn_bytes = this->bytes[ptn_idx];
+    const std::vector<cm_byte> & ptn_mask = this->masks[ptn_idx];
+
+
+    for (size_t i = 0; i < ptn_bytes.size(); ++i) {
+        if ((pos[i] & ptn_mask[i]) != ptn_bytes[i]) return false;
+    }
+
+    return true;
+}
+
+
+/*
+ *  NOTE: A compiled set file holds, in order:
+ *
+ *          [ magic & version                           ]
+ *          [ patterns: size, then bytes & mask of each ]
+ *          [ size of the literal hash, in bits         ]
+ *          [ literals filtered on their hash           ]
+ *          [ literals filtered on a single byte        ]
+ *          [ indeces of patterns without a literal     ]
+ *
+ *        Every count is a 32bit integer preceding its array. The
+ *        bitmaps are rebuilt from the literals when the file is read.
+ */
+
+void sc::_ptn_filter::pack(std::vector<cm_byte> & buf) const {
+
+    uint32_t num;
+
+
+    buf.clear();
+    _put_array(buf, sc::_ptn_set_magic, sc::file_magic_sz);
+    _put_array(buf, &sc::_ptn_set_ver_cur, 1);
+
+    //patterns
+    num = this->bytes.size();
+    _put_array(buf, &num, 1);
+    for (size_t i = 0; i < this->bytes.size(); ++i) {
+
+        num = this->bytes[i].size();
+        _put_array(buf, &num, 1);
+        _put_array(buf, this->bytes[i].data(), num);
+        _put_array(buf, this->masks[i].data(), num);
+    }
+
+    //literals
+    _put_array(buf, &this->hash_bits, 1);
+
+    num = this->gram_lits.size();
+    _put_array(buf, &num, 1);
+    _put_array(buf, this->gram_lits.data(), num);
+
+    num = this->byte_lits.size();
+    _put_array(buf, &num, 1);
+    _put_array(buf, this->byte_lits.data(), num);
+
+    num = this->unanchored.size();
+    _put_array(buf, &num, 1);
+    _put_array(buf, this->unanchored.data(), num);
+
+    return;
+}
+
+
+[[nodiscard]] int sc::_ptn_filter::unpack(
+                        const std::vector<cm_byte> & buf) {
+
+    int ret;
+    size_t off = 0;
+    uint32_t num, ptn_sz;
+    cm_byte magic[sc::file_magic_sz], version;
+
+    std::vector<cm_byte> ptn_bytes, ptn_mask;
+
+
+    this->clear();
+
+    //check the file holds a compiled set this version can read
+    ret = _get_array(buf, off, magic, sc::file_magic_sz);
+    if (ret != 0) return -1;
+    ret = _get_array(buf, off, &version, 1);
+    if (ret != 0) return -1;
+
+    if (std::memcmp(magic, sc::_ptn_set_magic, sc::file_magic_sz) != 0) {
+        sc_errno = SC_ERR_INVALID_FILE;
+        return -1;
+    }
+    if (version > sc::_ptn_set_ver_cur) {
+        sc_errno = SC_ERR_VERSION_FILE;
+        return -1;
+    }
+
+    //patterns
+    ret = _get_array(buf, off, &num, 1);
+    if (ret != 0) return -1;
+    for (uint32_t i = 0; i < num; ++i) {
+
+        ret = _get_array(buf, off, &ptn_sz, 1);
+        if (ret != 0) return -1;
+        if (ptn_sz == 0 || ptn_sz > sc::_ptn_max_sz) goto _unpack_fail;
+
+        ptn_bytes.resize(ptn_sz);
+        ptn_mask.resize(ptn_sz);
+        ret = _get_array(buf, off, ptn_bytes.data(), ptn_sz);
+        if (ret != 0) return -1;
+        ret = _get_array(buf, off, ptn_mask.data(), ptn_sz);
+        if (ret != 0) return -1;
+
+        (void) this->add(ptn_bytes, ptn_mask);
+    }
+
+    //literals
+    ret = _get_array(buf, off, &this->hash_bits, 1);
+    if (ret != 0) return -1;
+    if (this->hash_bits < sc::_ptn_hash_bits_min
+        || this->hash_bits > sc::_ptn_hash_bits_max) goto _unpack_fail;
+
+    ret = _get_array(buf, off, &num, 1);
+    if (ret != 0) return -1;
+    if (num > this->bytes.size()) goto _unpack_fail;
+    this->gram_lits.resize(num);
+    ret = _get_array(buf, off, this->gram_lits.data(), num);
+    if (ret != 0) return -1;
+
+    ret = _get_array(buf, off, &num, 1);
+    if (ret != 0) return -1;
+    if (num > this->bytes.size()) goto _unpack_fail;
+    this->byte_lits.resize(num);
+    ret = _get_array(buf, off, this->byte_lits.data(), num);
+    if (ret != 0) return -1;
+
+    ret = _get_array(buf, off, &num, 1);
+    if (ret != 0) return -1;
+    if (num > this->bytes.size()) goto _unpack_fail;
+    this->unanchored.resize(num);
+    ret = _get_array(buf, off, this->unanchored.data(), num);
+    if (ret != 0) return -1;
+
+    if (off != buf.size()) goto _unpack_fail;
+
+    //check every literal is filed under the key of its bytes
+    for (size_t i = 0; i < this->gram_lits.size(); ++i) {
+
+        const struct _ptn_lit & lit = this->gram_lits[i];
+        if (lit.ptn_idx >= this->bytes.size()
+            || ((size_t) lit.lit_off + sc::_ptn_gram_sz)
+               > this->bytes[lit.ptn_idx].size()
+            || lit.key != this->hash(this->bytes[lit.ptn_idx].data()
+                                     + lit.lit_off)
+            || (i != 0 && lit.key < this->gram_lits[i - 1].key))
+            goto _unpack_fail;
+    }
+
+    for (size_t i = 0; i < this->byte_lits.size(); ++i) {
+
+        const struct _ptn_lit & lit = this->byte_lits[i];
+        if (lit.ptn_idx >= this->bytes.size()
+            || lit.lit_off >= this->bytes[lit.ptn_idx].size()
+            || lit.key != this->bytes[lit.ptn_idx][lit.lit_off]
+            || (i != 0 && lit.key < this->byte_lits[i - 1].key))
+            goto _unpack_fail;
+    }
+
+    for (size_t i = 0; i < this->unanchored.size(); ++i) {
+        if (this->unanchored[i] >= this->bytes.size()) goto _unpack_fail;
+    }
+
+    this->fill_bitmaps();
+    this->compiled = true;
+    return 0;
+
+    _unpack_fail:
+    sc_errno = SC_ERR_INVALID_FILE;
+    return -1;
+}
+
+
+[[nodiscard]] size_t sc::_ptn_filter::get_ptns_num() const noexcept {
+
+    return this->bytes.size();
+}
+
+
+[[nodiscard]] size_t sc::_ptn_filter::get_ptn_size(
+                        const uint32_t ptn_idx) const noexcept {
+
+    return this->bytes[ptn_idx].size();
+}
+
+
+[[nodiscard]] size_t sc::_ptn_filter::get_max_size() const noexcept {
+
+    return this->max_sz;
+}
+
+
+[[nodiscard]] bool sc::_ptn_filter::is_compiled() const noexcept {
+
+    return this->compiled;
+}
+
+
+[[nodiscard]] const uint64_t *
+    sc::_ptn_filter::get_gram_bitmap() const noexcept {
+
+    return this->gram_bitmap.data();
+}
+
+
+[[nodiscard]] const std::vector<struct sc::_ptn_lit> &
+    sc::_ptn_filter::get_gram_lits() const noexcept {
+
+    return this->gram_lits;
+}
+
+
+[[nodiscard]] const uint64_t *
+    sc::_ptn_filter::get_byte_bitmap() const noexcept {
+
+    return this->byte_bitmap;
+}
+
+
+[[nodiscard]] const std::vector<struct sc::_ptn_lit> &
+    sc::_ptn_filter::get_byte_lits() const noexcept {
+
+    return this->byte_lits;
+}
+
+
+[[nodiscard]] const std::vector<uint32_t> &
+    sc::_ptn_filter::get_unanchored() const noexcept {
+
+    return this->unanchored;
+}
+
+
+
+/*
+ *  --- [PTN_SET | PUBLIC] ---
+ */
+
+sc::ptn_set::ptn_set()
+ : _lockable(),
+   filter_p(std::make_unique<sc::_ptn_filter>()) {}
+
+
+sc::ptn_set::ptn_set(const ptn_set & p_set)
+ : _lockable(),
+   filter_p(std::make_unique<sc::_ptn_filter>(*p_set.filter_p)) {}
+
+
+sc::ptn_set::~ptn_set() {}
+
+
+[[nodiscard]] int sc::ptn_set::reset() {
+
+    _LOCK(-1)
+    this->filter_p->clear();
+    _UNLOCK(-1)
+
+    return 0;
+}
+
+
+[[nodiscard]] ssize_t sc::ptn_set::add_pattern(
+                    const std::vector<cm_byte> & pattern,
+                    const std::optional<std::vector<cm_byte>> & mask) {
+
+    size_t ptn_idx;
+
+
+    //check the pattern is usable & the mask matches it
+    if (pattern.empty() == true || pattern.size() > sc::_ptn_max_sz
+        || (mask.has_value() == true && mask->size() != pattern.size())) {
+
+        sc_errno = SC_ERR_OPT_PATTERN;
+        return -1;
+    }
+
+    _LOCK(-1)
+    ptn_idx = this->filter_p->add(pattern, mask);
+    _UNLOCK(-1)
+
+    return ptn_idx;
+}
+
+
+[[nodiscard]] ssize_t sc::ptn_set::add_pattern_str(
+                    const std::string & pattern_str) {
+
+    int ret;
+    sc::opt_ptn opts_ptn;
+
+
+    //parse the pattern like a single pattern scan would
+    ret = opts_ptn.set_pattern_str(pattern_str);
+    if (ret != 0) return -1;
+
+    return this->add_pattern(opts_ptn.get_pattern().value(),
+                             opts_ptn.get_mask());
+}
+
+
+[[nodiscard]] int sc::ptn_set::compile() {
+
+    _LOCK(-1)
+    this->filter_p->compile();
+    _UNLOCK(-1)
+
+    return 0;
+}
+
+
+[[nodiscard]] int sc::ptn_set::save(const std::string & file_path) {
+
+    int ret;
+    std::ofstream fs;
+    std::vector<cm_byte> buf;
+
+    const std::string tmp_path = file_path + ".tmp";
+
+
+    _LOCK(-1)
+
+    //compile the set if it changed since it was last compiled
+    if (this->filter_p->is_compiled() == false)
+        this->filter_p->compile();
+    this->filter_p->pack(buf);
+
+    //write the compiled set next to the file, a failed write then leaves
+    //a previously saved set untouched
+    fs = std::ofstream(tmp_path, std::ios::out | std::ios::binary);
+    if (fs.fail() == true) goto _save_file_fail;
+
+    fs.write(reinterpret_cast<const char *>(buf.data()), buf.size());
+    if (fs.fail() == true) goto _save_file_fail;
+
+    fs.close();
+    if (fs.fail() == true) goto _save_file_fail;
+
+    //replace the file
+    ret = std::rename(tmp_path.c_str(), file_path.c_str());
+    if (ret != 0) goto _save_file_fail;
+
+    _UNLOCK(-1)
+    return 0;
+
+    _save_file_fail:
+    fs.close();
+    std::remove(tmp_path.c_str());
+    sc_errno = SC_ERR_FILE;
+    _UNLOCK(-1)
+    return -1;
+}
+
+
+[[nodiscard]] int sc::ptn_set::load(const std::string & file_path) {
+
+    int ret;
+
+    std::ifstream fs;
+    std::vector<cm_byte> buf;
+    std::unique_ptr<sc::_ptn_filter> new_filter_p;
+
+
+    //read the compiled set
+    fs = std::ifstream(file_path, std::ios::in | std::ios::binary);
+    if (fs.fail() == true) {
+        sc_errno = SC_ERR_FILE;
+        return -1;
+    }
+
+    buf = std::vector<cm_byte>(std::istreambuf_iterator<char>(fs),
+                               std::istreambuf_iterator<char>());
+    fs.close();
+
+    //a malformed file leaves the set as it was
+    new_filter_p = std::make_unique<sc::_ptn_filter>();
+    ret = new_filter_p->unpack(buf);
+    if (ret != 0) return -1;
+
+    _LOCK(-1)
+    this->filter_p = std::move(new_filter_p);
+    _UNLOCK(-1)
+
+    return 0;
+}
+
+
+[[nodiscard]] size_t sc::ptn_set::get_ptns_num() const noexcept {
+
+    return this->filter_p->get_ptns_num();
+}
+
+
+[[nodiscard]] bool sc::ptn_set::is_compiled() const noexcept {
+
+    return this->filter_p->is_compiled();
+}
+
+
+[[nodiscard]] const sc::_ptn_filter &
+    sc::ptn_set::_get_filter() const noexcept {
+
+    return *this->filter_p;
+}
+
+
+
+/*
+ *  --- [PTNSCAN | PRIVATE] ---
+ */
+
+void sc::ptnscan::do_reset() {
+
+    this->addrs.clear();
+    this->addrs.shrink_to_fit();
+    this->filter_p = nullptr;
+    this->area_addrs.clear();
+    this->area_tails.clear();
+    this->area_pending.clear();
+
+    return;
+}
+
+
+/*
+ *  NOTE: Candidates are kept per area until their bytes are available.
+ *        The tail of an area keeps enough of the bytes already searched
+ *        to verify candidates that start in a previous buffer.
+ */
+
+void sc::ptnscan::search_set(const struct _scan_arg & arg,
+                             const uintptr_t area_start,
+                             const size_t avail, const size_t adv,
+                             const bool area_end) {
+
+    uint32_t key, ptn_idx;
+    uintptr_t start;
+    size_t gram_num, kept, tail_max;
+
+    std::vector<cm_byte> window;
+
+
+    const sc::_ptn_filter & flt = *this->filter_p;
+    const uint64_t * gram_bitmap = flt.get_gram_bitmap();
+    const uint64_t * byte_bitmap = flt.get_byte_bitmap();
+    const std::vector<struct sc::_ptn_lit> & gram_lits = flt.get_gram_lits();
+    const std::vector<struct sc::_ptn_lit> & byte_lits = flt.get_byte_lits();
+    const std::vector<uint32_t> & unanchored = flt.get_unanchored();
+    const uintptr_t buf_end = arg.addr + avail;
+
+    auto addrs_iter = this->area_addrs.find(arg.area_node);
+    auto tail_iter = this->area_tails.find(arg.area_node);
+    auto pending_iter = this->area_pending.find(arg.area_node);
+    if (addrs_iter == this->area_addrs.end()
+        || tail_iter == this->area_tails.end()
+        || pending_iter == this->area_pending.end()) return;
+
+    std::vector<std::vector<uintptr_t>> & addrs = addrs_iter->second;
+    std::vector<cm_byte> & tail = tail_iter->second;
+    std::vector<std::pair<uintptr_t, uint32_t>> & pending
+        = pending_iter->second;
+
+    //hash every position that holds a whole literal
+    gram_num = (avail < sc::_ptn_gram_sz)
+               ? 0 : std::min(adv, avail - sc::_ptn_gram_sz + 1);
+    if (gram_lits.empty() == false) {
+        for (size_t i = 0; i < gram_num; ++i) {
+
+            key = flt.hash(arg.cur_byte + i);
+            if (((gram_bitmap[key / 64] >> (key % 64)) & 1) == 0) continue;
+            _add_cands(gram_lits, key, arg.addr + i, area_start, pending);
+        }
+    }
+
+    //test every position against the single byte literals
+    if (byte_lits.empty() == false) {
+        for (size_t i = 0; i < adv; ++i) {
+
+            key = arg.cur_byte[i];
+            if (((byte_bitmap[key / 64] >> (key % 64)) & 1) == 0) continue;
+            _add_cands(byte_lits, key, arg.addr + i, area_start, pending);
+        }
+    }
+
+    //every position is a candidate for patterns without a literal
+    for (size_t i = 0; i < unanchored.size(); ++i) {
+        for (size_t j = 0; j < adv; ++j)
+            pending.emplace_back(arg.addr + j, unanchored[i]);
+    }
+
+    //verify candidates whose bytes are available, keep the rest
+    kept = 0;
+    for (size_t i = 0; i < pending.size(); ++i) {
+
+        start = pending[i].first;
+        ptn_idx = pending[i].second;
+
+        if (start + flt.get_ptn_size(ptn_idx) > buf_end) {
+            if (area_end == false) pending[kept++] = pending[i];
+            continue;
+        }
+
+        if (_verify_cand(flt, ptn_idx, start, arg, tail, window) == true)
+            addrs[ptn_idx].push_back(start);
+    }
+    pending.resize(kept);
+
+    //keep the end of the bytes searched for the next buffer
+    if (area_end == true) return;
+
+    tail_max = flt.get_max_size() - 1;
+    if (adv >= tail_max) {
+        tail.assign(arg.cur_byte + (adv - tail_max), arg.cur_byte + adv);
+
+    } else {
+        tail.insert(tail.end(), arg.cur_byte, arg.cur_byte + adv);
+        if (tail.size() > tail_max)
+            tail.erase(tail.begin(), tail.end() - tail_max);
+    }
+
+    return;
+}
+
+
+/*
+ *  NOTE: Without a map every match is read. With a map, matches whose
+ *        address is no longer mapped are dropped.
+ */
+
+[[nodiscard]] int sc::ptnscan::read_addrs(const std::vector<cm_byte> & buf,
+                                          const mc_vm_map * map) {
+
+    off_t buf_off = 0;
+    std::optional<uint32_t> addrs_num;
+    std::optional<uint64_t> addr;
+    std::optional<cm_byte> end_byte;
+
+
+    //fetch the ptnscan header
+    std::optional<struct ptn_file_hdr> local_hdr
+        = fbuf_util::unpack_type<struct ptn_file_hdr>(buf, buf_off);
+    if (local_hdr.has_value() == false || local_hdr->ptns_num == 0
+        || local_hdr->ptns_num > (buf.size() / sizeof(uint32_t)))
+        goto _read_addrs_fail;
+
+    //fetch the matches of each pattern
+    this->addrs.resize(local_hdr->ptns_num);
+    for (uint32_t i = 0; i < local_hdr->ptns_num; ++i) {
+
+        addrs_num = fbuf_util::unpack_type<uint32_t>(buf, buf_off);
+        if (addrs_num.has_value() == false) goto _read_addrs_fail;
+
+        for (uint32_t j = 0; j < addrs_num.value(); ++j) {
+
+            addr = fbuf_util::unpack_type<uint64_t>(buf, buf_off);
+            if (addr.has_value() == false) goto _read_addrs_fail;
+
+            if (map != nullptr
+                && mc_get_area_by_addr(map, addr.value(), nullptr) == nullptr)
+                continue;
+
+            this->addrs[i].push_back((uintptr_t) addr.value());
+        }
+    }
+
+    //check the file is terminated
+    end_byte = fbuf_util::unpack_type<cm_byte>(buf, buf_off);
+    if (end_byte.has_value() == false || end_byte != fbuf_util::_file_end)
+        goto _read_addrs_fail;
+
+    return 0;
+
+    _read_addrs_fail:
+    this->addrs.clear();
+    sc_errno = SC_ERR_INVALID_FILE;
+    return -1;
+}
+
+
+
+/*
+ *  --- [PTNSCAN | PUBLIC] ---
+ */
+
+/*
+ *  NOTE: Every call searches the rest of the read buffer and returns
+ *        an advance that leaves only the overlap of `addr_width` bytes
+ *        for the next read. Positions whose match would run past the
+ *        buffer are kept in the tail of their area, and verified once
+ *        the next buffer supplies the rest of their bytes.
+ */
+
+[[nodiscard]] off_t sc::ptnscan::_process_addr(
+                                    const struct _scan_arg arg,
+                                    const opt * const opts,
+                                    const _opt_scan * const opts_scan) {
+
+    size_t area_left, avail, adv;
+
+
+    const mc_vm_area * area = MC_GET_NODE_AREA(arg.area_node);
+
+    area_left = area->end_addr - arg.addr;
+
+    //last buffer of this area, search up to the end of the area
+    if (area_left <= arg.buf_left) {
+        avail = area_left;
+        adv = area_left;
+
+    //otherwise leave the buffer overlap for the next read
+    } else {
+        avail = arg.buf_left;
+        adv = arg.buf_left - opts->addr_width;
+    }
+
+    //search every pattern of a set at once
+    if (this->filter_p != nullptr) {
+        this->search_set(arg, area->start_addr, avail, adv, adv == area_left);
+        return adv;
+    }
+
+    auto addrs_iter = this->area_addrs.find(arg.area_node);
+    auto tail_iter = this->area_tails.find(arg.area_node);
+    if (addrs_iter == this->area_addrs.end()
+        || tail_iter == this->area_tails.end()) return adv;
+
+    this->matcher_p->search(arg.cur_byte, arg.addr, avail, adv,
+                            adv == area_left, tail_iter->second,
+                            addrs_iter->second[0]);
+
+    return adv;
+}
+
+
+[[nodiscard]] int sc::ptnscan::_generate_body(
+    std::vector<cm_byte> & buf, const off_t hdr_off) {
+
+    int ret;
+    struct sc::ptn_file_hdr local_hdr;
+
+    uint32_t addrs_num;
+    cm_byte ctrl_byte;
+    off_t buf_off = 0;
+
+
+    //lock scanner
+    _LOCK(-1)
+
+    //build local header
+    local_hdr.ptns_num = this->addrs.size();
+    local_hdr.addrs_num = 0;
+    local_hdr.addrs_offset = hdr_off + sizeof(local_hdr);
+    for (auto iter = this->addrs.cbegin(); iter != this->addrs.cend(); ++iter)
+        local_hdr.addrs_num += iter->size();
+
+    //check the scan contains a result to serialise
+    if (local_hdr.addrs_num == 0) {
+        sc_errno = SC_ERR_NO_RESULT;
+        goto _generate_body_fail;
+    }
+
+    //allocate space for the header, the matches of every pattern
+    //& the file end byte
+    buf.resize(sizeof(local_hdr)
+               + (local_hdr.ptns_num * sizeof(uint32_t))
+               + (local_hdr.addrs_num * sizeof(uint64_t)) + 1);
+
+    //store the header
+    ret = fbuf_util::pack_type<struct ptn_file_hdr>(buf, buf_off, local_hdr);
+    if (ret != 0) goto _generate_body_fail;
+
+    //store the number of matches & every match of each pattern
+    for (auto iter = this->addrs.cbegin();
+         iter != this->addrs.cend(); ++iter) {
+
+        addrs_num = iter->size();
+        ret = fbuf_util::pack_type<uint32_t>(buf, buf_off, addrs_num);
+        if (ret != 0) goto _generate_body_fail;
+
+        for (auto addr_iter = iter->cbegin();
+             addr_iter != iter->cend(); ++addr_iter) {
+
+            ret = fbuf_util::pack_type<uint64_t>(buf, buf_off, *addr_iter);
+            if (ret != 0) goto _generate_body_fail;
+        }
+    }
+
+    //store the file end byte
+    ctrl_byte = fbuf_util::_file_end;
+    ret = fbuf_util::pack_type(buf, buf_off, ctrl_byte);
+    if (ret != 0) goto _generate_body_fail;
+
+    _UNLOCK(-1)
+    return 0;
+
+    _generate_body_fail:
+    _UNLOCK(-1)
+    return -1;
+}
+
+
+[[nodiscard]] int sc::ptnscan::_process_body(
+    const std::vector<cm_byte> & buf, off_t hdr_off,
+    const cm_byte version, const mc_vm_map & map) {
+
+    int ret;
+
+
+    _LOCK(-1)
+    ret = this->read_addrs(buf, &map);
+    _UNLOCK(-1)
+
+    return (ret != 0) ? -1 : 0;
+}
+
+
+[[nodiscard]] int sc::ptnscan::_read_body(
+    const std::vector<cm_byte> & buf, off_t hdr_off, const cm_byte version) {
+
+    int ret;
+
+
+    _LOCK(-1)
+    ret = this->read_addrs(buf, nullptr);
+    _UNLOCK(-1)
+
+    return (ret != 0) ? -1 : 0;
+}
+
+
+sc::ptnscan::ptnscan()
+ : _scan(),
+   matcher_p(std::make_unique<sc::_ptn_matcher>()),
+   filter_p(nullptr) {}
+
+
+sc::ptnscan::~ptnscan() {}
+
+
+[[nodiscard]] int sc::ptnscan::reset() {
+
+    _LOCK(-1);
+    this->do_reset();
+    _UNLOCK(-1);
+
+    return 0;
+}
+
+
+[[nodiscard]] int sc::ptnscan::scan(sc::opt & opts,
+                                    sc::opt_ptn & opts_ptn,
+                                    sc::map_area_set & ma_set,
+                                    worker_pool & w_pool,
+                                    const cm_byte flags) {
+
+    int ret;
+    bool run_err = false;
+
+    size_t ptns_num, addrs_num;
+    sc::ptn_set * signatures;
+
+
+    //lock the scan
+    _LOCK(-1)
+
+    //every scan starts from an empty result
+    this->do_reset();
+
+    //lock options
+    ret = opts._lock();
+    if (ret != 0) {
+        run_err = true;
+        goto _scan_ret;
+    }
+
+    //lock ptnscan options
+    ret = opts_ptn._lock();
+    if (ret != 0) {
+        run_err = true;
+        goto _scan_unlock_opts;
+    }
+
+    //lock the pattern set
+    signatures = opts_ptn.get_signatures();
+    if (signatures != nullptr) {
+        ret = signatures->_lock();
+        if (ret != 0) {
+            run_err = true;
+            goto _scan_unlock_opts_ptn;
+        }
+    }
+
+    //lock the map areas set
+    ret = ma_set._lock();
+    if (ret != 0) {
+        run_err = true;
+        goto _scan_unlock_signatures;
+    }
+
+    //check all necessary options have been set
+    if ((opts_ptn.get_pattern().has_value() == false && signatures == nullptr)
+        || opts.get_map() == nullptr) {
+
+        sc_errno = SC_ERR_OPT_MISSING;
+        run_err = true;
+        goto _scan_unlock_all;
+    }
+
+    //prepare the pattern set
+    if (signatures != nullptr) {
+
+        //check the set holds compiled patterns
+        if (signatures->is_compiled() == false
+            || signatures->get_ptns_num() == 0) {
+
+            sc_errno = SC_ERR_OPT_PATTERN;
+            run_err = true;
+            goto _scan_unlock_all;
+        }
+
+        this->filter_p = &signatures->_get_filter();
+        ptns_num = signatures->get_ptns_num();
+
+    //otherwise prepare the single pattern
+    } else {
+
+        //check the pattern is usable & the mask matches it
+        if (opts_ptn.get_pattern()->empty() == true
+            || opts_ptn.get_pattern()->size() > sc::_ptn_max_sz
+            || (opts_ptn.get_mask().has_value() == true
+                && opts_ptn.get_mask()->size()
+                   != opts_ptn.get_pattern()->size())) {
+
+            sc_errno = SC_ERR_OPT_PATTERN;
+            run_err = true;
+            goto _scan_unlock_all;
+        }
+
+        this->matcher_p->compile(opts_ptn.get_pattern().value(),
+                                 opts_ptn.get_mask());
+        ptns_num = 1;
+    }
+
+    //one buffer per area, every area is scanned by a single worker
+    for (auto iter = ma_set.get_area_nodes().cbegin();
+         iter != ma_set.get_area_nodes().cend(); ++iter) {
+
+        this->area_addrs.emplace(
+            *iter, std::vector<std::vector<uintptr_t>>(ptns_num));
+        this->area_tails.emplace(*iter, std::vector<cm_byte>());
+        this->area_pending.emplace(
+            *iter, std::vector<std::pair<uintptr_t, uint32_t>>());
+    }
+
+    //setup the worker pool
+    ret = w_pool._setup(opts, opts_ptn, *this, ma_set, flags);
+    if (ret != 0) {
+        run_err = true;
+        goto _scan_unlock_all;
+    }
+
+    //scan the selected address space once
+    ret = w_pool._single_run();
+    if (ret != 0) {
+        run_err = true;
+        goto _scan_unlock_all;
+    }
+
+    //gather & sort the matches of every pattern across areas
+    this->addrs.resize(ptns_num);
+    for (size_t i = 0; i < ptns_num; ++i) {
+
+        addrs_num = 0;
+        for (auto iter = this->area_addrs.cbegin();
+             iter != this->area_addrs.cend(); ++iter) {
+            addrs_num += iter->second[i].size();
+        }
+
+        this->addrs[i].reserve(addrs_num);
+        for (auto iter = this->area_addrs.cbegin();
+             iter != this->area_addrs.cend(); ++iter) {
+
+            this->addrs[i].insert(this->addrs[i].end(),
+                                  iter->second[i].begin(),
+                                  iter->second[i].end());
+        }
+        std::sort(this->addrs[i].begin(), this->addrs[i].end());
+    }
+    this->area_addrs.clear();
+    this->area_tails.clear();
+    this->area_pending.clear();
+
+
+    _scan_unlock_all:
+    ret = ma_set._unlock();
+    if (ret != 0) run_err = true;
+
+    _scan_unlock_signatures:
+    this->filter_p = nullptr;
+    if (signatures != nullptr) {
+        ret = signatures->_unlock();
+        if (ret != 0) run_err = true;
+    }
+
+    _scan_unlock_opts_ptn:
+    ret = opts_ptn._unlock();
+    if (ret != 0) run_err = true;
+
+    _scan_unlock_opts:
+    ret = opts._unlock();
+    if (ret != 0) run_err = true;
+
+    _scan_ret:
+    _UNLOCK(-1)
+    return run_err ? -1 : 0;
+}
+
+
+[[nodiscard]] std::vector<uintptr_t>
+    sc::ptnscan::get_addrs(const size_t ptn_idx) const {
+
+    if (ptn_idx >= this->addrs.size()) return std::vector<uintptr_t>();
+
+    return this->addrs[ptn_idx];
+}
+
+
+[[nodiscard]] size_t sc::ptnscan::get_ptns_num() const noexcept {
+
+    return this->addrs.size();
+}
+
+
+
+      /* ============= * 
+ ===== *  C INTERFACE  * =====
+       * ============= */
+
+/*
+ *  --- [EXTERNAL] ---
+ */
+
+sc_ptn_set sc_new_ptn_set() {
+
+    try {
+        return new sc::ptn_set();
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return nullptr;
+    }
+}
+
+
+sc_ptn_set sc_copy_ptn_set(const sc_ptn_set p_set) {
+
+    //cast opaque handle into class
+    sc::ptn_set * p = static_cast<sc::ptn_set *>(p_set);
+
+    try {
+        return new sc::ptn_set(*p);
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return nullptr;
+    }
+}
+
+
+int sc_del_ptn_set(sc_ptn_set p_set) {
+
+    //cast opaque handle into class
+    sc::ptn_set * p = static_cast<sc::ptn_set *>(p_set);
+
+    try {
+        delete p;
+        return 0;
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+int sc_ptn_set_reset(sc_ptn_set p_set) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::ptn_set * p = static_cast<sc::ptn_set *>(p_set);
+
+    try {
+        ret = p->reset();
+        return (ret != 0) ? -1 : 0;
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+ssize_t sc_ptn_set_add_pattern_str(sc_ptn_set p_set,
+                                   const char * pattern_str) {
+
+    //cast opaque handle into class
+    sc::ptn_set * p = static_cast<sc::ptn_set *>(p_set);
+
+    try {
+        if (pattern_str == nullptr) {
+            sc_errno = SC_ERR_OPT_PATTERN;
+            return -1;
+        }
+
+        return p->add_pattern_str(pattern_str);
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+int sc_ptn_set_compile(sc_ptn_set p_set) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::ptn_set * p = static_cast<sc::ptn_set *>(p_set);
+
+    try {
+        ret = p->compile();
+        return (ret != 0) ? -1 : 0;
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+int sc_ptn_set_save(sc_ptn_set p_set, const char * file_path) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::ptn_set * p = static_cast<sc::ptn_set *>(p_set);
+
+    try {
+        ret = p->save(file_path);
+        return (ret != 0) ? -1 : 0;
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+int sc_ptn_set_load(sc_ptn_set p_set, const char * file_path) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::ptn_set * p = static_cast<sc::ptn_set *>(p_set);
+
+    try {
+        ret = p->load(file_path);
+        return (ret != 0) ? -1 : 0;
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+size_t sc_ptn_set_get_ptns_num(const sc_ptn_set p_set) {
+
+    //cast opaque handle into class
+    sc::ptn_set * p = static_cast<sc::ptn_set *>(p_set);
+
+    return p->get_ptns_num();
+}
@@ -0,0 +1,207 @@
+#pragma once
+
+//standard template library
+#include <optional>
+#include <vector>
+#include <string>
+
+//external libraries
+#include <cmore.h>
+
+//local headers
+#include "scancry.h"
+
+
+
+namespace sc {
+
+//longest pattern a scan accepts, at most the size of the smallest page
+const constexpr size_t _ptn_max_sz = 0x1000;
+
+
+/*
+ *  NOTE: A matcher holds a pattern compiled for searching. Wildcard bits
+ *        are cleared from the pattern so a position matches when its
+ *        bytes, masked, equal the pattern. An optional fold is OR'ed
+ *        into each byte before it is masked; folding 0x20 into ASCII
+ *        letters compares them without regard to case.
+ *
+ *        The two whole bytes of the pattern least likely to appear in
+ *        memory are its anchors. Blocks of positions are compared
+ *        against both anchors at once, and only positions where both
+ *        anchors match are verified. Patterns made only of wildcards &
+ *        nibbles have no anchors; every position is verified.
+ */
+
+class _ptn_matcher {
+
+    _SC_DBG_PRIVATE:
+        //[attributes]
+        std::vector<cm_byte> bytes;
+        std::vector<cm_byte> mask;
+        std::vector<cm_byte> fold;
+        bool exact;
+
+        bool anchored;
+        size_t anchors[2];
+
+        //[methods]
+        [[nodiscard]] bool verify(const cm_byte * pos) const noexcept;
+
+    public:
+        //[methods]
+        _ptn_matcher();
+
+        //prepare a pattern for searching
+        void compile(const std::vector<cm_byte> & pattern,
+                     const std::optional<std::vector<cm_byte>> & mask,
+                     const std::optional<std::vector<cm_byte>> & fold
+                         = std::nullopt);
+
+        /*
+         *  NOTE: `buf` must hold `start_num + get_size() - 1` bytes.
+         */
+
+        //find every match starting in the first `start_num` bytes of `buf`
+        void find(const cm_byte * buf, const size_t start_num,
+                  const uintptr_t addr, std::vector<uintptr_t> & matches) const;
+
+        /*
+         *  NOTE: Searches the `adv` positions a worker advances past,
+         *        out of `avail` bytes read. Positions whose match runs
+         *        past `avail` are kept in `tail`, and finished by the
+         *        call for the next buffer of the same area.
+         */
+
+        //search the read buffer of a worker
+        void search(const cm_byte * cur_byte, const uintptr_t addr,
+                    const size_t avail, const size_t adv, const bool area_end,
+                    std::vector<cm_byte> & tail,
+                    std::vector<uintptr_t> & matches) const;
+
+        //getters & setters
+        [[nodiscard]] size_t get_size() const noexcept;
+};
+
+
+//size of the literals a set of patterns is filtered on
+const constexpr size_t _ptn_gram_sz = 4;
+
+//bounds of the size of the literal hash, in bits
+const constexpr uint32_t _ptn_hash_bits_min = 12;
+const constexpr uint32_t _ptn_hash_bits_max = 20;
+
+//compiled pattern set file constants
+const constexpr cm_byte _ptn_set_magic[file_magic_sz]
+                                           = {'S', 'C', 'P', 'S'};
+const constexpr cm_byte _ptn_set_ver_0 = 0;
+const constexpr cm_byte _ptn_set_ver_cur = _ptn_set_ver_0;
+
+
+//a literal of some pattern, filed under `key`
+struct _ptn_lit {
+
+    uint32_t key;
+    uint32_t ptn_idx;
+    uint32_t lit_off; //offset of the literal inside its pattern
+};
+
+
+/*
+ *  NOTE: A filter holds a set of patterns compiled for searching in one
+ *        pass. Each pattern contributes its rarest run of whole bytes
+ *        as a literal; the literal is filed under a hash of its bytes,
+ *        and a bitmap of the hashes in use is kept small enough to stay
+ *        in cache. Every position of memory is hashed & tested against
+ *        the bitmap, independent of every other position. Only the
+ *        positions whose hash is in use become candidates, verified
+ *        against the whole pattern.
+ *
+ *        Patterns without `_ptn_gram_sz` consecutive whole bytes are
+ *        filtered on their rarest whole byte instead. Patterns made only
+ *        of wildcards & nibbles have no literal; every position is a
+ *        candidate for them.
+ */
+
+class _ptn_filter {
+
+    _SC_DBG_PRIVATE:
+        //[attributes]
+        std::vector<std::vector<cm_byte>> bytes;
+        std::vector<std::vector<cm_byte>> masks;
+        size_t max_sz;
+
+        uint32_t hash_bits;
+        std::vector<uint64_t> gram_bitmap;
+        std::vector<struct _ptn_lit> gram_lits; //sorted by key
+        uint64_t byte_bitmap[0x100 / 64];
+        std::vector<struct _ptn_lit> byte_lits; //sorted by key
+        std::vector<uint32_t> unanchored;
+        bool compiled;
+
+        //[methods]
+        void fill_bitmaps();
+
+    public:
+        //[methods]
+        _ptn_filter();
+
+        void clear();
+
+        //add a pattern, returns its index
+        [[nodiscard]] size_t add(const std::vector<cm_byte> & pattern,
+                                 const std::optional<std::vector<cm_byte>> & mask);
+        void compile();
+
+        //hash the literal at `pos`
+        [[nodiscard]] uint32_t hash(const cm_byte * pos) const noexcept;
+
+        //test if a pattern matches at `pos`
+        [[nodiscard]] bool verify(const uint32_t ptn_idx,
+                                  const cm_byte * pos) const noexcept;
+
+        //convert to & from the contents of a file
+        void pack(std::vector<cm_byte> & buf) const;
+        [[nodiscard]] int unpack(const std::vector<cm_byte> & buf);
+
+        //getters & setters
+        [[nodiscard]] size_t get_ptns_num() const noexcept;
+        [[nodiscard]] size_t get_ptn_size(const uint32_t ptn_idx) const noexcept;
+        [[nodiscard]] size_t get_max_size() const noexcept;
+        [[nodiscard]] bool is_compiled() const noexcept;
+
+        [[nodiscard]] const uint64_t * get_gram_bitmap() const noexcept;
+        [[nodiscard]] const std::vector<struct _ptn_lit> &
+            get_gram_lits() const noexcept;
+        [[nodiscard]] const uint64_t * get_byte_bitmap() const noexcept;
+        [[nodiscard]] const std::vector<struct _ptn_lit> &
+            get_byte_lits() const noexcept;
+        [[nodiscard]] const std::vector<uint32_t> &
+            get_unanchored() const noexcept;
+};
+
+
+}; //namespace sc
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//external
+sc_ptn_set sc_new_ptn_set();
+sc_ptn_set sc_copy_ptn_set(const sc_ptn_set p_set);
+int sc_del_ptn_set(sc_ptn_set p_set);
+int sc_ptn_set_reset(sc_ptn_set p_set);
+ssize_t sc_ptn_set_add_pattern_str(sc_ptn_set p_set,
+                                   const char * pattern_str);
+int sc_ptn_set_compile(sc_ptn_set p_set);
+int sc_ptn_set_save(sc_ptn_set p_set, const char * file_path);
+int sc_ptn_set_load(sc_ptn_set p_set, const char * file_path);
+size_t sc_ptn_set_get_ptns_num(const sc_ptn_set p_set);
+
+
+#ifdef __cplusplus
+} //extern "C"
+#endif
@@ -0,0 +1,338 @@
+//standard template library
+#include <optional>
+#include <memory>
+#include <vector>
+#include <unordered_map>
+#include <utility>
+#include <algorithm>
+
+//external libraries
+#include <cmore.h>
+#include <memcry.h>
+
+//local headers
+#include "scancry.h"
+#include "addr_index.hh"
+#include "error.hh"
+
+
+
+      /* =============== *
+ ===== *  C++ INTERFACE  * =====
+       * =============== */
+
+/*
+ *  --- [INTERNAL] ---
+ */
+
+//order entries by value, then by the address they are stored at
+[[nodiscard]] _SC_DBG_STATIC _SC_DBG_INLINE
+bool _entry_less(const struct sc::ptr_index_entry & a,
+                 const struct sc::ptr_index_entry & b) {
+
+    if (a.value != b.value) return a.value < b.value;
+    return a.addr < b.addr;
+}
+
+
+
+/*
+ *  --- [POINTER INDEX | PRIVATE] ---
+ */
+
+[[nodiscard]] int sc::ptr_index::run(sc::opt & opts,
+                                     sc::opt_ptr & opts_ptr,
+                                     sc::map_area_set & ma_set,
+                                     worker_pool & w_pool,
+                                     const cm_byte flags,
+                                     const bool refresh) {
+
+    int ret;
+    bool run_err = false;
+
+    const mc_vm_area * area;
+    std::vector<std::pair<uintptr_t, uintptr_t>> ranges;
+    std::vector<struct sc::ptr_index_entry> new_entries;
+    size_t kept, new_num;
+
+
+    //lock the index
+    _LOCK(-1)
+
+    //a build starts from an empty index
+    if (refresh == false) this->do_reset();
+
+    //lock options
+    ret = opts._lock();
+    if (ret != 0) {
+        run_err = true;
+        goto _run_ret;
+    }
+
+    //lock ptrscan options
+    ret = opts_ptr._lock();
+    if (ret != 0) {
+        run_err = true;
+        goto _run_unlock_opts;
+    }
+
+    //lock the map areas set
+    ret = ma_set._lock();
+    if (ret != 0) {
+        run_err = true;
+        goto _run_unlock_opts_ptr;
+    }
+
+    //check all necessary options have been set
+    if (opts_ptr.get_alignment().has_value() == false
+        || opts.get_map() == nullptr) {
+
+        sc_errno = SC_ERR_OPT_MISSING;
+        run_err = true;
+        goto _run_unlock_all;
+    }
+
+    //index the areas of the map to validate pointers
+    this->area_index_p->build_areas(*opts.get_map());
+
+    //one buffer per area, every area is scanned by a single worker
+    this->area_entries.clear();
+    for (auto iter = ma_set.get_area_nodes().cbegin();
+         iter != ma_set.get_area_nodes().cend(); ++iter) {
+
+        this->area_entries.emplace(*iter,
+                                   std::vector<struct sc::ptr_index_entry>());
+    }
+
+    //setup the worker pool
+    ret = w_pool._setup(opts, opts_ptr, *this, ma_set, flags);
+    if (ret != 0) {
+        run_err = true;
+        goto _run_unlock_all;
+    }
+
+    //scan the selected address space once
+    ret = w_pool._single_run();
+    if (ret != 0) {
+        run_err = true;
+        goto _run_unlock_all;
+    }
+
+    //drop the stale entries of the rescanned areas
+    if (refresh == true) {
+
+        for (auto iter = ma_set.get_area_nodes().cbegin();
+             iter != ma_set.get_area_nodes().cend(); ++iter) {
+
+            area = MC_GET_NODE_AREA(*iter);
+            ranges.emplace_back(area->start_addr, area->end_addr);
+        }
+        std::sort(ranges.begin(), ranges.end());
+
+        kept = 0;
+        for (size_t i = 0; i < this->entries.size(); ++i) {
+
+            //find the last range starting at or before this entry
+            auto range = std::upper_bound(
+                ranges.begin(), ranges.end(),
+                std::make_pair(this->entries[i].addr, UINTPTR_MAX));
+            if (range != ranges.begin()
+                && this->entries[i].addr < (range - 1)->second) continue;
+
+            if (kept != i) this->entries[kept] = this->entries[i];
+            ++kept;
+        }
+        this->entries.resize(kept);
+    }
+
+    //gather & sort the new entries
+    new_num = 0;
+    for (auto iter = this->area_entries.cbegin();
+         iter != this->area_entries.cend(); ++iter) {
+        new_num += iter->second.size();
+    }
+
+    new_entries.reserve(new_num);
+    for (auto iter = this->area_entries.begin();
+         iter != this->area_entries.end(); ++iter) {
+
+        new_entries.insert(new_entries.end(),
+                           iter->second.begin(), iter->second.end());
+    }
+    this->area_entries.clear();
+    std::sort(new_entries.begin(), new_entries.end(), _entry_less);
+
+    //merge them into the index
+    kept = this->entries.size();
+    this->entries.insert(this->entries.end(),
+                         new_entries.begin(), new_entries.end());
+    std::inplace_merge(this->entries.begin(), this->entries.begin() + kept,
+                       this->entries.end(), _entry_less);
+
+
+    _run_unlock_all:
+    ret = ma_set._unlock();
+    if (ret != 0) run_err = true;
+
+    _run_unlock_opts_ptr:
+    ret = opts_ptr._unlock();
+    if (ret != 0) run_err = true;
+
+    _run_unlock_opts:
+    ret = opts._unlock();
+    if (ret != 0) run_err = true;
+
+    _run_ret:
+    _UNLOCK(-1)
+    return run_err ? -1 : 0;
+}
+
+
+void sc::ptr_index::do_reset() {
+
+    this->entries.clear();
+    this->entries.shrink_to_fit();
+    this->area_entries.clear();
+    this->area_index_p->clear();
+
+    return;
+}
+
+
+
+/*
+ *  --- [POINTER INDEX | PUBLIC] ---
+ */
+
+[[nodiscard]] off_t sc::ptr_index::_process_addr(
+                                    const struct _scan_arg arg,
+                                    const opt * const opts,
+                                    const _opt_scan * const opts_scan) {
+
+    uintptr_t value = 0;
+
+
+    //fetch ptrscan options & suppress warnings
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wignored-qualifiers"
+    const opt_ptr * const opts_ptr
+        = (const opt_ptr * const) opts_scan;
+    #pragma GCC diagnostic pop
+
+    //get potential pointer value
+    if (opts->addr_width == sc::AW32)
+        value = *((uint32_t *) arg.cur_byte);
+    if (opts->addr_width == sc::AW64)
+        value = *((uint64_t *) arg.cur_byte);
+
+    //record values that point into a mapped area
+    if (this->area_index_p->find_containing(value) != nullptr) {
+
+        auto area_iter = this->area_entries.find(arg.area_node);
+        if (area_iter != this->area_entries.end()) {
+            area_iter->second.push_back(
+                sc::ptr_index_entry{value, arg.addr});
+        }
+    }
+
+    return opts_ptr->get_alignment().value();
+}
+
+
+[[nodiscard]] int sc::ptr_index::_generate_body(
+    std::vector<cm_byte> & buf, const off_t hdr_off) {
+
+    sc_errno = SC_ERR_RTTI;
+    return -1;
+}
+
+
+[[nodiscard]] int sc::ptr_index::_process_body(
+    const std::vector<cm_byte> & buf, off_t hdr_off,
+    const cm_byte version, const mc_vm_map & map) {
+
+    sc_errno = SC_ERR_RTTI;
+    return -1;
+}
+
+
+[[nodiscard]] int sc::ptr_index::_read_body(
+    const std::vector<cm_byte> & buf, off_t hdr_off, const cm_byte version) {
+
+    sc_errno = SC_ERR_RTTI;
+    return -1;
+}
+
+
+sc::ptr_index::ptr_index()
+ : _scan(),
+   area_index_p(std::make_unique<sc::_addr_index>()) {}
+
+
+sc::ptr_index::~ptr_index() {}
+
+
+[[nodiscard]] int sc::ptr_index::reset() {
+
+    _LOCK(-1);
+    this->do_reset();
+    _UNLOCK(-1);
+
+    return 0;
+}
+
+
+[[nodiscard]] int sc::ptr_index::build(sc::opt & opts,
+                                       sc::opt_ptr & opts_ptr,
+                                       sc::map_area_set & ma_set,
+                                       worker_pool & w_pool,
+                                       const cm_byte flags) {
+
+    return this->run(opts, opts_ptr, ma_set, w_pool, flags, false);
+}
+
+
+/*
+ *  NOTE: Entries stored inside the areas of `ma_set` are replaced by
+ *        a fresh scan of those areas. Entries stored elsewhere are kept
+ *        as they are.
+ */
+
+[[nodiscard]] int sc::ptr_index::refresh(sc::opt & opts,
+                                         sc::opt_ptr & opts_ptr,
+                                         sc::map_area_set & ma_set,
+                                         worker_pool & w_pool,
+                                         const cm_byte flags) {
+
+    return this->run(opts, opts_ptr, ma_set, w_pool, flags, true);
+}
+
+
+[[nodiscard]] std::vector<struct sc::ptr_index_entry>
+    sc::ptr_index::query(const uintptr_t addr, const uintptr_t max_off) const {
+
+    std::vector<struct sc::ptr_index_entry> found;
+    const uintptr_t low = (addr > max_off) ? addr - max_off : 0;
+
+
+    //find the first pointer inside the range
+    auto iter = std::lower_bound(this->entries.begin(), this->entries.end(),
+                                 low, [](const struct sc::ptr_index_entry & e,
+                                         const uintptr_t value) {
+        return e.value < value;
+    });
+
+    //collect every pointer up to the end of the range
+    for (; iter != this->entries.end() && iter->value <= addr; ++iter) {
+        found.push_back(*iter);
+    }
+
+    return found;
+}
+
+
+[[nodiscard]] const std::vector<struct sc::ptr_index_entry> &
+    sc::ptr_index::get_entries() const noexcept {
+
+    return this->entries;
+}
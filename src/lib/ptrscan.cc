@@ -4,16 +4,24 @@
 #include <vector>
 #include <list>
 #include <unordered_map>
+#include <unordered_set>
 #include <string>
 #include <algorithm>
+#include <numeric>
 #include <functional>
 #include <exception>
+#include <fstream>
 
 //C standard library
 #include <cstring>
-#ifdef TRACE
+#include <cstdlib>
 #include <cstdio>
-#endif
+
+//system headers
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 //external libraries
 #include <cmore.h>
@@ -23,6 +31,8 @@
 //local headers
 #include "scancry.h"
 #include "ptrscan.hh"
+#include "batch_read.hh"
+#include "addr_index.hh"
 #include "fbuf_util.hh"
 #include "error.hh"
 
@@ -41,6 +51,19 @@ void sc::_ptrscan_tree_node::connect_child(
 }
 
 
+//disconnect every child present in the dropped set
+void sc::_ptrscan_tree_node::remove_children(
+    const std::unordered_set<const _ptrscan_tree_node *> & dropped) {
+
+    this->children.remove_if(
+        [&dropped](const std::shared_ptr<_ptrscan_tree_node> & child) {
+        return dropped.count(child.get()) != 0;
+    });
+
+    return;
+}
+
+
 void sc::_ptrscan_tree_node::clear() {
     this->children.clear();
 }
@@ -65,10 +88,16 @@ void sc::_ptrscan_tree_node::clear() {
  */
 
 sc::_ptrscan_tree::_ptrscan_tree(int max_depth)
- : next_id(0), write_mutex(PTHREAD_MUTEX_INITIALIZER) {
+ : next_id(0),
+   write_mutex(PTHREAD_MUTEX_INITIALIZER),
+   prune_at(sc::_ptrscan_prune_floor) {
 
     //reserve a vector for each depth level
     this->depth_levels.resize(max_depth + 1);
+
+    //create the virtual root, every target is a child of it
+    this->root_node = std::make_shared<sc::_ptrscan_tree_node>(
+                                        -1, nullptr, 0x0, 0x0, nullptr);
     
     return;
 }
@@ -95,6 +124,259 @@ void sc::_ptrscan_tree::add_node(std::shared_ptr<sc::_ptrscan_tree_node> node,
 }
 
 
+/*
+ *  NOTE: A node's offset is its distance from its parent. Pruning keeps
+ *        the nodes with the smallest offsets; these are the likeliest
+ *        to be real struct member accesses rather than coincidences.
+ */
+
+//drop equally spaced siblings, keeping the closest node of each run
+_SC_DBG_STATIC void _prune_array_runs(std::vector<size_t> & siblings,
+                                      const std::vector<off_t> & soffs,
+                                      const size_t max_run,
+                                      std::vector<cm_byte> & keep,
+                                      size_t & dropped) {
+
+    size_t start, end, closest;
+    off_t stride;
+
+
+    //order siblings by their signed offset
+    std::sort(siblings.begin(), siblings.end(), [&](size_t a, size_t b) {
+        if (soffs[a] != soffs[b]) return soffs[a] < soffs[b];
+        return a < b;
+    });
+
+    //for every run of siblings sharing a stride
+    start = 0;
+    while ((start + 1) < siblings.size()) {
+
+        stride = soffs[siblings[start + 1]] - soffs[siblings[start]];
+        end = start + 1;
+        while ((end + 1) < siblings.size()
+               && (soffs[siblings[end + 1]] - soffs[siblings[end]]) == stride)
+            ++end;
+
+        //short runs & duplicate offsets are not arrays
+        if (stride == 0 || (end - start + 1) <= max_run) {
+            start = end;
+            continue;
+        }
+
+        //keep only the node closest to the parent
+        closest = start;
+        for (size_t i = start; i <= end; ++i) {
+            if (std::abs(soffs[siblings[i]])
+                < std::abs(soffs[siblings[closest]])) closest = i;
+        }
+
+        for (size_t i = start; i <= end; ++i) {
+            if (i == closest) continue;
+            keep[siblings[i]] = false;
+            ++dropped;
+        }
+
+        start = end + 1;
+    }
+
+    return;
+}
+
+
+//drop the nodes of a depth level that exceed the given budgets & policies
+void sc::_ptrscan_tree::prune_level(
+                        const int depth_level,
+                        const sc::opt_ptr & opts_ptr,
+                        struct sc::ptrscan_report & report) {
+
+    size_t kept, group_end;
+    bool has_static;
+    std::shared_ptr<sc::_ptrscan_tree_node> parent;
+    const mc_vm_area * area;
+
+    std::vector<size_t> order, siblings;
+    std::vector<cm_byte> keep, is_static;
+    std::unordered_set<const sc::_ptrscan_tree_node *> dropped;
+    std::unordered_set<sc::_ptrscan_tree_node *> dropped_parents;
+
+    std::vector<std::shared_ptr<sc::_ptrscan_tree_node>> & level
+        = this->depth_levels[depth_level];
+
+    const std::optional<size_t> max_children = opts_ptr.get_max_children();
+    const std::optional<size_t> max_level_nodes
+        = opts_ptr.get_max_level_nodes();
+    const std::optional<size_t> max_array_run = opts_ptr.get_max_array_run();
+    const bool prefer_static = opts_ptr.get_prefer_static();
+    const std::optional<std::unordered_set<const cm_lst_node *>> &
+        static_areas = opts_ptr.get_static_areas();
+
+
+    //fetch the parent & offset of every node
+    std::vector<sc::_ptrscan_tree_node *> parents(level.size());
+    std::vector<off_t> soffs(level.size());
+    std::vector<uintptr_t> offs(level.size());
+    for (size_t i = 0; i < level.size(); ++i) {
+
+        parent = level[i]->parent.lock();
+        parents[i] = parent.get();
+        soffs[i] = (off_t) (parent->own_addr - level[i]->ptr_addr);
+        offs[i] = std::abs(soffs[i]);
+    }
+
+    //find the nodes that lie in static areas
+    if (prefer_static == true) {
+
+        is_static.resize(level.size());
+        for (size_t i = 0; i < level.size(); ++i) {
+
+            if (static_areas.has_value() == true) {
+                is_static[i] = static_areas->count(level[i]->area_node) != 0;
+            } else {
+                area = MC_GET_NODE_AREA(level[i]->area_node);
+                is_static[i] = area->obj_node_p != nullptr;
+            }
+        }
+    }
+
+    order.resize(level.size());
+    std::iota(order.begin(), order.end(), 0);
+    keep.assign(level.size(), true);
+
+    //apply the policies that act on the children of every parent
+    if (max_children.has_value() == true
+        || max_array_run.has_value() == true || prefer_static == true) {
+
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            if (parents[a] != parents[b]) return parents[a] < parents[b];
+            if (offs[a] != offs[b]) return offs[a] < offs[b];
+            return a < b;
+        });
+
+        //for every group of siblings
+        for (size_t i = 0; i < order.size(); i = group_end) {
+
+            group_end = i + 1;
+            while (group_end < order.size()
+                   && parents[order[group_end]] == parents[order[i]])
+                ++group_end;
+
+            //drop siblings outside static areas if any are inside one
+            if (prefer_static == true) {
+
+                has_static = false;
+                for (size_t j = i; j < group_end; ++j) {
+                    if (is_static[order[j]] == true) has_static = true;
+                }
+
+                for (size_t j = i; j < group_end && has_static; ++j) {
+                    if (is_static[order[j]] == true) continue;
+                    keep[order[j]] = false;
+                    ++report.non_static_dropped;
+                }
+            }
+
+            //collapse siblings that look like a scan over an array
+            if (max_array_run.has_value() == true) {
+
+                siblings.clear();
+                for (size_t j = i; j < group_end; ++j) {
+                    if (keep[order[j]] == true) siblings.push_back(order[j]);
+                }
+                _prune_array_runs(siblings, soffs, max_array_run.value(),
+                                  keep, report.array_nodes_dropped);
+            }
+
+            //keep the closest children
+            if (max_children.has_value() == true) {
+
+                kept = 0;
+                for (size_t j = i; j < group_end; ++j) {
+
+                    if (keep[order[j]] == false) continue;
+                    if (kept < max_children.value()) {
+                        ++kept;
+                        continue;
+                    }
+                    keep[order[j]] = false;
+                    ++report.children_dropped;
+                }
+            }
+        }
+    }
+
+    //keep the closest nodes of the whole level
+    if (max_level_nodes.has_value() == true) {
+
+        order.clear();
+        for (size_t i = 0; i < level.size(); ++i) {
+            if (keep[i] == true) order.push_back(i);
+        }
+
+        if (order.size() > max_level_nodes.value()) {
+
+            std::nth_element(order.begin(),
+                             order.begin() + max_level_nodes.value(),
+                             order.end(), [&](size_t a, size_t b) {
+                if (offs[a] != offs[b]) return offs[a] < offs[b];
+                return a < b;
+            });
+
+            for (size_t j = max_level_nodes.value(); j < order.size(); ++j) {
+                keep[order[j]] = false;
+                ++report.level_nodes_dropped;
+            }
+        }
+    }
+
+    //remove dropped nodes from the level
+    kept = 0;
+    for (size_t i = 0; i < level.size(); ++i) {
+
+        if (keep[i] == false) {
+            dropped.insert(level[i].get());
+            dropped_parents.insert(parents[i]);
+            continue;
+        }
+
+        if (kept != i) level[kept] = std::move(level[i]);
+        ++kept;
+    }
+
+    //remove dropped nodes from their parents, freeing them
+    for (auto iter = dropped_parents.begin();
+         iter != dropped_parents.end(); ++iter) {
+        (*iter)->remove_children(dropped);
+    }
+    level.resize(kept);
+
+    return;
+}
+
+
+/*
+ *  NOTE: Releasing a depth level frees its nodes. Its children remain
+ *        owned by their own depth level, but can no longer reach their
+ *        parents in memory.
+ */
+
+void sc::_ptrscan_tree::release_level(const int depth_level) {
+
+    //the targets are also owned by the virtual root
+    if (depth_level == 0) this->root_node->clear();
+
+    //disconnect & free every node of this depth level
+    for (auto iter = this->depth_levels[depth_level].begin();
+         iter != this->depth_levels[depth_level].end(); ++iter) {
+
+        (*iter)->clear();
+    }
+    this->depth_levels[depth_level].clear();
+    this->depth_levels[depth_level].shrink_to_fit();
+
+    return;
+}
+
+
 void sc::_ptrscan_tree::reset() {
 
     //free tree node depth layers in bottom-up order
@@ -118,6 +400,16 @@ void sc::_ptrscan_tree::reset() {
 }
 
 
+[[nodiscard]] size_t sc::_ptrscan_tree::get_prune_at() const noexcept {
+    return this->prune_at;
+}
+
+
+void sc::_ptrscan_tree::set_prune_at(const size_t prune_at) noexcept {
+    this->prune_at = prune_at;
+}
+
+
 [[nodiscard]] const std::vector<std::shared_ptr<sc::_ptrscan_tree_node>> &
     sc::_ptrscan_tree::get_depth_level_vct(int level) const noexcept {
 
@@ -157,19 +449,27 @@ void sc::_ptrscan_tree::reset() {
 
 sc::ptrscan_chain::ptrscan_chain(const cm_lst_node * obj_node,
                                  const uint32_t _obj_idx,
-                                 const std::vector<off_t> & offsets)
+                                 const std::vector<off_t> & offsets,
+                                 const uint32_t target_idx)
                                   : obj_idx(_obj_idx),
+                                    target_idx(target_idx),
                                     obj_node((cm_lst_node *) obj_node),
                                     pathname(std::nullopt),
-                                    offsets(offsets) {}
+                                    offsets(offsets),
+                                    checks(0),
+                                    hits(0) {}
 
 sc::ptrscan_chain::ptrscan_chain(const std::string pathname,
                                  const uint32_t _obj_idx,
-                                 const std::vector<off_t> & offsets)
+                                 const std::vector<off_t> & offsets,
+                                 const uint32_t target_idx)
                                   : obj_idx(_obj_idx),
+                                    target_idx(target_idx),
                                     obj_node(std::nullopt),
                                     pathname(pathname),
-                                    offsets(offsets) {}
+                                    offsets(offsets),
+                                    checks(0),
+                                    hits(0) {}
 
 
 uint32_t sc::ptrscan_chain::_get_obj_idx() const noexcept {
@@ -177,6 +477,25 @@ uint32_t sc::ptrscan_chain::_get_obj_idx() const noexcept {
 }
 
 
+void sc::ptrscan_chain::_record_check(const bool hit) noexcept {
+
+    ++this->checks;
+    if (hit == true) ++this->hits;
+
+    return;
+}
+
+
+void sc::ptrscan_chain::_set_stability(
+    const uint32_t checks, const uint32_t hits) noexcept {
+
+    this->checks = checks;
+    this->hits = hits;
+
+    return;
+}
+
+
 std::optional<const cm_lst_node *>
     sc::ptrscan_chain::get_obj_node() const noexcept {
 
@@ -184,6 +503,11 @@ std::optional<const cm_lst_node *>
 }
 
 
+uint32_t sc::ptrscan_chain::get_target_idx() const noexcept {
+    return this->target_idx;
+}
+
+
 const std::optional<std::string> &
     sc::ptrscan_chain::get_pathname() const noexcept{
 
@@ -198,273 +522,1383 @@ const std::vector<off_t> &
 }
 
 
+uint32_t sc::ptrscan_chain::get_checks() const noexcept {
+    return this->checks;
+}
+
+
+uint32_t sc::ptrscan_chain::get_hits() const noexcept {
+    return this->hits;
+}
+
+
+double sc::ptrscan_chain::get_stability() const noexcept {
+
+    if (this->checks == 0) return 0.0;
+    return (double) this->hits / (double) this->checks;
+}
+
+
 
 /*
- *  --- [POINTER SCANNER | PRIVATE] ---
+ *  --- [INTERNAL] ---
  */
 
-void sc::ptrscan::add_node(std::shared_ptr<sc::_ptrscan_tree_node> parent_node,
-                           const cm_lst_node * area_node,
-                           const uintptr_t own_addr,
-                           const uintptr_t ptr_addr) {
+//order chains by object, then lexicographically by offsets
+[[nodiscard]] _SC_DBG_STATIC _SC_DBG_INLINE
+bool _chain_less(const sc::ptrscan_chain & a, const sc::ptrscan_chain & b) {
 
-    //create node inside the ptrscan tree
-    this->tree_p->add_node(
-        parent_node, area_node, this->cur_depth_level, own_addr, ptr_addr);
+    const cm_lst_node * a_node = a.get_obj_node().value_or(nullptr);
+    const cm_lst_node * b_node = b.get_obj_node().value_or(nullptr);
 
-    return;
+    if (a_node != b_node) return a_node < b_node;
+    return a.get_offsets() < b.get_offsets();
 }
 
 
-[[nodiscard]] std::pair<std::string, cm_lst_node *>
-    sc::ptrscan::get_chain_data(
-        const cm_lst_node * const area_node) const {
+//get the number of leading offsets two chains have in common
+[[nodiscard]] _SC_DBG_STATIC _SC_DBG_INLINE
+int _chain_prefix_len(const sc::ptrscan_chain & a,
+                      const sc::ptrscan_chain & b) {
 
-    mc_vm_area * area;
+    int len = 0;
 
-    cm_lst_node * obj_node;
-    mc_vm_obj * obj;
 
+    //chains in different objects share nothing
+    if (a.get_obj_node() != b.get_obj_node()) return 0;
 
-    //fetch the appropriate object
-    area = MC_GET_NODE_AREA(area_node);
-    obj_node = (area->obj_node_p == nullptr)
-               ? area->last_obj_node_p : area->obj_node_p;
-    obj = MC_GET_NODE_OBJ(obj_node);
-        
-    return std::pair<std::string, cm_lst_node *>(obj->pathname, obj_node);
+    //count equal leading offsets
+    const std::vector<off_t> & a_offs = a.get_offsets();
+    const std::vector<off_t> & b_offs = b.get_offsets();
+    while (len < a_offs.size() && len < b_offs.size()
+           && a_offs[len] == b_offs[len]) ++len;
+
+    return len;
 }
 
 
-[[nodiscard]] _SC_DBG_INLINE int
-    sc::ptrscan::get_chain_idx(const std::string & pathname) {
+//sort address ranges & merge the ones that overlap
+_SC_DBG_STATIC void _merge_ranges(
+    std::vector<std::pair<uintptr_t, uintptr_t>> & ranges) {
+
+    size_t out = 0;
 
-    //find if pathname is already present in the serialised pathnames vector
-    auto iter = std::find(this->ser_pathnames.begin(),
-                          ser_pathnames.end(), pathname);
 
-    //if not present, add it and return its index
-    if (iter == ser_pathnames.end()) {
-        this->ser_pathnames.push_back(pathname);
-        return this->ser_pathnames.size() - 1;
+    if (ranges.empty() == true) return;
+    std::sort(ranges.begin(), ranges.end());
+
+    for (size_t i = 1; i < ranges.size(); ++i) {
+
+        //extend the current range or start a new one
+        if (ranges[i].first <= ranges[out].second) {
+            ranges[out].second = std::max(ranges[out].second,
+                                          ranges[i].second);
+        } else {
+            ranges[++out] = ranges[i];
+        }
     }
+    ranges.resize(out + 1);
 
-    //else return index
-    return std::distance(this->ser_pathnames.begin(), iter);
+    return;
 }
 
 
-[[nodiscard]] std::pair<size_t, size_t>
-    sc::ptrscan::get_fbuf_data_sz() const {
+//check if an address is inside a set of merged ranges
+[[nodiscard]] _SC_DBG_STATIC _SC_DBG_INLINE
+bool _in_ranges(const std::vector<std::pair<uintptr_t, uintptr_t>> & ranges,
+                const uintptr_t addr) {
 
-    size_t pathnames_sz = 0, chains_sz = 0;
+    //find the first range starting after the address
+    auto iter = std::upper_bound(ranges.begin(), ranges.end(), addr,
+                                 [](const uintptr_t addr,
+                                    const std::pair<uintptr_t, uintptr_t> & r) {
+        return addr < r.first;
+    });
 
-    //add-up pathname sizes
-    for (auto iter = this->ser_pathnames.begin();
-         iter != this->ser_pathnames.end(); ++iter) {
+    //the range before it must extend past the address
+    if (iter == ranges.begin()) return false;
+    return addr < (iter - 1)->second;
+}
 
-        //pathname string + null terminator
-        pathnames_sz += iter->size() + 1;
-    }
 
-    //additional null terminator to denote the end of pathnames
-    pathnames_sz += 1;
+//check if any depth level budget or pruning policy is set
+[[nodiscard]] _SC_DBG_STATIC _SC_DBG_INLINE
+bool _is_pruned(const sc::opt_ptr & opts_ptr) {
 
-    //add-up chain sizes
-    for (auto iter = this->chains.begin();
-         iter != this->chains.end(); ++iter) {
+    return opts_ptr.get_max_level_nodes().has_value()
+           || opts_ptr.get_max_children().has_value()
+           || opts_ptr.get_max_array_run().has_value()
+           || opts_ptr.get_prefer_static();
+}
 
-        //pathname index
-        chains_sz += 4;
 
-        //offsets & continue/end bytes
-        chains_sz += iter->get_offsets().size() * 5;
-    }
+//fold bytes into a FNV-1a digest
+_SC_DBG_STATIC _SC_DBG_INLINE
+void _digest_bytes(uint64_t & digest, const void * data, const size_t sz) {
 
-    //end of each chain contains a continue/end byte
-    //chains_sz += this->chains.size(); FIXME: Remove?
+    const cm_byte * bytes = (const cm_byte *) data;
 
-    return std::pair<size_t, size_t>(pathnames_sz, chains_sz);
+
+    for (size_t i = 0; i < sz; ++i) {
+        digest ^= bytes[i];
+        digest *= 0x100000001b3;
+    }
+
+    return;
 }
 
 
-//interpret the start of the file buffer
-[[nodiscard]] int sc::ptrscan::handle_body_start(
-    const std::vector<cm_byte> & buf, off_t hdr_off, off_t & buf_off) {
+//build the checkpoint header of a scan
+_SC_DBG_STATIC void _make_ckpt_hdr(struct sc::_ptrscan_ckpt_hdr & hdr,
+                                   const sc::opt_ptr & opts_ptr,
+                                   const uint32_t targets_num) {
 
-    //fetch the ptrscan header
-    std::optional<struct ptr_file_hdr> local_hdr
-        = fbuf_util::unpack_type<struct ptr_file_hdr>(buf, buf_off);
-    if (local_hdr.has_value() == false) return -1;
+    uint64_t digest = 0xcbf29ce484222325, num;
+    std::vector<std::pair<uintptr_t, uintptr_t>> static_ranges;
+    mc_vm_area * area;
 
-    //fetch every pathname
-    do {
 
-        //fetch the pathname string
-        std::optional<std::string> pathname
-            = fbuf_util::unpack_string(buf, buf_off);
-        if (pathname.has_value() == false) return -1;
+    std::memset(&hdr, 0, sizeof(hdr));
 
-        //if there are no more strings, stop
-        if (pathname->empty()) {
+    std::memcpy(hdr.magic, sc::_ptrscan_ckpt_magic,
+                sc::_ptrscan_ckpt_magic_sz);
+    hdr.targets_num = targets_num;
+    hdr.alignment = opts_ptr.get_alignment().value();
+    hdr.max_obj_sz = opts_ptr.get_max_obj_sz().value();
+    hdr.max_neg_off = opts_ptr.get_max_neg_off().value_or(0);
+    hdr.max_depth = opts_ptr.get_max_depth().value();
+    hdr.max_level_nodes = opts_ptr.get_max_level_nodes().value_or(UINT64_MAX);
+    hdr.max_children = opts_ptr.get_max_children().value_or(UINT64_MAX);
+    hdr.max_array_run = opts_ptr.get_max_array_run().value_or(UINT64_MAX);
+    hdr.version = sc::_ptrscan_ckpt_version;
+    hdr.smart_scan = opts_ptr.get_smart_scan();
+    hdr.bidirectional = opts_ptr.get_bidirectional();
+    hdr.prefer_static = opts_ptr.get_prefer_static();
 
-            //skip second null byte
-            buf_off += 1;
-            break;
+    //static areas are unordered, digest their sorted ranges
+    if (opts_ptr.get_static_areas().has_value() == true) {
+
+        for (auto iter = opts_ptr.get_static_areas()->cbegin();
+             iter != opts_ptr.get_static_areas()->cend(); ++iter) {
+
+            area = MC_GET_NODE_AREA(*iter);
+            static_ranges.emplace_back(area->start_addr, area->end_addr);
         }
+        std::sort(static_ranges.begin(), static_ranges.end());
+    }
 
-        //otherwise add this pathname to the pathnames vector
-        this->ser_pathnames.push_back(pathname.value());
+    num = static_ranges.size();
+    _digest_bytes(digest, &num, sizeof(num));
+    for (auto iter = static_ranges.cbegin();
+         iter != static_ranges.cend(); ++iter) {
 
-    } while(true);
+        _digest_bytes(digest, &iter->first, sizeof(iter->first));
+        _digest_bytes(digest, &iter->second, sizeof(iter->second));
+    }
 
-    return 0;
+    //preset offsets, unset differs from empty
+    if (opts_ptr.get_preset_offsets().has_value() == true) {
+
+        const std::vector<off_t> & presets
+            = opts_ptr.get_preset_offsets().value();
+
+        num = presets.size();
+        _digest_bytes(digest, &num, sizeof(num));
+        _digest_bytes(digest, presets.data(), presets.size() * sizeof(off_t));
+
+    } else {
+        num = UINT64_MAX;
+        _digest_bytes(digest, &num, sizeof(num));
+    }
+
+    hdr.digest = digest;
+
+    return;
 }
 
 
-//interpret a single chain in the file buffer
-[[nodiscard]] std::optional<std::pair<uint32_t, std::vector<off_t>>>
-    sc::ptrscan::handle_body_chain(
-        const std::vector<cm_byte> & buf, off_t & buf_off) {
+/*
+ *  NOTE: To verify if a chain is valid, simply attempt to follow it.
+ *        If it arrives at the expected address, it is valid. Failure
+ *        can be caused by both incorrect final address and failure to
+ *        read (e.g.: trying to read unmapped memory).
+ */
 
-    std::vector<off_t> offsets;
+//marks a chain that does not perform its own read at this depth level
+const constexpr size_t _verify_no_read = SIZE_MAX;
 
-    
-    //fetch the object index
-    std::optional<uint32_t> obj_idx
-        = fbuf_util::unpack_type<uint32_t>(buf, buf_off);
-    if (obj_idx.has_value() == false) return std::nullopt;
+//follow a share of sorted chains one depth level at a time
+_SC_DBG_STATIC void * _verify_worker(void * arg) {
 
-    //fetch the chain array
-    std::optional<std::vector<uint32_t>> chain_arr
-        = fbuf_util::unpack_type_array<uint32_t>(buf, buf_off);        
-    if (chain_arr.has_value() == false) return std::nullopt;
+    size_t chains_num, max_len = 0;
 
-    //convert on-disk `uint32_t` to `off_t`
-    for (auto iter = chain_arr->begin();
-         iter != chain_arr->end(); ++ iter) {
-        offsets.push_back((off_t) *iter);
-    }
+    //per-level read state
+    sc::_batch_reader reader;
+    std::vector<uintptr_t> read_values;
+    std::vector<cm_byte> read_ok;
 
-    return std::pair<uint32_t, std::vector<off_t>>(*obj_idx, offsets);
-}
 
+    //typecast argument
+    sc::_ptrscan_verify_arg * v_arg = (sc::_ptrscan_verify_arg *) arg;
+    const std::vector<sc::ptrscan_chain> & chains = *v_arg->chains;
+    const std::vector<size_t> & order = *v_arg->order;
+    const std::vector<int> & prefix_lens = *v_arg->prefix_lens;
 
-[[nodiscard]] int sc::ptrscan::flatten_tree() {
+    //read through the target's PID if it is known
+    reader.set_pid(v_arg->pid);
 
-    /*
-     *  NOTE: To extract individual pointer chains from the pointer scan
-     *        tree, each leaf node is followed up until it reaches the
-     *        root node. Only the starting area is recorded.
-     *
-     */
+    //setup per-chain state
+    chains_num = v_arg->end - v_arg->begin;
+    std::vector<uintptr_t> addrs(chains_num, 0);
+    std::vector<cm_byte> alive(chains_num, false);
+    std::vector<size_t> read_idxs(chains_num, _verify_no_read);
 
-    int idx;
-    off_t offset;
+    //bootstrap every chain at the start of its object
+    for (size_t i = 0; i < chains_num; ++i) {
 
-    mc_vm_obj * obj;
-    std::shared_ptr<sc::_ptrscan_tree_node> parent;
+        const sc::ptrscan_chain & chain = chains[order[v_arg->begin + i]];
+        std::optional<const cm_lst_node *> obj_node = chain.get_obj_node();
+
+        //malformed chains are invalid
+        if ((obj_node.has_value() == false) || (obj_node.value() == nullptr)
+            || (chain.get_offsets().empty() == true)) continue;
 
+        addrs[i] = MC_GET_NODE_OBJ(obj_node.value())->start_addr;
+        alive[i] = true;
+        max_len = std::max(max_len, chain.get_offsets().size());
+    }
 
     //for every depth level
-    for (auto iter = this->tree_p->get_depth_level_cbegin();
-         iter != this->tree_p->get_depth_level_cend(); ++iter) {
+    for (size_t lvl = 0; lvl < max_len; ++lvl) {
 
-        //for every node at this depth level
-        for (auto inner_iter = iter->cbegin();
-             inner_iter != iter->cend(); ++inner_iter) {
+        reader.clear();
 
-            //fetch node
-            std::shared_ptr<sc::_ptrscan_tree_node> node = *inner_iter;
+        //queue a read for every chain that does not share a prefix
+        for (size_t i = 0; i < chains_num; ++i) {
 
-            //skip this node if it is not a leaf node
-            if (node->has_children() == true) continue;
+            read_idxs[i] = _verify_no_read;
+            if (alive[i] == false) continue;
 
-            /* While it is tempting to recurse here, it is slow. */
+            const std::vector<off_t> & offs
+                = chains[order[v_arg->begin + i]].get_offsets();
+            if (lvl >= (offs.size() - 1)) continue;
 
-            //for each tree edge from this leaf to the root, add a chain entry
-            std::vector<off_t> offsets;
-            do {
-                //fetch parent
-                parent = node->parent.lock();
-                if (parent == nullptr) break;
+            //if the previous chain reads the same prefix, reuse its read
+            if ((i > 0) && (prefix_lens[v_arg->begin + i] > lvl)) {
 
-                //add offset
-                offset = parent->own_addr - node->ptr_addr;
-                offsets.push_back(offset);
+                const std::vector<off_t> & prev_offs
+                    = chains[order[v_arg->begin + i - 1]].get_offsets();
+                if (lvl < (prev_offs.size() - 1)) continue;
+            }
 
-                //advance iteration
-                node = node->parent.lock();
+            read_idxs[i] = reader.add(addrs[i] + offs[lvl]);
+        }
 
-            } while (1);
+        //read every queued pointer at once
+        reader.read_ptrs(v_arg->session, v_arg->addr_width,
+                         read_values, read_ok);
 
-            /*
-             *  TODO: Make the offset relative to the object, not 
-             *        the area.
-             */
+        //advance every chain, in order such that reuse sees a fresh read
+        for (size_t i = 0; i < chains_num; ++i) {
 
-            //fetch data for this chain
-            auto chain_data = this->get_chain_data(
-                                        (*inner_iter)->area_node);
-            idx = this->get_chain_idx(chain_data.first);
+            if (alive[i] == false) continue;
 
-            //add an offset from the start of the last node's object
-            obj = MC_GET_NODE_OBJ(chain_data.second);
-            offsets.insert(offsets.begin(),
-                           (*inner_iter)->own_addr - obj->start_addr);
+            const std::vector<off_t> & offs
+                = chains[order[v_arg->begin + i]].get_offsets();
+            if (lvl >= offs.size()) continue;
 
-            //add chain
-            this->chains.emplace_back(ptrscan_chain(chain_data.second,
-                                                    idx, offsets));
+            //do not dereference the last pointer
+            if (lvl == (offs.size() - 1)) {
+                addrs[i] += offs[lvl];
 
-        } //end for every node at this depth level
+            //reuse the read of the previous chain
+            } else if (read_idxs[i] == _verify_no_read) {
+                addrs[i] = addrs[i - 1];
+                alive[i] = alive[i - 1];
+
+            //take this chain's own read
+            } else {
+                addrs[i] = read_values[read_idxs[i]];
+                alive[i] = read_ok[read_idxs[i]];
+            }
+        } //end for every chain in this share
 
     } //end for every depth level
 
-    return 0;
+    //record which chains arrived at their target address
+    for (size_t i = 0; i < chains_num; ++i) {
+
+        const sc::ptrscan_chain & chain = chains[order[v_arg->begin + i]];
+        const std::vector<uintptr_t> & target_addrs = *v_arg->target_addrs;
+
+        (*v_arg->valid)[order[v_arg->begin + i]]
+            = (alive[i] == true)
+              && (chain.get_target_idx() < target_addrs.size())
+              && (addrs[i] == target_addrs[chain.get_target_idx()]);
+    }
+
+    v_arg->ret = 0;
+    return nullptr;
 }
 
 
+
 /*
- *  NOTE: To verify if a chain is valid, simply attempt to follow it.
- *        If it arrives at the expected address, it is valid. Failure
- *        can be caused by both incorrect final address and failure to
- *        read (e.g.: trying to read unmapped memory).
+ *  --- [POINTER SCANNER | PRIVATE] ---
  */
 
-[[nodiscard]] bool sc::ptrscan::is_chain_valid(
-                                    const uintptr_t target_addr,
-                                    const struct sc::ptrscan_chain & chain,
-                                    mc_session & session) const {
+void sc::ptrscan::add_node(std::shared_ptr<sc::_ptrscan_tree_node> parent_node,
+                           const cm_lst_node * area_node,
+                           const uintptr_t own_addr,
+                           const uintptr_t ptr_addr) {
+
+    //create node inside the ptrscan tree
+    this->tree_p->add_node(
+        parent_node, area_node, this->cur_depth_level, own_addr, ptr_addr);
+
+    return;
+}
+
+
+/*
+ *  NOTE: Every scanned address must be matched against every node of
+ *        the previous depth level; with several targets this level can
+ *        grow large. Sorting it by address once per depth level turns
+ *        each match into a binary search.
+ */
+
+void sc::ptrscan::build_level_index() {
+
+    //fetch the previous depth level
+    const std::vector<std::shared_ptr<sc::_ptrscan_tree_node>> & level_vct
+        = this->tree_p->get_depth_level_vct(this->cur_depth_level - 1);
+
+    //sort its nodes by address
+    this->cache.level_nodes = level_vct;
+    std::sort(this->cache.level_nodes.begin(), this->cache.level_nodes.end(),
+              [](const std::shared_ptr<sc::_ptrscan_tree_node> & a,
+                 const std::shared_ptr<sc::_ptrscan_tree_node> & b) {
+        return a->own_addr < b->own_addr;
+    });
+
+    //store addresses contiguously for the search
+    this->cache.level_addrs.resize(this->cache.level_nodes.size());
+    for (size_t i = 0; i < this->cache.level_nodes.size(); ++i) {
+        this->cache.level_addrs[i] = this->cache.level_nodes[i]->own_addr;
+    }
+
+    #ifdef TRACE_PTRSCAN
+    std::printf("[SCRY] indexed depth layer %d: %lu nodes\n",
+                this->cur_depth_level - 1, this->cache.level_addrs.size());
+    #endif
+
+    return;
+}
+
+
+/*
+ *  NOTE: A bidirectional scan meets the backward search from the
+ *        targets with a forward search from the static areas. Memory
+ *        reachable from a static area in one hop is every range
+ *        [ptr - max_neg_off, ptr + max_obj_sz] where `ptr` is a pointer
+ *        stored inside the static area. Reading the pointers stored in
+ *        those ranges gives the next hop, and so on for half of
+ *        `max_depth`.
+ *
+ *        A backward node with n depth levels left can only start a
+ *        chain if it lies in memory reachable in at most n hops. Nodes
+ *        of the deepest levels are filtered this way, which removes
+ *        most of the frontier that never reaches a static area.
+ */
+
+[[nodiscard]] int sc::ptrscan::build_reach(const sc::opt & opts,
+                                           const sc::opt_ptr & opts_ptr) {
+
+    int ret;
+    int hops;
+    uintptr_t addr, chunk_end, value;
+    size_t ptr_sz;
+
+    mc_vm_area * area;
+    const mc_session * session;
+    const struct _addr_index_entry * entry;
+
+    std::vector<cm_byte> buf;
+    std::vector<std::pair<uintptr_t, uintptr_t>> frontier, next, cumulative;
+    sc::_addr_index area_index;
+
+
+    //fetch scan parameters
+    session = opts.get_sessions()[0];
+    ptr_sz = (size_t) opts.addr_width;
+    const off_t alignment = opts_ptr.get_alignment().value();
+    const uintptr_t max_obj_sz = opts_ptr.get_max_obj_sz().value();
+    const uintptr_t max_neg_off = opts_ptr.get_max_neg_off().value_or(0);
+    hops = opts_ptr.get_max_depth().value() / 2;
+
+    //index the areas of the map to validate pointers
+    area_index.build_areas(*opts.get_map());
+    const std::vector<struct _addr_index_entry> & entries
+        = area_index.get_entries();
+
+    //static areas are reachable in 0 hops
+    for (auto iter = opts_ptr.get_static_areas()->cbegin();
+         iter != opts_ptr.get_static_areas()->cend(); ++iter) {
+
+        area = MC_GET_NODE_AREA(*iter);
+        frontier.emplace_back(area->start_addr, area->end_addr);
+    }
+    _merge_ranges(frontier);
+    this->cache.reach.push_back(frontier);
+
+    //expand forward one hop at a time
+    for (int i = 0; i < hops; ++i) {
+
+        next.clear();
+
+        //for every range reached by the previous hop
+        for (auto iter = frontier.cbegin(); iter != frontier.cend(); ++iter) {
+
+            addr = iter->first;
+            while (addr < iter->second) {
+
+                //align the address
+                if ((addr % alignment) != 0)
+                    addr += alignment - (addr % alignment);
+                if (addr >= iter->second) break;
+
+                //skip to the next mapped area if the address is unmapped
+                entry = area_index.find_preceding(addr);
+                if (entry == nullptr || addr >= entry->end_addr) {
+
+                    entry = (entry == nullptr)
+                            ? entries.data() : entry + 1;
+                    if (entry == entries.data() + entries.size()) break;
+                    addr = std::max(addr, entry->start_addr);
+                    continue;
+                }
+
+                //read up to a chunk of this area
+                chunk_end = std::min({iter->second, entry->end_addr,
+                                      addr + _ptrscan_reach_chunk});
+                if ((chunk_end - addr) < ptr_sz) {
+                    addr = chunk_end;
+                    continue;
+                }
+
+                buf.resize(chunk_end - addr);
+                ret = mc_read(session, addr, buf.data(), buf.size());
+                if (ret != 0) {
+                    addr = chunk_end;
+                    continue;
+                }
+
+                //every stored pointer makes its object reachable
+                for (size_t off = 0; off + ptr_sz <= buf.size();
+                     off += alignment) {
+
+                    value = 0;
+                    std::memcpy(&value, buf.data() + off, ptr_sz);
+                    if (area_index.find_containing(value) == nullptr)
+                        continue;
+
+                    next.emplace_back((value > max_neg_off)
+                                      ? value - max_neg_off : 0,
+                                      value + max_obj_sz + 1);
+                }
+
+                addr = chunk_end;
+            } //end while inside range
+
+        } //end for every range
+
+        //record everything reachable in at most this many hops
+        _merge_ranges(next);
+        cumulative = this->cache.reach.back();
+        cumulative.insert(cumulative.end(), next.begin(), next.end());
+        _merge_ranges(cumulative);
+        this->cache.reach.push_back(std::move(cumulative));
+
+        /* Ranges already expanded may be read again, reads stay correct. */
+        frontier = std::move(next);
+        next = {};
+    }
+
+    #ifdef TRACE_PTRSCAN
+    std::printf("[SCRY] forward reach: %d hops, %lu ranges\n",
+                hops, this->cache.reach.back().size());
+    #endif
+
+    return 0;
+}
+
+
+[[nodiscard]] int sc::ptrscan::write_checkpoint(
+    const std::string & path, const sc::opt_ptr & opts_ptr,
+    const int depth_level) const {
+
+    uint32_t nodes_num;
+    std::ofstream fs;
+    struct _ptrscan_ckpt_hdr hdr;
+    std::vector<struct _ptrscan_ckpt_node> ckpt_nodes;
+    std::unordered_map<const sc::_ptrscan_tree_node *, uint32_t> parent_idxs;
+
+    const std::vector<std::shared_ptr<sc::_ptrscan_tree_node>> & level_vct
+        = this->tree_p->get_depth_level_vct(depth_level);
+
+
+    //index the parents of this depth level
+    if (depth_level > 0) {
+        const std::vector<std::shared_ptr<sc::_ptrscan_tree_node>> & parents
+            = this->tree_p->get_depth_level_vct(depth_level - 1);
+        for (size_t i = 0; i < parents.size(); ++i) {
+            parent_idxs[parents[i].get()] = i;
+        }
+    }
+
+    //convert every node of this depth level, zeroing their padding
+    ckpt_nodes.resize(level_vct.size());
+    std::memset(ckpt_nodes.data(), 0,
+                ckpt_nodes.size() * sizeof(struct _ptrscan_ckpt_node));
+
+    for (size_t i = 0; i < level_vct.size(); ++i) {
+
+        ckpt_nodes[i].own_addr = (uint64_t) level_vct[i]->own_addr;
+        if (depth_level == 0) continue;
+
+        std::shared_ptr<sc::_ptrscan_tree_node> parent
+            = level_vct[i]->parent.lock();
+        ckpt_nodes[i].parent_idx = parent_idxs[parent.get()];
+        ckpt_nodes[i].offset = (int64_t) (parent->own_addr
+                                          - level_vct[i]->ptr_addr);
+    }
+
+    //the targets start a new checkpoint, later depth levels are appended
+    fs = std::ofstream(path, std::ios::out | std::ios::binary
+                       | ((depth_level == 0) ? std::ios::trunc
+                                             : std::ios::app));
+    if (fs.fail() == true) {
+        sc_errno = SC_ERR_FILE;
+        return -1;
+    }
+
+    //write the header
+    if (depth_level == 0) {
+
+        _make_ckpt_hdr(hdr, opts_ptr, level_vct.size());
+        fs.write(reinterpret_cast<const char *>(&hdr), sizeof(hdr));
+    }
+
+    //write the depth level record
+    nodes_num = ckpt_nodes.size();
+    fs.write(reinterpret_cast<const char *>(&nodes_num), sizeof(nodes_num));
+    fs.write(reinterpret_cast<const char *>(ckpt_nodes.data()),
+             ckpt_nodes.size() * sizeof(struct _ptrscan_ckpt_node));
+    fs.write(reinterpret_cast<const char *>(&fbuf_util::_file_end),
+             sizeof(fbuf_util::_file_end));
+    
+    if (fs.fail() == true) {
+        sc_errno = SC_ERR_FILE;
+        fs.close();
+        return -1;
+    }
+
+    fs.close();
+    return 0;
+}
+
+
+/*
+ *  NOTE: Returns the number of depth levels restored from the checkpoint,
+ *        0 if there is no checkpoint to resume from, or -1 on error.
+ *        The checkpoint must have been made by a scan with the same
+ *        targets & options against the same map.
+ */
+
+[[nodiscard]] int sc::ptrscan::read_checkpoint(
+    const sc::opt & opts, const sc::opt_ptr & opts_ptr) {
+
+    int ret;
+    int levels_num = 0;
+    off_t good_off, file_sz;
+    uint32_t nodes_num;
+    cm_byte end_byte;
+
+    std::ifstream fs;
+    struct _ptrscan_ckpt_hdr hdr, expected_hdr;
+    std::vector<struct _ptrscan_ckpt_node> ckpt_nodes;
+    const struct _addr_index_entry * entry;
+    sc::_addr_index area_index;
+
+    const std::string & path = opts_ptr.get_checkpoint_path().value();
+    const std::vector<uintptr_t> target_addrs = opts_ptr.get_targets();
+    const int max_levels = opts_ptr.get_max_depth().value() + 1;
+
+
+    //a missing checkpoint starts a new scan
+    fs = std::ifstream(path, std::ios::in | std::ios::binary);
+    if (fs.fail() == true) return 0;
+
+    //get the size of the checkpoint
+    fs.seekg(0, std::ios::end);
+    file_sz = fs.tellg();
+    fs.seekg(0, std::ios::beg);
+
+    //read the header, it must match the header this scan would write
+    _make_ckpt_hdr(expected_hdr, opts_ptr, target_addrs.size());
+
+    fs.read(reinterpret_cast<char *>(&hdr), sizeof(hdr));
+    if (fs.fail() == true || fs.gcount() < sizeof(hdr)
+        || std::memcmp(&hdr, &expected_hdr, sizeof(hdr)) != 0) {
+
+        sc_errno = SC_ERR_INVALID_FILE;
+        goto _read_checkpoint_fail;
+    }
+    good_off = sizeof(hdr);
+
+    //index the areas of the map to re-attach every node
+    area_index.build_areas(*opts.get_map());
+
+    //restore every complete depth level
+    while (levels_num < max_levels) {
+
+        //read the depth level record, stop at an interrupted record
+        fs.read(reinterpret_cast<char *>(&nodes_num), sizeof(nodes_num));
+        if (fs.fail() == true) break;
+
+        //the first depth level must hold exactly the targets of this scan
+        if (levels_num == 0 && nodes_num != target_addrs.size()) {
+            sc_errno = SC_ERR_INVALID_FILE;
+            goto _read_checkpoint_fail;
+        }
+
+        //a record longer than the rest of the file was interrupted
+        if ((off_t) (nodes_num * sizeof(struct _ptrscan_ckpt_node))
+            > file_sz - good_off - (off_t) sizeof(nodes_num)) break;
+
+        ckpt_nodes.resize(nodes_num);
+        fs.read(reinterpret_cast<char *>(ckpt_nodes.data()),
+                nodes_num * sizeof(struct _ptrscan_ckpt_node));
+        if (fs.fail() == true) break;
+
+        fs.read(reinterpret_cast<char *>(&end_byte), sizeof(end_byte));
+        if (fs.fail() == true || end_byte != fbuf_util::_file_end) break;
+
+        //the first depth level must hold the targets in order
+        if (levels_num == 0) {
+            for (uint32_t i = 0; i < nodes_num; ++i) {
+                if (ckpt_nodes[i].own_addr != target_addrs[i]) {
+                    sc_errno = SC_ERR_INVALID_FILE;
+                    goto _read_checkpoint_fail;
+                }
+            }
+        }
+
+        //rebuild the nodes of this depth level
+        for (auto iter = ckpt_nodes.cbegin();
+             iter != ckpt_nodes.cend(); ++iter) {
+
+            entry = area_index.find_containing(iter->own_addr);
+
+            if (levels_num == 0) {
+                this->tree_p->add_node(
+                    this->tree_p->get_root_node(),
+                    (entry == nullptr) ? nullptr : entry->node,
+                    0, iter->own_addr, 0x0);
+                continue;
+            }
+
+            //every other node must be attached to its parent in the map
+            const std::vector<std::shared_ptr<sc::_ptrscan_tree_node>> &
+                parents = this->tree_p->get_depth_level_vct(levels_num - 1);
+            if (entry == nullptr || iter->parent_idx >= parents.size()) {
+                sc_errno = SC_ERR_INVALID_FILE;
+                goto _read_checkpoint_fail;
+            }
+
+            this->tree_p->add_node(
+                parents[iter->parent_idx], entry->node, levels_num,
+                iter->own_addr,
+                parents[iter->parent_idx]->own_addr - (off_t) iter->offset);
+        }
+
+        good_off += sizeof(nodes_num)
+                    + nodes_num * sizeof(struct _ptrscan_ckpt_node)
+                    + sizeof(end_byte);
+        ++levels_num;
+    }
+    fs.close();
+
+    //discard an interrupted depth level so new levels append cleanly
+    ret = truncate(path.c_str(), good_off);
+    if (ret != 0) {
+        sc_errno = SC_ERR_FILE;
+        return -1;
+    }
+
+    #ifdef TRACE_PTRSCAN
+    std::printf("[SCRY] resumed %d depth levels from a checkpoint\n",
+                levels_num);
+    #endif
+
+    return levels_num;
+
+    _read_checkpoint_fail:
+    fs.close();
+    return -1;
+}
+
+
+/*
+ *  NOTE: The spill file uses the checkpoint format. Once a depth level
+ *        is written, the level above it is no longer needed to match
+ *        new pointers or to index parents, so it is released.
+ */
+
+[[nodiscard]] int sc::ptrscan::spill_level(
+    const sc::opt_ptr & opts_ptr, const int depth_level) {
+
+    int ret;
+
+
+    //move this depth level to the spill file
+    ret = this->write_checkpoint(opts_ptr.get_spill_path().value(),
+                                 opts_ptr, depth_level);
+    if (ret != 0) return -1;
+    this->cache.spill_counts.push_back(
+        this->tree_p->get_depth_level_vct(depth_level).size());
+
+    //release the depth level above it
+    if (depth_level > 0) this->tree_p->release_level(depth_level - 1);
+
+    return 0;
+}
+
+
+[[nodiscard]] _SC_DBG_INLINE int
+    sc::ptrscan::get_chain_idx(const std::string & pathname) {
+
+    //intern the pathname if it is not present yet
+    auto ret = this->cache.pathname_idxs.emplace(
+                   pathname, (uint32_t) this->ser_pathnames.size());
+    if (ret.second == true) this->ser_pathnames.push_back(pathname);
+
+    //return its index
+    return ret.first->second;
+}
+
+
+void sc::ptrscan::clear_pathnames() {
+
+    this->ser_pathnames.clear();
+    this->ser_pathnames.shrink_to_fit();
+    this->cache.pathname_idxs.clear();
+
+    return;
+}
+
+
+[[nodiscard]] std::pair<size_t, size_t>
+    sc::ptrscan::get_fbuf_data_sz(const std::vector<cm_byte> * keep) const {
+
+    size_t pathnames_sz = 0, chains_sz = 0;
+
+    //add-up pathname sizes
+    for (auto iter = this->ser_pathnames.begin();
+         iter != this->ser_pathnames.end(); ++iter) {
+
+        //pathname string + null terminator
+        pathnames_sz += iter->size() + 1;
+    }
+
+    //additional null terminator to denote the end of pathnames
+    pathnames_sz += 1;
+
+    //add-up chain sizes
+    for (auto iter = this->chains.begin();
+         iter != this->chains.end(); ++iter) {
+
+        //skip chains that are not kept
+        if ((keep != nullptr)
+            && ((*keep)[iter - this->chains.begin()] == false)) continue;
+
+        //pathname index, target index & stability counters
+        chains_sz += 16;
+
+        //offsets & continue/end bytes
+        chains_sz += iter->get_offsets().size() * (sizeof(int64_t) + 1);
+    }
+
+    //end of each chain contains a continue/end byte
+    //chains_sz += this->chains.size(); FIXME: Remove?
+
+    return std::pair<size_t, size_t>(pathnames_sz, chains_sz);
+}
+
+
+//interpret the start of the file buffer
+[[nodiscard]] int sc::ptrscan::handle_body_start(
+    const std::vector<cm_byte> & buf, off_t hdr_off,
+    off_t & buf_off, uint32_t & chains_num) {
+
+    //fetch the ptrscan header
+    std::optional<struct ptr_file_hdr> local_hdr
+        = fbuf_util::unpack_type<struct ptr_file_hdr>(buf, buf_off);
+    if (local_hdr.has_value() == false) return -1;
+    chains_num = local_hdr->chains_num;
+
+    //fetch every pathname
+    do {
+
+        //fetch the pathname string
+        std::optional<std::string> pathname
+            = fbuf_util::unpack_string(buf, buf_off);
+        if (pathname.has_value() == false) return -1;
+
+        //if there are no more strings, stop
+        if (pathname->empty()) {
+
+            //skip second null byte
+            buf_off += 1;
+            break;
+        }
+
+        /*
+         *  NOTE: Chains refer to pathnames by their position in the
+         *        file, so the pathname is stored even if it repeats.
+         */
+
+        //otherwise intern this pathname
+        this->cache.pathname_idxs.emplace(
+            pathname.value(), (uint32_t) this->ser_pathnames.size());
+        this->ser_pathnames.push_back(pathname.value());
+
+    } while(true);
+
+    return 0;
+}
+
+
+//interpret a single chain in the file buffer
+[[nodiscard]] std::optional<sc::ptrscan_chain>
+    sc::ptrscan::handle_body_chain(
+        const std::vector<cm_byte> & buf, off_t & buf_off,
+        const cm_byte version) {
+
+    std::vector<off_t> offsets;
+    std::optional<uint32_t> target_idx = 0;
+    std::optional<uint32_t> checks = 0, hits = 0;
+
+    
+    //fetch the object index
+    std::optional<uint32_t> obj_idx
+        = fbuf_util::unpack_type<uint32_t>(buf, buf_off);
+    if (obj_idx.has_value() == false) return std::nullopt;
+    if (obj_idx.value() >= this->ser_pathnames.size()) return std::nullopt;
+
+    //fetch the target index, version 0 files only had a single target
+    if (version >= sc::file_ver_1) {
+        target_idx = fbuf_util::unpack_type<uint32_t>(buf, buf_off);
+        if (target_idx.has_value() == false) return std::nullopt;
+    }
+
+    //fetch the stability counters, older versions were never scored
+    if (version >= sc::file_ver_3) {
+        checks = fbuf_util::unpack_type<uint32_t>(buf, buf_off);
+        if (checks.has_value() == false) return std::nullopt;
+        hits = fbuf_util::unpack_type<uint32_t>(buf, buf_off);
+        if (hits.has_value() == false) return std::nullopt;
+    }
+
+    //fetch the signed chain array
+    if (version >= sc::file_ver_2) {
+
+        std::optional<std::vector<int64_t>> chain_arr
+            = fbuf_util::unpack_type_array<int64_t>(buf, buf_off);
+        if (chain_arr.has_value() == false) return std::nullopt;
+
+        offsets.assign(chain_arr->begin(), chain_arr->end());
+
+    //fetch the chain array, older versions only stored positive offsets
+    } else {
+
+        std::optional<std::vector<uint32_t>> chain_arr
+            = fbuf_util::unpack_type_array<uint32_t>(buf, buf_off);        
+        if (chain_arr.has_value() == false) return std::nullopt;
+
+        //convert on-disk `uint32_t` to `off_t`
+        for (auto iter = chain_arr->begin();
+             iter != chain_arr->end(); ++ iter) {
+            offsets.push_back((off_t) *iter);
+        }
+    }
+
+    sc::ptrscan_chain chain(this->ser_pathnames[obj_idx.value()],
+                            obj_idx.value(), offsets, target_idx.value());
+    chain._set_stability(checks.value(), hits.value());
+
+    return chain;
+}
+
+
+[[nodiscard]] int sc::ptrscan::flatten_tree(const mc_vm_map & map,
+                                            const sc::opt_ptr & opts_ptr) {
+
+    /*
+     *  NOTE: To extract individual pointer chains from the pointer scan
+     *        tree, each leaf node is followed up until it reaches the
+     *        root node. Only the starting object is recorded.
+     *
+     *        The owning object of every leaf is found with a binary
+     *        search of an index built once per flattening, rather than
+     *        by following the area's object pointers.
+     */
 
     int ret;
-    uintptr_t addr;
+    off_t offset;
+    std::shared_ptr<sc::_ptrscan_tree_node> parent;
+    std::unordered_map<const sc::_ptrscan_tree_node *, uint32_t> target_idxs;
+
+    sc::_addr_index obj_index;
+    std::vector<int> obj_idxs;
+
+
+    //index the objects of the map, each pathname is interned once
+    obj_index.build_objs(map);
+    obj_idxs.resize(obj_index.get_entries().size(), -1);
+
+    //add the chain that starts at a leaf, `offsets` are ordered leaf-first
+    auto add_chain = [&](const uintptr_t leaf_addr,
+                         std::vector<off_t> & offsets,
+                         const uint32_t target_idx) {
+
+        mc_vm_obj * obj;
+        size_t entry_idx;
+        const struct _addr_index_entry * entry;
+
+        //in a bidirectional scan, chains must start in a static area
+        if (this->cache.reach.empty() == false
+            && _in_ranges(this->cache.reach[0], leaf_addr) == false) return;
+
+        //find the object that owns the leaf, skip unowned leaves
+        entry = obj_index.find_preceding(leaf_addr);
+        if (entry == nullptr) return;
+
+        obj = MC_GET_NODE_OBJ(entry->node);
+        entry_idx = entry - obj_index.get_entries().data();
+        if (obj_idxs[entry_idx] == -1) {
+            obj_idxs[entry_idx] = this->get_chain_idx(obj->pathname);
+        }
+
+        //add an offset from the start of the leaf's object
+        offsets.insert(offsets.begin(), leaf_addr - obj->start_addr);
+
+        //add chain
+        this->chains.emplace_back(ptrscan_chain(entry->node,
+                                                obj_idxs[entry_idx],
+                                                offsets, target_idx));
+        return;
+    };
+
+    //depth levels moved out of memory are flattened from the spill file
+    if (this->cache.spill_counts.empty() == false) {
+        ret = this->flatten_spill(opts_ptr, add_chain);
+        return ret;
+    }
+
+    //the position of a target in the first depth level is its index
+    const std::vector<std::shared_ptr<sc::_ptrscan_tree_node>> & targets
+        = this->tree_p->get_depth_level_vct(0);
+    for (size_t i = 0; i < targets.size(); ++i) {
+        target_idxs[targets[i].get()] = i;
+    }
+
+    //for every depth level
+    for (auto iter = this->tree_p->get_depth_level_cbegin();
+         iter != this->tree_p->get_depth_level_cend(); ++iter) {
+
+        //for every node at this depth level
+        for (auto inner_iter = iter->cbegin();
+             inner_iter != iter->cend(); ++inner_iter) {
+
+            //fetch node
+            std::shared_ptr<sc::_ptrscan_tree_node> node = *inner_iter;
+
+            //skip this node if it is not a leaf node
+            if (node->has_children() == true) continue;
+
+            /* While it is tempting to recurse here, it is slow. */
+
+            //for each tree edge from this leaf to a target, add a chain entry
+            std::vector<off_t> offsets;
+            do {
+                //fetch parent, stop at the virtual root
+                parent = node->parent.lock();
+                if (parent == nullptr
+                    || parent == this->tree_p->get_root_node()) break;
+
+                //add offset
+                offset = parent->own_addr - node->ptr_addr;
+                offsets.push_back(offset);
+
+                //advance iteration
+                node = node->parent.lock();
+
+            } while (1);
+
+            //the last node reached is the target of this chain
+            add_chain((*inner_iter)->own_addr,
+                      offsets, target_idxs[node.get()]);
+
+        } //end for every node at this depth level
+
+    } //end for every depth level
+
+    return 0;
+}
+
+
+/*
+ *  NOTE: Flattening a spilled tree is a single streaming pass over the
+ *        memory mapped spill file. A node is a leaf if no node of the
+ *        next depth level names it as its parent; only a bitmap of the
+ *        current depth level is kept in memory.
+ */
+
+[[nodiscard]] int sc::ptrscan::flatten_spill(
+    const sc::opt_ptr & opts_ptr,
+    const std::function<void(const uintptr_t, std::vector<off_t> &,
+                             const uint32_t)> & add_chain) const {
+
+    int fd, ret;
+    struct stat st;
+    size_t file_off;
+    uint32_t idx;
 
+    cm_byte * data;
+    struct _ptrscan_ckpt_node ckpt_node;
+    std::vector<size_t> level_offs;
+    std::vector<cm_byte> has_child;
+    std::vector<off_t> offsets;
+
+    const std::vector<uint32_t> & counts = this->cache.spill_counts;
 
-    //return false if chain is malformed
-    if ((chain.get_obj_node().has_value() == false)
-        || (chain.get_obj_node().value() == nullptr)) return false;
 
-    //get relevant object & bootstrap iteration
-    const cm_lst_node * obj_node = chain.get_obj_node().value();
-    const mc_vm_obj * obj = MC_GET_NODE_OBJ(obj_node);
-    addr = obj->start_addr;
+    //map the spill file
+    fd = open(opts_ptr.get_spill_path()->c_str(), O_RDONLY);
+    if (fd == -1) {
+        sc_errno = SC_ERR_FILE;
+        return -1;
+    }
+
+    ret = fstat(fd, &st);
+    if (ret != 0 || st.st_size == 0) {
+        sc_errno = SC_ERR_FILE;
+        close(fd);
+        return -1;
+    }
+
+    data = (cm_byte *) mmap(nullptr, st.st_size,
+                            PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        sc_errno = SC_ERR_FILE;
+        return -1;
+    }
+
+    //locate the nodes of every depth level
+    file_off = sizeof(struct _ptrscan_ckpt_hdr);
+    for (auto iter = counts.cbegin(); iter != counts.cend(); ++iter) {
+        level_offs.push_back(file_off + sizeof(uint32_t));
+        file_off += sizeof(uint32_t)
+                    + (*iter * sizeof(struct _ptrscan_ckpt_node))
+                    + sizeof(fbuf_util::_file_end);
+    }
+
+    if (file_off > (size_t) st.st_size) {
+        sc_errno = SC_ERR_INVALID_FILE;
+        munmap(data, st.st_size);
+        return -1;
+    }
+
+    //records are packed, copy them out to respect alignment
+    auto get_node = [&](const size_t level, const uint32_t i) {
+        std::memcpy(&ckpt_node, data + level_offs[level]
+                    + (i * sizeof(struct _ptrscan_ckpt_node)),
+                    sizeof(ckpt_node));
+        return ckpt_node;
+    };
+
+    //for every depth level
+    for (size_t level = 0; level < counts.size(); ++level) {
+
+        //find which nodes of this depth level have children
+        has_child.assign(counts[level], false);
+        if ((level + 1) < counts.size()) {
+            for (uint32_t i = 0; i < counts[level + 1]; ++i) {
+                idx = get_node(level + 1, i).parent_idx;
+                if (idx < counts[level]) has_child[idx] = true;
+            }
+        }
+
+        //follow every leaf up to its target
+        for (uint32_t i = 0; i < counts[level]; ++i) {
+
+            if (has_child[i] == true) continue;
+
+            offsets.clear();
+            idx = i;
+            for (size_t up = level; up > 0; --up) {
+                struct _ptrscan_ckpt_node up_node = get_node(up, idx);
+                offsets.push_back(up_node.offset);
+                idx = up_node.parent_idx;
+            }
+
+            add_chain(get_node(level, i).own_addr, offsets, idx);
+        }
+    }
+
+    munmap(data, st.st_size);
+    return 0;
+}
+
+
+//keep the shortest chains with the smallest offsets
+void sc::ptrscan::prune_chains(const size_t max_chains) {
+
+    std::vector<size_t> order;
+    std::vector<uintptr_t> weights;
+    std::vector<sc::ptrscan_chain> kept_chains;
+
+
+    if (this->chains.size() <= max_chains) return;
+
+    /*
+     *  NOTE: The first offset locates the chain inside its object and
+     *        says nothing about its quality, it is not weighed.
+     */
+
+    //weigh every chain
+    weights.resize(this->chains.size(), 0);
+    for (size_t i = 0; i < this->chains.size(); ++i) {
+
+        const std::vector<off_t> & offs = this->chains[i].get_offsets();
+        for (size_t j = 1; j < offs.size(); ++j)
+            weights[i] += std::abs(offs[j]);
+    }
+
+    //select the best chains
+    order.resize(this->chains.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::nth_element(order.begin(), order.begin() + max_chains, order.end(),
+                     [&](size_t a, size_t b) {
+        size_t a_len = this->chains[a].get_offsets().size();
+        size_t b_len = this->chains[b].get_offsets().size();
+
+        if (a_len != b_len) return a_len < b_len;
+        if (weights[a] != weights[b]) return weights[a] < weights[b];
+        return a < b;
+    });
+
+    //keep selected chains in their original order
+    order.resize(max_chains);
+    std::sort(order.begin(), order.end());
+
+    kept_chains.reserve(max_chains);
+    for (auto iter = order.begin(); iter != order.end(); ++iter) {
+        kept_chains.push_back(std::move(this->chains[*iter]));
+    }
+
+    this->report.chains_dropped += this->chains.size() - max_chains;
+    this->chains = std::move(kept_chains);
+
+    return;
+}
+
+
+//verify every chain, splitting the work between sessions
+[[nodiscard]] int sc::ptrscan::verify_chains(
+                        const sc::opt & opts,
+                        const std::vector<uintptr_t> & target_addrs,
+                        std::vector<cm_byte> & valid) const {
+
+    int ret;
+    bool run_err = false;
+
+    size_t part_sz, begin;
+    int started;
+
+    std::vector<size_t> order;
+    std::vector<int> prefix_lens;
+    std::vector<struct _ptrscan_verify_arg> v_args;
+    std::vector<pthread_t> thread_ids;
+
+
+    //fetch sessions, one thread is used per session
+    const std::vector<const mc_session *> & sessions = opts.get_sessions();
+
+    //sort chains such that chains sharing a prefix are adjacent
+    order.resize(this->chains.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+        return _chain_less(this->chains[a], this->chains[b]);
+    });
+
+    //find the length of the prefix each chain shares with its predecessor
+    prefix_lens.resize(order.size(), 0);
+    for (size_t i = 1; i < order.size(); ++i) {
+        prefix_lens[i] = _chain_prefix_len(this->chains[order[i - 1]],
+                                           this->chains[order[i]]);
+    }
+
+    //every chain is invalid until proven otherwise
+    valid.assign(this->chains.size(), false);
+
+    /*
+     *  NOTE: Splitting a prefix group between two threads only costs
+     *        the second thread a re-read of the shared prefix.
+     */
+
+    //divide the sorted chains between sessions
+    part_sz = (order.size() / sessions.size()) + 1;
+    for (begin = 0; begin < order.size(); begin += part_sz) {
+
+        struct _ptrscan_verify_arg v_arg;
+
+        v_arg.chains      = &this->chains;
+        v_arg.order       = &order;
+        v_arg.prefix_lens = &prefix_lens;
+        v_arg.begin       = begin;
+        v_arg.end         = std::min(begin + part_sz, order.size());
+        v_arg.target_addrs = &target_addrs;
+        v_arg.addr_width  = opts.addr_width;
+        v_arg.session     = sessions[v_args.size()];
+        v_arg.pid         = opts.get_pid();
+        v_arg.valid       = &valid;
+        v_arg.ret         = 0;
+
+        v_args.push_back(v_arg);
+    }
+
+    //start a thread for every share of chains
+    thread_ids.resize(v_args.size());
+    for (started = 0; started < v_args.size(); ++started) {
+
+        ret = pthread_create(&thread_ids[started], nullptr,
+                             _verify_worker, &v_args[started]);
+        if (ret != 0) {
+            sc_errno = SC_ERR_PTHREAD;
+            run_err = true;
+            break;
+        }
+    }
+
+    //wait for every started thread to finish
+    for (int i = 0; i < started; ++i) {
+
+        ret = pthread_join(thread_ids[i], nullptr);
+        if (ret != 0) {
+            sc_errno = SC_ERR_PTHREAD;
+            run_err = true;
+        }
+    }
+
+    return run_err ? -1 : 0;
+}
+
+
+//serialise chains, if `keep` is provided only the kept chains are stored
+[[nodiscard]] int sc::ptrscan::generate_body(
+    std::vector<cm_byte> & buf, const off_t hdr_off,
+    const std::vector<cm_byte> * keep) const {
+
+    int ret;
+    struct sc::ptr_file_hdr local_hdr;
+
+    cm_byte ctrl_byte;
+    off_t buf_off = 0;
+    std::pair<size_t, size_t> ptrscan_data_szs;
+    uint32_t chains_num;
+
+
+    //count chains to store
+    chains_num = (keep == nullptr)
+                 ? this->chains.size()
+                 : std::count(keep->begin(), keep->end(), true);
+
+    //get the size of pathnames & chains
+    ptrscan_data_szs = this->get_fbuf_data_sz(keep);
+
+    //build local header
+    local_hdr.pathnames_num = this->ser_pathnames.size();
+    local_hdr.pathnames_offset = hdr_off + sizeof(local_hdr);
+    local_hdr.chains_num = chains_num;
+    local_hdr.chains_offset = hdr_off
+                              + sizeof(local_hdr)
+                              + ptrscan_data_szs.first;
+
+    //allocate space in the vector for the data
+    buf.resize(sizeof(local_hdr)
+               + ptrscan_data_szs.first + ptrscan_data_szs.second + 1);
+
+
+    //store the header
+    ret = fbuf_util::pack_type<struct ptr_file_hdr>(
+                                                buf, buf_off, local_hdr);
+    if (ret != 0) return -1;
+    
+
+    //store every pathname
+    for (auto iter = this->ser_pathnames.begin();
+         iter != this->ser_pathnames.end(); ++iter) {
+
+        ret = fbuf_util::pack_string(buf, buf_off, *iter);
+        if (ret != 0) return -1;
+    }
+
+    //store an additional null terminator to denote the end of pathnames
+    ctrl_byte = 0x00;
+    ret = fbuf_util::pack_type(buf, buf_off, ctrl_byte);
+    if (ret != 0) return -1;
+    
+
+    //store every chain
+    for (auto iter = this->chains.begin();
+         iter != this->chains.end(); ++iter) {
+
+        //skip chains that are not kept
+        if ((keep != nullptr)
+            && ((*keep)[iter - this->chains.begin()] == false)) continue;
+
+        //store pathname index
+        ret = fbuf_util::pack_type(buf, buf_off, iter->_get_obj_idx());
+        if (ret != 0) return -1;
+
+        //store target index
+        ret = fbuf_util::pack_type(buf, buf_off, iter->get_target_idx());
+        if (ret != 0) return -1;
 
-    //for every offset
-    const std::vector<off_t> & offs = chain.get_offsets();
-    for (int i = 0; i < offs.size(); ++i) {
+        //store stability counters
+        ret = fbuf_util::pack_type(buf, buf_off, iter->get_checks());
+        if (ret != 0) return -1;
+        ret = fbuf_util::pack_type(buf, buf_off, iter->get_hits());
+        if (ret != 0) return -1;
 
-        //read next address
-        addr += offs[i];
+        //store every signed offset
+        std::vector<int64_t> offsets_64bit(iter->get_offsets().cbegin(),
+                                           iter->get_offsets().cend());
 
-        //do not dereference the last pointer
-        if (i < (offs.size() - 1)) {
-            ret = mc_read(&session, addr, (cm_byte *) &addr, sizeof(addr));
-            if (ret != 0) return false;
-        }
+        ret = fbuf_util::pack_type_array<int64_t>(
+            buf, buf_off, offsets_64bit);
+        if (ret != 0) return -1;
     }
 
-    return (addr == target_addr) ? true : false;
+    //store the file end byte
+    ctrl_byte = fbuf_util::_file_end;
+    ret = fbuf_util::pack_type(buf, buf_off, ctrl_byte);
+    if (ret != 0) return -1;
+
+    return 0;
 }
 
 
@@ -474,15 +1908,25 @@ void sc::ptrscan::do_reset() {
     if (this->tree_p.get() != nullptr) this->tree_p->reset();
     this->cur_depth_level = 0;
     
-    this->ser_pathnames.clear();
-    this->ser_pathnames.shrink_to_fit();
+    this->clear_pathnames();
 
     this->chains.clear();
     this->chains.shrink_to_fit();
 
+    this->report = sc::ptrscan_report();
+
     //reset cache
+    this->cache.level_addrs.clear();
+    this->cache.level_addrs.shrink_to_fit();
+    this->cache.level_nodes.clear();
+    this->cache.level_nodes.shrink_to_fit();
+
     this->cache.serial_buf.clear();
     this->cache.serial_buf.shrink_to_fit();
+    this->cache.reach.clear();
+    this->cache.reach.shrink_to_fit();
+    this->cache.spill_counts.clear();
+    this->cache.spill_counts.shrink_to_fit();
 
     return;
 }
@@ -519,11 +1963,6 @@ struct _potential_node {
                                     const opt * const opts,
                                     const _opt_scan * const opts_scan) {
 
-    #ifdef TRACE_PTRSCAN
-    mc_vm_area * _trace_area;
-    mc_vm_obj * _trace_obj;
-    #endif
-
     /*
      *  NOTE: This function is called for each byte of memory that is
      *        scanned; it is imperative that the most common fail cases
@@ -552,32 +1991,6 @@ struct _potential_node {
     if (arg.buf_left < required_left) return 0;
     */
 
-    /*
-     *  `const` qualifier is discarded; no better way to do this the way
-     *  things are currently organised.
-     */
-
-    //re-cache the depth level vector at the start of every area
-    if (arg.area_off == 0) {
-
-        this->cache.depth_level_vct =
-            (std::vector<std::shared_ptr<sc::_ptrscan_tree_node>> *)
-            &this->tree_p->get_depth_level_vct(this->cur_depth_level - 1);
-
-        #ifdef TRACE_PTRSCAN
-        //log current address & depth vector being cached
-        _trace_area = MC_GET_NODE_AREA(arg.area_node);
-        _trace_obj = _trace_area->obj_node_p == nullptr
-                     ? MC_GET_NODE_OBJ(_trace_area->last_obj_node_p)
-                     : MC_GET_NODE_OBJ(_trace_area->obj_node_p);
-
-        std::printf("[SCRY] caching depth layer %d: %s - 0x%lx\n",
-                    this->cur_depth_level,
-                    _trace_obj->basename,
-                    _trace_area->start_addr);
-        #endif
-    }
-
     /*
      *  NOTE: `new_nodes` stores nodes that will be added by the end of
      *        this call (if any). In case a smart scan is being performed,
@@ -590,7 +2003,10 @@ struct _potential_node {
 
     //setup new node container
     std::vector<struct _potential_node> new_nodes;
-    off_t min_obj_sz = opts_ptr->get_max_obj_sz().value();
+    const uintptr_t max_obj_sz = opts_ptr->get_max_obj_sz().value();
+    const uintptr_t max_neg_off = opts_ptr->get_max_neg_off().value_or(0);
+    uintptr_t min_obj_sz = std::max(max_obj_sz, max_neg_off);
+    uintptr_t dist;
 
     //get potential pointer value
     uintptr_t potential_ptr;
@@ -610,25 +2026,33 @@ struct _potential_node {
 
 
     /*
-     *  NOTE: Iteration over each potential parent node begins now.
+     *  NOTE: A potential pointer can point to any node at most
+     *        `max_obj_sz` bytes above it, or at most `max_neg_off`
+     *        bytes below it. Only nodes in the range
+     *        [potential_ptr - max_neg_off, potential_ptr + max_obj_sz]
+     *        are visited.
      */
 
-    //for every ptrscan tree node at this depth
-    for (auto level_iter = this->cache.depth_level_vct->begin();
-         level_iter != this->cache.depth_level_vct->end(); ++level_iter) {
+    //find the first ptrscan tree node inside the window
+    const uintptr_t window_start = (potential_ptr > max_neg_off)
+                                   ? potential_ptr - max_neg_off : 0;
+    const uintptr_t window_end
+        = (potential_ptr > (UINTPTR_MAX - max_obj_sz))
+          ? UINTPTR_MAX : potential_ptr + max_obj_sz;
 
-        //get the current node from the iterator
-        const std::shared_ptr<sc::_ptrscan_tree_node> & now_node
-            = *level_iter;
+    const std::vector<uintptr_t> & level_addrs = this->cache.level_addrs;
+    auto addr_iter = std::lower_bound(level_addrs.begin(),
+                                      level_addrs.end(), window_start);
 
-        //if this potential pointer falls outside the range of this
-        //node, skip it
-        if (potential_ptr <
-                (now_node->own_addr - opts_ptr->get_max_obj_sz().value())
-            || potential_ptr > (now_node->own_addr)) continue;
+    //for every ptrscan tree node within range of this potential pointer
+    for (; addr_iter != level_addrs.end()
+           && *addr_iter <= window_end; ++addr_iter) {
 
+        //get the current node
+        const std::shared_ptr<sc::_ptrscan_tree_node> & now_node
+            = this->cache.level_nodes[addr_iter - level_addrs.begin()];
 
-        //else this is a match
+        //this is a match
         #ifdef TRACE_PTRSCAN
         //log a new match
         std::printf(
@@ -663,13 +2087,19 @@ struct _potential_node {
         //if this is a smart scan, manipulate the new node container
         if (opts_ptr->get_smart_scan() == true) {
 
+            //offsets in either direction are compared by distance
+            dist = (now_node->own_addr >= potential_ptr)
+                   ? now_node->own_addr - potential_ptr
+                   : potential_ptr - now_node->own_addr;
+
             //if greater than current minimum, ignore this match
-            if ((now_node->own_addr - potential_ptr)
-                 > min_obj_sz) continue;
+            if (dist > min_obj_sz) continue;
 
             //if smaller than current minimum, reset the node container
-            if ((now_node->own_addr - potential_ptr)
-                 < min_obj_sz) new_nodes.clear();
+            if (dist < min_obj_sz) {
+                new_nodes.clear();
+                min_obj_sz = dist;
+            }
 
         }
 
@@ -684,7 +2114,20 @@ struct _potential_node {
         new_nodes.push_back(_potential_node(arg.addr, potential_ptr,
                                             now_node, arg.area_node));
         
-    } //end for every ptrscan tree node at this depth
+    } //end for every ptrscan tree node within range
+
+    //most addresses match nothing, do not touch the mutex for them
+    if (new_nodes.empty() == true) return opts_ptr->get_alignment().value();
+
+    //drop nodes that no static area can reach with the levels left
+    if (opts_ptr->get_bidirectional() == true) {
+
+        const size_t levels_left
+            = opts_ptr->get_max_depth().value() - this->cur_depth_level;
+        if (levels_left < this->cache.reach.size()
+            && _in_ranges(this->cache.reach[levels_left], arg.addr) == false)
+            return opts_ptr->get_alignment().value();
+    }
 
 
     /*
@@ -711,6 +2154,18 @@ struct _potential_node {
                                new_iter->ptr_addr);
     }
 
+    //bound the memory of this depth level if it is limited
+    if (_is_pruned(*opts_ptr) == true
+        && (this->tree_p->get_depth_level_vct(this->cur_depth_level).size()
+            >= this->tree_p->get_prune_at())) {
+
+        this->tree_p->prune_level(
+            this->cur_depth_level, *opts_ptr, this->report);
+        this->tree_p->set_prune_at(std::max(this->tree_p->get_prune_at(),
+            2 * this->tree_p->get_depth_level_vct(
+                                        this->cur_depth_level).size()));
+    }
+
     //release the mutex
     ret = pthread_mutex_unlock(&this->tree_p->get_write_mutex());
     if (ret != 0) {
@@ -726,11 +2181,6 @@ struct _potential_node {
     std::vector<cm_byte> & buf, const off_t hdr_off) {
 
     int ret;
-    struct sc::ptr_file_hdr local_hdr;
-
-    cm_byte ctrl_byte;
-    off_t buf_off = 0;
-    std::pair<size_t, size_t> ptrscan_data_szs;
 
 
     //lock scanner
@@ -742,68 +2192,8 @@ struct _potential_node {
         goto _generate_body_fail;
     }
 
-    //get the size of pathnames & chains
-    ptrscan_data_szs = this->get_fbuf_data_sz();
-
-    //build local header
-    local_hdr.pathnames_num = this->ser_pathnames.size();
-    local_hdr.pathnames_offset = hdr_off + sizeof(local_hdr);
-    local_hdr.chains_num = this->chains.size();
-    local_hdr.chains_offset = hdr_off
-                              + sizeof(local_hdr)
-                              + ptrscan_data_szs.first;
-
-    //allocate space in the vector for the data
-    buf.resize(sizeof(local_hdr)
-               + ptrscan_data_szs.first + ptrscan_data_szs.second + 1);
-
-
-    //store the header
-    ret = fbuf_util::pack_type<struct ptr_file_hdr>(
-                                                buf, buf_off, local_hdr);
-    if (ret != 0) goto _generate_body_fail;
-    
-
-    //store every pathname
-    for (auto iter = this->ser_pathnames.begin();
-         iter != this->ser_pathnames.end(); ++iter) {
-
-        ret = fbuf_util::pack_string(buf, buf_off, *iter);
-        if (ret != 0) goto _generate_body_fail;
-    }
-
-    //store an additional null terminator to denote the end of pathnames
-    ctrl_byte = 0x00;
-    ret = fbuf_util::pack_type(buf, buf_off, ctrl_byte);
-    if (ret != 0) goto _generate_body_fail;
-    
-
-    //store every chain
-    for (auto iter = this->chains.begin();
-         iter != this->chains.end(); ++iter) {
-
-        //store pathname index
-        ret = fbuf_util::pack_type(buf, buf_off, iter->_get_obj_idx());
-        if (ret != 0) goto _generate_body_fail;
-
-        //store every offset & downcast to 32bit offsets
-        std::vector<uint32_t> offsets_32bit;
-        offsets_32bit.resize(iter->get_offsets().size());
-        std::transform(iter->get_offsets().cbegin(),
-                       iter->get_offsets().cend(),
-                       offsets_32bit.begin(),
-                       [](off_t offset) {
-            return (uint32_t) offset;
-        });
-
-        ret = fbuf_util::pack_type_array<uint32_t>(
-            buf, buf_off, offsets_32bit);
-        if (ret != 0) goto _generate_body_fail;
-    }
-
-    //store the file end byte
-    ctrl_byte = fbuf_util::_file_end;
-    ret = fbuf_util::pack_type(buf, buf_off, ctrl_byte);
+    //serialise every chain
+    ret = this->generate_body(buf, hdr_off, nullptr);
     if (ret != 0) goto _generate_body_fail;
 
     _UNLOCK(-1)
@@ -816,57 +2206,56 @@ struct _potential_node {
 
 
 [[nodiscard]] int sc::ptrscan::_process_body(
-    const std::vector<cm_byte> & buf, off_t hdr_off, const mc_vm_map & map) {
+    const std::vector<cm_byte> & buf, off_t hdr_off,
+    const cm_byte version, const mc_vm_map & map) {
 
     int ret;
-    std::optional<std::pair<uint32_t, std::vector<off_t>>> inprog_chain;
+    std::optional<sc::ptrscan_chain> inprog_chain;
 
     off_t buf_off = 0;
+    uint32_t chains_num;
 
     cm_lst_node * obj_node;
-    std::unordered_map<std::string, cm_lst_node *> obj_node_map;
+    std::vector<cm_lst_node *> obj_nodes;
 
 
     //lock scanner
     _LOCK(-1)
 
     //process the start of the header
-    ret = this->handle_body_start(buf, hdr_off, buf_off);
+    ret = this->handle_body_start(buf, hdr_off, buf_off, chains_num);
     if (ret != 0) goto _process_body_fail;
 
-    //associate each read pathname to a vm_obj node if one is present
+    //resolve each interned pathname to a vm_obj node once
+    obj_nodes.reserve(this->ser_pathnames.size());
     for (auto iter = this->ser_pathnames.begin();
          iter != this->ser_pathnames.end(); ++iter) {
 
-        obj_node = mc_get_obj_by_pathname(&map, iter->c_str());        
-        obj_node_map[*iter] = obj_node;
+        obj_nodes.push_back(mc_get_obj_by_pathname(&map, iter->c_str()));
     }
 
 
     //fetch each chain
-    do {
+    for (uint32_t i = 0; i < chains_num; ++i) {
 
-        //get pathname index & offset chains
-        inprog_chain = this->handle_body_chain(buf, buf_off);
+        //get pathname index, target index & offset chains
+        inprog_chain = this->handle_body_chain(buf, buf_off, version);
         if (inprog_chain.has_value() == false) {
-            this->ser_pathnames.clear();
-            this->ser_pathnames.shrink_to_fit();
+            this->clear_pathnames();
             goto _process_body_fail;
         }
 
-        //fetch the MemCry object for this pathname, if one is present
-        obj_node = mc_get_obj_by_pathname(
-                      &map, this->ser_pathnames[inprog_chain->first].c_str());
+        //fetch the MemCry object for this chain, if one is present
+        obj_node = obj_nodes[inprog_chain->_get_obj_idx()];
         if (obj_node == nullptr) continue;
 
         //add this chain to the chain list
         this->chains.emplace_back(ptrscan_chain(
-            obj_node, inprog_chain->first, inprog_chain->second));
-
-        if ((buf.size() >= buf_off) || buf[buf_off] == fbuf_util::_file_end)
-            break;
-
-    } while (true);
+            obj_node, inprog_chain->_get_obj_idx(),
+            inprog_chain->get_offsets(), inprog_chain->get_target_idx()));
+        this->chains.back()._set_stability(inprog_chain->get_checks(),
+                                           inprog_chain->get_hits());
+    }
 
     _UNLOCK(-1)
     return 0;
@@ -879,42 +2268,36 @@ struct _potential_node {
 
 
 [[nodiscard]] int sc::ptrscan::_read_body(
-    const std::vector<cm_byte> & buf, off_t hdr_off) {
+    const std::vector<cm_byte> & buf, off_t hdr_off, const cm_byte version) {
 
     int ret;
-    std::optional<std::pair<uint32_t, std::vector<off_t>>> inprog_chain;
+    std::optional<sc::ptrscan_chain> inprog_chain;
 
     off_t buf_off = 0;
+    uint32_t chains_num;
 
 
     //lock scanner
     _LOCK(-1)
 
     //process the start of the header
-    ret = this->handle_body_start(buf, hdr_off, buf_off);
+    ret = this->handle_body_start(buf, hdr_off, buf_off, chains_num);
     if (ret != 0) goto _read_body_fail;
 
 
     //fetch each chain
-    do {
+    for (uint32_t i = 0; i < chains_num; ++i) {
 
-        //get pathname index & offset chains
-        inprog_chain = this->handle_body_chain(buf, buf_off);
+        //get pathname index, target index & offset chains
+        inprog_chain = this->handle_body_chain(buf, buf_off, version);
         if (inprog_chain.has_value() == false) {
-            this->ser_pathnames.clear();
-            this->ser_pathnames.shrink_to_fit();
+            this->clear_pathnames();
             goto _read_body_fail;
         }
 
         //add this chain to the chain list
-        this->chains.emplace_back(ptrscan_chain(
-            this->ser_pathnames[inprog_chain->first],
-            inprog_chain->first, inprog_chain->second));
-
-        if ((buf.size() >= buf_off) || buf[buf_off] == fbuf_util::_file_end)
-            break;
-
-    } while (true);
+        this->chains.emplace_back(std::move(inprog_chain.value()));
+    }
     
     _UNLOCK(-1)
     return 0;
@@ -961,10 +2344,11 @@ sc::ptrscan::ptrscan()
      */
 
     int ret;
+    int levels_done = 0;
     bool run_err = false;
     
     cm_lst_node * area_node;
-    uintptr_t target_addr;
+    std::vector<uintptr_t> target_addrs;
 
     #ifdef TRACE_PTRSCAN
     int _trace_idx;
@@ -1001,7 +2385,8 @@ sc::ptrscan::ptrscan()
     }
 
     //check all necessary options have been set
-    if (opts_ptr.get_target_addr().has_value() == false
+    target_addrs = opts_ptr.get_targets();
+    if (target_addrs.empty() == true
         || opts_ptr.get_alignment().has_value() == false
         || opts_ptr.get_max_obj_sz().has_value() == false
         || opts_ptr.get_max_depth().has_value() == false) {
@@ -1011,15 +2396,29 @@ sc::ptrscan::ptrscan()
         goto _scan_unlock_all;
     }
 
+    //a bidirectional scan needs static areas & a session to read them
+    if (opts_ptr.get_bidirectional() == true
+        && (opts_ptr.get_static_areas().has_value() == false
+            || opts.get_sessions().empty() == true)) {
+
+        sc_errno = SC_ERR_OPT_MISSING;
+        run_err = true;
+        goto _scan_unlock_all;
+    }
+
     //setup the worker pool
     ret = w_pool._setup(opts, opts_ptr, *this, ma_set, flags);
-    if (ret != 0) goto _scan_unlock_all;
+    if (ret != 0) {
+        run_err = true;
+        goto _scan_unlock_all;
+    }
 
     /*
-     *  NOTE: Index 0 is the target address. If the user requests a
+     *  NOTE: Index 0 holds the target addresses. If the user requests a
      *        max depth of 3, 3 layers of scans must be run. The
-     *        target address gets its own layer at index 0, meaning
-     *        `max_depth + 1` vectors are necessary.
+     *        targets get their own layer at index 0, meaning
+     *        `max_depth + 1` vectors are necessary. Targets are children
+     *        of a virtual root node which is not part of any layer.
      */
 
     //reserve space in the pointer scan tree
@@ -1027,6 +2426,16 @@ sc::ptrscan::ptrscan()
                             opts_ptr.get_max_depth().value());
 
 
+    //resume from a checkpoint if one is present
+    if (opts_ptr.get_checkpoint_path().has_value() == true) {
+        levels_done = this->read_checkpoint(opts, opts_ptr);
+        if (levels_done == -1) {
+            run_err = true;
+            goto _scan_unlock_all;
+        }
+    }
+
+
     /*
      *  NOTE: For the time being, this code re-finds the appropriate 
      *        area for the target address. However it's becoming 
@@ -1035,14 +2444,52 @@ sc::ptrscan::ptrscan()
      *        an object.
      */
 
-    //setup the root node
-    target_addr = opts_ptr.get_target_addr().value();
-    area_node = mc_get_area_by_addr(opts.get_map(), target_addr, nullptr);
-    this->add_node(nullptr, area_node, target_addr, 0x0);
-    ++this->cur_depth_level;
+    //otherwise setup a node for every target
+    if (levels_done == 0) {
 
-    //for every depth level
-    for (int i = 0; i < opts_ptr.get_max_depth().value(); ++i) {
+        for (auto iter = target_addrs.cbegin();
+             iter != target_addrs.cend(); ++iter) {
+
+            area_node = mc_get_area_by_addr(opts.get_map(), *iter, nullptr);
+            this->add_node(this->tree_p->get_root_node(),
+                           area_node, *iter, 0x0);
+        }
+
+        if (opts_ptr.get_checkpoint_path().has_value() == true) {
+            ret = this->write_checkpoint(
+                opts_ptr.get_checkpoint_path().value(), opts_ptr, 0);
+            if (ret != 0) {
+                run_err = true;
+                goto _scan_unlock_all;
+            }
+        }
+        levels_done = 1;
+    }
+    this->cur_depth_level = levels_done;
+
+    //move every depth level present so far to the spill file
+    if (opts_ptr.get_spill_path().has_value() == true) {
+        for (int i = 0; i < levels_done; ++i) {
+            ret = this->spill_level(opts_ptr, i);
+            if (ret != 0) {
+                run_err = true;
+                goto _scan_unlock_all;
+            }
+        }
+    }
+
+    //expand the static areas forward
+    if (opts_ptr.get_bidirectional() == true) {
+        ret = this->build_reach(opts, opts_ptr);
+        if (ret != 0) {
+            run_err = true;
+            goto _scan_unlock_all;
+        }
+    }
+
+    //for every depth level not restored from a checkpoint
+    for (int i = this->cur_depth_level - 1;
+         i < opts_ptr.get_max_depth().value(); ++i) {
 
         #ifdef TRACE_PTRSCAN
         std::printf("[SCRY] running depth: %d/%d\n",
@@ -1050,9 +2497,21 @@ sc::ptrscan::ptrscan()
                     opts_ptr.get_max_depth().value());
         #endif
 
+        //index the previous depth level for the workers
+        this->build_level_index();
+
+        //a level may grow to twice its budget before it is pruned
+        this->tree_p->set_prune_at(
+            opts_ptr.get_max_level_nodes().has_value()
+            ? std::max((size_t) 1, 2 * opts_ptr.get_max_level_nodes().value())
+            : sc::_ptrscan_prune_floor);
+
         //scan the selected address space once
         ret = w_pool._single_run();
-        if (ret != 0) goto _scan_unlock_all;
+        if (ret != 0) {
+            run_err = true;
+            goto _scan_unlock_all;
+        }
 
         #ifdef TRACE_PTRSCAN
         //get this layer of tree nodes
@@ -1082,16 +2541,60 @@ sc::ptrscan::ptrscan()
         }
         #endif
 
+        //enforce depth level limits & pruning policies
+        if (_is_pruned(opts_ptr) == true) {
+            this->tree_p->prune_level(
+                this->cur_depth_level, opts_ptr, this->report);
+        }
+
+        //checkpoint the completed depth level
+        if (opts_ptr.get_checkpoint_path().has_value() == true) {
+            ret = this->write_checkpoint(
+                    opts_ptr.get_checkpoint_path().value(),
+                    opts_ptr, this->cur_depth_level);
+            if (ret != 0) {
+                run_err = true;
+                goto _scan_unlock_all;
+            }
+        }
+
+        //move the completed depth level to the spill file
+        if (opts_ptr.get_spill_path().has_value() == true) {
+            ret = this->spill_level(opts_ptr, this->cur_depth_level);
+            if (ret != 0) {
+                run_err = true;
+                goto _scan_unlock_all;
+            }
+        }
+
         //increment current depth
         ++this->cur_depth_level;
     }
 
     //flatten the tree
-    ret = this->flatten_tree();
-    if (ret != 0) goto _scan_unlock_all;
+    ret = this->flatten_tree(*opts.get_map(), opts_ptr);
+    if (ret != 0) {
+        run_err = true;
+        goto _scan_unlock_all;
+    }
+
+    //enforce the chain limit
+    if (opts_ptr.get_max_chains().has_value()) {
+        this->prune_chains(opts_ptr.get_max_chains().value());
+    }
+
+    //the scan is complete, its checkpoint is no longer needed
+    if (opts_ptr.get_checkpoint_path().has_value() == true) {
+        std::remove(opts_ptr.get_checkpoint_path()->c_str());
+    }
 
 
     _scan_unlock_all:
+    //the spill file never outlives the scan, successful or not
+    if (opts_ptr.get_spill_path().has_value() == true) {
+        std::remove(opts_ptr.get_spill_path()->c_str());
+    }
+
     ret = ma_set._unlock();
     if (ret != 0) run_err = true;
 
@@ -1112,14 +2615,17 @@ sc::ptrscan::ptrscan()
 [[nodiscard]] int sc::ptrscan::verify(
         sc::opt & opts, const sc::opt_ptr & opts_ptr) {
 
-    bool valid;
+    int ret;
+    size_t keep;
+    std::vector<cm_byte> valid;
+    std::vector<uintptr_t> target_addrs = opts_ptr.get_targets();
 
 
     //lock scanner
     _LOCK(-1)
 
     //check a target address is provided
-    if (opts_ptr.get_target_addr().has_value() == false) {
+    if (target_addrs.empty() == true) {
         sc_errno = SC_ERR_OPT_MISSING;
         goto _verify_fail;
     }
@@ -1142,18 +2648,20 @@ sc::ptrscan::ptrscan()
         goto _verify_fail;
     }
 
-    //for every chain
-    for (int i = 0; i < this->chains.size(); ++i) {
+    //verify every chain using every session
+    ret = this->verify_chains(opts, target_addrs, valid);
+    if (ret != 0) goto _verify_fail;
 
-        //delete this chain if it fails verification
-        valid = is_chain_valid(opts_ptr.get_target_addr().value(),
-                               this->chains[i],
-                               *((mc_session *) opts.get_sessions()[0]));
-        if (valid == false) {
-            this->chains.erase(this->chains.begin() + i);
-            --i;
-        }
-    } //end for every chain
+    //discard invalid chains in a single pass
+    keep = 0;
+    for (size_t i = 0; i < this->chains.size(); ++i) {
+
+        this->chains[i]._record_check(valid[i]);
+        if (valid[i] == false) continue;
+        if (keep != i) this->chains[keep] = std::move(this->chains[i]);
+        ++keep;
+    }
+    this->chains.erase(this->chains.begin() + keep, this->chains.end());
 
     _UNLOCK(-1)
     return 0;
@@ -1164,12 +2672,186 @@ sc::ptrscan::ptrscan()
 }
 
 
+/*
+ *  NOTE: Unlike `verify()`, filtering leaves the chains of this scan
+ *        untouched. This permits filtering the same set of chains
+ *        against several targets, e.g. after every restart of a target.
+ */
+
+[[nodiscard]] int sc::ptrscan::filter(
+        const sc::opt & opts, const sc::opt_ptr & opts_ptr) {
+
+    int ret;
+    std::vector<cm_byte> valid;
+    std::vector<cm_byte> body_buf;
+    std::vector<uintptr_t> target_addrs = opts_ptr.get_targets();
+    sc::serialiser serialiser;
+
+
+    //lock scanner
+    _LOCK(-1)
+
+    //check a target address & an output file are provided
+    if (target_addrs.empty() == true
+        || opts.get_file_path_out().has_value() == false) {
+        sc_errno = SC_ERR_OPT_MISSING;
+        goto _filter_fail;
+    }
+
+    //check at least one session is provided
+    if (opts.get_sessions().empty() == true) {
+        sc_errno = SC_ERR_OPT_MISSING;
+        goto _filter_fail;
+    }
+
+    //check there are chains to filter
+    if (this->chains.empty() == true) {
+        sc_errno = SC_ERR_NO_RESULT;
+        goto _filter_fail;
+    }
+
+    //check chains were processed if read from disk
+    if (this->chains[0].get_obj_node().has_value() == false) {
+        sc_errno = SC_ERR_SHALLOW_RESULT;
+        goto _filter_fail;
+    }
+
+    //verify every chain using every session
+    ret = this->verify_chains(opts, target_addrs, valid);
+    if (ret != 0) goto _filter_fail;
+
+    //serialise surviving chains
+    ret = this->generate_body(
+            body_buf, sizeof(struct sc::scancry_file_hdr), &valid);
+    if (ret != 0) goto _filter_fail;
+
+    //write them to the output file
+    ret = serialiser._write_file(
+            opts.get_file_path_out().value(), sc::scan_type_ptr, body_buf);
+    if (ret != 0) goto _filter_fail;
+
+    _UNLOCK(-1)
+    return 0;
+
+    _filter_fail:
+    _UNLOCK(-1)
+    return -1;
+}
+
+
+/*
+ *  NOTE: Scoring records the outcome of a verification in every chain
+ *        and keeps them all. Scoring the same chains after each restart
+ *        of a target gives a measure of how reliably each chain resolves.
+ *        The counters are saved with the chains, so scoring can continue
+ *        across sessions.
+ */
+
+[[nodiscard]] int sc::ptrscan::score(
+        sc::opt & opts, const sc::opt_ptr & opts_ptr) {
+
+    int ret;
+    std::vector<cm_byte> valid;
+    std::vector<uintptr_t> target_addrs = opts_ptr.get_targets();
+
+
+    //lock scanner
+    _LOCK(-1)
+
+    //check a target address is provided
+    if (target_addrs.empty() == true) {
+        sc_errno = SC_ERR_OPT_MISSING;
+        goto _score_fail;
+    }
+
+    //check at least one session is provided
+    if (opts.get_sessions().empty() == true) {
+        sc_errno = SC_ERR_OPT_MISSING;
+        goto _score_fail;
+    }
+
+    //check there are chains to score
+    if (this->chains.empty() == true) {
+        sc_errno = SC_ERR_NO_RESULT;
+        goto _score_fail;
+    }
+
+    //check chains were processed if read from disk
+    if (this->chains[0].get_obj_node().has_value() == false) {
+        sc_errno = SC_ERR_SHALLOW_RESULT;
+        goto _score_fail;
+    }
+
+    //verify every chain using every session
+    ret = this->verify_chains(opts, target_addrs, valid);
+    if (ret != 0) goto _score_fail;
+
+    //record the outcome for every chain
+    for (size_t i = 0; i < this->chains.size(); ++i) {
+        this->chains[i]._record_check(valid[i]);
+    }
+
+    _UNLOCK(-1)
+    return 0;
+
+    _score_fail:
+    _UNLOCK(-1)
+    return -1;
+}
+
+
+//most stable chains first, ties keep their scan order
+[[nodiscard]] int sc::ptrscan::rank_stability() {
+
+    //lock scanner
+    _LOCK(-1)
+
+    std::stable_sort(this->chains.begin(), this->chains.end(),
+                     [](const sc::ptrscan_chain & a,
+                        const sc::ptrscan_chain & b) {
+        return a.get_stability() > b.get_stability();
+    });
+
+    _UNLOCK(-1)
+    return 0;
+}
+
+
+[[nodiscard]] int sc::ptrscan::prune_stability(const double min_stability) {
+
+    size_t keep;
+
+
+    //lock scanner
+    _LOCK(-1)
+
+    //discard chains below the threshold in a single pass
+    keep = 0;
+    for (size_t i = 0; i < this->chains.size(); ++i) {
+
+        if (this->chains[i].get_stability() < min_stability) continue;
+        if (keep != i) this->chains[keep] = std::move(this->chains[i]);
+        ++keep;
+    }
+    this->chains.erase(this->chains.begin() + keep, this->chains.end());
+
+    _UNLOCK(-1)
+    return 0;
+}
+
+
 //fetch pointer chains
 const std::vector<struct sc::ptrscan_chain> & sc::ptrscan::get_chains() const {
     return this->chains;    
 }
 
 
+//fetch limits enforced during the last scan
+const struct sc::ptrscan_report & sc::ptrscan::get_report() const noexcept {
+    return this->report;
+}
+
+
 
       /* ============= * 
  ===== *  C INTERFACE  * =====
@@ -1,8 +1,10 @@
 #pragma once
 
 //standard template library
+#include <optional>
 #include <vector>
 #include <list>
+#include <unordered_set>
 
 //external libraries
 #include <cmore.h>
@@ -50,6 +52,10 @@ class _ptrscan_tree_node {
         void connect_child(
             const std::shared_ptr<_ptrscan_tree_node> child_node);
 
+        //disconnect dropped children
+        void remove_children(
+            const std::unordered_set<const _ptrscan_tree_node *> & dropped);
+
         //free children
         void clear();
 
@@ -60,6 +66,64 @@ class _ptrscan_tree_node {
 };
 
 
+//size at which a depth level without a node budget is first pruned
+const constexpr size_t _ptrscan_prune_floor = 0x10000;
+
+//largest read performed while expanding static areas forward
+const constexpr size_t _ptrscan_reach_chunk = 0x100000;
+
+
+/*
+ *  NOTE: A checkpoint file is a header followed by one record per
+ *        completed depth level. Each record is a node count, the nodes
+ *        and an end byte. A record without its end byte was interrupted
+ *        and is discarded when the checkpoint is read.
+ *
+ *        Nodes refer to their parent by its index in the previous
+ *        depth level & store their offset from it instead of the raw
+ *        pointer value.
+ *
+ *        The header records every option that shapes the tree. Static
+ *        areas & preset offsets do not fit a fixed size header, so only
+ *        a digest of them is recorded. Unset limits are stored as
+ *        UINT64_MAX. Headers & nodes are zeroed before they are filled
+ *        such that no padding reaches the file.
+ */
+
+//checkpoint file constants
+const constexpr int _ptrscan_ckpt_magic_sz = 4;
+const constexpr cm_byte _ptrscan_ckpt_magic[_ptrscan_ckpt_magic_sz]
+                                             = {'S', 'C', 'C', 'K'};
+const constexpr cm_byte _ptrscan_ckpt_version = 0x2;
+
+//checkpoint file header
+struct _ptrscan_ckpt_hdr {
+
+    cm_byte magic[_ptrscan_ckpt_magic_sz];
+    uint32_t targets_num;
+    int64_t alignment;
+    int64_t max_obj_sz;
+    int64_t max_neg_off;
+    int32_t max_depth;
+    uint64_t max_level_nodes;
+    uint64_t max_children;
+    uint64_t max_array_run;
+    uint64_t digest;        //static areas & preset offsets
+    cm_byte version;
+    cm_byte smart_scan;
+    cm_byte bidirectional;
+    cm_byte prefer_static;
+};
+
+//checkpoint record of a single node
+struct _ptrscan_ckpt_node {
+
+    uint32_t parent_idx;
+    int64_t offset;
+    uint64_t own_addr;
+};
+
+
 class _ptrscan_tree {
 
     _SC_DBG_PRIVATE:
@@ -67,6 +131,9 @@ class _ptrscan_tree {
         int next_id;
         pthread_mutex_t write_mutex;
 
+        //size of the current depth level that triggers the next prune
+        size_t prune_at;
+
         //2D vector is desirable here, we need fast iteration
         std::vector<
             std::vector<std::shared_ptr<_ptrscan_tree_node>>> depth_levels;
@@ -84,11 +151,17 @@ class _ptrscan_tree {
                       const int depth_level,
                       const uintptr_t own_addr,
                       const uintptr_t ptr_addr);
+        void prune_level(const int depth_level,
+                         const opt_ptr & opts_ptr,
+                         struct ptrscan_report & report);
+        void release_level(const int depth_level);
         void reset();
 
 
         //getters & setters
         [[nodiscard]] pthread_mutex_t & get_write_mutex() noexcept;
+        [[nodiscard]] size_t get_prune_at() const noexcept;
+        void set_prune_at(const size_t prune_at) noexcept;
         [[nodiscard]] const std::vector<std::shared_ptr<_ptrscan_tree_node>>
             & get_depth_level_vct(int level) const noexcept;
         [[nodiscard]] std::vector<
@@ -104,4 +177,34 @@ class _ptrscan_tree {
 };
 
 
+/*
+ *  NOTE: Chain verification is split between one thread per session.
+ *        Chains are first sorted such that chains sharing a prefix
+ *        (same object & same leading offsets) are adjacent. Each thread
+ *        then follows its share of chains one depth level at a time;
+ *        only the first chain of a prefix group performs a read, the
+ *        rest of the group reuses its result.
+ */
+
+//state passed to a single chain verification thread
+struct _ptrscan_verify_arg {
+
+    //[members]
+    const std::vector<sc::ptrscan_chain> * chains;
+    const std::vector<size_t> * order;
+    const std::vector<int> * prefix_lens;
+
+    size_t begin;
+    size_t end;
+
+    const std::vector<uintptr_t> * target_addrs;
+    enum addr_width addr_width;
+    const mc_session * session;
+    std::optional<pid_t> pid;
+
+    std::vector<cm_byte> * valid;
+    int ret;
+};
+
+
 }; //namespace sc
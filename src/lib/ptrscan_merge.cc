@@ -0,0 +1,716 @@
+//standard template library
+#include <optional>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <memory>
+#include <algorithm>
+
+//C standard library
+#include <cstring>
+#include <cstdio>
+
+//external libraries
+#include <cmore.h>
+
+//local headers
+#include "scancry.h"
+#include "ptrscan_merge.hh"
+#include "fbuf_util.hh"
+#include "scancry_impl.h"
+#include "error.hh"
+
+
+
+/*
+ *  --- [INTERNAL] ---
+ */
+
+//order chains by pathname, then offsets, then target
+_SC_DBG_STATIC bool _merge_chain_less(const struct sc::_merge_chain & a,
+                                      const struct sc::_merge_chain & b) {
+
+    if (a.obj_rank != b.obj_rank) return a.obj_rank < b.obj_rank;
+    if (a.offsets != b.offsets) return a.offsets < b.offsets;
+    return a.target_idx < b.target_idx;
+}
+
+
+_SC_DBG_STATIC bool _merge_chain_eq(const struct sc::_merge_chain & a,
+                                    const struct sc::_merge_chain & b) {
+
+    return (a.obj_rank == b.obj_rank)
+           && (a.target_idx == b.target_idx)
+           && (a.offsets == b.offsets);
+}
+
+
+//append a chain to a run file
+_SC_DBG_STATIC void _write_run_chain(std::ofstream & fs,
+                                     const struct sc::_merge_chain & chain) {
+
+    uint32_t fields[5];
+
+
+    fields[0] = chain.obj_rank;
+    fields[1] = chain.target_idx;
+    fields[2] = chain.checks;
+    fields[3] = chain.hits;
+    fields[4] = (uint32_t) chain.offsets.size();
+
+    fs.write(reinterpret_cast<const char *>(fields), sizeof(fields));
+    fs.write(reinterpret_cast<const char *>(chain.offsets.data()),
+             chain.offsets.size() * sizeof(int64_t));
+
+    return;
+}
+
+
+
+/*
+ *  --- [MERGE READER | PUBLIC] ---
+ */
+
+[[nodiscard]] int sc::_merge_reader::open(const std::string & file_path) {
+
+    struct sc::scancry_file_hdr sc_hdr;
+    struct sc::ptr_file_hdr ptr_hdr;
+    std::string pathname;
+
+
+    //open an input file stream
+    this->fs = std::ifstream(file_path, std::ios::in | std::ios::binary);
+    if (this->fs.fail() == true) {
+        sc_errno = SC_ERR_FILE;
+        return -1;
+    }
+
+    //read & verify the ScanCry header
+    this->fs.read(reinterpret_cast<char *>(&sc_hdr), sizeof(sc_hdr));
+    if (this->fs.fail() == true) {
+        sc_errno = SC_ERR_FILE;
+        return -1;
+    }
+
+    if (std::memcmp(sc_hdr.magic, sc::file_magic, sc::file_magic_sz) != 0
+        || sc_hdr.scan_type != sc::scan_type_ptr) {
+        sc_errno = SC_ERR_INVALID_FILE;
+        return -1;
+    }
+
+    if (sc_hdr.version > sc::file_ver_cur) {
+        sc_errno = SC_ERR_VERSION_FILE;
+        return -1;
+    }
+    this->version = sc_hdr.version;
+
+    //read the pointer scan header
+    this->fs.read(reinterpret_cast<char *>(&ptr_hdr), sizeof(ptr_hdr));
+    if (this->fs.fail() == true) {
+        sc_errno = SC_ERR_INVALID_FILE;
+        return -1;
+    }
+    this->chains_left = ptr_hdr.chains_num;
+
+    //read every pathname, an empty string ends the table
+    this->pathnames.clear();
+    this->fs.seekg(ptr_hdr.pathnames_offset);
+    while (true) {
+
+        std::getline(this->fs, pathname, '\0');
+        if (this->fs.fail() == true) {
+            sc_errno = SC_ERR_INVALID_FILE;
+            return -1;
+        }
+
+        if (pathname.empty() == true) break;
+        this->pathnames.push_back(pathname);
+    }
+
+    //move to the first chain
+    this->fs.seekg(ptr_hdr.chains_offset);
+    if (this->fs.fail() == true) {
+        sc_errno = SC_ERR_INVALID_FILE;
+        return -1;
+    }
+
+    return 0;
+}
+
+
+[[nodiscard]] int sc::_merge_reader::next(struct sc::_merge_chain & chain) {
+
+    uint32_t offset_32bit;
+    int64_t offset_64bit;
+    cm_byte ctrl_byte;
+
+
+    if (this->chains_left == 0) return 1;
+
+    //fetch the object index
+    this->fs.read(reinterpret_cast<char *>(&chain.obj_rank), sizeof(uint32_t));
+
+    //fetch the target index & stability counters if this version has them
+    chain.target_idx = chain.checks = chain.hits = 0;
+    if (this->version >= sc::file_ver_1) {
+        this->fs.read(
+            reinterpret_cast<char *>(&chain.target_idx), sizeof(uint32_t));
+    }
+
+    if (this->version >= sc::file_ver_3) {
+        this->fs.read(
+            reinterpret_cast<char *>(&chain.checks), sizeof(uint32_t));
+        this->fs.read(
+            reinterpret_cast<char *>(&chain.hits), sizeof(uint32_t));
+    }
+
+    //fetch the offsets, older versions only stored positive offsets
+    chain.offsets.clear();
+    do {
+        if (this->version >= sc::file_ver_2) {
+            this->fs.read(reinterpret_cast<char *>(&offset_64bit),
+                          sizeof(offset_64bit));
+        } else {
+            this->fs.read(reinterpret_cast<char *>(&offset_32bit),
+                          sizeof(offset_32bit));
+            offset_64bit = (int64_t) offset_32bit;
+        }
+        this->fs.read(reinterpret_cast<char *>(&ctrl_byte), sizeof(ctrl_byte));
+        if (this->fs.fail() == true) break;
+
+        chain.offsets.push_back(offset_64bit);
+
+    } while (ctrl_byte == fbuf_util::_array_delim);
+
+    //check the chain is well formed
+    if (this->fs.fail() == true
+        || ctrl_byte != fbuf_util::_array_end
+        || chain.obj_rank >= this->pathnames.size()) {
+        sc_errno = SC_ERR_INVALID_FILE;
+        return -1;
+    }
+
+    --this->chains_left;
+    return 0;
+}
+
+
+[[nodiscard]] const std::vector<std::string> &
+    sc::_merge_reader::get_pathnames() const noexcept {
+
+    return this->pathnames;
+}
+
+
+
+/*
+ *  --- [MERGE STREAM | PRIVATE] ---
+ */
+
+//read the next record of a run into its head
+[[nodiscard]] int sc::_merge_stream::read_run(const size_t idx) {
+
+    uint32_t fields[5];
+    std::ifstream & fs = *this->runs[idx];
+    struct sc::_merge_chain & chain = this->heads[idx];
+
+
+    fs.read(reinterpret_cast<char *>(fields), sizeof(fields));
+    if (fs.gcount() == 0 && fs.eof() == true) return 1;
+    if (fs.fail() == true) {
+        sc_errno = SC_ERR_FILE;
+        return -1;
+    }
+
+    chain.obj_rank = fields[0];
+    chain.target_idx = fields[1];
+    chain.checks = fields[2];
+    chain.hits = fields[3];
+
+    chain.offsets.resize(fields[4]);
+    fs.read(reinterpret_cast<char *>(chain.offsets.data()),
+            fields[4] * sizeof(int64_t));
+    if (fs.fail() == true) {
+        sc_errno = SC_ERR_FILE;
+        return -1;
+    }
+
+    return 0;
+}
+
+
+
+/*
+ *  --- [MERGE STREAM | PUBLIC] ---
+ */
+
+[[nodiscard]] int sc::_merge_stream::open(
+    const std::vector<std::string> & run_paths) {
+
+    int ret;
+
+
+    this->runs.clear();
+    this->heads.assign(run_paths.size(), sc::_merge_chain());
+    this->heap.clear();
+
+    //open every run & fetch its first record
+    for (size_t i = 0; i < run_paths.size(); ++i) {
+
+        this->runs.emplace_back(std::make_unique<std::ifstream>(
+            run_paths[i], std::ios::in | std::ios::binary));
+        if (this->runs.back()->fail() == true) {
+            sc_errno = SC_ERR_FILE;
+            return -1;
+        }
+
+        ret = this->read_run(i);
+        if (ret == -1) return -1;
+        if (ret == 0) this->heap.push_back(i);
+    }
+
+    //heap of runs, smallest head on top
+    std::make_heap(this->heap.begin(), this->heap.end(),
+                   [this](const size_t a, const size_t b) {
+        return _merge_chain_less(this->heads[b], this->heads[a]);
+    });
+
+    return 0;
+}
+
+
+void sc::_merge_stream::close() {
+
+    this->runs.clear();
+    this->heads.clear();
+    this->heap.clear();
+
+    return;
+}
+
+
+[[nodiscard]] int sc::_merge_stream::next(struct sc::_merge_chain & chain) {
+
+    int ret;
+    size_t idx;
+
+    auto cmp = [this](const size_t a, const size_t b) {
+        return _merge_chain_less(this->heads[b], this->heads[a]);
+    };
+
+
+    if (this->heap.empty() == true) return 1;
+
+    //take the smallest head
+    std::pop_heap(this->heap.begin(), this->heap.end(), cmp);
+    idx = this->heap.back();
+    chain = std::move(this->heads[idx]);
+
+    //refill it from its run
+    ret = this->read_run(idx);
+    if (ret == -1) return -1;
+
+    if (ret == 0) {
+        std::push_heap(this->heap.begin(), this->heap.end(), cmp);
+    } else {
+        this->heap.pop_back();
+    }
+
+    return 0;
+}
+
+
+
+/*
+ *  --- [POINTER SCAN MERGE | PRIVATE] ---
+ */
+
+/*
+ *  NOTE: Pathname indeces are local to a file. Chains are keyed by the
+ *        rank of their pathname in the sorted union of both tables,
+ *        which is also the pathname table of the output file.
+ */
+
+void sc::_ptrscan_merge::merge_pathnames(
+    const std::vector<std::string> & pathnames_a,
+    const std::vector<std::string> & pathnames_b,
+    std::vector<uint32_t> & ranks_a, std::vector<uint32_t> & ranks_b) {
+
+    //build the sorted union
+    this->pathnames = pathnames_a;
+    this->pathnames.insert(this->pathnames.end(),
+                           pathnames_b.begin(), pathnames_b.end());
+    std::sort(this->pathnames.begin(), this->pathnames.end());
+    this->pathnames.erase(
+        std::unique(this->pathnames.begin(), this->pathnames.end()),
+        this->pathnames.end());
+
+    //map local indeces to ranks
+    auto rank = [this](const std::string & pathname) {
+        return (uint32_t) (std::lower_bound(this->pathnames.begin(),
+                                            this->pathnames.end(), pathname)
+                           - this->pathnames.begin());
+    };
+
+    ranks_a.clear();
+    for (auto iter = pathnames_a.begin(); iter != pathnames_a.end(); ++iter) {
+        ranks_a.push_back(rank(*iter));
+    }
+
+    ranks_b.clear();
+    for (auto iter = pathnames_b.begin(); iter != pathnames_b.end(); ++iter) {
+        ranks_b.push_back(rank(*iter));
+    }
+
+    return;
+}
+
+
+//sort a run & write it to disk
+[[nodiscard]] int sc::_ptrscan_merge::write_run(
+    std::vector<struct sc::_merge_chain> & run, const std::string & run_path) {
+
+    std::ofstream fs;
+
+
+    std::sort(run.begin(), run.end(), _merge_chain_less);
+
+    //register the run before writing so it is always removed
+    this->run_paths.push_back(run_path);
+    fs = std::ofstream(run_path, std::ios::out | std::ios::binary);
+    if (fs.fail() == true) {
+        sc_errno = SC_ERR_FILE;
+        return -1;
+    }
+
+    for (auto iter = run.begin(); iter != run.end(); ++iter) {
+        _write_run_chain(fs, *iter);
+    }
+
+    fs.close();
+    if (fs.fail() == true) {
+        sc_errno = SC_ERR_FILE;
+        return -1;
+    }
+
+    run.clear();
+    return 0;
+}
+
+
+/*
+ *  NOTE: Each pass merges groups of `fan_in` runs into one longer run,
+ *        dividing the number of runs by `fan_in`. Merged runs are
+ *        removed straight away, so a pass needs at most one extra copy
+ *        of the chains on disk.
+ */
+
+//merge runs until at most `fan_in` of them are left
+[[nodiscard]] int sc::_ptrscan_merge::reduce_runs(
+    const std::string & run_prefix, std::vector<std::string> & runs) {
+
+    int ret;
+    size_t pass = 0;
+
+    std::ofstream fs;
+    sc::_merge_stream stream;
+    struct sc::_merge_chain chain;
+    std::vector<std::string> group, merged;
+
+
+    while (runs.size() > this->fan_in) {
+
+        merged.clear();
+        for (size_t i = 0; i < runs.size(); i += this->fan_in) {
+
+            group.assign(runs.begin() + i,
+                         runs.begin() + std::min(i + this->fan_in,
+                                                 runs.size()));
+
+            //register the run before writing so it is always removed
+            merged.push_back(run_prefix + "." + std::to_string(pass)
+                             + "_" + std::to_string(merged.size()));
+            this->run_paths.push_back(merged.back());
+
+            fs = std::ofstream(merged.back(),
+                               std::ios::out | std::ios::binary);
+            if (fs.fail() == true) {
+                sc_errno = SC_ERR_FILE;
+                return -1;
+            }
+
+            //merge this group of runs into one run
+            ret = stream.open(group);
+            if (ret != 0) return -1;
+
+            while ((ret = stream.next(chain)) == 0) {
+                _write_run_chain(fs, chain);
+            }
+            if (ret == -1) return -1;
+
+            fs.close();
+            if (fs.fail() == true) {
+                sc_errno = SC_ERR_FILE;
+                return -1;
+            }
+
+            //the group is no longer needed
+            stream.close();
+            for (auto iter = group.begin(); iter != group.end(); ++iter) {
+                std::remove(iter->c_str());
+            }
+        }
+
+        runs = std::move(merged);
+        ++pass;
+    }
+
+    return 0;
+}
+
+
+//split the chains of a file into sorted runs
+[[nodiscard]] int sc::_ptrscan_merge::make_runs(
+    sc::_merge_reader & reader, const std::vector<uint32_t> & ranks,
+    const std::string & run_prefix, std::vector<std::string> & runs) {
+
+    int ret;
+    size_t run_bytes = 0;
+
+    struct sc::_merge_chain chain;
+    std::vector<struct sc::_merge_chain> run;
+
+
+    runs.clear();
+    while (true) {
+
+        ret = reader.next(chain);
+        if (ret == -1) return -1;
+        if (ret == 1) break;
+
+        //key the chain by its pathname's rank
+        chain.obj_rank = ranks[chain.obj_rank];
+        run_bytes += sizeof(chain) + (chain.offsets.size() * sizeof(int64_t));
+        run.push_back(std::move(chain));
+
+        //move a full run to disk
+        if (run_bytes >= this->run_sz) {
+            runs.push_back(run_prefix + std::to_string(runs.size()));
+            ret = this->write_run(run, runs.back());
+            if (ret != 0) return -1;
+            run_bytes = 0;
+        }
+    }
+
+    //move the last run to disk
+    if (run.empty() == false) {
+        runs.push_back(run_prefix + std::to_string(runs.size()));
+        ret = this->write_run(run, runs.back());
+        if (ret != 0) return -1;
+    }
+
+    return 0;
+}
+
+
+//append a chain to the output file in the current file version
+[[nodiscard]] int sc::_ptrscan_merge::write_chain(
+    std::ofstream & fs, const struct sc::_merge_chain & chain) {
+
+    int ret;
+    off_t buf_off = 0;
+    std::vector<cm_byte> buf((sizeof(uint32_t) * 4)
+                             + (chain.offsets.size() * (sizeof(int64_t) + 1)));
+
+
+    ret = fbuf_util::pack_type(buf, buf_off, chain.obj_rank);
+    if (ret != 0) return -1;
+    ret = fbuf_util::pack_type(buf, buf_off, chain.target_idx);
+    if (ret != 0) return -1;
+    ret = fbuf_util::pack_type(buf, buf_off, chain.checks);
+    if (ret != 0) return -1;
+    ret = fbuf_util::pack_type(buf, buf_off, chain.hits);
+    if (ret != 0) return -1;
+    ret = fbuf_util::pack_type_array<int64_t>(buf, buf_off, chain.offsets);
+    if (ret != 0) return -1;
+
+    fs.write(reinterpret_cast<const char *>(buf.data()), buf.size());
+    if (fs.fail() == true) {
+        sc_errno = SC_ERR_FILE;
+        return -1;
+    }
+
+    return 0;
+}
+
+
+void sc::_ptrscan_merge::remove_runs() {
+
+    for (auto iter = this->run_paths.begin();
+         iter != this->run_paths.end(); ++iter) {
+
+        std::remove(iter->c_str());
+    }
+    this->run_paths.clear();
+
+    return;
+}
+
+
+
+/*
+ *  --- [POINTER SCAN MERGE | PUBLIC] ---
+ */
+
+/*
+ *  NOTE: Both operations write the chains of `file_a` to `file_out`.
+ *        An intersection keeps chains also present in `file_b` and sums
+ *        their stability counters. A difference keeps chains absent from
+ *        `file_b`. Duplicate chains are written once. The output is
+ *        written to `<file_out>.tmp` & renamed over `file_out` once
+ *        complete, so a failed merge leaves a previous result intact.
+ */
+
+[[nodiscard]] int sc::_ptrscan_merge::combine(
+    const std::string & file_a, const std::string & file_b,
+    const std::string & file_out, const cm_byte op) {
+
+    int ret, ret_a, ret_b;
+    bool match;
+
+    sc::_merge_reader reader_a, reader_b;
+    sc::_merge_stream stream_a, stream_b;
+    std::vector<uint32_t> ranks_a, ranks_b;
+    std::vector<std::string> runs_a, runs_b;
+
+    struct sc::_merge_chain chain_a, chain_b, prev;
+    std::ofstream fs;
+    struct sc::scancry_file_hdr sc_hdr;
+    struct sc::ptr_file_hdr ptr_hdr;
+    cm_byte ctrl_byte;
+
+    const std::string tmp_path = file_out + ".tmp";
+
+
+    //open both files & build the output pathname table
+    ret = reader_a.open(file_a);
+    if (ret != 0) goto _combine_fail;
+    ret = reader_b.open(file_b);
+    if (ret != 0) goto _combine_fail;
+
+    this->merge_pathnames(reader_a.get_pathnames(),
+                          reader_b.get_pathnames(), ranks_a, ranks_b);
+
+    //sort both files into runs
+    ret = this->make_runs(reader_a, ranks_a, file_out + ".run_a", runs_a);
+    if (ret != 0) goto _combine_fail;
+    ret = this->make_runs(reader_b, ranks_b, file_out + ".run_b", runs_b);
+    if (ret != 0) goto _combine_fail;
+
+    //bound the number of runs open at once
+    ret = this->reduce_runs(file_out + ".run_a", runs_a);
+    if (ret != 0) goto _combine_fail;
+    ret = this->reduce_runs(file_out + ".run_b", runs_b);
+    if (ret != 0) goto _combine_fail;
+
+    ret = stream_a.open(runs_a);
+    if (ret != 0) goto _combine_fail;
+    ret = stream_b.open(runs_b);
+    if (ret != 0) goto _combine_fail;
+
+
+    //build the headers, the chain count is filled in once known
+    std::memcpy(sc_hdr.magic, sc::file_magic, sc::file_magic_sz);
+    sc_hdr.version = sc::file_ver_cur;
+    sc_hdr.scan_type = sc::scan_type_ptr;
+
+    ptr_hdr.pathnames_num = this->pathnames.size();
+    ptr_hdr.pathnames_offset = sizeof(sc_hdr) + sizeof(ptr_hdr);
+    ptr_hdr.chains_num = 0;
+    ptr_hdr.chains_offset = ptr_hdr.pathnames_offset + 1;
+    for (auto iter = this->pathnames.begin();
+         iter != this->pathnames.end(); ++iter) {
+        ptr_hdr.chains_offset += iter->size() + 1;
+    }
+
+    //write the headers & the pathname table
+    fs = std::ofstream(tmp_path, std::ios::out | std::ios::binary);
+    if (fs.fail() == true) {
+        sc_errno = SC_ERR_FILE;
+        goto _combine_file_fail;
+    }
+
+    fs.write(reinterpret_cast<const char *>(&sc_hdr), sizeof(sc_hdr));
+    fs.write(reinterpret_cast<const char *>(&ptr_hdr), sizeof(ptr_hdr));
+    for (auto iter = this->pathnames.begin();
+         iter != this->pathnames.end(); ++iter) {
+        fs.write(iter->c_str(), iter->size() + 1);
+    }
+    ctrl_byte = 0x00;
+    fs.write(reinterpret_cast<const char *>(&ctrl_byte), sizeof(ctrl_byte));
+
+
+    //merge both sorted streams
+    ret_a = stream_a.next(chain_a);
+    ret_b = stream_b.next(chain_b);
+    while (ret_a == 0) {
+
+        //advance the second file up to this chain
+        while (ret_b == 0 && _merge_chain_less(chain_b, chain_a)) {
+            ret_b = stream_b.next(chain_b);
+        }
+        if (ret_b == -1) goto _combine_file_fail;
+
+        match = (ret_b == 0) && _merge_chain_eq(chain_a, chain_b);
+
+        //write the chain if the operation keeps it
+        if ((op == sc::_merge_op_intersect && match == true)
+            || (op == sc::_merge_op_diff && match == false)) {
+
+            if (match == true) {
+                chain_a.checks += chain_b.checks;
+                chain_a.hits += chain_b.hits;
+            }
+
+            ret = this->write_chain(fs, chain_a);
+            if (ret != 0) goto _combine_file_fail;
+            ++ptr_hdr.chains_num;
+        }
+
+        //skip duplicates of this chain
+        prev = std::move(chain_a);
+        do {
+            ret_a = stream_a.next(chain_a);
+        } while (ret_a == 0 && _merge_chain_eq(chain_a, prev));
+    }
+    if (ret_a == -1) goto _combine_file_fail;
+
+    //store the file end byte & the final chain count
+    ctrl_byte = fbuf_util::_file_end;
+    fs.write(reinterpret_cast<const char *>(&ctrl_byte), sizeof(ctrl_byte));
+    fs.seekp(sizeof(sc_hdr));
+    fs.write(reinterpret_cast<const char *>(&ptr_hdr), sizeof(ptr_hdr));
+    fs.close();
+    if (fs.fail() == true) {
+        sc_errno = SC_ERR_FILE;
+        goto _combine_file_fail;
+    }
+
+    //replace the output file
+    ret = std::rename(tmp_path.c_str(), file_out.c_str());
+    if (ret != 0) {
+        sc_errno = SC_ERR_FILE;
+        goto _combine_file_fail;
+    }
+
+    this->remove_runs();
+    return 0;
+
+    _combine_file_fail:
+    fs.close();
+    std::remove(tmp_path.c_str());
+
+    _combine_fail:
+    this->remove_runs();
+    return -1;
+}
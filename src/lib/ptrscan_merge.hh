@@ -0,0 +1,140 @@
+#pragma once
+
+//standard template library
+#include <vector>
+#include <string>
+#include <fstream>
+#include <memory>
+#include <algorithm>
+
+//external libraries
+#include <cmore.h>
+
+//local headers
+#include "scancry.h"
+
+
+
+namespace sc {
+
+//set operations on pointer scan files
+const constexpr cm_byte _merge_op_intersect = 0x0;
+const constexpr cm_byte _merge_op_diff      = 0x1;
+
+//memory used to sort chains before they are moved to a run file
+const constexpr size_t _merge_run_sz = 0x4000000;
+
+//maximum number of run files open at once while merging
+const constexpr size_t _merge_fan_in = 0x40;
+
+
+//a pointer chain keyed by its position in a merged pathname table
+struct _merge_chain {
+
+    //[members]
+    uint32_t obj_rank;
+    uint32_t target_idx;
+    uint32_t checks;
+    uint32_t hits;
+    std::vector<int64_t> offsets;
+};
+
+
+/*
+ *  NOTE: `next()` methods of the merge readers return 0 when a chain
+ *        was read, 1 once every chain was read, and -1 on error.
+ */
+
+//reads the chains of a pointer scan file one at a time
+class _merge_reader {
+
+    _SC_DBG_PRIVATE:
+        //[attributes]
+        std::ifstream fs;
+        cm_byte version;
+        uint32_t chains_left;
+        std::vector<std::string> pathnames;
+
+    public:
+        //[methods]
+        [[nodiscard]] int open(const std::string & file_path);
+        [[nodiscard]] int next(struct _merge_chain & chain);
+
+        //getters & setters
+        [[nodiscard]] const std::vector<std::string> &
+            get_pathnames() const noexcept;
+};
+
+
+//yields the chains of several sorted run files in sorted order
+class _merge_stream {
+
+    _SC_DBG_PRIVATE:
+        //[attributes]
+        std::vector<std::unique_ptr<std::ifstream>> runs;
+        std::vector<struct _merge_chain> heads;
+        std::vector<size_t> heap;
+
+        //[methods]
+        [[nodiscard]] int read_run(const size_t idx);
+
+    public:
+        //[methods]
+        [[nodiscard]] int open(const std::vector<std::string> & run_paths);
+        [[nodiscard]] int next(struct _merge_chain & chain);
+        void close();
+};
+
+
+/*
+ *  NOTE: Pointer scan files are combined with an external sort-merge.
+ *        Chains of each file are read in runs of at most `run_sz` bytes,
+ *        keyed by (pathname, offsets, target index), sorted, and written
+ *        to temporary run files next to the output file. While a file
+ *        has more than `fan_in` runs, groups of `fan_in` runs are merged
+ *        into longer runs, so at most `fan_in` runs per file are ever
+ *        open. The remaining runs of both files are then merged into
+ *        the output file. Memory use is bounded by `run_sz` and the
+ *        pathname tables, not by the number of chains.
+ */
+
+class _ptrscan_merge {
+
+    _SC_DBG_PRIVATE:
+        //[attributes]
+        const size_t run_sz;
+        const size_t fan_in;
+        std::vector<std::string> pathnames;
+        std::vector<std::string> run_paths;
+
+        //[methods]
+        void merge_pathnames(const std::vector<std::string> & pathnames_a,
+                             const std::vector<std::string> & pathnames_b,
+                             std::vector<uint32_t> & ranks_a,
+                             std::vector<uint32_t> & ranks_b);
+        [[nodiscard]] int write_run(std::vector<struct _merge_chain> & run,
+                                    const std::string & run_path);
+        [[nodiscard]] int reduce_runs(const std::string & run_prefix,
+                                      std::vector<std::string> & runs);
+        [[nodiscard]] int make_runs(_merge_reader & reader,
+                                    const std::vector<uint32_t> & ranks,
+                                    const std::string & run_prefix,
+                                    std::vector<std::string> & runs);
+        [[nodiscard]] int write_chain(std::ofstream & fs,
+                                      const struct _merge_chain & chain);
+        void remove_runs();
+
+    public:
+        //[methods]
+        _ptrscan_merge(const size_t run_sz = _merge_run_sz,
+                       const size_t fan_in = _merge_fan_in)
+         : run_sz(run_sz), fan_in(std::max(fan_in, (size_t) 2)) {}
+
+        [[nodiscard]] int combine(const std::string & file_a,
+                                  const std::string & file_b,
+                                  const std::string & file_out,
+                                  const cm_byte op);
+};
+
+
+}; //namespace sc
@@ -8,6 +8,7 @@
 #include <vector>
 #include <list>
 #include <unordered_set>
+#include <unordered_map>
 #include <string>
 #include <fstream>
 #include <functional>
@@ -16,6 +17,7 @@
 
 //C standard library
 #include <stddef.h>
+#include <time.h>
 
 //external libraries
 #include <cmore.h>
@@ -53,6 +55,56 @@ enum addr_width {
 };
 
 
+//value scanner type enum
+enum val_type {
+    VT_I8  = 0,
+    VT_U8  = 1,
+    VT_I16 = 2,
+    VT_U16 = 3,
+    VT_I32 = 4,
+    VT_U32 = 5,
+    VT_I64 = 6,
+    VT_U64 = 7,
+    VT_F32 = 8,
+    VT_F64 = 9
+};
+
+
+//value scanner predicate enum
+enum val_pred {
+    VP_EQ           = 0,
+    VP_CHANGED      = 1,
+    VP_UNCHANGED    = 2,
+    VP_INCREASED    = 3,
+    VP_DECREASED    = 4,
+    VP_INCREASED_BY = 5,
+    VP_DECREASED_BY = 6,
+    VP_RANGE        = 7
+};
+
+
+//value scanner rounding mode enum
+enum val_round {
+    VR_NONE  = 0,
+    VR_ROUND = 1,
+    VR_TRUNC = 2
+};
+
+
+//string scanner encoding enum, values combine into a mask
+enum str_enc {
+    SE_UTF8    = 0x1,
+    SE_UTF16LE = 0x2
+};
+
+
+//structure scanner field kind enum
+enum struct_field_kind {
+    SF_VALUE = 0,
+    SF_PTR   = 1
+};
+
+
 /*
  *  Configuration options for all scan types.
  */
@@ -77,6 +129,17 @@ class opt : public _lockable {
         //MemCry memory map of target
         mc_vm_map * map;
 
+        /*
+         *  NOTE: If the PID of the target is set, batched reads of
+         *        pointer chains & watch lists are made with
+         *        `process_vm_readv()` instead of going through the
+         *        sessions. Leave it unset if the target must only be
+         *        accessed through MemCry (e.g.: a krncry session).
+         */
+
+        //PID of the target
+        std::optional<pid_t> pid;
+
         /*
          *  NOTE: The following attributes define constraints to apply
          *        to a `mc_vm_map`. For example, `omit_objs` will not
@@ -184,6 +247,9 @@ class opt : public _lockable {
         [[nodiscard]] int set_access(
             const std::optional<cm_byte> access) noexcept;
         [[nodiscard]] std::optional<cm_byte> get_access() const noexcept;
+
+        [[nodiscard]] int set_pid(const std::optional<pid_t> pid) noexcept;
+        [[nodiscard]] std::optional<pid_t> get_pid() const noexcept;
 };
 
 
@@ -235,6 +301,74 @@ class opt_ptr final : public _opt_scan {
          */
         bool smart_scan;
 
+        /*
+         *  NOTE: `target_addrs` allow a single scan to find chains to
+         *        several targets at once. If set, it is used in place
+         *        of `target_addr`. Each resulting chain records the
+         *        index of the target it leads to.
+         */
+        std::optional<std::vector<uintptr_t>> target_addrs;
+
+        /*
+         *  NOTE: `max_chains`, `max_level_nodes` & `max_children` bound
+         *        the size of a scan. Once a limit is exceeded, the
+         *        candidates with the smallest offsets are kept. Anything
+         *        dropped is counted in the scan's `ptrscan_report`.
+         */
+        std::optional<size_t> max_chains;
+        std::optional<size_t> max_level_nodes;
+        std::optional<size_t> max_children;
+
+        /*
+         *  NOTE: With `bidirectional` on, memory reachable from the
+         *        `static_areas` is first expanded forward for half of
+         *        `max_depth`. Nodes of the deeper depth levels are only
+         *        kept if a static area can still reach them with the
+         *        depth levels left, so every chain starts in a static
+         *        area. Requires `static_areas` to be set.
+         */
+        bool bidirectional;
+
+        /*
+         *  NOTE: If `checkpoint_path` is set, every completed depth level
+         *        is appended to this file. A scan that finds a matching
+         *        checkpoint resumes after its last complete depth level.
+         *        The file is removed once the scan completes.
+         */
+        std::optional<std::string> checkpoint_path;
+
+        /*
+         *  NOTE: If `spill_path` is set, every completed depth level is
+         *        moved out of memory into this file. Only the depth level
+         *        the next level is matched against stays in memory, the
+         *        chains are flattened from the file. The file is removed
+         *        once the scan completes.
+         */
+        std::optional<std::string> spill_path;
+
+        /*
+         *  NOTE: `max_neg_off` extends the match window above a node.
+         *        A pointer matches a node if it lies in the range
+         *        [own_addr - max_obj_sz, own_addr + max_neg_off]. Pointers
+         *        above the node produce negative offsets, as found in
+         *        container-of patterns.
+         */
+        std::optional<off_t> max_neg_off;
+
+        /*
+         *  NOTE: `prefer_static` & `max_array_run` are pruning policies
+         *        applied to the children of every node. With
+         *        `prefer_static` on, a node with children in static areas
+         *        (the `static_areas` if set, otherwise areas backed by an
+         *        object) drops its other children. `max_array_run` limits
+         *        how many equally spaced offsets siblings may form before
+         *        they are taken for a scan over an array and reduced to
+         *        the closest one. Pruned nodes are counted in the scan's
+         *        `ptrscan_report`.
+         */
+        bool prefer_static;
+        std::optional<size_t> max_array_run;
+
     public:
         //ctor
         opt_ptr();
@@ -280,6 +414,309 @@ class opt_ptr final : public _opt_scan {
         
         [[nodiscard]] int set_smart_scan(const bool enable) noexcept;
         [[nodiscard]] bool get_smart_scan() const noexcept;    
+
+        [[nodiscard]] int set_target_addrs(
+            const std::optional<std::vector<uintptr_t>> & target_addrs);
+        [[nodiscard]] const std::optional<std::vector<uintptr_t>> &
+            get_target_addrs() const;
+
+        [[nodiscard]] int set_max_chains(
+            const std::optional<size_t> max_chains) noexcept;
+        [[nodiscard]] std::optional<size_t>
+            get_max_chains() const noexcept;
+
+        [[nodiscard]] int set_max_level_nodes(
+            const std::optional<size_t> max_level_nodes) noexcept;
+        [[nodiscard]] std::optional<size_t>
+            get_max_level_nodes() const noexcept;
+
+        [[nodiscard]] int set_max_children(
+            const std::optional<size_t> max_children) noexcept;
+        [[nodiscard]] std::optional<size_t>
+            get_max_children() const noexcept;
+
+        [[nodiscard]] int set_bidirectional(const bool enable) noexcept;
+        [[nodiscard]] bool get_bidirectional() const noexcept;
+
+        [[nodiscard]] int set_checkpoint_path(
+            const std::optional<std::string> & checkpoint_path);
+        [[nodiscard]] const std::optional<std::string> &
+            get_checkpoint_path() const;
+
+        [[nodiscard]] int set_spill_path(
+            const std::optional<std::string> & spill_path);
+        [[nodiscard]] const std::optional<std::string> &
+            get_spill_path() const;
+
+        [[nodiscard]] int set_max_neg_off(
+            const std::optional<off_t> max_neg_off) noexcept;
+        [[nodiscard]] std::optional<off_t>
+            get_max_neg_off() const noexcept;
+
+        [[nodiscard]] int set_prefer_static(const bool enable) noexcept;
+        [[nodiscard]] bool get_prefer_static() const noexcept;
+
+        [[nodiscard]] int set_max_array_run(
+            const std::optional<size_t> max_array_run) noexcept;
+        [[nodiscard]] std::optional<size_t>
+            get_max_array_run() const noexcept;
+
+        //get every target of a scan, `target_addrs` takes priority
+        [[nodiscard]] std::vector<uintptr_t> get_targets() const;
+};
+
+
+/*
+ *  Configuration options only applicable to value scans.
+ */
+class opt_val final : public _opt_scan {
+
+    _SC_DBG_PRIVATE:
+        //[attributes]
+        /* `type` & `alignment` are _not_ optional, they must be set. */
+        std::optional<enum val_type> type;
+        std::optional<off_t> alignment;
+
+        /*
+         *  NOTE: `value` holds the raw bytes of the value to scan for,
+         *        in the byte order of the target. Its size must match
+         *        the size of `type`.
+         */
+        std::optional<std::vector<cm_byte>> value;
+
+        /*
+         *  NOTE: `predicate` selects the candidates a next scan keeps.
+         *        `VP_EQ` compares against `value`, `VP_RANGE` keeps
+         *        values from `value` up to `value_hi`, both included.
+         *        `VP_INCREASED_BY` & `VP_DECREASED_BY` take `value` as
+         *        the difference from the previous scan. The other
+         *        predicates only compare against the previous scan.
+         *
+         *        A first scan tests for `VP_RANGE` if it is selected &
+         *        for equality otherwise; without a `value`, it keeps
+         *        every aligned position as a candidate.
+         */
+        enum val_pred predicate;
+        std::optional<std::vector<cm_byte>> value_hi;
+
+        /*
+         *  NOTE: The following only apply to floating point types. They
+         *        widen the equality of `VP_EQ` into a range. `round`
+         *        matches the values that round or truncate to `value`,
+         *        which is itself rounded or truncated first. `epsilon`
+         *        then widens the range by that much on either side.
+         */
+        enum val_round round;
+        std::optional<double> epsilon;
+
+    public:
+        //ctor
+        opt_val();
+        opt_val(const opt_val & opts_val);
+        opt_val(const opt_val && opts_val);
+        ~opt_val() override final {};
+
+        //reset
+        [[nodiscard]] int reset() override final;
+
+        //getters & setters
+        [[nodiscard]] int set_type(
+            const std::optional<enum val_type> type) noexcept;
+        [[nodiscard]] std::optional<enum val_type>
+            get_type() const noexcept;
+
+        [[nodiscard]] int set_alignment(
+            const std::optional<off_t> alignment) noexcept;
+        [[nodiscard]] std::optional<off_t>
+            get_alignment() const noexcept;
+
+        [[nodiscard]] int set_value(
+            const std::optional<std::vector<cm_byte>> & value);
+        [[nodiscard]] const std::optional<std::vector<cm_byte>> &
+            get_value() const;
+
+        [[nodiscard]] int set_predicate(
+            const enum val_pred predicate) noexcept;
+        [[nodiscard]] enum val_pred get_predicate() const noexcept;
+
+        [[nodiscard]] int set_value_hi(
+            const std::optional<std::vector<cm_byte>> & value_hi);
+        [[nodiscard]] const std::optional<std::vector<cm_byte>> &
+            get_value_hi() const;
+
+        [[nodiscard]] int set_round(const enum val_round round) noexcept;
+        [[nodiscard]] enum val_round get_round() const noexcept;
+
+        [[nodiscard]] int set_epsilon(
+            const std::optional<double> epsilon) noexcept;
+        [[nodiscard]] std::optional<double> get_epsilon() const noexcept;
+};
+
+
+class ptn_set;
+
+
+/*
+ *  Configuration options only applicable to pattern scans.
+ */
+class opt_ptn final : public _opt_scan {
+
+    _SC_DBG_PRIVATE:
+        //[attributes]
+        /* Either `pattern` or `signatures` must be set. */
+        std::optional<std::vector<cm_byte>> pattern;
+
+        /*
+         *  NOTE: `mask` selects the bits of each byte of `pattern` that
+         *        must match: 0xFF matches the whole byte, 0xF0 & 0x0F
+         *        a single nibble, 0x00 any byte. Its size must match the
+         *        size of `pattern`. Without a mask, every byte must match.
+         */
+        std::optional<std::vector<cm_byte>> mask;
+
+        /*
+         *  NOTE: A compiled set of patterns to search for in one pass,
+         *        takes priority over `pattern`.
+         */
+        ptn_set * signatures;
+
+    public:
+        //ctor
+        opt_ptn();
+        opt_ptn(const opt_ptn & opts_ptn);
+        opt_ptn(const opt_ptn && opts_ptn);
+        ~opt_ptn() override final {};
+
+        //reset
+        [[nodiscard]] int reset() override final;
+
+        //getters & setters
+        [[nodiscard]] int set_pattern(
+            const std::optional<std::vector<cm_byte>> & pattern);
+        [[nodiscard]] const std::optional<std::vector<cm_byte>> &
+            get_pattern() const;
+
+        [[nodiscard]] int set_mask(
+            const std::optional<std::vector<cm_byte>> & mask);
+        [[nodiscard]] const std::optional<std::vector<cm_byte>> &
+            get_mask() const;
+
+        /*
+         *  NOTE: Sets both `pattern` & `mask` from a string of hex bytes
+         *        separated by spaces. A `?` in place of a hex digit
+         *        matches any nibble, a lone `?` any byte:
+         *
+         *          "48 8B ?? ?5 C3 ?"
+         */
+        [[nodiscard]] int set_pattern_str(const std::string & pattern_str);
+
+        [[nodiscard]] int set_signatures(const ptn_set * signatures) noexcept;
+        [[nodiscard]] ptn_set * get_signatures() const noexcept;
+};
+
+
+/*
+ *  Configuration options only applicable to string scans.
+ */
+class opt_str final : public _opt_scan {
+
+    _SC_DBG_PRIVATE:
+        //[attributes]
+        /* `str` is _not_ optional, it must be set. */
+        std::optional<std::string> str;
+
+        /*
+         *  NOTE: `str` is UTF-8 text. A string scan searches for it in
+         *        every encoding selected by `encodings`, a mask of
+         *        `str_enc` values; both are selected by default.
+         */
+        cm_byte encodings;
+
+        /*
+         *  NOTE: With `case_insensitive` on, ASCII letters match in
+         *        either case. Every other character matches exactly.
+         */
+        bool case_insensitive;
+
+        //only match strings followed by a null terminator
+        bool null_term;
+
+    public:
+        //ctor
+        opt_str();
+        opt_str(const opt_str & opts_str);
+        opt_str(const opt_str && opts_str);
+        ~opt_str() override final {};
+
+        //reset
+        [[nodiscard]] int reset() override final;
+
+        //getters & setters
+        [[nodiscard]] int set_str(const std::optional<std::string> & str);
+        [[nodiscard]] const std::optional<std::string> & get_str() const;
+
+        [[nodiscard]] int set_encodings(const cm_byte encodings) noexcept;
+        [[nodiscard]] cm_byte get_encodings() const noexcept;
+
+        [[nodiscard]] int set_case_insensitive(const bool enable) noexcept;
+        [[nodiscard]] bool get_case_insensitive() const noexcept;
+
+        [[nodiscard]] int set_null_term(const bool enable) noexcept;
+        [[nodiscard]] bool get_null_term() const noexcept;
+};
+
+
+/*
+ *  NOTE: A field of a structure lies `off` bytes past the base of the
+ *        structure. `SF_VALUE` fields hold a value of `type`, equal to
+ *        `value` for `VP_EQ` or inside `value` to `value_hi` for
+ *        `VP_RANGE`; no other predicate applies. `SF_PTR` fields hold
+ *        an address of the target's width that points into a mapped
+ *        area; their other members are ignored.
+ */
+
+struct struct_field {
+
+    off_t off;
+    enum struct_field_kind kind;
+    enum val_type type;
+    enum val_pred predicate;
+    std::vector<cm_byte> value;
+    std::vector<cm_byte> value_hi;
+};
+
+
+/*
+ *  Configuration options only applicable to structure scans.
+ */
+class opt_struct final : public _opt_scan {
+
+    _SC_DBG_PRIVATE:
+        //[attributes]
+        /* `fields` & `alignment` must be set. */
+        std::vector<struct struct_field> fields;
+        std::optional<off_t> alignment;
+
+    public:
+        //ctor
+        opt_struct();
+        opt_struct(const opt_struct & opts_struct);
+        opt_struct(const opt_struct && opts_struct);
+        ~opt_struct() override final {};
+
+        //reset
+        [[nodiscard]] int reset() override final;
+
+        //getters & setters
+        [[nodiscard]] int set_fields(
+            const std::vector<struct struct_field> & fields);
+        [[nodiscard]] const std::vector<struct struct_field> &
+            get_fields() const;
+
+        [[nodiscard]] int set_alignment(
+            const std::optional<off_t> alignment) noexcept;
+        [[nodiscard]] std::optional<off_t>
+            get_alignment() const noexcept;
 };
 
 
@@ -392,31 +829,76 @@ class ptrscan_chain {
     _SC_DBG_PRIVATE:
         //[attributes]
         uint32_t obj_idx;
+        uint32_t target_idx;
         std::optional<const cm_lst_node *> obj_node;
         std::optional<std::string> pathname;
         std::vector<off_t> offsets;
 
+        //number of verifications of this chain & how many it passed
+        uint32_t checks;
+        uint32_t hits;
+
     public:
         //[methods]
         /* internal */ uint32_t _get_obj_idx() const noexcept;
+        /* internal */ void _record_check(const bool hit) noexcept;
+        /* internal */ void _set_stability(
+            const uint32_t checks, const uint32_t hits) noexcept;
     
         //ctors
         ptrscan_chain(const cm_lst_node * obj_node,
                       const uint32_t _obj_idx,
-                      const std::vector<off_t> & offsets);
+                      const std::vector<off_t> & offsets,
+                      const uint32_t target_idx = 0);
         ptrscan_chain(const std::string pathname,
                       const uint32_t _obj_idx,
-                      const std::vector<off_t> & offsets);
+                      const std::vector<off_t> & offsets,
+                      const uint32_t target_idx = 0);
         
         //getters & setters
         std::optional<const cm_lst_node *> get_obj_node() const noexcept;
+        uint32_t get_target_idx() const noexcept;
         const std::optional<std::string> &
             get_pathname() const noexcept;
         const std::vector<off_t> & get_offsets() const noexcept;
-
+        uint32_t get_checks() const noexcept;
+        uint32_t get_hits() const noexcept;
+        //fraction of verifications passed, 0 if never verified
+        double get_stability() const noexcept;
 };
  
 
+//limits enforced during the last pointer scan
+struct ptrscan_report {
+
+    //[attributes]
+    //nodes dropped by `max_children`
+    size_t children_dropped;
+    //nodes dropped by `max_level_nodes`
+    size_t level_nodes_dropped;
+    //chains dropped by `max_chains`
+    size_t chains_dropped;
+    //nodes dropped by `prefer_static`
+    size_t non_static_dropped;
+    //nodes dropped by `max_array_run`
+    size_t array_nodes_dropped;
+
+    //[methods]
+    ptrscan_report()
+     : children_dropped(0),
+       level_nodes_dropped(0),
+       chains_dropped(0),
+       non_static_dropped(0),
+       array_nodes_dropped(0) {}
+
+    //true if any limit caused results to be dropped
+    bool is_truncated() const noexcept {
+        return (children_dropped + level_nodes_dropped + chains_dropped
+                + non_static_dropped + array_nodes_dropped) != 0;
+    }
+};
+
+
 class ptrscan : public _scan {
 
     _SC_DBG_PRIVATE:
@@ -425,6 +907,9 @@ class ptrscan : public _scan {
         std::unique_ptr<_ptrscan_tree> tree_p;
         int cur_depth_level;
 
+        //limits enforced during the last scan
+        struct ptrscan_report report;
+
         //flattened tree chains
         std::vector<std::string> ser_pathnames;
         std::vector<struct ptrscan_chain> chains;
@@ -438,24 +923,43 @@ class ptrscan : public _scan {
                       const uintptr_t own_addr, const
                       uintptr_t ptr_addr);
 
-        [[nodiscard]] std::pair<std::string, cm_lst_node *>
-            get_chain_data(const cm_lst_node * const area_node) const;
         [[nodiscard]] int get_chain_idx(const std::string & pathname);
-
-        [[nodiscard]] bool
-            is_chain_valid(const uintptr_t target_addr,
-                           const struct sc::ptrscan_chain & chain,
-                           mc_session & session) const;
+        void clear_pathnames();
+
+        void build_level_index();
+        [[nodiscard]] int build_reach(const sc::opt & opts,
+                                      const sc::opt_ptr & opts_ptr);
+
+        [[nodiscard]] int write_checkpoint(const std::string & path,
+                                           const sc::opt_ptr & opts_ptr,
+                                           const int depth_level) const;
+        [[nodiscard]] int read_checkpoint(const sc::opt & opts,
+                                          const sc::opt_ptr & opts_ptr);
+        [[nodiscard]] int spill_level(const sc::opt_ptr & opts_ptr,
+                                      const int depth_level);
+        [[nodiscard]] int
+            verify_chains(const sc::opt & opts,
+                          const std::vector<uintptr_t> & target_addrs,
+                          std::vector<cm_byte> & valid) const;
 
         [[nodiscard]] std::pair<size_t, size_t>
-            get_fbuf_data_sz() const;
+            get_fbuf_data_sz(const std::vector<cm_byte> * keep) const;
+        [[nodiscard]] int generate_body(
+            std::vector<cm_byte> & buf, const off_t hdr_off,
+            const std::vector<cm_byte> * keep) const;
         [[nodiscard]] int handle_body_start(
-            const std::vector<cm_byte> & buf, off_t hdr_off, off_t & buf_off);
-        [[nodiscard]]
-            std::optional<std::pair<uint32_t, std::vector<off_t>>>
-                handle_body_chain(
-                    const std::vector<cm_byte> & buf, off_t & buf_off);
-        [[nodiscard]] int flatten_tree();
+            const std::vector<cm_byte> & buf, off_t hdr_off,
+            off_t & buf_off, uint32_t & chains_num);
+        [[nodiscard]] std::optional<ptrscan_chain> handle_body_chain(
+                    const std::vector<cm_byte> & buf, off_t & buf_off,
+                    const cm_byte version);
+        [[nodiscard]] int flatten_tree(const mc_vm_map & map,
+                                       const sc::opt_ptr & opts_ptr);
+        [[nodiscard]] int flatten_spill(
+            const sc::opt_ptr & opts_ptr,
+            const std::function<void(const uintptr_t, std::vector<off_t> &,
+                                     const uint32_t)> & add_chain) const;
+        void prune_chains(const size_t max_chains);
 
         void do_reset();
 
@@ -470,10 +974,11 @@ class ptrscan : public _scan {
                     const off_t hdr_off) override final;
         /* internal */ [[nodiscard]] int _process_body(
                     const std::vector<cm_byte> & buf, off_t hdr_off,
+                    const cm_byte version,
                     const mc_vm_map & map) override final;
         /* internal */ [[nodiscard]] int _read_body(
-                    const std::vector<cm_byte> & buf,
-                    off_t hdr_off) override final;
+                    const std::vector<cm_byte> & buf, off_t hdr_off,
+                    const cm_byte version) override final;
 
         //ctors
         ptrscan();
@@ -494,85 +999,821 @@ class ptrscan : public _scan {
         [[nodiscard]] int verify(
             sc::opt & opts, const sc::opt_ptr & opts_ptr);
 
+        //save only the chains that lead to the current target(s)
+        [[nodiscard]] int filter(
+            const sc::opt & opts, const sc::opt_ptr & opts_ptr);
+
+        //verify chains without discarding them, recording the outcome
+        [[nodiscard]] int score(
+            sc::opt & opts, const sc::opt_ptr & opts_ptr);
+
+        //order chains by stability & drop the unstable ones
+        [[nodiscard]] int rank_stability();
+        [[nodiscard]] int prune_stability(const double min_stability);
+
         //getters & setters
         [[nodiscard]]
             const std::vector<struct ptrscan_chain> & get_chains() const;
+        [[nodiscard]]
+            const struct ptrscan_report & get_report() const noexcept;
 };
 
 
 /*
- *  NOTE: ScanCry uses a binary file format with the following sections:
- *
- *        Name format: <process comm>.<pid>.sc
- *               e.g.: netnote.1823.sc
- *
- *        File format:
- *                     [ 1. ScanCry header ]
- *                     [ 2. scan header    ]
- *                     [ 3. data           ]
- *
- *        The ScanCry header is a generic header applicable to all files.
- *
+ *  Pointer index.
  */
 
-//scancry header constants
-const constexpr int file_magic_sz = 4;
-const constexpr cm_byte file_magic[file_magic_sz]
-                                           = {'S', 'C', 0x13, 0x37};
-const constexpr cm_byte scan_type_ptr = 0x00;
-const constexpr cm_byte scan_type_ptn = 0x01;
-const constexpr cm_byte scan_type_val = 0x02;
-
-//versions
-const constexpr cm_byte file_ver_0 = 0;
+class _addr_index;
 
 
-//ScanCry file header
-struct scancry_file_hdr {
+//a single pointer found in memory
+struct ptr_index_entry {
 
-    cm_byte magic[file_magic_sz];
-    cm_byte version;
-    cm_byte scan_type;
+    //[attributes]
+    //value of the pointer & the address it is stored at
+    uintptr_t value;
+    uintptr_t addr;
 };
 
 
-//pointer scan file header
-struct ptr_file_hdr {
-
-    uint32_t pathnames_num;
-    uint32_t pathnames_offset;
-    uint32_t chains_num;
-    uint32_t chains_offset;
-};
-
+/*
+ *  NOTE: A pointer index records every aligned value of the scanned
+ *        areas that points into a mapped area, sorted by value. Once
+ *        built it answers "who points here" queries with a binary
+ *        search instead of a new scan. Refreshing rescans only the
+ *        given areas, e.g. after they were written to.
+ */
 
-//combined ScanCry & scan header struct
-struct combined_file_hdr {
-    struct scancry_file_hdr scancry_hdr;
-    union {
-        ptr_file_hdr ptr_hdr;
-    };
-};
+class ptr_index : public _scan {
 
+    _SC_DBG_PRIVATE:
+        //[attributes]
+        std::vector<struct ptr_index_entry> entries;
 
-class serialiser : public _lockable {
+        //cache
+        std::unique_ptr<_addr_index> area_index_p;
+        std::unordered_map<const cm_lst_node *,
+                           std::vector<struct ptr_index_entry>> area_entries;
 
-    _SC_DBG_PRIVATE:
         //[methods]
-        //miscellaneous
-        [[nodiscard]] std::optional<cm_byte>
-            get_scan_type(_scan * scan) const;
-        [[nodiscard]] bool
-            is_header_valid(sc::scancry_file_hdr & hdr) const;
+        [[nodiscard]] int run(sc::opt & opts,
+                              sc::opt_ptr & opts_ptr,
+                              sc::map_area_set & ma_set,
+                              worker_pool & w_pool,
+                              const cm_byte flags,
+                              const bool refresh);
+        void do_reset();
 
     public:
-        //file operations
-        [[nodiscard]] int save_scan(
-            sc::_scan & scan, const sc::opt & opts);
-        [[nodiscard]] int load_scan(
-            sc::_scan & scan, const sc::opt & opts, const bool shallow);
-        [[nodiscard]] std::optional<combined_file_hdr> read_headers(
-            const char * file_path);
+        //[methods]
+        /* internal */ [[nodiscard]] off_t _process_addr(
+                    const struct _scan_arg arg, const opt * const opts,
+                    const _opt_scan * const opts_scan) override final;
+
+        /*
+         *  NOTE: Pointer indeces are not saved; the methods below
+         *        only fail.
+         */
+
+        /* internal */ [[nodiscard]] int _generate_body(
+                    std::vector<cm_byte> & buf,
+                    const off_t hdr_off) override final;
+        /* internal */ [[nodiscard]] int _process_body(
+                    const std::vector<cm_byte> & buf, off_t hdr_off,
+                    const cm_byte version,
+                    const mc_vm_map & map) override final;
+        /* internal */ [[nodiscard]] int _read_body(
+                    const std::vector<cm_byte> & buf, off_t hdr_off,
+                    const cm_byte version) override final;
+
+        //ctors
+        ptr_index();
+        ptr_index(const ptr_index & ptr_idx) = delete;
+        ptr_index(const ptr_index && ptr_idx) = delete;
+        ~ptr_index();
+
+        [[nodiscard]] int reset() override final;
+
+        //index every pointer of the map area set, uses `alignment`
+        [[nodiscard]] int build(
+                    sc::opt & opts,
+                    sc::opt_ptr & opts_ptr,
+                    sc::map_area_set & ma_set,
+                    worker_pool & w_pool,
+                    cm_byte flags);
+
+        //re-index only the areas of the map area set
+        [[nodiscard]] int refresh(
+                    sc::opt & opts,
+                    sc::opt_ptr & opts_ptr,
+                    sc::map_area_set & ma_set,
+                    worker_pool & w_pool,
+                    cm_byte flags);
+
+        //every pointer to the range [addr - max_off, addr]
+        [[nodiscard]] std::vector<struct ptr_index_entry>
+            query(const uintptr_t addr, const uintptr_t max_off) const;
+
+        //getters & setters
+        [[nodiscard]] const std::vector<struct ptr_index_entry> &
+            get_entries() const noexcept;
+};
+
+
+/*
+ *  Value scanner.
+ */
+
+class _val_chunk;
+struct val_file_hdr;
+
+
+//size of a value of the given type
+[[nodiscard]] size_t val_type_sz(const enum val_type type) noexcept;
+
+
+/*
+ *  NOTE: A value scan compares every aligned position of the scanned
+ *        areas against `value`, or against the range `opt_val` widens
+ *        it into. Each page read by a worker is compared in one call,
+ *        several values at a time with vector kernels when `alignment`
+ *        equals the size of the type or is small enough for a vector
+ *        block to hold several positions. Wider alignments are compared
+ *        one position at a time.
+ *
+ *        Matches become candidates for `next_scan()`, which only reads
+ *        the memory that still holds candidates and keeps those that
+ *        satisfy the `predicate` of `opt_val`. Candidates are grouped
+ *        in chunks, stored as a bitmap while dense and as a sorted list
+ *        of offsets once sparse. Chunks are split between the sessions
+ *        of `opt`, one thread each, and runs of adjacent chunks are read
+ *        at once.
+ *
+ *        A scan without a `value` searches for an unknown initial value.
+ *        Rather than a copy of all scanned memory, every chunk keeps a
+ *        compressed snapshot of its memory, which next scans decompress
+ *        one chunk at a time.
+ *
+ *        Saved scans keep their candidates & previous values, so a
+ *        loaded scan can continue with `next_scan()`.
+ */
+
+class valscan : public _scan {
+
+    _SC_DBG_PRIVATE:
+        //[attributes]
+        std::vector<_val_chunk> chunks;
+        std::optional<enum val_type> type;
+        off_t alignment;
+
+        //cache
+        std::vector<cm_byte> bound_lo;
+        std::vector<cm_byte> bound_hi;
+        std::unordered_map<const cm_lst_node *,
+                           std::vector<_val_chunk>> area_chunks;
+        std::unordered_map<const cm_lst_node *,
+                           std::vector<uintptr_t>> area_matches;
+        std::unordered_map<const cm_lst_node *,
+                           std::vector<cm_byte>> area_raw;
+
+        //[methods]
+        void do_reset();
+        [[nodiscard]] struct val_file_hdr make_hdr(const off_t hdr_off) const;
+        [[nodiscard]] int read_hdr(const struct val_file_hdr & hdr);
+        [[nodiscard]] int read_chunk(const std::vector<cm_byte> & buf,
+                                     off_t & buf_off, const mc_vm_map * map);
+        [[nodiscard]] int read_chunks(const std::vector<cm_byte> & buf,
+                                      const mc_vm_map * map);
+
+    public:
+        //[methods]
+        /* internal */ [[nodiscard]] off_t _process_addr(
+                    const struct _scan_arg arg, const opt * const opts,
+                    const _opt_scan * const opts_scan) override final;
+
+        /* internal */ [[nodiscard]] int _generate_body(
+                    std::vector<cm_byte> & buf,
+                    const off_t hdr_off) override final;
+        /* internal */ [[nodiscard]] int _process_body(
+                    const std::vector<cm_byte> & buf, off_t hdr_off,
+                    const cm_byte version,
+                    const mc_vm_map & map) override final;
+        /* internal */ [[nodiscard]] int _read_body(
+                    const std::vector<cm_byte> & buf, off_t hdr_off,
+                    const cm_byte version) override final;
+
+        //stream the candidates one chunk at a time
+        /* internal */ [[nodiscard]] int _write_body(
+                    std::ostream & os, const off_t hdr_off) override final;
+        /* internal */ [[nodiscard]] int _load_body(
+                    std::istream & is, const off_t hdr_off,
+                    const cm_byte version,
+                    const mc_vm_map * map) override final;
+
+        //ctors
+        valscan();
+        valscan(const valscan & v_scan) = delete;
+        valscan(const valscan && v_scan) = delete;
+        ~valscan();
+
+        [[nodiscard]] int reset() override final;
+
+        //find every address of the map area set holding `value`, or a
+        //value in its range, or snapshot every address if no `value` is set
+        [[nodiscard]] int scan(
+                    sc::opt & opts,
+                    sc::opt_val & opts_val,
+                    sc::map_area_set & ma_set,
+                    worker_pool & w_pool,
+                    cm_byte flags);
+
+        //keep the candidates that satisfy the predicate of `opts_val`
+        [[nodiscard]] int next_scan(
+                    sc::opt & opts, sc::opt_val & opts_val);
+
+        //getters & setters
+        [[nodiscard]] std::vector<uintptr_t> get_addrs() const;
+        [[nodiscard]] size_t get_addrs_num() const noexcept;
+};
+
+
+/*
+ *  Pattern scanner.
+ */
+
+class _ptn_matcher;
+class _ptn_filter;
+
+
+/*
+ *  NOTE: A pattern set compiles many patterns, e.g. a library of
+ *        signatures, into a single filter that a pattern scan searches
+ *        for in one pass of memory. Patterns are identified by the index
+ *        `add_pattern()` returns.
+ *
+ *        Compiling a large set takes time; `save()` writes the compiled
+ *        set to a file that `load()` reads back without compiling it
+ *        again.
+ */
+
+class ptn_set : public _lockable {
+
+    _SC_DBG_PRIVATE:
+        //[attributes]
+        std::unique_ptr<_ptn_filter> filter_p;
+
+    public:
+        //[methods]
+
+        //ctors
+        ptn_set();
+        ptn_set(const ptn_set & p_set);
+        ptn_set(const ptn_set && p_set) = delete;
+        ~ptn_set();
+
+        //reset
+        [[nodiscard]] int reset();
+
+        //add a pattern to the set, returns its index
+        [[nodiscard]] ssize_t add_pattern(
+                    const std::vector<cm_byte> & pattern,
+                    const std::optional<std::vector<cm_byte>> & mask);
+        [[nodiscard]] ssize_t add_pattern_str(const std::string & pattern_str);
+
+        //build the filter for the patterns added so far
+        [[nodiscard]] int compile();
+
+        //write & read a compiled set
+        [[nodiscard]] int save(const std::string & file_path);
+        [[nodiscard]] int load(const std::string & file_path);
+
+        //getters & setters
+        [[nodiscard]] size_t get_ptns_num() const noexcept;
+        [[nodiscard]] bool is_compiled() const noexcept;
+        /* internal */ [[nodiscard]] const _ptn_filter &
+            _get_filter() const noexcept;
+};
+
+
+/*
+ *  NOTE: A pattern scan finds every address of the scanned areas where
+ *        `pattern` of `opt_ptn` matches. Restrict the scan to executable
+ *        areas with the `access` of `opt` to search code for signatures.
+ *
+ *        Positions are first filtered on two bytes of the pattern that
+ *        are expected to be rare in memory, many positions at a time.
+ *        Every remaining position is then verified against the whole
+ *        pattern. Patterns that cross the end of a worker's read buffer
+ *        are verified once the next buffer is read.
+ *
+ *        With `signatures` of `opt_ptn` set, every pattern of the set is
+ *        searched for at once. Matches are kept per pattern, retrieve
+ *        them with the index of the pattern in its set.
+ */
+
+class ptnscan : public _scan {
+
+    _SC_DBG_PRIVATE:
+        //[attributes]
+        std::vector<std::vector<uintptr_t>> addrs;
+        std::unique_ptr<_ptn_matcher> matcher_p;
+        const _ptn_filter * filter_p;
+
+        //cache
+        std::unordered_map<const cm_lst_node *,
+                           std::vector<std::vector<uintptr_t>>> area_addrs;
+        std::unordered_map<const cm_lst_node *,
+                           std::vector<cm_byte>> area_tails;
+        std::unordered_map<const cm_lst_node *,
+                           std::vector<std::pair<uintptr_t, uint32_t>>>
+                               area_pending;
+
+        //[methods]
+        void do_reset();
+        void search_set(const struct _scan_arg & arg,
+                        const uintptr_t area_start,
+                        const size_t avail, const size_t adv,
+                        const bool area_end);
+        [[nodiscard]] int read_addrs(const std::vector<cm_byte> & buf,
+                                     const mc_vm_map * map);
+
+    public:
+        //[methods]
+        /* internal */ [[nodiscard]] off_t _process_addr(
+                    const struct _scan_arg arg, const opt * const opts,
+                    const _opt_scan * const opts_scan) override final;
+
+        /* internal */ [[nodiscard]] int _generate_body(
+                    std::vector<cm_byte> & buf,
+                    const off_t hdr_off) override final;
+        /* internal */ [[nodiscard]] int _process_body(
+                    const std::vector<cm_byte> & buf, off_t hdr_off,
+                    const cm_byte version,
+                    const mc_vm_map & map) override final;
+        /* internal */ [[nodiscard]] int _read_body(
+                    const std::vector<cm_byte> & buf, off_t hdr_off,
+                    const cm_byte version) override final;
+
+        //ctors
+        ptnscan();
+        ptnscan(const ptnscan & p_scan) = delete;
+        ptnscan(const ptnscan && p_scan) = delete;
+        ~ptnscan();
+
+        [[nodiscard]] int reset() override final;
+
+        //find every address of the map area set matching `pattern`,
+        //or any pattern of `signatures`
+        [[nodiscard]] int scan(
+                    sc::opt & opts,
+                    sc::opt_ptn & opts_ptn,
+                    sc::map_area_set & ma_set,
+                    worker_pool & w_pool,
+                    cm_byte flags);
+
+        //getters & setters
+        [[nodiscard]] std::vector<uintptr_t> get_addrs(
+                    const size_t ptn_idx = 0) const;
+        [[nodiscard]] size_t get_ptns_num() const noexcept;
+};
+
+
+/*
+ *  String scanner.
+ */
+
+//a string found by a string scan, tagged with its encoding
+struct str_match {
+
+    uintptr_t addr;
+    enum str_enc enc;
+};
+
+
+/*
+ *  NOTE: A string scan finds every address of the scanned areas holding
+ *        `str` of `opt_str`, in each selected encoding. The string is
+ *        converted to each encoding & searched for the same way as a
+ *        pattern, so strings that cross the end of a worker's read
+ *        buffer are found as well. Case insensitive scans fold both
+ *        memory & string to lowercase as part of the block compare.
+ */
+
+class strscan : public _scan {
+
+    _SC_DBG_PRIVATE:
+        //[attributes]
+        std::vector<struct str_match> matches;
+        std::vector<enum str_enc> encs;
+        std::vector<std::unique_ptr<_ptn_matcher>> matchers;
+
+        //cache
+        std::unordered_map<const cm_lst_node *,
+                           std::vector<std::vector<uintptr_t>>> area_addrs;
+        std::unordered_map<const cm_lst_node *,
+                           std::vector<std::vector<cm_byte>>> area_tails;
+
+        //[methods]
+        void do_reset();
+        [[nodiscard]] int compile(const opt_str & opts_str);
+        [[nodiscard]] int read_matches(const std::vector<cm_byte> & buf,
+                                       const mc_vm_map * map);
+
+    public:
+        //[methods]
+        /* internal */ [[nodiscard]] off_t _process_addr(
+                    const struct _scan_arg arg, const opt * const opts,
+                    const _opt_scan * const opts_scan) override final;
+
+        /* internal */ [[nodiscard]] int _generate_body(
+                    std::vector<cm_byte> & buf,
+                    const off_t hdr_off) override final;
+        /* internal */ [[nodiscard]] int _process_body(
+                    const std::vector<cm_byte> & buf, off_t hdr_off,
+                    const cm_byte version,
+                    const mc_vm_map & map) override final;
+        /* internal */ [[nodiscard]] int _read_body(
+                    const std::vector<cm_byte> & buf, off_t hdr_off,
+                    const cm_byte version) override final;
+
+        //ctors
+        strscan();
+        strscan(const strscan & s_scan) = delete;
+        strscan(const strscan && s_scan) = delete;
+        ~strscan();
+
+        [[nodiscard]] int reset() override final;
+
+        //find every address of the map area set holding `str`
+        [[nodiscard]] int scan(
+                    sc::opt & opts,
+                    sc::opt_str & opts_str,
+                    sc::map_area_set & ma_set,
+                    worker_pool & w_pool,
+                    cm_byte flags);
+
+        //getters & setters
+        [[nodiscard]] const std::vector<struct str_match> &
+            get_matches() const noexcept;
+};
+
+
+/*
+ *  Structure scanner.
+ */
+
+struct _struct_field;
+
+
+/*
+ *  NOTE: A structure scan finds the base of every aligned structure of
+ *        the scanned areas whose fields all match `opt_struct`, in a
+ *        single pass. The value field least likely to match is compared
+ *        first with the kernels of a value scan; every other field is
+ *        tested only at the structures where it matched. Structures
+ *        that cross the end of a worker's read buffer are finished with
+ *        the next buffer of the same area.
+ *
+ *        Equality is considered more selective than a range, wider
+ *        types more selective than narrow ones, and any value more
+ *        selective than zero, which fills most of memory. Pointer
+ *        fields are always tested last.
+ */
+
+class structscan : public _scan {
+
+    _SC_DBG_PRIVATE:
+        //[attributes]
+        std::vector<uintptr_t> addrs;
+        std::vector<struct _struct_field> fields; //most selective first
+        size_t struct_sz;
+        off_t alignment;
+
+        //cache
+        std::unique_ptr<_addr_index> area_index_p;
+        std::unordered_map<const cm_lst_node *,
+                           std::vector<uintptr_t>> area_addrs;
+        std::unordered_map<const cm_lst_node *,
+                           std::vector<uintptr_t>> area_hits;
+        std::unordered_map<const cm_lst_node *,
+                           std::vector<cm_byte>> area_tails;
+
+        //[methods]
+        void do_reset();
+        [[nodiscard]] int compile(const opt_struct & opts_struct,
+                                  const enum addr_width addr_width);
+        void match(const cm_byte * buf, const size_t pos_num,
+                   const uintptr_t addr, const enum addr_width addr_width,
+                   std::vector<uintptr_t> & hits,
+                   std::vector<uintptr_t> & addrs) const;
+
+    public:
+        //[methods]
+        /* internal */ [[nodiscard]] off_t _process_addr(
+                    const struct _scan_arg arg, const opt * const opts,
+                    const _opt_scan * const opts_scan) override final;
+
+        /*
+         *  NOTE: Structure scans can not be saved yet; the methods below
+         *        only fail.
+         */
+
+        /* internal */ [[nodiscard]] int _generate_body(
+                    std::vector<cm_byte> & buf,
+                    const off_t hdr_off) override final;
+        /* internal */ [[nodiscard]] int _process_body(
+                    const std::vector<cm_byte> & buf, off_t hdr_off,
+                    const cm_byte version,
+                    const mc_vm_map & map) override final;
+        /* internal */ [[nodiscard]] int _read_body(
+                    const std::vector<cm_byte> & buf, off_t hdr_off,
+                    const cm_byte version) override final;
+
+        //ctors
+        structscan();
+        structscan(const structscan & st_scan) = delete;
+        structscan(const structscan && st_scan) = delete;
+        ~structscan();
+
+        [[nodiscard]] int reset() override final;
+
+        //find the base of every structure of the map area set
+        //whose fields all match
+        [[nodiscard]] int scan(
+                    sc::opt & opts,
+                    sc::opt_struct & opts_struct,
+                    sc::map_area_set & ma_set,
+                    worker_pool & w_pool,
+                    cm_byte flags);
+
+        //getters & setters
+        [[nodiscard]] const std::vector<uintptr_t> &
+            get_addrs() const noexcept;
+};
+
+
+
+/*
+ *  Watch list.
+ */
+
+class _watch_buffer;
+class _watch_state;
+
+
+//largest value a watch list entry holds
+const constexpr size_t watch_val_max_sz = sizeof(uint64_t);
+
+
+//an address or pointer chain of a watch list
+struct _watch_entry {
+
+    //[attributes]
+    std::optional<ptrscan_chain> chain;
+    uintptr_t addr; //if not a chain
+    enum val_type type;
+    size_t sz;
+};
+
+
+//the value of an entry, as of one refresh
+struct watch_value {
+
+    //[attributes]
+    uintptr_t addr; //address the chain resolved to
+    bool ok;        //false if the chain did not resolve or the read failed
+    cm_byte bytes[watch_val_max_sz];
+};
+
+
+//the values of every entry, as of one refresh
+struct watch_frame {
+
+    //[attributes]
+    uint64_t seq;   //number of the refresh, 0 before the first one
+    std::vector<struct watch_value> values;
+};
+
+
+/*
+ *  NOTE: A watch list polls the values of many addresses & pointer
+ *        chains. `refresh()` refreshes it once on the calling thread;
+ *        `start()` refreshes it on a dedicated thread every `interval`
+ *        until `stop()` is called. Chains are resolved one depth level
+ *        at a time & values are then read, batching every level into
+ *        one read per page of the target. If `opts` holds the PID of
+ *        the target, the pages of a level are read together through
+ *        `process_vm_readv()`, otherwise each is read through MemCry.
+ *
+ *        Refreshes are published through a lock-free triple buffer.
+ *        `get_frame()` returns the latest frame without waiting for the
+ *        thread, & the thread never waits for a reader. The frame stays
+ *        valid until the next call to `get_frame()`. Only one thread
+ *        may read frames.
+ *
+ *        A frozen entry has its value written back on every refresh,
+ *        before it is read. Freezes can change while the thread runs;
+ *        entries can not. The thread holds `opts` & uses its first
+ *        session, which must not be shared with scans.
+ */
+
+class watch_list : public _lockable {
+
+    _SC_DBG_PRIVATE:
+        //[attributes]
+        std::vector<struct _watch_entry> entries;
+        size_t max_len; //longest chain
+
+        std::unique_ptr<_watch_buffer> buffer_p;
+        std::unique_ptr<_watch_state> state_p;
+
+        //[methods]
+        [[nodiscard]] ssize_t add_entry(struct _watch_entry && entry);
+        void resolve(const mc_session * session,
+                     const enum addr_width addr_width);
+        void write_freezes(const mc_session * session);
+        void read_values(const mc_session * session);
+        void do_refresh(const mc_session * session,
+                        const enum addr_width addr_width);
+
+        void do_reset();
+
+    public:
+        //[methods]
+        /* internal */ void _run();
+
+        //ctors
+        watch_list();
+        watch_list(const watch_list & w_list) = delete;
+        watch_list(const watch_list && w_list) = delete;
+        ~watch_list();
+
+        //reset
+        [[nodiscard]] int reset();
+
+        //add an entry, returns its index
+        [[nodiscard]] ssize_t add_addr(const uintptr_t addr,
+                                       const enum val_type type);
+        [[nodiscard]] ssize_t add_chain(const ptrscan_chain & chain,
+                                        const enum val_type type);
+
+        //write `value` to an entry on every refresh, `std::nullopt` thaws it
+        [[nodiscard]] int set_freeze(
+            const size_t idx,
+            const std::optional<std::vector<cm_byte>> & value);
+
+        //refresh every entry once
+        [[nodiscard]] int refresh(sc::opt & opts);
+
+        //refresh every entry on a dedicated thread
+        [[nodiscard]] int start(sc::opt & opts,
+                                const struct timespec & interval);
+        [[nodiscard]] int stop();
+
+        //getters & setters
+        [[nodiscard]] const struct watch_frame & get_frame() noexcept;
+        [[nodiscard]] size_t get_entries_num() const noexcept;
+        [[nodiscard]] bool is_running() const noexcept;
+};
+
+
+/*
+ *  NOTE: ScanCry uses a binary file format with the following sections:
+ *
+ *        Name format: <process comm>.<pid>.sc
+ *               e.g.: netnote.1823.sc
+ *
+ *        File format:
+ *                     [ 1. ScanCry header ]
+ *                     [ 2. scan header    ]
+ *                     [ 3. data           ]
+ *
+ *        The ScanCry header is a generic header applicable to all files.
+ *
+ *        Value scan files hold the candidates of a scan one chunk at a
+ *        time, each with the previous values of its candidates or a
+ *        compressed snapshot of their memory. Next scans can continue
+ *        from a loaded file without reading the target first.
+ */
+
+//scancry header constants
+const constexpr int file_magic_sz = 4;
+const constexpr cm_byte file_magic[file_magic_sz]
+                                           = {'S', 'C', 0x13, 0x37};
+const constexpr cm_byte scan_type_ptr = 0x00;
+const constexpr cm_byte scan_type_ptn = 0x01;
+const constexpr cm_byte scan_type_val = 0x02;
+const constexpr cm_byte scan_type_str = 0x03;
+
+//versions
+const constexpr cm_byte file_ver_0 = 0;
+const constexpr cm_byte file_ver_1 = 1; //ptrscan chains store a target index
+const constexpr cm_byte file_ver_2 = 2; //ptrscan offsets are signed 64bit
+const constexpr cm_byte file_ver_3 = 3; //ptrscan chains store stability
+const constexpr cm_byte file_ver_cur = file_ver_3;
+
+
+//ScanCry file header
+struct scancry_file_hdr {
+
+    cm_byte magic[file_magic_sz];
+    cm_byte version;
+    cm_byte scan_type;
+};
+
+
+//pointer scan file header
+struct ptr_file_hdr {
+
+    uint32_t pathnames_num;
+    uint32_t pathnames_offset;
+    uint32_t chains_num;
+    uint32_t chains_offset;
+};
+
+
+//value scan file header
+struct val_file_hdr {
+
+    uint64_t addrs_num;
+    uint32_t chunks_num;
+    uint32_t chunks_offset;
+    uint32_t alignment;
+    cm_byte type;
+};
+
+
+//pattern scan file header
+struct ptn_file_hdr {
+
+    uint32_t ptns_num;
+    uint32_t addrs_num;
+    uint32_t addrs_offset;
+};
+
+
+//string scan file header
+struct str_file_hdr {
+
+    uint32_t matches_num;
+    uint32_t matches_offset;
+};
+
+
+//combined ScanCry & scan header struct
+struct combined_file_hdr {
+    struct scancry_file_hdr scancry_hdr;
+    union {
+        ptr_file_hdr ptr_hdr;
+        val_file_hdr val_hdr;
+        ptn_file_hdr ptn_hdr;
+        str_file_hdr str_hdr;
+    };
+};
+
+
+class serialiser : public _lockable {
+
+    _SC_DBG_PRIVATE:
+        //[methods]
+        //miscellaneous
+        [[nodiscard]] std::optional<cm_byte>
+            get_scan_type(_scan * scan) const;
+        [[nodiscard]] bool
+            is_header_valid(sc::scancry_file_hdr & hdr) const;
+        [[nodiscard]] int open_file(std::ofstream & fs,
+                                    const std::string & file_path,
+                                    const cm_byte scan_type) const;
+
+        //write to `<file_path>.tmp` & rename it over `file_path`
+        [[nodiscard]] int open_tmp_file(std::ofstream & fs,
+                                        const std::string & file_path,
+                                        const cm_byte scan_type) const;
+        [[nodiscard]] int finish_tmp_file(std::ofstream & fs,
+                                          const std::string & file_path,
+                                          const bool commit) const;
+
+    public:
+        //write a header & a prepared body
+        /* internal */ [[nodiscard]] int _write_file(
+            const std::string & file_path, const cm_byte scan_type,
+            const std::vector<cm_byte> & body_buf);
+
+        //file operations
+        [[nodiscard]] int save_scan(
+            sc::_scan & scan, const sc::opt & opts);
+        [[nodiscard]] int load_scan(
+            sc::_scan & scan, const sc::opt & opts, const bool shallow);
+        [[nodiscard]] std::optional<combined_file_hdr> read_headers(
+            const char * file_path);
+
+        //combine two pointer scan files without loading either of them
+        [[nodiscard]] int intersect_scans(const std::string & file_a,
+                                          const std::string & file_b,
+                                          const std::string & file_out);
+        [[nodiscard]] int diff_scans(const std::string & file_a,
+                                     const std::string & file_b,
+                                     const std::string & file_out);
 };
 
 
@@ -602,9 +1843,15 @@ extern "C" {
 typedef void * sc_opt;
 typedef /* base */ void * sc_opt_scan;
 typedef void * sc_opt_ptr;
+typedef void * sc_opt_val;
+typedef void * sc_opt_ptn;
+typedef void * sc_opt_str;
+typedef void * sc_opt_struct;
+typedef void * sc_ptn_set;
 
 typedef void * sc_map_area_set;
 typedef void * sc_worker_pool;
+typedef void * sc_watch_list;
 
 typedef /* base */ void * sc_scan;
 
@@ -619,6 +1866,16 @@ typedef struct {
 } sc_addr_range;
 
 
+//value of a watch list entry
+#define SC_WATCH_VAL_MAX_SZ 8
+
+typedef struct {
+    uintptr_t addr;
+    bool ok;
+    cm_byte bytes[SC_WATCH_VAL_MAX_SZ];
+} sc_watch_value;
+
+
 //architecture address width enum
 enum sc_addr_width {
     AW32 = 4,
@@ -626,13 +1883,64 @@ enum sc_addr_width {
 };
 
 
+//value scanner type enum
+enum sc_val_type {
+    VT_I8  = 0,
+    VT_U8  = 1,
+    VT_I16 = 2,
+    VT_U16 = 3,
+    VT_I32 = 4,
+    VT_U32 = 5,
+    VT_I64 = 6,
+    VT_U64 = 7,
+    VT_F32 = 8,
+    VT_F64 = 9
+};
+
+
+//value scanner predicate enum
+enum sc_val_pred {
+    VP_EQ           = 0,
+    VP_CHANGED      = 1,
+    VP_UNCHANGED    = 2,
+    VP_INCREASED    = 3,
+    VP_DECREASED    = 4,
+    VP_INCREASED_BY = 5,
+    VP_DECREASED_BY = 6,
+    VP_RANGE        = 7
+};
+
+
+//value scanner rounding mode enum
+enum sc_val_round {
+    VR_NONE  = 0,
+    VR_ROUND = 1,
+    VR_TRUNC = 2
+};
+
+
+//string scanner encoding enum, values combine into a mask
+enum sc_str_enc {
+    SE_UTF8    = 0x1,
+    SE_UTF16LE = 0x2
+};
+
+
+//structure scanner field kind enum
+enum sc_struct_field_kind {
+    SF_VALUE = 0,
+    SF_PTR   = 1
+};
+
+
 //scancry header constants
 #define SC_FILE_MAGIC_SZ 4
 #define SC_FILE_MAGIC {'S', 'C', 0x13, 0x37}
 
 #define SC_SCAN_TYPE_PTR 0x00
-#define SC_SCAN_TYPE_PTN 0x01;
-#define SC_SCAN_TYPE_VAL 0x02;
+#define SC_SCAN_TYPE_PTN 0x01
+#define SC_SCAN_TYPE_VAL 0x02
+#define SC_SCAN_TYPE_STR 0x03
 
 
 //ScanCry file header
@@ -654,11 +1962,42 @@ typedef struct {
 } sc_ptr_file_hdr;
 
 
+//value scan file header
+typedef struct {
+
+    uint64_t addrs_num;
+    uint32_t chunks_num;
+    uint32_t chunks_offset;
+    uint32_t alignment;
+    cm_byte type;
+} sc_val_file_hdr;
+
+
+//pattern scan file header
+typedef struct {
+
+    uint32_t ptns_num;
+    uint32_t addrs_num;
+    uint32_t addrs_offset;
+} sc_ptn_file_hdr;
+
+
+//string scan file header
+typedef struct {
+
+    uint32_t matches_num;
+    uint32_t matches_offset;
+} sc_str_file_hdr;
+
+
 //combined ScanCry & scan header struct
 typedef struct combined_file_hdr {
     sc_scancry_file_hdr scancry_hdr;
     union {
         sc_ptr_file_hdr ptr_hdr;
+        sc_val_file_hdr val_hdr;
+        sc_ptn_file_hdr ptn_hdr;
+        sc_str_file_hdr str_hdr;
     };
 } sc_combined_file_hdr;
 
@@ -764,6 +2103,12 @@ extern int sc_opt_set_access(sc_opt opts, const cm_byte access);
 //return: access mask on success, -1 if not set
 extern cm_byte sc_opt_get_access(const sc_opt opts);
 
+//return: 0 on success, -1 on error
+//`pid` of -1 unsets it
+extern int sc_opt_set_pid(sc_opt opts, const pid_t pid);
+//return: PID on success, -1 if not set
+extern pid_t sc_opt_get_pid(const sc_opt opts);
+
 
 /*
  *  --- [OPT_PTR] ---
@@ -826,6 +2171,237 @@ extern int sc_opt_ptr_set_smart_scan(sc_opt_ptr opts_ptr,
 //return: whether smart scan is enabled
 extern bool sc_opt_ptr_get_smart_scan(const sc_opt_ptr opts_ptr);
 
+/*
+ * The following setter requires an initialised CMore vector (`cm_vct`)
+ * holding `uintptr_t`. The getter requires an unitialised CMore vector
+ * which will be initialised and populated by the call. Must be manually
+ * destroyed later.
+ */
+
+//all return 0 on success, -1 on error
+extern int sc_opt_ptr_set_target_addrs(sc_opt_ptr opts_ptr,
+                                       const cm_vct * target_addrs);
+extern int sc_opt_ptr_get_target_addrs(const sc_opt_ptr opts_ptr,
+                                       cm_vct * target_addrs);
+
+//return: 0 on success, -1 on error
+extern int sc_opt_ptr_set_max_chains(sc_opt_ptr opts_ptr,
+                                     const size_t max_chains);
+//return: max number of chains if set, 0x0 if not set
+extern size_t sc_opt_ptr_get_max_chains(const sc_opt_ptr opts_ptr);
+
+//return: 0 on success, -1 on error
+extern int sc_opt_ptr_set_max_level_nodes(sc_opt_ptr opts_ptr,
+                                          const size_t max_level_nodes);
+//return: max nodes per depth level if set, 0x0 if not set
+extern size_t sc_opt_ptr_get_max_level_nodes(const sc_opt_ptr opts_ptr);
+
+//return: 0 on success, -1 on error
+extern int sc_opt_ptr_set_max_children(sc_opt_ptr opts_ptr,
+                                       const size_t max_children);
+//return: max children per node if set, 0x0 if not set
+extern size_t sc_opt_ptr_get_max_children(const sc_opt_ptr opts_ptr);
+
+//return: 0 on success, -1 on error
+extern int sc_opt_ptr_set_bidirectional(sc_opt_ptr opts_ptr,
+                                        const bool enable);
+//return: whether bidirectional search is enabled
+extern bool sc_opt_ptr_get_bidirectional(const sc_opt_ptr opts_ptr);
+
+//return: 0 on success, -1 on error
+extern int sc_opt_ptr_set_checkpoint_path(sc_opt_ptr opts_ptr,
+                                          const char * path);
+//returns checkpoint file path string if set, NULL if not set
+extern const char * sc_opt_ptr_get_checkpoint_path(const sc_opt_ptr opts_ptr);
+
+//return: 0 on success, -1 on error
+extern int sc_opt_ptr_set_spill_path(sc_opt_ptr opts_ptr,
+                                     const char * path);
+//returns spill file path string if set, NULL if not set
+extern const char * sc_opt_ptr_get_spill_path(const sc_opt_ptr opts_ptr);
+
+//return: 0 on success, -1 on error
+extern int sc_opt_ptr_set_max_neg_off(sc_opt_ptr opts_ptr,
+                                      const off_t max_neg_off);
+//return: maximum negative offset, 0x0 if not set
+extern off_t sc_opt_ptr_get_max_neg_off(const sc_opt_ptr opts_ptr);
+
+//return: 0 on success, -1 on error
+extern int sc_opt_ptr_set_prefer_static(sc_opt_ptr opts_ptr,
+                                        const bool enable);
+//return: whether static areas are preferred when pruning
+extern bool sc_opt_ptr_get_prefer_static(const sc_opt_ptr opts_ptr);
+
+//return: 0 on success, -1 on error
+extern int sc_opt_ptr_set_max_array_run(sc_opt_ptr opts_ptr,
+                                        const size_t max_array_run);
+//return: max equally spaced siblings if set, 0x0 if not set
+extern size_t sc_opt_ptr_get_max_array_run(const sc_opt_ptr opts_ptr);
+
+
+/*
+ *  --- [OPT_VAL] ---
+ */
+
+//return: an opaque handle to a `opt_val` object, or NULL on error
+extern sc_opt_val sc_new_opt_val();
+extern sc_opt_val sc_copy_opt_val(const sc_opt_val opts_val);
+//returns 0 on success, -1 on error
+extern int sc_del_opt_val(sc_opt_val opts_val);
+extern int sc_opt_val_reset(sc_opt_val opts_val);
+
+//return: 0 on success, -1 on error
+extern int sc_opt_val_set_type(sc_opt_val opts_val,
+                               const enum sc_val_type type);
+//return: type if set, -1 if unset
+extern int sc_opt_val_get_type(const sc_opt_val opts_val);
+
+//return: 0 on success, -1 on error
+extern int sc_opt_val_set_alignment(sc_opt_val opts_val,
+                                    const off_t alignment);
+//return: alignment if set, 0x0 if unset
+extern off_t sc_opt_val_get_alignment(const sc_opt_val opts_val);
+
+/*
+ * The value is passed as a CMore vector holding `cm_byte`. The getter
+ * requires an unitialised CMore vector which will be initialised and
+ * populated by the call. Must be manually destroyed later.
+ */
+
+//return: 0 on success, -1 on error
+extern int sc_opt_val_set_value(sc_opt_val opts_val, const cm_vct * value);
+extern int sc_opt_val_get_value(const sc_opt_val opts_val, cm_vct * value);
+
+//return: 0 on success, -1 on error
+extern int sc_opt_val_set_predicate(sc_opt_val opts_val,
+                                    const enum sc_val_pred predicate);
+//return: the predicate
+extern enum sc_val_pred sc_opt_val_get_predicate(const sc_opt_val opts_val);
+
+/*
+ * The upper bound of `VP_RANGE` is passed the same way as the value.
+ */
+
+//return: 0 on success, -1 on error
+extern int sc_opt_val_set_value_hi(sc_opt_val opts_val,
+                                   const cm_vct * value_hi);
+extern int sc_opt_val_get_value_hi(const sc_opt_val opts_val,
+                                   cm_vct * value_hi);
+
+//return: 0 on success, -1 on error
+extern int sc_opt_val_set_round(sc_opt_val opts_val,
+                                const enum sc_val_round round);
+//return: the rounding mode
+extern enum sc_val_round sc_opt_val_get_round(const sc_opt_val opts_val);
+
+//return: 0 on success, -1 on error
+extern int sc_opt_val_set_epsilon(sc_opt_val opts_val, const double epsilon);
+//return: epsilon if set, 0.0 if unset
+extern double sc_opt_val_get_epsilon(const sc_opt_val opts_val);
+
+
+/*
+ *  --- [OPT_PTN] ---
+ */
+
+//return: an opaque handle to a `opt_ptn` object, or NULL on error
+extern sc_opt_ptn sc_new_opt_ptn();
+extern sc_opt_ptn sc_copy_opt_ptn(const sc_opt_ptn opts_ptn);
+//returns 0 on success, -1 on error
+extern int sc_del_opt_ptn(sc_opt_ptn opts_ptn);
+extern int sc_opt_ptn_reset(sc_opt_ptn opts_ptn);
+
+/*
+ * The pattern & mask are passed as CMore vectors holding `cm_byte`. The
+ * getters require an unitialised CMore vector which will be initialised
+ * and populated by the call. Must be manually destroyed later.
+ */
+
+//return: 0 on success, -1 on error
+extern int sc_opt_ptn_set_pattern(sc_opt_ptn opts_ptn, const cm_vct * pattern);
+extern int sc_opt_ptn_get_pattern(const sc_opt_ptn opts_ptn, cm_vct * pattern);
+
+//return: 0 on success, -1 on error
+extern int sc_opt_ptn_set_mask(sc_opt_ptn opts_ptn, const cm_vct * mask);
+extern int sc_opt_ptn_get_mask(const sc_opt_ptn opts_ptn, cm_vct * mask);
+
+//return: 0 on success, -1 on error
+extern int sc_opt_ptn_set_pattern_str(sc_opt_ptn opts_ptn,
+                                      const char * pattern_str);
+
+//return: 0 on success, -1 on error
+extern int sc_opt_ptn_set_signatures(sc_opt_ptn opts_ptn,
+                                     const sc_ptn_set signatures);
+//return: the pattern set, or NULL if not set
+extern sc_ptn_set sc_opt_ptn_get_signatures(const sc_opt_ptn opts_ptn);
+
+
+/*
+ *  --- [OPT_STR] ---
+ */
+
+//return: an opaque handle to a `opt_str` object, or NULL on error
+extern sc_opt_str sc_new_opt_str();
+extern sc_opt_str sc_copy_opt_str(const sc_opt_str opts_str);
+//returns 0 on success, -1 on error
+extern int sc_del_opt_str(sc_opt_str opts_str);
+extern int sc_opt_str_reset(sc_opt_str opts_str);
+
+//return: 0 on success, -1 on error
+extern int sc_opt_str_set_str(sc_opt_str opts_str, const char * str);
+//return: the string if set, NULL if unset
+extern const char * sc_opt_str_get_str(const sc_opt_str opts_str);
+
+//return: 0 on success, -1 on error
+extern int sc_opt_str_set_encodings(sc_opt_str opts_str,
+                                    const cm_byte encodings);
+//return: mask of `sc_str_enc` values
+extern cm_byte sc_opt_str_get_encodings(const sc_opt_str opts_str);
+
+//return: 0 on success, -1 on error
+extern int sc_opt_str_set_case_insensitive(sc_opt_str opts_str,
+                                           const bool enable);
+extern bool sc_opt_str_get_case_insensitive(const sc_opt_str opts_str);
+
+//return: 0 on success, -1 on error
+extern int sc_opt_str_set_null_term(sc_opt_str opts_str, const bool enable);
+extern bool sc_opt_str_get_null_term(const sc_opt_str opts_str);
+
+
+/*
+ *  --- [OPT_STRUCT] ---
+ */
+
+//return: an opaque handle to a `opt_struct` object, or NULL on error
+extern sc_opt_struct sc_new_opt_struct();
+extern sc_opt_struct sc_copy_opt_struct(const sc_opt_struct opts_struct);
+//returns 0 on success, -1 on error
+extern int sc_del_opt_struct(sc_opt_struct opts_struct);
+extern int sc_opt_struct_reset(sc_opt_struct opts_struct);
+
+/*
+ * Values are passed as CMore vectors holding `cm_byte`. `value_hi` is
+ * only read for `VP_RANGE` and may otherwise be NULL.
+ */
+
+//return: 0 on success, -1 on error
+extern int sc_opt_struct_add_val_field(sc_opt_struct opts_struct,
+                                       const off_t off,
+                                       const enum sc_val_type type,
+                                       const enum sc_val_pred predicate,
+                                       const cm_vct * value,
+                                       const cm_vct * value_hi);
+extern int sc_opt_struct_add_ptr_field(sc_opt_struct opts_struct,
+                                       const off_t off);
+//return: number of fields
+extern size_t sc_opt_struct_get_fields_num(const sc_opt_struct opts_struct);
+
+//return: 0 on success, -1 on error
+extern int sc_opt_struct_set_alignment(sc_opt_struct opts_struct,
+                                       const off_t alignment);
+//return: alignment if set, 0x0 if unset
+extern off_t sc_opt_struct_get_alignment(const sc_opt_struct opts_struct);
+
 
 /*
  *  --- [MAP_AREA_SET] ---
@@ -851,6 +2427,30 @@ extern int sc_update_set(sc_map_area_set s_set, const sc_opt opts);
 extern int sc_get_set(const sc_map_area_set s_set, cm_vct * area_nodes);
 
 
+/*
+ *  --- [PTN_SET] ---
+ */
+
+//return: opaque handle to `ptn_set` object, or NULL on error
+extern sc_ptn_set sc_new_ptn_set();
+extern sc_ptn_set sc_copy_ptn_set(const sc_ptn_set p_set);
+//return: 0 on success, -1 on error
+extern int sc_del_ptn_set(sc_ptn_set p_set);
+extern int sc_ptn_set_reset(sc_ptn_set p_set);
+
+//return: index of the added pattern, or -1 on error
+extern ssize_t sc_ptn_set_add_pattern_str(sc_ptn_set p_set,
+                                          const char * pattern_str);
+
+//return: 0 on success, -1 on error
+extern int sc_ptn_set_compile(sc_ptn_set p_set);
+extern int sc_ptn_set_save(sc_ptn_set p_set, const char * file_path);
+extern int sc_ptn_set_load(sc_ptn_set p_set, const char * file_path);
+
+//return: number of patterns in the set
+extern size_t sc_ptn_set_get_ptns_num(const sc_ptn_set p_set);
+
+
 /*
  *  --- [WORKER_POOL] ---
  */
@@ -877,6 +2477,46 @@ extern int sc_load_scan(sc_serialiser serialiser,
                         sc_scan scan, const sc_opt opts, const bool shallow);
 extern int sc_read_headers(sc_serialiser serialiser, const char * file_path,
                            sc_combined_file_hdr * cmb_hdr);
+extern int sc_intersect_scans(sc_serialiser serialiser,
+                              const char * file_a, const char * file_b,
+                              const char * file_out);
+extern int sc_diff_scans(sc_serialiser serialiser,
+                         const char * file_a, const char * file_b,
+                         const char * file_out);
+
+
+/*
+ *  --- [WATCH_LIST] ---
+ */
+
+//return: opaque handle to `watch_list` object, or NULL on error
+extern sc_watch_list sc_new_watch_list();
+//return: 0 on success, -1 on error
+extern int sc_del_watch_list(sc_watch_list w_list);
+extern int sc_watch_list_reset(sc_watch_list w_list);
+
+//return: index of the added entry, or -1 on error
+extern ssize_t sc_watch_list_add_addr(sc_watch_list w_list,
+                                      const uintptr_t addr,
+                                      const enum sc_val_type type);
+
+//return: 0 on success, -1 on error
+//`value` of NULL thaws the entry
+extern int sc_watch_list_set_freeze(sc_watch_list w_list, const size_t idx,
+                                    const cm_byte * value,
+                                    const size_t value_sz);
+extern int sc_watch_list_refresh(sc_watch_list w_list, sc_opt opts);
+extern int sc_watch_list_start(sc_watch_list w_list, sc_opt opts,
+                               const struct timespec * interval);
+extern int sc_watch_list_stop(sc_watch_list w_list);
+
+//return: number of the refresh, 0 before the first refresh
+//`values` must hold one value per entry
+extern uint64_t sc_watch_list_get_frame(sc_watch_list w_list,
+                                        sc_watch_value * values);
+
+//return: number of entries
+extern size_t sc_watch_list_get_entries_num(const sc_watch_list w_list);
 
 
 #ifdef __cplusplus
@@ -921,6 +2561,12 @@ extern __thread int sc_errno;
 #define SC_ERR_SHALLOW_RESULT 3109
 #define SC_ERR_INVALID_FILE   3110
 #define SC_ERR_VERSION_FILE   3111
+#define SC_ERR_OPT_VALUE      3112
+#define SC_ERR_OPT_PATTERN    3113
+#define SC_ERR_OPT_STRING     3114
+#define SC_ERR_OPT_STRUCT     3115
+#define SC_ERR_OPT_INTERVAL   3116
+#define SC_ERR_WATCH_ENTRY    3117
 
 // 2XX - internal errors
 #define SC_ERR_CMORE          3200
@@ -965,6 +2611,18 @@ extern __thread int sc_errno;
     "The provided file is invalid or corrupt.\n"
 #define SC_ERR_VERSION_FILE_MSG \
     "The provided file's version is incompatible.\n"
+#define SC_ERR_OPT_VALUE_MSG \
+    "Size of a value does not match its type, or its range is invalid.\n"
+#define SC_ERR_OPT_PATTERN_MSG \
+    "Malformed pattern, or its mask does not match its size.\n"
+#define SC_ERR_OPT_STRING_MSG \
+    "Malformed string, or no encoding is selected.\n"
+#define SC_ERR_OPT_STRUCT_MSG \
+    "Malformed structure field, or no field holds a value.\n"
+#define SC_ERR_OPT_INTERVAL_MSG \
+    "Interval is not a positive time.\n"
+#define SC_ERR_WATCH_ENTRY_MSG \
+    "Watch list entry does not exist, or its chain has no object.\n"
 
 // 2XX - internal errors
 #define SC_ERR_CMORE_MSG \
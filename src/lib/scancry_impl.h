@@ -7,6 +7,10 @@
 #include <optional>
 #include <memory>
 #include <vector>
+#include <utility>
+#include <string>
+#include <iosfwd>
+#include <unordered_map>
 #include <functional>
 #endif
 
@@ -148,11 +152,31 @@ class _scan : public _lockable {
 
         /* internal */ [[nodiscard]] virtual int _generate_body(
                 std::vector<cm_byte> & buf, off_t hdr_off) = 0;
+
+        /*
+         *  NOTE: `version` is the version of the file being read; older
+         *        versions must remain readable.
+         */
+
         /* internal */ [[nodiscard]] virtual int _process_body(
                 const std::vector<cm_byte> & buf, off_t hdr_off,
-                const mc_vm_map & map) = 0;
+                const cm_byte version, const mc_vm_map & map) = 0;
         /* internal */ [[nodiscard]] virtual int _read_body(
-                const std::vector<cm_byte> & buf, off_t hdr_off) = 0;
+                const std::vector<cm_byte> & buf, off_t hdr_off,
+                const cm_byte version) = 0;
+
+        /*
+         *  NOTE: _write_body() & _load_body() stream a body to & from
+         *        a file. By default the whole body is held in memory,
+         *        scans with large results write & read it in parts.
+         *        `map` is NULL for shallow loads.
+         */
+
+        /* internal */ [[nodiscard]] virtual int _write_body(
+                std::ostream & os, const off_t hdr_off);
+        /* internal */ [[nodiscard]] virtual int _load_body(
+                std::istream & is, const off_t hdr_off,
+                const cm_byte version, const mc_vm_map * map);
 
         [[nodiscard]] virtual int reset() = 0;
 };
@@ -292,12 +316,27 @@ class _ptrscan_tree_node;
 //pointer scanner cache
 struct _ptrscan_cache {
 
-    std::vector<std::shared_ptr<sc::_ptrscan_tree_node>> * depth_level_vct;
+    //previous depth level sorted by `own_addr`, searched by every worker
+    std::vector<uintptr_t> level_addrs;
+    std::vector<std::shared_ptr<sc::_ptrscan_tree_node>> level_nodes;
     std::vector<cm_byte> serial_buf;
 
+    //index of every interned pathname in `ser_pathnames`
+    std::unordered_map<std::string, uint32_t> pathname_idxs;
+
+    //ranges reachable from static areas in at most n hops, at index n
+    std::vector<std::vector<std::pair<uintptr_t, uintptr_t>>> reach;
+
+    //number of nodes of every depth level moved to the spill file
+    std::vector<uint32_t> spill_counts;
+
     _ptrscan_cache()
-     : depth_level_vct(nullptr),
-       serial_buf({}) {}
+     : level_addrs({}),
+       level_nodes({}),
+       serial_buf({}),
+       pathname_idxs({}),
+       reach({}),
+       spill_counts({}) {}
 };
 
 
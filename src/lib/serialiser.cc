@@ -6,6 +6,7 @@
 
 //C standard library
 #include <cstring>
+#include <cstdio>
 
 //external libraries
 #include <cmore.h>
@@ -13,6 +14,7 @@
 //local headers
 #include "scancry.h"
 #include "scancry_impl.h"
+#include "ptrscan_merge.hh"
 #include "error.hh"
 
 
@@ -21,6 +23,48 @@
  ===== *  C++ INTERFACE  * =====
        * =============== */
 
+/*
+ *  --- [_SCAN | PUBLIC] ---
+ */
+
+[[nodiscard]] int sc::_scan::_write_body(std::ostream & os,
+                                         const off_t hdr_off) {
+
+    int ret;
+    std::vector<cm_byte> body_buf;
+
+
+    //build the body
+    ret = this->_generate_body(body_buf, hdr_off);
+    if (ret != 0) return -1;
+
+    //write the body
+    os.write(reinterpret_cast<const char *>(body_buf.data()), body_buf.size());
+    if (os.fail() == true) {
+        sc_errno = SC_ERR_FILE;
+        return -1;
+    }
+
+    return 0;
+}
+
+
+[[nodiscard]] int sc::_scan::_load_body(std::istream & is,
+                                        const off_t hdr_off,
+                                        const cm_byte version,
+                                        const mc_vm_map * map) {
+
+    //read the body
+    const std::vector<cm_byte> body_buf = std::vector<cm_byte>(
+        std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+
+    //process the body
+    if (map == nullptr) return this->_read_body(body_buf, hdr_off, version);
+    return this->_process_body(body_buf, hdr_off, version, *map);
+}
+
+
+
 /*
  *  --- [PRIVATE] ---
  */
@@ -32,6 +76,18 @@ sc::serialiser::get_scan_type(sc::_scan * scan) const {
         return sc::scan_type_ptr;
     }
 
+    else if (dynamic_cast<sc::valscan *>(scan)) {
+        return sc::scan_type_val;
+    }
+
+    else if (dynamic_cast<sc::ptnscan *>(scan)) {
+        return sc::scan_type_ptn;
+    }
+
+    else if (dynamic_cast<sc::strscan *>(scan)) {
+        return sc::scan_type_str;
+    }
+
     /* return ptrscan during unit testing */
     #ifdef DEBUG
     else {
@@ -56,7 +112,7 @@ sc::serialiser::is_header_valid(sc::scancry_file_hdr & hdr) const {
     }
 
     //check file version is compatible
-    if (hdr.version != sc::file_ver_0) {
+    if (hdr.version > sc::file_ver_cur) {
         sc_errno = SC_ERR_VERSION_FILE;
         return false;
     }
@@ -65,11 +121,126 @@ sc::serialiser::is_header_valid(sc::scancry_file_hdr & hdr) const {
 }
 
 
+[[nodiscard]] int
+sc::serialiser::open_file(std::ofstream & fs, const std::string & file_path,
+                          const cm_byte scan_type) const {
+
+    struct sc::scancry_file_hdr sc_hdr;
+
+
+    //open an output file stream
+    fs = std::ofstream(file_path, std::ios::out | std::ios::binary);
+    if (fs.fail() == true) {
+        sc_errno = SC_ERR_FILE;
+        return -1;
+    }
+
+    //build the header
+    std::memcpy(sc_hdr.magic, sc::file_magic, sc::file_magic_sz);
+    sc_hdr.version = sc::file_ver_cur;
+    sc_hdr.scan_type = scan_type;
+
+    //write the header
+    fs.write(reinterpret_cast<const char *>(&sc_hdr), sizeof(sc_hdr));
+    if (fs.fail() == true) {
+        sc_errno = SC_ERR_FILE;
+        fs.close();
+        return -1;
+    }
+
+    return 0;
+}
+
+
+/*
+ *  NOTE: Scan files are written next to the output file & only renamed
+ *        over it once complete. A scan without results, or a failed
+ *        write, leaves a previously saved file untouched.
+ */
+
+[[nodiscard]] int
+sc::serialiser::open_tmp_file(std::ofstream & fs,
+                              const std::string & file_path,
+                              const cm_byte scan_type) const {
+
+    int ret;
+    const std::string tmp_path = file_path + ".tmp";
+
+
+    //open a temporary file & write the header
+    ret = this->open_file(fs, tmp_path, scan_type);
+    if (ret != 0) {
+        std::remove(tmp_path.c_str());
+        return -1;
+    }
+
+    return 0;
+}
+
+
+[[nodiscard]] int
+sc::serialiser::finish_tmp_file(std::ofstream & fs,
+                                const std::string & file_path,
+                                const bool commit) const {
+
+    int ret;
+    const std::string tmp_path = file_path + ".tmp";
+
+
+    fs.close();
+    if (commit == false) goto _finish_tmp_file_fail;
+
+    if (fs.fail() == true) {
+        sc_errno = SC_ERR_FILE;
+        goto _finish_tmp_file_fail;
+    }
+
+    //replace the output file
+    ret = std::rename(tmp_path.c_str(), file_path.c_str());
+    if (ret != 0) {
+        sc_errno = SC_ERR_FILE;
+        goto _finish_tmp_file_fail;
+    }
+
+    return 0;
+
+    _finish_tmp_file_fail:
+    std::remove(tmp_path.c_str());
+    return -1;
+}
+
+
 
 /*
  *  --- [PUBLIC]
  */
 
+[[nodiscard]] int
+sc::serialiser::_write_file(
+    const std::string & file_path, const cm_byte scan_type,
+    const std::vector<cm_byte> & body_buf) {
+
+    int ret;
+    std::ofstream fs;
+
+
+    //open a temporary file & write the header
+    ret = this->open_tmp_file(fs, file_path, scan_type);
+    if (ret != 0) return -1;
+
+    //write the body
+    fs.write(reinterpret_cast<const char *>(body_buf.data()), body_buf.size());
+    if (fs.fail() == true) {
+        sc_errno = SC_ERR_FILE;
+        ret = this->finish_tmp_file(fs, file_path, false);
+        return -1;
+    }
+
+    //replace the output file
+    return this->finish_tmp_file(fs, file_path, true);
+}
+
+
 [[nodiscard]] int
 sc::serialiser::save_scan(
     sc::_scan & scan, const sc::opt & opts) {
@@ -77,9 +248,6 @@ sc::serialiser::save_scan(
     int ret;
 
     std::ofstream fs;
-    std::vector<cm_byte> body_buf;
-
-    struct sc::scancry_file_hdr sc_hdr;
     std::optional<cm_byte> scan_type;
 
 
@@ -96,44 +264,24 @@ sc::serialiser::save_scan(
     scan_type = this->get_scan_type(&scan);
     if (scan_type.has_value() == false) goto _save_scan_fail;
 
-    //open an output file stream
-    fs = std::ofstream(opts.get_file_path_out().value(),
-                        std::ios::out | std::ios::binary);
-    if (fs.fail() == true) {
-        sc_errno = SC_ERR_FILE;
-        goto _save_scan_fail;
-    }
-
-    //build the header
-    std::memcpy(sc_hdr.magic, sc::file_magic, sc::file_magic_sz);
-    sc_hdr.version = sc::file_ver_0;
-    sc_hdr.scan_type = scan_type.value();
-
-    //write the header
-    fs.write(reinterpret_cast<const char *>(&sc_hdr), sizeof(sc_hdr));
-    if (fs.fail() == true) {
-        sc_errno = SC_ERR_FILE;
-        goto _save_scan_file_fail;
-    }
-
-    //build the body
-    ret = scan._generate_body(body_buf, sizeof(sc_hdr));
-    if (ret != 0) goto _save_scan_file_fail;
+    //open a temporary file & write the header
+    ret = this->open_tmp_file(
+            fs, opts.get_file_path_out().value(), scan_type.value());
+    if (ret != 0) goto _save_scan_fail;
 
     //write the body
-    fs.write(reinterpret_cast<const char *>(body_buf.data()), body_buf.size());
-    if (fs.fail() == true) {
-        sc_errno = SC_ERR_FILE;
-        goto _save_scan_file_fail;
-    }
+    ret = scan._write_body(fs, sizeof(struct sc::scancry_file_hdr));
+    if (ret != 0) goto _save_scan_file_fail;
 
+    //replace the output file
+    ret = this->finish_tmp_file(fs, opts.get_file_path_out().value(), true);
+    if (ret != 0) goto _save_scan_fail;
 
-    fs.close();
     _UNLOCK(-1);
     return 0;
 
     _save_scan_file_fail:
-    fs.close();
+    ret = this->finish_tmp_file(fs, opts.get_file_path_out().value(), false);
 
     _save_scan_fail:
     _UNLOCK(-1)
@@ -148,7 +296,6 @@ sc::serialiser::load_scan(
     int ret;
 
     std::ifstream fs;
-    std::vector<cm_byte> body_buf;
 
     struct sc::scancry_file_hdr sc_hdr;
     std::optional<cm_byte> scan_type;
@@ -190,25 +337,22 @@ sc::serialiser::load_scan(
     //verify the header
     if (this->is_header_valid(sc_hdr) == false) goto _load_scan_file_fail;
 
-    //read the body
-    body_buf = std::vector<cm_byte>(std::istreambuf_iterator<char>(fs),
-                                    std::istreambuf_iterator<char>());
-    fs.close();
+    //check the file holds this type of scan
+    scan_type = this->get_scan_type(&scan);
+    if (scan_type.has_value() == false) goto _load_scan_file_fail;
+    if (scan_type.value() != sc_hdr.scan_type) {
+        sc_errno = SC_ERR_INVALID_FILE;
+        goto _load_scan_file_fail;
+    }
 
-    //process the body
-    if (shallow) {
-        ret = scan._read_body(body_buf, sizeof(sc_hdr));
-        if (ret != 0) goto _load_scan_fail;
-
-    } else {
-        if (opts.get_map() == nullptr) {
-            sc_errno = SC_ERR_OPT_MISSING;
-            goto _load_scan_fail;
-        }
-        ret = scan._process_body(body_buf, sizeof(sc_hdr), *opts.get_map());
-        if(ret != 0) goto _load_scan_fail;
+    //read & process the body
+    if (shallow == false && opts.get_map() == nullptr) {
+        sc_errno = SC_ERR_OPT_MISSING;
+        goto _load_scan_file_fail;
     }
-    
+    ret = scan._load_body(fs, sizeof(sc_hdr), sc_hdr.version,
+                          shallow ? nullptr : opts.get_map());
+    if (ret != 0) goto _load_scan_file_fail;
 
     fs.close();
     _UNLOCK(-1);
@@ -258,6 +402,15 @@ sc::serialiser::read_headers(const char * file_path) {
         case scan_type_ptr:
             scan_hdr_sz = sizeof(cmb_hdr.ptr_hdr);
             break;
+        case scan_type_val:
+            scan_hdr_sz = sizeof(cmb_hdr.val_hdr);
+            break;
+        case scan_type_ptn:
+            scan_hdr_sz = sizeof(cmb_hdr.ptn_hdr);
+            break;
+        case scan_type_str:
+            scan_hdr_sz = sizeof(cmb_hdr.str_hdr);
+            break;
         default:
             sc_errno = SC_ERR_FILE;
             goto _read_headers_fail;
@@ -282,6 +435,42 @@ sc::serialiser::read_headers(const char * file_path) {
 }
 
 
+[[nodiscard]] int sc::serialiser::intersect_scans(
+    const std::string & file_a, const std::string & file_b,
+    const std::string & file_out) {
+
+    int ret;
+    sc::_ptrscan_merge merge;
+
+
+    //apply lock
+    _LOCK(-1)
+
+    ret = merge.combine(file_a, file_b, file_out, sc::_merge_op_intersect);
+
+    _UNLOCK(-1)
+    return (ret != 0) ? -1 : 0;
+}
+
+
+[[nodiscard]] int sc::serialiser::diff_scans(
+    const std::string & file_a, const std::string & file_b,
+    const std::string & file_out) {
+
+    int ret;
+    sc::_ptrscan_merge merge;
+
+
+    //apply lock
+    _LOCK(-1)
+
+    ret = merge.combine(file_a, file_b, file_out, sc::_merge_op_diff);
+
+    _UNLOCK(-1)
+    return (ret != 0) ? -1 : 0;
+}
+
+
 
       /* ============= * 
  ===== *  C INTERFACE  * =====
@@ -377,3 +566,43 @@ int sc_read_headers(sc_serialiser serialiser,
         return -1;
     }
 }
+
+
+int sc_intersect_scans(sc_serialiser serialiser,
+                       const char * file_a, const char * file_b,
+                       const char * file_out) {
+
+    int ret;
+    sc::serialiser * cc_serialiser
+        = static_cast<sc::serialiser *>(serialiser);
+
+
+    try {
+        ret = cc_serialiser->intersect_scans(file_a, file_b, file_out);
+        return (ret == 0) ? 0 : -1;
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+int sc_diff_scans(sc_serialiser serialiser,
+                  const char * file_a, const char * file_b,
+                  const char * file_out) {
+
+    int ret;
+    sc::serialiser * cc_serialiser
+        = static_cast<sc::serialiser *>(serialiser);
+
+
+    try {
+        ret = cc_serialiser->diff_scans(file_a, file_b, file_out);
+        return (ret == 0) ? 0 : -1;
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
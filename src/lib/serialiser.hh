@@ -17,5 +17,11 @@ int sc_load_scan(sc_serialiser serialiser,
                  sc_scan scan, const sc_opt opts, const bool shallow);
 int sc_read_headers(sc_serialiser serialiser,
                     const char * file_path, sc_combined_file_hdr * cmb_hdr);
+int sc_intersect_scans(sc_serialiser serialiser,
+                       const char * file_a, const char * file_b,
+                       const char * file_out);
+int sc_diff_scans(sc_serialiser serialiser,
+                  const char * file_a, const char * file_b,
+                  const char * file_out);
 
 }
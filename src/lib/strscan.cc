@@ -0,0 +1,534 @@
+//standard template library
+#include <optional>
+#include <memory>
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <algorithm>
+
+//external libraries
+#include <cmore.h>
+#include <memcry.h>
+
+//local headers
+#include "scancry.h"
+#include "ptnscan.hh"
+#include "fbuf_util.hh"
+#include "error.hh"
+
+
+
+      /* =============== *
+ ===== *  C++ INTERFACE  * =====
+       * =============== */
+
+/*
+ *  --- [INTERNAL] ---
+ */
+
+//smallest code point of each UTF-8 sequence length, rejects overlong forms
+const constexpr uint32_t _utf8_min_cp[] = {0, 0, 0x80, 0x800, 0x10000};
+
+
+//append a UTF-16LE code unit
+_SC_DBG_STATIC _SC_DBG_INLINE void _put_utf16le(
+                    std::vector<cm_byte> & bytes, const uint32_t unit) {
+
+    bytes.push_back(unit & 0xFF);
+    bytes.push_back((unit >> 8) & 0xFF);
+
+    return;
+}
+
+
+//convert UTF-8 text to some encoding, fails on malformed UTF-8
+[[nodiscard]] _SC_DBG_STATIC bool _encode_str(
+                    const std::string & str, const enum sc::str_enc enc,
+                    std::vector<cm_byte> & bytes) {
+
+    size_t seq_len;
+    uint32_t cp;
+    cm_byte b;
+
+
+    bytes.clear();
+    for (size_t i = 0; i < str.size(); i += seq_len) {
+
+        //decode the length of the sequence from its lead byte
+        b = str[i];
+        if (b < 0x80) {
+            cp = b;
+            seq_len = 1;
+        } else if ((b & 0xE0) == 0xC0) {
+            cp = b & 0x1F;
+            seq_len = 2;
+        } else if ((b & 0xF0) == 0xE0) {
+            cp = b & 0x0F;
+            seq_len = 3;
+        } else if ((b & 0xF8) == 0xF0) {
+            cp = b & 0x07;
+            seq_len = 4;
+        } else {
+            return false;
+        }
+
+        //decode the continuation bytes
+        if (i + seq_len > str.size()) return false;
+        for (size_t j = 1; j < seq_len; ++j) {
+
+            b = str[i + j];
+            if ((b & 0xC0) != 0x80) return false;
+            cp = (cp << 6) | (b & 0x3F);
+        }
+
+        //reject overlong forms, surrogates & out of range code points
+        if (cp < _utf8_min_cp[seq_len] || cp > 0x10FFFF
+            || (cp >= 0xD800 && cp <= 0xDFFF)) return false;
+
+        //UTF-8 is kept as is
+        if (enc == sc::SE_UTF8) {
+            bytes.insert(bytes.end(), str.begin() + i,
+                         str.begin() + i + seq_len);
+
+        //code points past the basic plane take a surrogate pair
+        } else if (cp >= 0x10000) {
+            cp -= 0x10000;
+            _put_utf16le(bytes, 0xD800 + (cp >> 10));
+            _put_utf16le(bytes, 0xDC00 + (cp & 0x3FF));
+
+        } else {
+            _put_utf16le(bytes, cp);
+        }
+    }
+
+    return true;
+}
+
+
+//test if a byte is an ASCII letter
+[[nodiscard]] _SC_DBG_STATIC _SC_DBG_INLINE bool _is_ascii_letter(
+                    const cm_byte b) {
+
+    return (b | 0x20) >= 'a' && (b | 0x20) <= 'z';
+}
+
+
+
+/*
+ *  --- [STRSCAN | PRIVATE] ---
+ */
+
+void sc::strscan::do_reset() {
+
+    this->matches.clear();
+    this->matches.shrink_to_fit();
+    this->encs.clear();
+    this->matchers.clear();
+    this->area_addrs.clear();
+    this->area_tails.clear();
+
+    return;
+}
+
+
+/*
+ *  NOTE: Only whole code units that are ASCII letters are folded; the
+ *        bytes of other characters, including the high byte of every
+ *        UTF-16LE code unit, must match exactly.
+ */
+
+[[nodiscard]] int sc::strscan::compile(const opt_str & opts_str) {
+
+    bool ret;
+    size_t unit_sz;
+
+    std::vector<cm_byte> bytes, fold;
+    std::unique_ptr<sc::_ptn_matcher> matcher_p;
+
+    const std::string & str = opts_str.get_str().value();
+
+
+    for (const enum sc::str_enc enc : {sc::SE_UTF8, sc::SE_UTF16LE}) {
+
+        if ((opts_str.get_encodings() & enc) == 0) continue;
+        unit_sz = (enc == sc::SE_UTF8) ? 1 : 2;
+
+        //convert the string to this encoding
+        ret = _encode_str(str, enc, bytes);
+        if (ret == false) goto _compile_fail;
+
+        //fold ASCII letters to lowercase
+        fold.assign(bytes.size(), 0x00);
+        for (size_t i = 0; i < bytes.size(); i += unit_sz) {
+
+            if (opts_str.get_case_insensitive() == false) break;
+            if (_is_ascii_letter(bytes[i]) == false
+                || (unit_sz == 2 && bytes[i + 1] != 0x00)) continue;
+            fold[i] = 0x20;
+        }
+
+        //a terminated string is followed by a null code unit
+        if (opts_str.get_null_term() == true) {
+            bytes.insert(bytes.end(), unit_sz, 0x00);
+            fold.insert(fold.end(), unit_sz, 0x00);
+        }
+
+        if (bytes.size() > sc::_ptn_max_sz) goto _compile_fail;
+
+        matcher_p = std::make_unique<sc::_ptn_matcher>();
+        matcher_p->compile(bytes, std::nullopt, fold);
+        this->encs.push_back(enc);
+        this->matchers.push_back(std::move(matcher_p));
+    }
+
+    //at least one encoding must be selected
+    if (this->matchers.empty() == true) goto _compile_fail;
+
+    return 0;
+
+    _compile_fail:
+    sc_errno = SC_ERR_OPT_STRING;
+    return -1;
+}
+
+
+/*
+ *  NOTE: Without a map every match is read. With a map, matches whose
+ *        address is no longer mapped are dropped.
+ */
+
+[[nodiscard]] int sc::strscan::read_matches(
+    const std::vector<cm_byte> & buf, const mc_vm_map * map) {
+
+    off_t buf_off = 0;
+    std::optional<uint64_t> addr;
+    std::optional<cm_byte> enc, end_byte;
+
+
+    //fetch the strscan header
+    std::optional<struct str_file_hdr> local_hdr
+        = fbuf_util::unpack_type<struct str_file_hdr>(buf, buf_off);
+    if (local_hdr.has_value() == false) goto _read_matches_fail;
+
+    //fetch each match
+    for (uint32_t i = 0; i < local_hdr->matches_num; ++i) {
+
+        addr = fbuf_util::unpack_type<uint64_t>(buf, buf_off);
+        if (addr.has_value() == false) goto _read_matches_fail;
+        enc = fbuf_util::unpack_type<cm_byte>(buf, buf_off);
+        if (enc.has_value() == false
+            || (enc.value() != sc::SE_UTF8 && enc.value() != sc::SE_UTF16LE))
+            goto _read_matches_fail;
+
+        if (map != nullptr
+            && mc_get_area_by_addr(map, addr.value(), nullptr) == nullptr)
+            continue;
+
+        this->matches.push_back(sc::str_match{
+            (uintptr_t) addr.value(), (enum sc::str_enc) enc.value()});
+    }
+
+    //check the file is terminated
+    end_byte = fbuf_util::unpack_type<cm_byte>(buf, buf_off);
+    if (end_byte.has_value() == false || end_byte != fbuf_util::_file_end)
+        goto _read_matches_fail;
+
+    return 0;
+
+    _read_matches_fail:
+    this->matches.clear();
+    sc_errno = SC_ERR_INVALID_FILE;
+    return -1;
+}
+
+
+
+/*
+ *  --- [STRSCAN | PUBLIC] ---
+ */
+
+/*
+ *  NOTE: Every call searches the rest of the read buffer for the string
+ *        in each of its encodings, see `ptnscan::_process_addr()`.
+ */
+
+[[nodiscard]] off_t sc::strscan::_process_addr(
+                                    const struct _scan_arg arg,
+                                    const opt * const opts,
+                                    const _opt_scan * const opts_scan) {
+
+    size_t area_left, avail, adv;
+
+
+    const mc_vm_area * area = MC_GET_NODE_AREA(arg.area_node);
+
+    area_left = area->end_addr - arg.addr;
+
+    //last buffer of this area, search up to the end of the area
+    if (area_left <= arg.buf_left) {
+        avail = area_left;
+        adv = area_left;
+
+    //otherwise leave the buffer overlap for the next read
+    } else {
+        avail = arg.buf_left;
+        adv = arg.buf_left - opts->addr_width;
+    }
+
+    auto addrs_iter = this->area_addrs.find(arg.area_node);
+    auto tails_iter = this->area_tails.find(arg.area_node);
+    if (addrs_iter == this->area_addrs.end()
+        || tails_iter == this->area_tails.end()) return adv;
+
+    //search for every encoding of the string
+    for (size_t i = 0; i < this->matchers.size(); ++i) {
+
+        this->matchers[i]->search(arg.cur_byte, arg.addr, avail, adv,
+                                  adv == area_left, tails_iter->second[i],
+                                  addrs_iter->second[i]);
+    }
+
+    return adv;
+}
+
+
+[[nodiscard]] int sc::strscan::_generate_body(
+    std::vector<cm_byte> & buf, const off_t hdr_off) {
+
+    int ret;
+    struct sc::str_file_hdr local_hdr;
+
+    cm_byte ctrl_byte;
+    off_t buf_off = 0;
+
+
+    //lock scanner
+    _LOCK(-1)
+
+    //check the scan contains a result to serialise
+    if (this->matches.empty() == true) {
+        sc_errno = SC_ERR_NO_RESULT;
+        goto _generate_body_fail;
+    }
+
+    //build local header
+    local_hdr.matches_num = this->matches.size();
+    local_hdr.matches_offset = hdr_off + sizeof(local_hdr);
+
+    //allocate space for the header, every match & the file end byte
+    buf.resize(sizeof(local_hdr)
+               + (this->matches.size() * (sizeof(uint64_t) + 1)) + 1);
+
+    //store the header
+    ret = fbuf_util::pack_type<struct str_file_hdr>(buf, buf_off, local_hdr);
+    if (ret != 0) goto _generate_body_fail;
+
+    //store every address & encoding
+    for (auto iter = this->matches.cbegin();
+         iter != this->matches.cend(); ++iter) {
+
+        ret = fbuf_util::pack_type<uint64_t>(buf, buf_off, iter->addr);
+        if (ret != 0) goto _generate_body_fail;
+
+        ctrl_byte = iter->enc;
+        ret = fbuf_util::pack_type(buf, buf_off, ctrl_byte);
+        if (ret != 0) goto _generate_body_fail;
+    }
+
+    //store the file end byte
+    ctrl_byte = fbuf_util::_file_end;
+    ret = fbuf_util::pack_type(buf, buf_off, ctrl_byte);
+    if (ret != 0) goto _generate_body_fail;
+
+    _UNLOCK(-1)
+    return 0;
+
+    _generate_body_fail:
+    _UNLOCK(-1)
+    return -1;
+}
+
+
+[[nodiscard]] int sc::strscan::_process_body(
+    const std::vector<cm_byte> & buf, off_t hdr_off,
+    const cm_byte version, const mc_vm_map & map) {
+
+    int ret;
+
+
+    _LOCK(-1)
+    ret = this->read_matches(buf, &map);
+    _UNLOCK(-1)
+
+    return (ret != 0) ? -1 : 0;
+}
+
+
+[[nodiscard]] int sc::strscan::_read_body(
+    const std::vector<cm_byte> & buf, off_t hdr_off, const cm_byte version) {
+
+    int ret;
+
+
+    _LOCK(-1)
+    ret = this->read_matches(buf, nullptr);
+    _UNLOCK(-1)
+
+    return (ret != 0) ? -1 : 0;
+}
+
+
+sc::strscan::strscan() : _scan() {}
+
+
+sc::strscan::~strscan() {}
+
+
+[[nodiscard]] int sc::strscan::reset() {
+
+    _LOCK(-1);
+    this->do_reset();
+    _UNLOCK(-1);
+
+    return 0;
+}
+
+
+[[nodiscard]] int sc::strscan::scan(sc::opt & opts,
+                                    sc::opt_str & opts_str,
+                                    sc::map_area_set & ma_set,
+                                    worker_pool & w_pool,
+                                    const cm_byte flags) {
+
+    int ret;
+    bool run_err = false;
+
+    size_t matches_num;
+
+
+    //lock the scan
+    _LOCK(-1)
+
+    //every scan starts from an empty result
+    this->do_reset();
+
+    //lock options
+    ret = opts._lock();
+    if (ret != 0) {
+        run_err = true;
+        goto _scan_ret;
+    }
+
+    //lock strscan options
+    ret = opts_str._lock();
+    if (ret != 0) {
+        run_err = true;
+        goto _scan_unlock_opts;
+    }
+
+    //lock the map areas set
+    ret = ma_set._lock();
+    if (ret != 0) {
+        run_err = true;
+        goto _scan_unlock_opts_str;
+    }
+
+    //check all necessary options have been set
+    if (opts_str.get_str().has_value() == false
+        || opts.get_map() == nullptr) {
+
+        sc_errno = SC_ERR_OPT_MISSING;
+        run_err = true;
+        goto _scan_unlock_all;
+    }
+
+    //prepare the string in each encoding
+    if (opts_str.get_str()->empty() == true) {
+
+        sc_errno = SC_ERR_OPT_STRING;
+        run_err = true;
+        goto _scan_unlock_all;
+    }
+
+    ret = this->compile(opts_str);
+    if (ret != 0) {
+        run_err = true;
+        goto _scan_unlock_all;
+    }
+
+    //one buffer per area, every area is scanned by a single worker
+    for (auto iter = ma_set.get_area_nodes().cbegin();
+         iter != ma_set.get_area_nodes().cend(); ++iter) {
+
+        this->area_addrs.emplace(
+            *iter, std::vector<std::vector<uintptr_t>>(this->encs.size()));
+        this->area_tails.emplace(
+            *iter, std::vector<std::vector<cm_byte>>(this->encs.size()));
+    }
+
+    //setup the worker pool
+    ret = w_pool._setup(opts, opts_str, *this, ma_set, flags);
+    if (ret != 0) {
+        run_err = true;
+        goto _scan_unlock_all;
+    }
+
+    //scan the selected address space once
+    ret = w_pool._single_run();
+    if (ret != 0) {
+        run_err = true;
+        goto _scan_unlock_all;
+    }
+
+    //gather the matches of every encoding across areas
+    matches_num = 0;
+    for (auto iter = this->area_addrs.cbegin();
+         iter != this->area_addrs.cend(); ++iter) {
+
+        for (size_t i = 0; i < this->encs.size(); ++i)
+            matches_num += iter->second[i].size();
+    }
+
+    this->matches.reserve(matches_num);
+    for (auto iter = this->area_addrs.cbegin();
+         iter != this->area_addrs.cend(); ++iter) {
+
+        for (size_t i = 0; i < this->encs.size(); ++i) {
+            for (const uintptr_t addr : iter->second[i])
+                this->matches.push_back(sc::str_match{addr, this->encs[i]});
+        }
+    }
+
+    //sort by address, then by encoding
+    std::sort(this->matches.begin(), this->matches.end(),
+              [](const sc::str_match & a, const sc::str_match & b) {
+                  return (a.addr != b.addr) ? a.addr < b.addr
+                                            : a.enc < b.enc;
+              });
+    this->area_addrs.clear();
+    this->area_tails.clear();
+
+
+    _scan_unlock_all:
+    ret = ma_set._unlock();
+    if (ret != 0) run_err = true;
+
+    _scan_unlock_opts_str:
+    ret = opts_str._unlock();
+    if (ret != 0) run_err = true;
+
+    _scan_unlock_opts:
+    ret = opts._unlock();
+    if (ret != 0) run_err = true;
+
+    _scan_ret:
+    _UNLOCK(-1)
+    return run_err ? -1 : 0;
+}
+
+
+[[nodiscard]] const std::vector<struct sc::str_match> &
+    sc::strscan::get_matches() const noexcept {
+
+    return this->matches;
+}
@@ -0,0 +1,456 @@
+//standard template library
+#include <optional>
+#include <memory>
+#include <vector>
+#include <tuple>
+#include <unordered_map>
+#include <algorithm>
+
+//C standard library
+#include <cstring>
+
+//external libraries
+#include <cmore.h>
+#include <memcry.h>
+
+//local headers
+#include "scancry.h"
+#include "structscan.hh"
+#include "valscan.hh"
+#include "addr_index.hh"
+#include "error.hh"
+
+
+
+      /* =============== *
+ ===== *  C++ INTERFACE  * =====
+       * =============== */
+
+/*
+ *  --- [INTERNAL] ---
+ */
+
+//rank a field by how often it matches, lower ranks are compared first
+[[nodiscard]] _SC_DBG_STATIC std::tuple<bool, bool, bool, size_t>
+    _rank_field(const struct sc::_struct_field & field) {
+
+    bool is_range, is_zero;
+
+
+    //pointers match too much of memory to be compared first
+    if (field.kind == sc::SF_PTR)
+        return std::make_tuple(true, true, true, (size_t) 0);
+
+    is_range = field.lo != field.hi;
+    is_zero = std::all_of(field.lo.begin(), field.lo.end(),
+                          [](const cm_byte b) { return b == 0; });
+
+    return std::make_tuple(false, is_range, is_zero,
+                           sizeof(uint64_t) - field.sz);
+}
+
+
+
+/*
+ *  --- [STRUCTSCAN | PRIVATE] ---
+ */
+
+void sc::structscan::do_reset() {
+
+    this->addrs.clear();
+    this->addrs.shrink_to_fit();
+    this->fields.clear();
+    this->struct_sz = 0;
+    this->area_index_p->clear();
+    this->area_addrs.clear();
+    this->area_hits.clear();
+    this->area_tails.clear();
+
+    return;
+}
+
+
+[[nodiscard]] int sc::structscan::compile(const opt_struct & opts_struct,
+                                          const enum addr_width addr_width) {
+
+    int ret;
+    bool has_value = false;
+
+
+    for (auto iter = opts_struct.get_fields().cbegin();
+         iter != opts_struct.get_fields().cend(); ++iter) {
+
+        struct sc::_struct_field field = {
+            iter->off, 0, iter->kind, iter->type, {}, {}
+        };
+
+        if (iter->off < 0) goto _compile_fail;
+
+        switch (iter->kind) {
+
+            case SF_PTR:
+                field.sz = addr_width;
+                break;
+
+            //compile the value into the range it matches
+            case SF_VALUE:
+                if (iter->predicate != VP_EQ && iter->predicate != VP_RANGE)
+                    goto _compile_fail;
+
+                field.sz = sc::val_type_sz(iter->type);
+                if (field.sz == 0) goto _compile_fail;
+
+                ret = sc::_val_compile_bounds(
+                    iter->type, iter->value, iter->predicate,
+                    iter->value_hi.empty()
+                        ? std::nullopt
+                        : std::optional<std::vector<cm_byte>>(iter->value_hi),
+                    VR_NONE, std::nullopt, field.lo, field.hi);
+                if (ret != 0) return -1;
+
+                has_value = true;
+                break;
+
+            default:
+                goto _compile_fail;
+        }
+
+        this->struct_sz = std::max(this->struct_sz,
+                                   (size_t) iter->off + field.sz);
+        this->fields.push_back(std::move(field));
+    }
+
+    //a value field must be available to compare first
+    if (has_value == false || this->struct_sz > sc::_struct_max_sz)
+        goto _compile_fail;
+
+    std::stable_sort(this->fields.begin(), this->fields.end(),
+                     [](const sc::_struct_field & a,
+                        const sc::_struct_field & b) {
+                         return _rank_field(a) < _rank_field(b);
+                     });
+
+    return 0;
+
+    _compile_fail:
+    sc_errno = SC_ERR_OPT_STRUCT;
+    return -1;
+}
+
+
+void sc::structscan::match(const cm_byte * buf, const size_t pos_num,
+                           const uintptr_t addr,
+                           const enum addr_width addr_width,
+                           std::vector<uintptr_t> & hits,
+                           std::vector<uintptr_t> & addrs) const {
+
+    bool matched;
+    uintptr_t base, ptr;
+    const cm_byte * pos;
+
+    const struct _struct_field & first = this->fields[0];
+
+
+    //compare the most selective field of every structure at once
+    hits.clear();
+    sc::_val_match_span(first.type, buf + first.off, pos_num,
+                        this->alignment, first.lo, first.hi,
+                        addr + first.off, hits);
+
+    //test the remaining fields of structures where it matched
+    for (auto iter = hits.cbegin(); iter != hits.cend(); ++iter) {
+
+        base = *iter - first.off;
+        pos = buf + (base - addr);
+
+        matched = true;
+        for (size_t i = 1; i < this->fields.size() && matched == true; ++i) {
+
+            const struct _struct_field & field = this->fields[i];
+
+            if (field.kind == SF_VALUE) {
+                matched = sc::_val_in_range(field.type, pos + field.off,
+                                            field.lo, field.hi);
+                continue;
+            }
+
+            ptr = 0;
+            std::memcpy(&ptr, pos + field.off, addr_width);
+            matched = this->area_index_p->find_containing(ptr) != nullptr;
+        }
+
+        if (matched == true) addrs.push_back(base);
+    }
+
+    return;
+}
+
+
+
+/*
+ *  --- [STRUCTSCAN | PUBLIC] ---
+ */
+
+/*
+ *  NOTE: Every call matches the structures that fit inside the rest of
+ *        the read buffer. The bytes of structures that run past it are
+ *        kept & finished by the call for the next buffer of the area.
+ *        The advance always leaves the `addr_width` bytes the worker
+ *        carries over, so aligned positions are found from the offset
+ *        of the buffer inside its area rather than from the advance.
+ */
+
+[[nodiscard]] off_t sc::structscan::_process_addr(
+                                    const struct _scan_arg arg,
+                                    const opt * const opts,
+                                    const _opt_scan * const opts_scan) {
+
+    size_t span_sz, adv, pos_num, area_left, tail_sz, seam_sz, phase;
+
+
+    const mc_vm_area * area = MC_GET_NODE_AREA(arg.area_node);
+
+    area_left = area->end_addr - arg.addr;
+
+    //last buffer of this area, match up to the end of the area
+    if (area_left <= arg.buf_left) {
+        span_sz = area_left;
+        adv = area_left;
+
+    //otherwise leave the buffer overlap for the next read
+    } else {
+        span_sz = arg.buf_left;
+        adv = arg.buf_left - opts->addr_width;
+    }
+
+    auto addrs_iter = this->area_addrs.find(arg.area_node);
+    auto hits_iter = this->area_hits.find(arg.area_node);
+    auto tails_iter = this->area_tails.find(arg.area_node);
+    if (addrs_iter == this->area_addrs.end()
+        || hits_iter == this->area_hits.end()
+        || tails_iter == this->area_tails.end()) return adv;
+
+    std::vector<cm_byte> & tail = tails_iter->second;
+
+    //finish the structures left over by the previous buffer
+    if (tail.empty() == false) {
+
+        tail_sz = tail.size();
+        seam_sz = std::min(this->struct_sz - 1, span_sz);
+        tail.insert(tail.end(), arg.cur_byte, arg.cur_byte + seam_sz);
+
+        if (tail.size() >= this->struct_sz) {
+
+            pos_num = std::min(((tail.size() - this->struct_sz)
+                                / this->alignment) + 1,
+                               (tail_sz + this->alignment - 1)
+                               / this->alignment);
+            this->match(tail.data(), pos_num, arg.addr - tail_sz,
+                        opts->addr_width, hits_iter->second,
+                        addrs_iter->second);
+        }
+        tail.clear();
+    }
+
+    //find the first aligned position of this buffer
+    phase = (this->alignment
+             - ((arg.addr - area->start_addr) % this->alignment))
+            % this->alignment;
+    if (phase >= adv) return adv;
+
+    //match the structures that fit inside this buffer
+    pos_num = (span_sz < phase + this->struct_sz)
+              ? 0 : ((span_sz - phase - this->struct_sz)
+                     / this->alignment) + 1;
+    pos_num = std::min(pos_num, (adv - phase + this->alignment - 1)
+                                / this->alignment);
+    if (pos_num != 0) {
+        this->match(arg.cur_byte + phase, pos_num, arg.addr + phase,
+                    opts->addr_width, hits_iter->second,
+                    addrs_iter->second);
+    }
+
+    //keep the other structures for the next buffer
+    if (phase + (pos_num * this->alignment) < adv && adv != area_left) {
+        tail.assign(arg.cur_byte + phase + (pos_num * this->alignment),
+                    arg.cur_byte + adv);
+    }
+
+    return adv;
+}
+
+
+[[nodiscard]] int sc::structscan::_generate_body(
+    std::vector<cm_byte> & buf, const off_t hdr_off) {
+
+    sc_errno = SC_ERR_RTTI;
+    return -1;
+}
+
+
+[[nodiscard]] int sc::structscan::_process_body(
+    const std::vector<cm_byte> & buf, off_t hdr_off,
+    const cm_byte version, const mc_vm_map & map) {
+
+    sc_errno = SC_ERR_RTTI;
+    return -1;
+}
+
+
+[[nodiscard]] int sc::structscan::_read_body(
+    const std::vector<cm_byte> & buf, off_t hdr_off, const cm_byte version) {
+
+    sc_errno = SC_ERR_RTTI;
+    return -1;
+}
+
+
+sc::structscan::structscan()
+ : _scan(),
+   struct_sz(0),
+   alignment(0),
+   area_index_p(std::make_unique<sc::_addr_index>()) {}
+
+
+sc::structscan::~structscan() {}
+
+
+[[nodiscard]] int sc::structscan::reset() {
+
+    _LOCK(-1);
+    this->do_reset();
+    _UNLOCK(-1);
+
+    return 0;
+}
+
+
+[[nodiscard]] int sc::structscan::scan(sc::opt & opts,
+                                       sc::opt_struct & opts_struct,
+                                       sc::map_area_set & ma_set,
+                                       worker_pool & w_pool,
+                                       const cm_byte flags) {
+
+    int ret;
+    bool run_err = false;
+
+    size_t addrs_num;
+
+
+    //lock the scan
+    _LOCK(-1)
+
+    //every scan starts from an empty result
+    this->do_reset();
+
+    //lock options
+    ret = opts._lock();
+    if (ret != 0) {
+        run_err = true;
+        goto _scan_ret;
+    }
+
+    //lock structscan options
+    ret = opts_struct._lock();
+    if (ret != 0) {
+        run_err = true;
+        goto _scan_unlock_opts;
+    }
+
+    //lock the map areas set
+    ret = ma_set._lock();
+    if (ret != 0) {
+        run_err = true;
+        goto _scan_unlock_opts_struct;
+    }
+
+    //check all necessary options have been set
+    if (opts_struct.get_fields().empty() == true
+        || opts_struct.get_alignment().has_value() == false
+        || opts_struct.get_alignment().value() <= 0
+        || opts.get_map() == nullptr) {
+
+        sc_errno = SC_ERR_OPT_MISSING;
+        run_err = true;
+        goto _scan_unlock_all;
+    }
+
+    //order the fields by how selective they are
+    ret = this->compile(opts_struct, opts.addr_width);
+    if (ret != 0) {
+        run_err = true;
+        goto _scan_unlock_all;
+    }
+    this->alignment = opts_struct.get_alignment().value();
+
+    //pointer fields must point into some area of the map
+    this->area_index_p->build_areas(*opts.get_map());
+
+    //one buffer per area, every area is scanned by a single worker
+    for (auto iter = ma_set.get_area_nodes().cbegin();
+         iter != ma_set.get_area_nodes().cend(); ++iter) {
+
+        this->area_addrs.emplace(*iter, std::vector<uintptr_t>());
+        this->area_hits.emplace(*iter, std::vector<uintptr_t>());
+        this->area_tails.emplace(*iter, std::vector<cm_byte>());
+    }
+
+    //setup the worker pool
+    ret = w_pool._setup(opts, opts_struct, *this, ma_set, flags);
+    if (ret != 0) {
+        run_err = true;
+        goto _scan_unlock_all;
+    }
+
+    //scan the selected address space once
+    ret = w_pool._single_run();
+    if (ret != 0) {
+        run_err = true;
+        goto _scan_unlock_all;
+    }
+
+    //gather & sort the structures of every area
+    addrs_num = 0;
+    for (auto iter = this->area_addrs.cbegin();
+         iter != this->area_addrs.cend(); ++iter) {
+        addrs_num += iter->second.size();
+    }
+
+    this->addrs.reserve(addrs_num);
+    for (auto iter = this->area_addrs.cbegin();
+         iter != this->area_addrs.cend(); ++iter) {
+
+        this->addrs.insert(this->addrs.end(),
+                           iter->second.begin(), iter->second.end());
+    }
+    std::sort(this->addrs.begin(), this->addrs.end());
+    this->area_addrs.clear();
+    this->area_hits.clear();
+    this->area_tails.clear();
+
+
+    _scan_unlock_all:
+    this->area_index_p->clear();
+
+    ret = ma_set._unlock();
+    if (ret != 0) run_err = true;
+
+    _scan_unlock_opts_struct:
+    ret = opts_struct._unlock();
+    if (ret != 0) run_err = true;
+
+    _scan_unlock_opts:
+    ret = opts._unlock();
+    if (ret != 0) run_err = true;
+
+    _scan_ret:
+    _UNLOCK(-1)
+    return run_err ? -1 : 0;
+}
+
+
+[[nodiscard]] const std::vector<uintptr_t> &
+    sc::structscan::get_addrs() const noexcept {
+
+    return this->addrs;
+}
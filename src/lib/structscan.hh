@@ -0,0 +1,37 @@
+#pragma once
+
+//standard template library
+#include <vector>
+
+//external libraries
+#include <cmore.h>
+
+//local headers
+#include "scancry.h"
+
+
+
+namespace sc {
+
+//largest structure a scan accepts, at most the size of the smallest page
+const constexpr size_t _struct_max_sz = 0x1000;
+
+
+/*
+ *  NOTE: A field compiled for matching. Value fields hold the closed
+ *        range `[lo, hi]` they match, see `_val_compile_bounds()`.
+ *        Pointer fields are `sz` bytes wide, the width of an address.
+ */
+
+struct _struct_field {
+
+    off_t off;
+    size_t sz;
+    enum struct_field_kind kind;
+    enum val_type type;
+    std::vector<cm_byte> lo;
+    std::vector<cm_byte> hi;
+};
+
+
+}; //namespace sc
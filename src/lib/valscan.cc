@@ -0,0 +1,2205 @@
+//standard template library
+#include <optional>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <numeric>
+#include <type_traits>
+#include <istream>
+#include <ostream>
+
+//C standard library
+#include <cstring>
+#include <cmath>
+
+//system headers
+#include <pthread.h>
+
+//external libraries
+#include <cmore.h>
+#include <memcry.h>
+
+//local headers
+#include "scancry.h"
+#include "valscan.hh"
+#include "fbuf_util.hh"
+#include "error.hh"
+
+
+
+      /* =============== *
+ ===== *  C++ INTERFACE  * =====
+       * =============== */
+
+/*
+ *  --- [INTERNAL] ---
+ */
+
+//bytes compared by a single kernel iteration
+#ifdef __AVX2__
+const constexpr size_t _val_vec_sz = 32;
+#else
+const constexpr size_t _val_vec_sz = 16;
+#endif
+
+
+/*
+ *  NOTE: Kernels are written with GCC vector extensions rather than
+ *        intrinsics of one instruction set. Blocks are as wide as the
+ *        vector registers the build targets, 16 bytes (SSE2) on a
+ *        baseline x86-64 build & 32 bytes (AVX2) with `-mavx2`. GCC
+ *        splits wider vectors into scalar operations. Blocks without a
+ *        match cost a compare and a reduction; only matching blocks
+ *        are walked lane by lane.
+ */
+
+//test if any lane of a block compare matched
+template <typename M>
+[[nodiscard]] _SC_DBG_STATIC _SC_DBG_INLINE bool _any_lane(const M found) {
+
+    uint64_t any = 0;
+
+
+    for (size_t i = 0; i < sizeof(M) / sizeof(uint64_t); ++i) any |= found[i];
+
+    return any != 0;
+}
+
+
+/*
+ *  NOTE: Every comparison tests whether a value lies inside a closed
+ *        range `[lo, hi]`; equality is the range `[val, val]`. Ranges
+ *        are compared with two compares and an AND per block, so they
+ *        cost no branches beyond the one an equality compare takes.
+ *        Half-open ranges of floating point types are closed by moving
+ *        their open bound to the nearest value inside the range.
+ */
+
+/*
+ *  NOTE: Positions that are not packed one value after another are
+ *        compared with the same dense blocks. Values at an alignment
+ *        `a` start at offsets that are multiples of gcd(a, sizeof(T))
+ *        modulo the size of the type, so `sizeof(T) / gcd` blocks, each
+ *        starting at one of these offsets, hold every value that starts
+ *        inside a region of the span. Lanes off the alignment are
+ *        masked out and the hits of a region are put back in address
+ *        order. Unaligned loads & the reassembly of a region cost more
+ *        than a scalar compare, so blocks are only used while there
+ *        are at most a quarter as many of them as positions in a region.
+ */
+
+//compare whole regions of strided positions, returns the next position
+template <typename T>
+[[nodiscard]] _SC_DBG_STATIC size_t _match_span_strided(
+                                const cm_byte * buf, const size_t pos_num,
+                                const off_t alignment, const T lo, const T hi,
+                                const uintptr_t addr,
+                                std::vector<uintptr_t> & matches) {
+
+    typedef T _vec __attribute__((vector_size(_val_vec_sz)));
+    typedef uint64_t _mask __attribute__((vector_size(_val_vec_sz)));
+    const constexpr size_t lanes = _val_vec_sz / sizeof(T);
+
+    const size_t step = std::gcd((size_t) alignment, sizeof(T));
+    const size_t span_end = ((pos_num - 1) * alignment) + sizeof(T);
+
+    const _vec lo_vec = (_vec){} + lo;
+    const _vec hi_vec = (_vec){} + hi;
+    const bool ranged = !(lo == hi);
+
+    size_t r, off;
+    uint64_t hits;
+    _vec block;
+    _mask found;
+
+
+    //fall back to scalar compares when blocks save too little
+    if (((sizeof(T) / step) * 4) > (_val_vec_sz / alignment)) return 0;
+
+    for (r = 0; r + (sizeof(T) - step) + _val_vec_sz <= span_end;
+         r += _val_vec_sz) {
+
+        //compare one block for every offset a value can start at
+        hits = 0;
+        for (size_t s = 0; s < sizeof(T); s += step) {
+
+            std::memcpy(&block, buf + r + s, sizeof(block));
+            if (ranged == true) {
+                found = (_mask) ((block >= lo_vec) & (block <= hi_vec));
+            } else {
+                found = (_mask) (block == lo_vec);
+            }
+            if (_any_lane(found) == false) continue;
+
+            for (size_t j = 0; j < lanes; ++j) {
+
+                off = s + (j * sizeof(T));
+                if (((r + off) % alignment) != 0) continue;
+                if (((block[j] >= lo) & (block[j] <= hi)) == false) continue;
+                hits |= ((uint64_t) 1) << off;
+            }
+        }
+
+        //record the hits of this region in address order
+        while (hits != 0) {
+            matches.push_back(addr + r + __builtin_ctzll(hits));
+            hits &= hits - 1;
+        }
+    }
+
+    return (r + alignment - 1) / alignment;
+}
+
+
+//compare `pos_num` positions of a buffer span against `[lo, hi]`
+template <typename T>
+_SC_DBG_STATIC void _match_span(const cm_byte * buf, const size_t pos_num,
+                                const off_t alignment, const T lo, const T hi,
+                                const uintptr_t addr,
+                                std::vector<uintptr_t> & matches) {
+
+    typedef T _vec __attribute__((vector_size(_val_vec_sz)));
+    typedef uint64_t _mask __attribute__((vector_size(_val_vec_sz)));
+    const constexpr size_t lanes = _val_vec_sz / sizeof(T);
+
+    size_t i = 0;
+    T cur;
+
+
+    //densely packed values are compared one block at a time
+    if (alignment == (off_t) sizeof(T)) {
+
+        const _vec lo_vec = (_vec){} + lo;
+        const _vec hi_vec = (_vec){} + hi;
+        const bool ranged = !(lo == hi);
+        _vec block;
+        _mask found;
+
+        for (; i + lanes <= pos_num; i += lanes) {
+
+            std::memcpy(&block, buf + (i * sizeof(T)), sizeof(block));
+            if (ranged == true) {
+                found = (_mask) ((block >= lo_vec) & (block <= hi_vec));
+            } else {
+                found = (_mask) (block == lo_vec);
+            }
+            if (_any_lane(found) == false) continue;
+
+            for (size_t j = 0; j < lanes; ++j) {
+                if (((block[j] >= lo) & (block[j] <= hi)) == false) continue;
+                matches.push_back(addr + ((i + j) * sizeof(T)));
+            }
+        }
+
+    //other alignments compare dense blocks & mask out unaligned lanes
+    } else if (pos_num != 0 && alignment < (off_t) _val_vec_sz) {
+        i = _match_span_strided<T>(buf, pos_num, alignment,
+                                   lo, hi, addr, matches);
+    }
+
+    //compare the remaining positions one at a time
+    for (; i < pos_num; ++i) {
+
+        std::memcpy(&cur, buf + (i * alignment), sizeof(T));
+        if ((cur >= lo) & (cur <= hi))
+            matches.push_back(addr + (i * alignment));
+    }
+
+    return;
+}
+
+
+//fetch the bounds of a type & run its kernel
+template <typename T>
+_SC_DBG_STATIC _SC_DBG_INLINE void _match_span_as(
+                                const cm_byte * buf, const size_t pos_num,
+                                const off_t alignment,
+                                const std::vector<cm_byte> & lo,
+                                const std::vector<cm_byte> & hi,
+                                const uintptr_t addr,
+                                std::vector<uintptr_t> & matches) {
+
+    T lo_val, hi_val;
+
+
+    std::memcpy(&lo_val, lo.data(), sizeof(T));
+    std::memcpy(&hi_val, hi.data(), sizeof(T));
+    _match_span<T>(buf, pos_num, alignment, lo_val, hi_val, addr, matches);
+
+    return;
+}
+
+
+//get the closed range of the values that round or truncate to `val`
+template <typename T>
+_SC_DBG_STATIC void _round_bounds(const T val, const enum sc::val_round round,
+                                  T & lo, T & hi) {
+
+    T n, below, above;
+
+
+    //values round to within half of `n`, or truncate to within one of `n`
+    if (round == sc::VR_TRUNC) {
+        n = std::trunc(val);
+        below = (n > 0) ? n : n - (T) 1;
+        above = (n < 0) ? n : n + (T) 1;
+    } else {
+        n = std::round(val);
+        below = n - (T) 0.5;
+        above = n + (T) 0.5;
+    }
+
+    //the bound nearer to zero is closed, unless both bounds surround it
+    lo = (n > 0) ? below : std::nextafter(below, n);
+    hi = (n < 0) ? above : std::nextafter(above, n);
+
+    return;
+}
+
+
+//get the range of the values a predicate compares against
+template <typename T>
+[[nodiscard]] _SC_DBG_STATIC int _compile_bounds_as(
+                        const std::vector<cm_byte> & value,
+                        const enum sc::val_pred predicate,
+                        const std::optional<std::vector<cm_byte>> & value_hi,
+                        const enum sc::val_round round,
+                        const std::optional<double> epsilon,
+                        std::vector<cm_byte> & lo, std::vector<cm_byte> & hi) {
+
+    T lo_val, hi_val;
+
+
+    if (value.size() != sizeof(T)) {
+        sc_errno = SC_ERR_OPT_VALUE;
+        return -1;
+    }
+
+    std::memcpy(&lo_val, value.data(), sizeof(T));
+    hi_val = lo_val;
+
+    //a range takes its upper bound from `value_hi`
+    if (predicate == sc::VP_RANGE) {
+
+        if (value_hi.has_value() == false) {
+            sc_errno = SC_ERR_OPT_MISSING;
+            return -1;
+        }
+
+        if (value_hi->size() != sizeof(T)) {
+            sc_errno = SC_ERR_OPT_VALUE;
+            return -1;
+        }
+
+        std::memcpy(&hi_val, value_hi->data(), sizeof(T));
+    }
+
+    //floating point equality may be widened into a range
+    if constexpr (std::is_floating_point_v<T> == true) {
+
+        if (predicate == sc::VP_EQ) {
+
+            if (round != sc::VR_NONE)
+                _round_bounds<T>(lo_val, round, lo_val, hi_val);
+
+            if (epsilon.has_value() == true) {
+
+                if ((epsilon.value() >= 0) == false) {
+                    sc_errno = SC_ERR_OPT_VALUE;
+                    return -1;
+                }
+
+                lo_val -= (T) epsilon.value();
+                hi_val += (T) epsilon.value();
+            }
+        }
+    }
+
+    //reject empty ranges, including those bound by a NaN
+    if ((lo_val <= hi_val) == false) {
+        sc_errno = SC_ERR_OPT_VALUE;
+        return -1;
+    }
+
+    lo.resize(sizeof(T));
+    hi.resize(sizeof(T));
+    std::memcpy(lo.data(), &lo_val, sizeof(T));
+    std::memcpy(hi.data(), &hi_val, sizeof(T));
+
+    return 0;
+}
+
+
+//test if the value at `pos` lies inside `[lo, hi]`
+template <typename T>
+[[nodiscard]] _SC_DBG_STATIC _SC_DBG_INLINE bool _in_range_as(
+                                const cm_byte * pos,
+                                const std::vector<cm_byte> & lo,
+                                const std::vector<cm_byte> & hi) {
+
+    T cur, lo_val, hi_val;
+
+
+    std::memcpy(&cur, pos, sizeof(T));
+    std::memcpy(&lo_val, lo.data(), sizeof(T));
+    std::memcpy(&hi_val, hi.data(), sizeof(T));
+
+    return (cur >= lo_val) & (cur <= hi_val);
+}
+
+
+[[nodiscard]] int sc::_val_compile_bounds(
+                        const enum val_type type,
+                        const std::vector<cm_byte> & value,
+                        const enum val_pred predicate,
+                        const std::optional<std::vector<cm_byte>> & value_hi,
+                        const enum val_round round,
+                        const std::optional<double> epsilon,
+                        std::vector<cm_byte> & lo, std::vector<cm_byte> & hi) {
+
+    switch (type) {
+
+        case VT_I8:
+            return _compile_bounds_as<int8_t>(
+                value, predicate, value_hi, round, epsilon, lo, hi);
+
+        case VT_U8:
+            return _compile_bounds_as<uint8_t>(
+                value, predicate, value_hi, round, epsilon, lo, hi);
+
+        case VT_I16:
+            return _compile_bounds_as<int16_t>(
+                value, predicate, value_hi, round, epsilon, lo, hi);
+
+        case VT_U16:
+            return _compile_bounds_as<uint16_t>(
+                value, predicate, value_hi, round, epsilon, lo, hi);
+
+        case VT_I32:
+            return _compile_bounds_as<int32_t>(
+                value, predicate, value_hi, round, epsilon, lo, hi);
+
+        case VT_U32:
+            return _compile_bounds_as<uint32_t>(
+                value, predicate, value_hi, round, epsilon, lo, hi);
+
+        case VT_I64:
+            return _compile_bounds_as<int64_t>(
+                value, predicate, value_hi, round, epsilon, lo, hi);
+
+        case VT_U64:
+            return _compile_bounds_as<uint64_t>(
+                value, predicate, value_hi, round, epsilon, lo, hi);
+
+        case VT_F32:
+            return _compile_bounds_as<float>(
+                value, predicate, value_hi, round, epsilon, lo, hi);
+
+        case VT_F64:
+            return _compile_bounds_as<double>(
+                value, predicate, value_hi, round, epsilon, lo, hi);
+    }
+
+    sc_errno = SC_ERR_OPT_VALUE;
+    return -1;
+}
+
+
+void sc::_val_match_span(const enum val_type type,
+                         const cm_byte * buf, const size_t pos_num,
+                         const off_t alignment,
+                         const std::vector<cm_byte> & lo,
+                         const std::vector<cm_byte> & hi,
+                         const uintptr_t addr,
+                         std::vector<uintptr_t> & matches) {
+
+    switch (type) {
+
+        case VT_I8:
+            _match_span_as<int8_t>(buf, pos_num, alignment,
+                                   lo, hi, addr, matches);
+            break;
+
+        case VT_U8:
+            _match_span_as<uint8_t>(buf, pos_num, alignment,
+                                    lo, hi, addr, matches);
+            break;
+
+        case VT_I16:
+            _match_span_as<int16_t>(buf, pos_num, alignment,
+                                    lo, hi, addr, matches);
+            break;
+
+        case VT_U16:
+            _match_span_as<uint16_t>(buf, pos_num, alignment,
+                                     lo, hi, addr, matches);
+            break;
+
+        case VT_I32:
+            _match_span_as<int32_t>(buf, pos_num, alignment,
+                                    lo, hi, addr, matches);
+            break;
+
+        case VT_U32:
+            _match_span_as<uint32_t>(buf, pos_num, alignment,
+                                     lo, hi, addr, matches);
+            break;
+
+        case VT_I64:
+            _match_span_as<int64_t>(buf, pos_num, alignment,
+                                    lo, hi, addr, matches);
+            break;
+
+        case VT_U64:
+            _match_span_as<uint64_t>(buf, pos_num, alignment,
+                                     lo, hi, addr, matches);
+            break;
+
+        case VT_F32:
+            _match_span_as<float>(buf, pos_num, alignment,
+                                  lo, hi, addr, matches);
+            break;
+
+        case VT_F64:
+            _match_span_as<double>(buf, pos_num, alignment,
+                                   lo, hi, addr, matches);
+            break;
+    }
+
+    return;
+}
+
+
+[[nodiscard]] bool sc::_val_in_range(const enum val_type type,
+                                     const cm_byte * pos,
+                                     const std::vector<cm_byte> & lo,
+                                     const std::vector<cm_byte> & hi) {
+
+    switch (type) {
+
+        case VT_I8:
+            return _in_range_as<int8_t>(pos, lo, hi);
+
+        case VT_U8:
+            return _in_range_as<uint8_t>(pos, lo, hi);
+
+        case VT_I16:
+            return _in_range_as<int16_t>(pos, lo, hi);
+
+        case VT_U16:
+            return _in_range_as<uint16_t>(pos, lo, hi);
+
+        case VT_I32:
+            return _in_range_as<int32_t>(pos, lo, hi);
+
+        case VT_U32:
+            return _in_range_as<uint32_t>(pos, lo, hi);
+
+        case VT_I64:
+            return _in_range_as<int64_t>(pos, lo, hi);
+
+        case VT_U64:
+            return _in_range_as<uint64_t>(pos, lo, hi);
+
+        case VT_F32:
+            return _in_range_as<float>(pos, lo, hi);
+
+        case VT_F64:
+            return _in_range_as<double>(pos, lo, hi);
+    }
+
+    return false;
+}
+
+
+//get the range of the values the options of a value scan compare against
+[[nodiscard]] _SC_DBG_STATIC _SC_DBG_INLINE int _compile_bounds(
+                                const enum sc::val_type type,
+                                const sc::opt_val & opts_val,
+                                std::vector<cm_byte> & lo,
+                                std::vector<cm_byte> & hi) {
+
+    return sc::_val_compile_bounds(type, opts_val.get_value().value(),
+                                   opts_val.get_predicate(),
+                                   opts_val.get_value_hi(),
+                                   opts_val.get_round(),
+                                   opts_val.get_epsilon(), lo, hi);
+}
+
+
+
+//test if a candidate satisfies a predicate
+template <typename T>
+[[nodiscard]] _SC_DBG_STATIC _SC_DBG_INLINE
+bool _test_pred(const T cur, const T prev,
+                const T lo, const T hi, const enum sc::val_pred predicate) {
+
+    switch (predicate) {
+
+        case sc::VP_EQ:
+        case sc::VP_RANGE:
+            return (cur >= lo) & (cur <= hi);
+
+        case sc::VP_CHANGED:
+            return cur != prev;
+
+        case sc::VP_UNCHANGED:
+            return cur == prev;
+
+        case sc::VP_INCREASED:
+            return cur > prev;
+
+        case sc::VP_DECREASED:
+            return cur < prev;
+
+        case sc::VP_INCREASED_BY:
+            return cur == (T) (prev + lo);
+
+        case sc::VP_DECREASED_BY:
+            return cur == (T) (prev - lo);
+    }
+
+    return false;
+}
+
+
+//keep the candidates of a chunk that satisfy a predicate
+template <typename T>
+_SC_DBG_STATIC void _filter_chunk(const cm_byte * buf, const uint16_t buf_off,
+                                  const std::vector<uint16_t> & offs,
+                                  const std::vector<cm_byte> & vals,
+                                  const std::vector<cm_byte> & lo,
+                                  const std::vector<cm_byte> & hi,
+                                  const enum sc::val_pred predicate,
+                                  std::vector<uint16_t> & new_offs,
+                                  std::vector<cm_byte> & new_vals) {
+
+    T cur, prev, lo_val = 0, hi_val = 0;
+
+
+    //fetch the bounds of the predicate, if any
+    if (lo.size() == sizeof(T)) {
+        std::memcpy(&lo_val, lo.data(), sizeof(T));
+        std::memcpy(&hi_val, hi.data(), sizeof(T));
+    }
+
+    for (size_t i = 0; i < offs.size(); ++i) {
+
+        std::memcpy(&cur, buf + (offs[i] - buf_off), sizeof(T));
+        std::memcpy(&prev, vals.data() + (i * sizeof(T)), sizeof(T));
+        if (_test_pred<T>(cur, prev, lo_val, hi_val, predicate) == false)
+            continue;
+
+        new_offs.push_back(offs[i]);
+        new_vals.insert(new_vals.end(),
+                        (cm_byte *) &cur, ((cm_byte *) &cur) + sizeof(T));
+    }
+
+    return;
+}
+
+
+//snapshot compression parameters
+const constexpr size_t _lz_min_match = 4;
+const constexpr size_t _lz_max_dist  = 0xFFFF;
+const constexpr int _lz_hash_bits    = 12;
+
+
+/*
+ *  NOTE: Snapshots are compressed with a small LZ77 codec. A stream is
+ *        a series of sequences, each a token followed by a run of
+ *        literals and a back-reference into the bytes already decoded:
+ *
+ *          token:     literal count (high nibble) & match length - 4
+ *                     (low nibble), a nibble of 15 is extended by bytes
+ *                     that follow, each adding up to 255
+ *          literals:  copied as they are
+ *          match:     16-bit little-endian distance & extended length
+ *
+ *        The last sequence ends after its literals. Pages of zeroes or
+ *        of repeated structures shrink to a few dozen bytes, and random
+ *        data grows by less than one percent.
+ */
+
+//append an extended length
+_SC_DBG_STATIC _SC_DBG_INLINE
+void _lz_put_len(std::vector<cm_byte> & dst, size_t len) {
+
+    for (; len >= 0xFF; len -= 0xFF) dst.push_back(0xFF);
+    dst.push_back((cm_byte) len);
+
+    return;
+}
+
+
+//append a sequence, a match length of 0 ends the stream
+_SC_DBG_STATIC void _lz_put_seq(std::vector<cm_byte> & dst,
+                                const cm_byte * lit, const size_t lit_sz,
+                                const size_t dist, const size_t match_sz) {
+
+    const size_t match_ext = (match_sz == 0) ? 0 : match_sz - _lz_min_match;
+
+
+    dst.push_back((cm_byte) ((std::min(lit_sz, (size_t) 0xF) << 4)
+                             | std::min(match_ext, (size_t) 0xF)));
+    if (lit_sz >= 0xF) _lz_put_len(dst, lit_sz - 0xF);
+    dst.insert(dst.end(), lit, lit + lit_sz);
+
+    if (match_sz == 0) return;
+    dst.push_back((cm_byte) (dist & 0xFF));
+    dst.push_back((cm_byte) (dist >> 8));
+    if (match_ext >= 0xF) _lz_put_len(dst, match_ext - 0xF);
+
+    return;
+}
+
+
+//compress a buffer
+_SC_DBG_STATIC void _lz_compress(const cm_byte * src, const size_t src_sz,
+                                 std::vector<cm_byte> & dst) {
+
+    uint32_t table[1 << _lz_hash_bits];
+    uint32_t seq, hash;
+    size_t pos, lit, cand, match_sz;
+
+
+    dst.clear();
+    std::fill(std::begin(table), std::end(table), UINT32_MAX);
+
+    pos = lit = 0;
+    while (pos + _lz_min_match <= src_sz) {
+
+        //look up the last position starting with the same bytes
+        std::memcpy(&seq, src + pos, sizeof(seq));
+        hash = (seq * 2654435761u) >> (32 - _lz_hash_bits);
+        cand = table[hash];
+        table[hash] = (uint32_t) pos;
+
+        if (cand == UINT32_MAX || (pos - cand) > _lz_max_dist
+            || std::memcmp(src + cand, src + pos, _lz_min_match) != 0) {
+            ++pos;
+            continue;
+        }
+
+        //extend the match as far as it goes
+        match_sz = _lz_min_match;
+        while (pos + match_sz < src_sz
+               && src[cand + match_sz] == src[pos + match_sz]) ++match_sz;
+
+        _lz_put_seq(dst, src + lit, pos - lit, pos - cand, match_sz);
+        pos += match_sz;
+        lit = pos;
+    }
+
+    //the remaining bytes end the stream
+    _lz_put_seq(dst, src + lit, src_sz - lit, 0, 0);
+
+    return;
+}
+
+
+//read an extended length
+[[nodiscard]] _SC_DBG_STATIC _SC_DBG_INLINE
+int _lz_get_len(const cm_byte * src, const size_t src_sz,
+                size_t & pos, size_t & len) {
+
+    cm_byte ext;
+
+
+    do {
+        if (pos >= src_sz) return -1;
+        ext = src[pos++];
+        len += ext;
+    } while (ext == 0xFF);
+
+    return 0;
+}
+
+
+//decompress a buffer of a known size
+[[nodiscard]] _SC_DBG_STATIC
+int _lz_decompress(const cm_byte * src, const size_t src_sz,
+                   cm_byte * dst, const size_t dst_sz) {
+
+    int ret;
+
+    cm_byte token;
+    size_t ip, op, lit_sz, dist, match_sz;
+
+
+    ip = op = 0;
+    while (ip < src_sz) {
+
+        //copy the literals
+        token = src[ip++];
+        lit_sz = token >> 4;
+        if (lit_sz == 0xF) {
+            ret = _lz_get_len(src, src_sz, ip, lit_sz);
+            if (ret != 0) return -1;
+        }
+
+        if (lit_sz > (src_sz - ip) || lit_sz > (dst_sz - op)) return -1;
+        std::memcpy(dst + op, src + ip, lit_sz);
+        ip += lit_sz;
+        op += lit_sz;
+
+        //the last sequence has no match
+        if (ip == src_sz) break;
+
+        //copy the match, it may overlap itself
+        if ((src_sz - ip) < 2) return -1;
+        dist = src[ip] | (((size_t) src[ip + 1]) << 8);
+        ip += 2;
+
+        match_sz = token & 0xF;
+        if (match_sz == 0xF) {
+            ret = _lz_get_len(src, src_sz, ip, match_sz);
+            if (ret != 0) return -1;
+        }
+        match_sz += _lz_min_match;
+
+        if (dist == 0 || dist > op || match_sz > (dst_sz - op)) return -1;
+        for (size_t i = 0; i < match_sz; ++i) dst[op + i] = dst[op - dist + i];
+        op += match_sz;
+    }
+
+    return (op == dst_sz) ? 0 : -1;
+}
+
+
+//snapshot the complete chunks of the memory read so far
+_SC_DBG_STATIC void _fold_snapshot(std::vector<sc::_val_chunk> & chunks,
+                                   std::vector<cm_byte> & raw,
+                                   const uintptr_t raw_base,
+                                   const uintptr_t area_start,
+                                   const size_t val_sz, const off_t alignment,
+                                   const bool area_end) {
+
+    const size_t full_sz = sc::_val_chunk_sz + val_sz - 1;
+
+    uintptr_t base;
+    size_t snap_sz, phase, pos_num;
+
+
+    /*
+     *  A chunk is complete once the bytes of its last value are read,
+     *  they may lie in the next chunk. The end of the area completes
+     *  every chunk.
+     */
+
+    base = raw_base;
+    while (raw.size() >= full_sz
+           || (area_end == true && raw.empty() == false)) {
+
+        snap_sz = std::min(raw.size(), full_sz);
+        phase = (alignment - ((base - area_start) % alignment)) % alignment;
+
+        //count the aligned positions that hold a whole value
+        pos_num = 0;
+        if (snap_sz >= phase + val_sz) {
+            pos_num = std::min(((snap_sz - phase - val_sz) / alignment) + 1,
+                               ((sc::_val_chunk_sz - phase)
+                                + alignment - 1) / alignment);
+        }
+
+        if (pos_num != 0) {
+            chunks.emplace_back(base);
+            chunks.back().snapshot((uint16_t) phase, pos_num,
+                                   alignment, raw.data(), snap_sz);
+        }
+
+        //keep the bytes the next chunk is made of
+        raw.erase(raw.begin(),
+                  raw.begin() + std::min(raw.size(), sc::_val_chunk_sz));
+        base += sc::_val_chunk_sz;
+    }
+
+    return;
+}
+
+
+//move the matches of the last buffer into the chunks of an area
+_SC_DBG_STATIC void _fold_matches(std::vector<sc::_val_chunk> & chunks,
+                                  std::vector<uintptr_t> & matches,
+                                  const cm_byte * buf, const uintptr_t addr,
+                                  const size_t val_sz, const off_t alignment) {
+
+    uintptr_t base;
+
+
+    for (auto iter = matches.begin(); iter != matches.end(); ++iter) {
+
+        //start a new chunk, packing the finished one
+        base = *iter & ~((uintptr_t) sc::_val_chunk_sz - 1);
+        if (chunks.empty() == true || chunks.back().get_base() != base) {
+
+            if (chunks.empty() == false) chunks.back().pack(alignment);
+            chunks.emplace_back(base);
+        }
+
+        chunks.back().push((uint16_t) (*iter - base),
+                           buf + (*iter - addr), val_sz);
+    }
+    matches.clear();
+
+    return;
+}
+
+
+/*
+ *  NOTE: A next scan reads the candidates of a run of adjacent chunks
+ *        with a single read. If the read fails, e.g. because part of
+ *        the run was unmapped since the last scan, every chunk of the
+ *        run is read on its own instead. Chunks that can not be read
+ *        are dropped.
+ */
+
+//narrow the candidates of one chunk, `span` holds the memory they span
+_SC_DBG_STATIC bool _next_scan_chunk(sc::_val_chunk & chunk,
+                                     const std::vector<uint16_t> & offs,
+                                     const cm_byte * span,
+                                     const size_t span_sz,
+                                     const struct sc::_val_next_arg * n_arg,
+                                     struct sc::_val_next_bufs & bufs) {
+
+    int ret;
+    const size_t val_sz = sc::val_type_sz(n_arg->type);
+
+    std::vector<cm_byte> & snap_vals = bufs.snap_vals;
+    std::vector<uint16_t> & new_offs = bufs.new_offs;
+    std::vector<cm_byte> & new_vals = bufs.new_vals;
+    const std::vector<cm_byte> & bound_lo = *n_arg->bound_lo;
+    const std::vector<cm_byte> & bound_hi = *n_arg->bound_hi;
+    const enum sc::val_pred predicate = n_arg->predicate;
+
+
+    //fetch the previous values
+    if (chunk.has_snap() == true) {
+        ret = chunk.get_snap_vals(offs, val_sz, snap_vals, bufs.snap_raw);
+        if (ret != 0) return false;
+    }
+
+    const std::vector<cm_byte> & vals
+        = chunk.has_snap() ? snap_vals : chunk.get_vals();
+
+    //filter the candidates
+    new_offs.clear();
+    new_vals.clear();
+    switch (n_arg->type) {
+
+        case VT_I8:
+            _filter_chunk<int8_t>(span, offs.front(), offs,
+                                  vals, bound_lo, bound_hi,
+                                  predicate, new_offs, new_vals);
+            break;
+
+        case VT_U8:
+            _filter_chunk<uint8_t>(span, offs.front(), offs,
+                                   vals, bound_lo, bound_hi,
+                                   predicate, new_offs, new_vals);
+            break;
+
+        case VT_I16:
+            _filter_chunk<int16_t>(span, offs.front(), offs,
+                                   vals, bound_lo, bound_hi,
+                                   predicate, new_offs, new_vals);
+            break;
+
+        case VT_U16:
+            _filter_chunk<uint16_t>(span, offs.front(), offs,
+                                    vals, bound_lo, bound_hi,
+                                    predicate, new_offs, new_vals);
+            break;
+
+        case VT_I32:
+            _filter_chunk<int32_t>(span, offs.front(), offs,
+                                   vals, bound_lo, bound_hi,
+                                   predicate, new_offs, new_vals);
+            break;
+
+        case VT_U32:
+            _filter_chunk<uint32_t>(span, offs.front(), offs,
+                                    vals, bound_lo, bound_hi,
+                                    predicate, new_offs, new_vals);
+            break;
+
+        case VT_I64:
+            _filter_chunk<int64_t>(span, offs.front(), offs,
+                                   vals, bound_lo, bound_hi,
+                                   predicate, new_offs, new_vals);
+            break;
+
+        case VT_U64:
+            _filter_chunk<uint64_t>(span, offs.front(), offs,
+                                    vals, bound_lo, bound_hi,
+                                    predicate, new_offs, new_vals);
+            break;
+
+        case VT_F32:
+            _filter_chunk<float>(span, offs.front(), offs,
+                                 vals, bound_lo, bound_hi,
+                                 predicate, new_offs, new_vals);
+            break;
+
+        case VT_F64:
+            _filter_chunk<double>(span, offs.front(), offs,
+                                  vals, bound_lo, bound_hi,
+                                  predicate, new_offs, new_vals);
+            break;
+    }
+
+    //drop chunks without candidates
+    if (new_offs.empty() == true) return false;
+
+    chunk.assign(new_offs, new_vals, n_arg->alignment);
+    chunk.compress(offs.front(), span, span_sz);
+
+    return true;
+}
+
+
+//narrow a share of the chunks of a value scan
+_SC_DBG_STATIC void * _next_scan_worker(void * arg) {
+
+    int ret;
+    size_t end;
+    uintptr_t lo, hi, chunk_lo;
+    size_t span_sz;
+    const cm_byte * span;
+
+    struct sc::_val_next_bufs bufs;
+    std::vector<std::vector<uint16_t>> run_offs;
+    std::vector<cm_byte> run_buf, chunk_buf;
+
+
+    //typecast argument
+    sc::_val_next_arg * n_arg = (sc::_val_next_arg *) arg;
+    std::vector<sc::_val_chunk> & chunks = *n_arg->chunks;
+    std::vector<cm_byte> & keep = *n_arg->keep;
+    const size_t val_sz = sc::val_type_sz(n_arg->type);
+
+    for (size_t i = n_arg->begin; i < n_arg->end; i = end) {
+
+        //find the run of adjacent chunks starting at this chunk
+        end = i + 1;
+        while (end < n_arg->end && (end - i) < sc::_val_run_chunks
+               && chunks[end].get_base()
+                  == chunks[end - 1].get_base() + sc::_val_chunk_sz) ++end;
+
+        run_offs.resize(end - i);
+        for (size_t j = i; j < end; ++j) {
+            chunks[j].get_offs(run_offs[j - i], n_arg->alignment);
+        }
+
+        //read the memory spanning every candidate of the run
+        lo = chunks[i].get_base() + run_offs.front().front();
+        hi = chunks[end - 1].get_base() + run_offs[end - i - 1].back()
+             + val_sz;
+        run_buf.resize(hi - lo);
+        ret = mc_read(n_arg->session, lo, run_buf.data(), hi - lo);
+
+        for (size_t j = i; j < end; ++j) {
+
+            const std::vector<uint16_t> & offs = run_offs[j - i];
+            chunk_lo = chunks[j].get_base() + offs.front();
+            span_sz = (offs.back() + val_sz) - offs.front();
+
+            //take this chunk's span from the run, or read it on its own
+            if (ret == 0) {
+                span = run_buf.data() + (chunk_lo - lo);
+
+            } else {
+                chunk_buf.resize(span_sz);
+                if (mc_read(n_arg->session, chunk_lo,
+                            chunk_buf.data(), span_sz) != 0) {
+                    keep[j] = false;
+                    continue;
+                }
+                span = chunk_buf.data();
+            }
+
+            keep[j] = _next_scan_chunk(chunks[j], offs, span, span_sz,
+                                       n_arg, bufs);
+        }
+    }
+
+    return nullptr;
+}
+
+
+
+/*
+ *  --- [VAL_CHUNK | PUBLIC] ---
+ */
+
+[[nodiscard]] size_t sc::_val_chunk_rec_sz(
+                        const struct _val_chunk_hdr & hdr) noexcept {
+
+    size_t rec_sz = sizeof(hdr);
+
+
+    //dense chunks save a bitmap, sparse chunks a list of offsets
+    if (hdr.words != 0) {
+        rec_sz += (size_t) hdr.words * sizeof(uint64_t);
+    } else {
+        rec_sz += (size_t) hdr.count * sizeof(uint16_t);
+    }
+
+    return rec_sz + hdr.vals_sz + hdr.snap_len;
+}
+
+
+sc::_val_chunk::_val_chunk(const uintptr_t base)
+ : base(base),
+   count(0),
+   phase(0),
+   snap_off(0),
+   snap_sz(0) {}
+
+
+void sc::_val_chunk::push(const uint16_t off,
+                          const cm_byte * val, const size_t val_sz) {
+
+    this->offs.push_back(off);
+    this->vals.insert(this->vals.end(), val, val + val_sz);
+    ++this->count;
+
+    return;
+}
+
+
+void sc::_val_chunk::pack(const off_t alignment) {
+
+    size_t words;
+
+
+    //dense chunks are already packed
+    if (this->offs.empty() == true) return;
+
+    //keep the list while it is smaller than a bitmap
+    words = ((_val_chunk_sz / alignment) + 63) / 64;
+    if ((this->offs.size() * sizeof(uint16_t))
+        < (words * sizeof(uint64_t))) return;
+
+    //every candidate shares the offset of the first aligned position
+    this->phase = this->offs[0] % alignment;
+    this->bitmap.assign(words, 0);
+    for (auto iter = this->offs.begin(); iter != this->offs.end(); ++iter) {
+
+        const size_t idx = (*iter - this->phase) / alignment;
+        this->bitmap[idx / 64] |= ((uint64_t) 1) << (idx % 64);
+    }
+
+    this->offs.clear();
+    this->offs.shrink_to_fit();
+
+    return;
+}
+
+
+void sc::_val_chunk::assign(const std::vector<uint16_t> & offs,
+                            std::vector<cm_byte> & vals,
+                            const off_t alignment) {
+
+    //replace the candidates with a list
+    this->bitmap.clear();
+    this->bitmap.shrink_to_fit();
+    this->offs = offs;
+    this->vals.swap(vals);
+    this->snap.clear();
+    this->snap.shrink_to_fit();
+    this->snap_sz = 0;
+    this->count = offs.size();
+
+    this->pack(alignment);
+
+    return;
+}
+
+
+void sc::_val_chunk::snapshot(const uint16_t phase, const size_t pos_num,
+                              const off_t alignment,
+                              const cm_byte * raw, const size_t raw_sz) {
+
+    const size_t words = ((_val_chunk_sz / alignment) + 63) / 64;
+
+
+    //set a bit for every position
+    this->phase = phase;
+    this->count = pos_num;
+    this->bitmap.assign(words, 0);
+    for (size_t i = 0; i < pos_num / 64; ++i) this->bitmap[i] = UINT64_MAX;
+    if ((pos_num % 64) != 0)
+        this->bitmap[pos_num / 64] = (((uint64_t) 1) << (pos_num % 64)) - 1;
+
+    this->offs.clear();
+    this->vals.clear();
+
+    //compress the memory holding the positions
+    _lz_compress(raw, raw_sz, this->snap);
+    this->snap.shrink_to_fit();
+    this->snap_off = 0;
+    this->snap_sz = (uint16_t) raw_sz;
+
+    return;
+}
+
+
+void sc::_val_chunk::compress(const uint16_t off,
+                              const cm_byte * raw, const size_t raw_sz) {
+
+    std::vector<cm_byte> snap;
+
+
+    //lists are only kept for a few candidates
+    if (this->bitmap.empty() == true) return;
+
+    _lz_compress(raw, raw_sz, snap);
+    if (snap.size() >= this->vals.size()) return;
+
+    this->snap.swap(snap);
+    this->snap.shrink_to_fit();
+    this->snap_off = off;
+    this->snap_sz = (uint16_t) raw_sz;
+    this->vals.clear();
+    this->vals.shrink_to_fit();
+
+    return;
+}
+
+
+void sc::_val_chunk::get_offs(std::vector<uint16_t> & offs,
+                              const off_t alignment) const {
+
+    uint64_t word;
+
+
+    offs.clear();
+
+    //sparse form
+    if (this->bitmap.empty() == true) {
+        offs = this->offs;
+        return;
+    }
+
+    //dense form
+    offs.reserve(this->count);
+    for (size_t i = 0; i < this->bitmap.size(); ++i) {
+
+        word = this->bitmap[i];
+        while (word != 0) {
+
+            const size_t idx = (i * 64) + __builtin_ctzll(word);
+            offs.push_back((uint16_t) (this->phase + (idx * alignment)));
+            word &= word - 1;
+        }
+    }
+
+    return;
+}
+
+
+[[nodiscard]] int sc::_val_chunk::get_snap_vals(
+                                    const std::vector<uint16_t> & offs,
+                                    const size_t val_sz,
+                                    std::vector<cm_byte> & vals,
+                                    std::vector<cm_byte> & raw) const {
+
+    int ret;
+    size_t raw_off;
+
+
+    //decompress the snapshot
+    raw.resize(this->snap_sz);
+    ret = _lz_decompress(this->snap.data(), this->snap.size(),
+                         raw.data(), raw.size());
+    if (ret != 0) return -1;
+
+    //gather the value of every candidate
+    vals.resize(offs.size() * val_sz);
+    for (size_t i = 0; i < offs.size(); ++i) {
+
+        raw_off = offs[i] - this->snap_off;
+        if (offs[i] < this->snap_off
+            || (raw_off + val_sz) > raw.size()) return -1;
+        std::memcpy(vals.data() + (i * val_sz), raw.data() + raw_off, val_sz);
+    }
+
+    return 0;
+}
+
+
+[[nodiscard]] uintptr_t sc::_val_chunk::get_base() const noexcept {
+
+    return this->base;
+}
+
+
+[[nodiscard]] size_t sc::_val_chunk::get_count() const noexcept {
+
+    return this->count;
+}
+
+
+[[nodiscard]] bool sc::_val_chunk::is_dense() const noexcept {
+
+    return this->bitmap.empty() == false;
+}
+
+
+[[nodiscard]] bool sc::_val_chunk::has_snap() const noexcept {
+
+    return this->snap_sz != 0;
+}
+
+
+[[nodiscard]] const std::vector<cm_byte> &
+    sc::_val_chunk::get_vals() const noexcept {
+
+    return this->vals;
+}
+
+
+[[nodiscard]] struct sc::_val_chunk_hdr
+    sc::_val_chunk::get_hdr() const noexcept {
+
+    struct _val_chunk_hdr hdr;
+
+
+    std::memset(&hdr, 0, sizeof(hdr));
+
+    hdr.base = this->base;
+    hdr.count = this->count;
+    hdr.vals_sz = this->vals.size();
+    hdr.snap_len = this->snap.size();
+    hdr.phase = this->phase;
+    hdr.words = this->bitmap.size();
+    hdr.snap_off = this->snap_off;
+    hdr.snap_sz = this->snap_sz;
+
+    return hdr;
+}
+
+
+[[nodiscard]] int sc::_val_chunk::store(const std::vector<cm_byte> & buf,
+                                        off_t & buf_off) const {
+
+    int ret;
+
+
+    ret = fbuf_util::pack_type(buf, buf_off, this->get_hdr());
+    if (ret != 0) return -1;
+
+    ret = fbuf_util::pack_bytes(buf, buf_off, this->bitmap.data(),
+                                this->bitmap.size() * sizeof(uint64_t));
+    if (ret != 0) return -1;
+    ret = fbuf_util::pack_bytes(buf, buf_off, this->offs.data(),
+                                this->offs.size() * sizeof(uint16_t));
+    if (ret != 0) return -1;
+    ret = fbuf_util::pack_bytes(buf, buf_off,
+                                this->vals.data(), this->vals.size());
+    if (ret != 0) return -1;
+    ret = fbuf_util::pack_bytes(buf, buf_off,
+                                this->snap.data(), this->snap.size());
+    if (ret != 0) return -1;
+
+    return 0;
+}
+
+
+/*
+ *  NOTE: A chunk is only loaded if its candidates lie inside it & its
+ *        previous values are held by exactly one of the values or the
+ *        snapshot. Snapshots are checked once a next scan reads them.
+ */
+
+[[nodiscard]] int sc::_val_chunk::load(const std::vector<cm_byte> & buf,
+                                       off_t & buf_off, const size_t val_sz,
+                                       const off_t alignment) {
+
+    int ret;
+    size_t words;
+
+    std::vector<uint16_t> offs;
+    std::optional<struct _val_chunk_hdr> hdr;
+
+
+    hdr = fbuf_util::unpack_type<struct _val_chunk_hdr>(buf, buf_off);
+    if (hdr.has_value() == false) goto _load_fail;
+
+    //check the form of the chunk
+    words = ((_val_chunk_sz / alignment) + 63) / 64;
+    if ((hdr->base % _val_chunk_sz) != 0 || hdr->count == 0
+        || (hdr->words != 0 && hdr->words != words)
+        || (hdr->words != 0 && hdr->phase >= alignment)) goto _load_fail;
+
+    //check the previous values are held by one of the two forms
+    if (hdr->snap_sz == 0) {
+        if (hdr->vals_sz != (hdr->count * val_sz)
+            || hdr->snap_len != 0) goto _load_fail;
+
+    } else {
+        if (hdr->words == 0 || hdr->vals_sz != 0 || hdr->snap_len == 0
+            || ((size_t) hdr->snap_off + hdr->snap_sz)
+               > (_val_chunk_sz + val_sz - 1)) goto _load_fail;
+    }
+
+    this->base = hdr->base;
+    this->count = hdr->count;
+    this->phase = hdr->phase;
+    this->snap_off = hdr->snap_off;
+    this->snap_sz = hdr->snap_sz;
+
+    //read the candidates & their previous values
+    this->bitmap.resize(hdr->words);
+    this->offs.resize((hdr->words == 0) ? hdr->count : 0);
+    this->vals.resize(hdr->vals_sz);
+    this->snap.resize(hdr->snap_len);
+
+    ret = fbuf_util::unpack_bytes(buf, buf_off, this->bitmap.data(),
+                                  this->bitmap.size() * sizeof(uint64_t));
+    if (ret != 0) goto _load_fail;
+    ret = fbuf_util::unpack_bytes(buf, buf_off, this->offs.data(),
+                                  this->offs.size() * sizeof(uint16_t));
+    if (ret != 0) goto _load_fail;
+    ret = fbuf_util::unpack_bytes(buf, buf_off,
+                                  this->vals.data(), this->vals.size());
+    if (ret != 0) goto _load_fail;
+    ret = fbuf_util::unpack_bytes(buf, buf_off,
+                                  this->snap.data(), this->snap.size());
+    if (ret != 0) goto _load_fail;
+
+    //check every candidate is counted & lies in order inside the chunk
+    this->get_offs(offs, alignment);
+    if (offs.size() != this->count || offs.back() >= _val_chunk_sz)
+        goto _load_fail;
+
+    for (size_t i = 1; i < offs.size(); ++i) {
+        if (offs[i - 1] >= offs[i]) goto _load_fail;
+    }
+
+    return 0;
+
+    _load_fail:
+    sc_errno = SC_ERR_INVALID_FILE;
+    return -1;
+}
+
+
+
+/*
+ *  --- [VALSCAN | PRIVATE] ---
+ */
+
+void sc::valscan::do_reset() {
+
+    this->chunks.clear();
+    this->chunks.shrink_to_fit();
+    this->type = std::nullopt;
+    this->bound_lo.clear();
+    this->bound_hi.clear();
+    this->area_chunks.clear();
+    this->area_matches.clear();
+    this->area_raw.clear();
+
+    return;
+}
+
+
+[[nodiscard]] struct sc::val_file_hdr
+    sc::valscan::make_hdr(const off_t hdr_off) const {
+
+    struct sc::val_file_hdr local_hdr;
+
+
+    //zero the padding so files are reproducible
+    std::memset(&local_hdr, 0, sizeof(local_hdr));
+
+    local_hdr.addrs_num = this->get_addrs_num();
+    local_hdr.chunks_num = this->chunks.size();
+    local_hdr.chunks_offset = hdr_off + sizeof(local_hdr);
+    local_hdr.alignment = this->alignment;
+    local_hdr.type = this->type.value();
+
+    return local_hdr;
+}
+
+
+[[nodiscard]] int sc::valscan::read_hdr(const struct val_file_hdr & hdr) {
+
+    //check the type & alignment
+    if (hdr.type > VT_F64 || hdr.alignment == 0
+        || hdr.alignment > sc::_val_chunk_sz) {
+
+        sc_errno = SC_ERR_INVALID_FILE;
+        return -1;
+    }
+
+    this->type = (enum sc::val_type) hdr.type;
+    this->alignment = hdr.alignment;
+
+    return 0;
+}
+
+
+/*
+ *  NOTE: Without a map every chunk is read. With a map, chunks whose
+ *        memory is no longer mapped are dropped.
+ */
+
+[[nodiscard]] int sc::valscan::read_chunk(const std::vector<cm_byte> & buf,
+                                          off_t & buf_off,
+                                          const mc_vm_map * map) {
+
+    int ret;
+    sc::_val_chunk chunk(0x0);
+
+
+    ret = chunk.load(buf, buf_off,
+                     sc::val_type_sz(this->type.value()), this->alignment);
+    if (ret != 0) return -1;
+
+    //chunks are saved in address order
+    if (this->chunks.empty() == false
+        && this->chunks.back().get_base() >= chunk.get_base()) {
+
+        sc_errno = SC_ERR_INVALID_FILE;
+        return -1;
+    }
+
+    if (map != nullptr
+        && mc_get_area_by_addr(map, chunk.get_base(), nullptr) == nullptr)
+        return 0;
+
+    this->chunks.push_back(std::move(chunk));
+
+    return 0;
+}
+
+
+[[nodiscard]] int sc::valscan::read_chunks(const std::vector<cm_byte> & buf,
+                                           const mc_vm_map * map) {
+
+    int ret;
+    off_t buf_off = 0;
+    std::optional<cm_byte> end_byte;
+
+
+    //fetch the valscan header
+    std::optional<struct val_file_hdr> local_hdr
+        = fbuf_util::unpack_type<struct val_file_hdr>(buf, buf_off);
+    if (local_hdr.has_value() == false) goto _read_chunks_fail;
+
+    ret = this->read_hdr(local_hdr.value());
+    if (ret != 0) goto _read_chunks_fail;
+
+    //fetch each chunk
+    for (uint32_t i = 0; i < local_hdr->chunks_num; ++i) {
+
+        ret = this->read_chunk(buf, buf_off, map);
+        if (ret != 0) goto _read_chunks_fail;
+    }
+
+    //check the file is terminated
+    end_byte = fbuf_util::unpack_type<cm_byte>(buf, buf_off);
+    if (end_byte.has_value() == false || end_byte != fbuf_util::_file_end)
+        goto _read_chunks_fail;
+
+    return 0;
+
+    _read_chunks_fail:
+    this->do_reset();
+    sc_errno = SC_ERR_INVALID_FILE;
+    return -1;
+}
+
+
+
+/*
+ *  --- [VALSCAN | PUBLIC] ---
+ */
+
+[[nodiscard]] size_t sc::val_type_sz(const enum val_type type) noexcept {
+
+    switch (type) {
+
+        case VT_I8:
+        case VT_U8:
+            return sizeof(uint8_t);
+
+        case VT_I16:
+        case VT_U16:
+            return sizeof(uint16_t);
+
+        case VT_I32:
+        case VT_U32:
+        case VT_F32:
+            return sizeof(uint32_t);
+
+        case VT_I64:
+        case VT_U64:
+        case VT_F64:
+            return sizeof(uint64_t);
+    }
+
+    return 0;
+}
+
+
+/*
+ *  NOTE: Every call compares the rest of the read buffer and returns
+ *        an advance that leaves exactly the overlap of `addr_width`
+ *        bytes the worker carries into the next read. The advance does
+ *        not follow the alignment, aligned positions are instead found
+ *        from the offset of the buffer inside its area. Values larger
+ *        than `addr_width` + 1 bytes that cross a buffer seam are
+ *        missed.
+ */
+
+[[nodiscard]] off_t sc::valscan::_process_addr(
+                                    const struct _scan_arg arg,
+                                    const opt * const opts,
+                                    const _opt_scan * const opts_scan) {
+
+    size_t span_sz, adv, pos_num, val_sz, area_left, phase;
+
+
+    //fetch valscan options & suppress warnings
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wignored-qualifiers"
+    const opt_val * const opts_val
+        = (const opt_val * const) opts_scan;
+    #pragma GCC diagnostic pop
+
+    const enum val_type type = opts_val->get_type().value();
+    const off_t alignment = opts_val->get_alignment().value();
+    const mc_vm_area * area = MC_GET_NODE_AREA(arg.area_node);
+
+    val_sz = sc::val_type_sz(type);
+    area_left = area->end_addr - arg.addr;
+
+    //last buffer of this area, compare up to the end of the area
+    if (area_left <= arg.buf_left) {
+        span_sz = area_left;
+        adv = area_left;
+
+    //otherwise leave the buffer overlap for the next read
+    } else {
+        span_sz = arg.buf_left;
+        adv = arg.buf_left - opts->addr_width;
+    }
+
+    //without an initial value, snapshot the memory instead
+    if (opts_val->get_value().has_value() == false) {
+
+        auto raw_iter = this->area_raw.find(arg.area_node);
+        auto chunks_iter = this->area_chunks.find(arg.area_node);
+        if (raw_iter == this->area_raw.end()
+            || chunks_iter == this->area_chunks.end()) return adv;
+
+        //the snapshot of this area ends at the current address
+        std::vector<cm_byte> & raw = raw_iter->second;
+        const uintptr_t raw_base = arg.addr - raw.size();
+
+        raw.insert(raw.end(), arg.cur_byte, arg.cur_byte + adv);
+        _fold_snapshot(chunks_iter->second, raw, raw_base, area->start_addr,
+                       val_sz, alignment, adv == area_left);
+
+        return adv;
+    }
+
+    //find the first aligned position of the span
+    phase = (alignment - ((arg.addr - area->start_addr) % alignment))
+            % alignment;
+    if (phase >= adv || span_sz < phase + val_sz) return adv;
+
+    //count positions that hold a whole value & start before the advance
+    pos_num = ((span_sz - phase - val_sz) / alignment) + 1;
+    pos_num = std::min(pos_num, (adv - phase + alignment - 1) / alignment);
+
+    auto area_iter = this->area_matches.find(arg.area_node);
+    auto chunks_iter = this->area_chunks.find(arg.area_node);
+    if (area_iter == this->area_matches.end()
+        || chunks_iter == this->area_chunks.end()) return adv;
+
+    //compare the span
+    sc::_val_match_span(type, arg.cur_byte + phase, pos_num, alignment,
+                        this->bound_lo, this->bound_hi,
+                        arg.addr + phase, area_iter->second);
+
+    //add the matches to the candidates of this area
+    if (area_iter->second.empty() == false) {
+        _fold_matches(chunks_iter->second, area_iter->second,
+                      arg.cur_byte, arg.addr, val_sz, alignment);
+    }
+
+    return adv;
+}
+
+
+[[nodiscard]] int sc::valscan::_generate_body(
+    std::vector<cm_byte> & buf, const off_t hdr_off) {
+
+    int ret;
+    size_t body_sz;
+    struct sc::val_file_hdr local_hdr;
+
+    cm_byte ctrl_byte;
+    off_t buf_off = 0;
+
+
+    //lock scanner
+    _LOCK(-1)
+
+    //check the scan contains a result to serialise
+    if (this->type.has_value() == false || this->chunks.empty() == true) {
+        sc_errno = SC_ERR_NO_RESULT;
+        goto _generate_body_fail;
+    }
+
+    //build local header
+    local_hdr = this->make_hdr(hdr_off);
+
+    //allocate space for the header, every chunk & the file end byte
+    body_sz = sizeof(local_hdr) + 1;
+    for (auto iter = this->chunks.cbegin();
+         iter != this->chunks.cend(); ++iter) {
+        body_sz += sc::_val_chunk_rec_sz(iter->get_hdr());
+    }
+    buf.resize(body_sz);
+
+    //store the header & every chunk
+    ret = fbuf_util::pack_type<struct val_file_hdr>(buf, buf_off, local_hdr);
+    if (ret != 0) goto _generate_body_fail;
+
+    for (auto iter = this->chunks.cbegin();
+         iter != this->chunks.cend(); ++iter) {
+
+        ret = iter->store(buf, buf_off);
+        if (ret != 0) goto _generate_body_fail;
+    }
+
+    //store the file end byte
+    ctrl_byte = fbuf_util::_file_end;
+    ret = fbuf_util::pack_type(buf, buf_off, ctrl_byte);
+    if (ret != 0) goto _generate_body_fail;
+
+    _UNLOCK(-1)
+    return 0;
+
+    _generate_body_fail:
+    _UNLOCK(-1)
+    return -1;
+}
+
+
+[[nodiscard]] int sc::valscan::_process_body(
+    const std::vector<cm_byte> & buf, off_t hdr_off,
+    const cm_byte version, const mc_vm_map & map) {
+
+    int ret;
+
+
+    _LOCK(-1)
+    ret = this->read_chunks(buf, &map);
+    _UNLOCK(-1)
+
+    return (ret != 0) ? -1 : 0;
+}
+
+
+[[nodiscard]] int sc::valscan::_read_body(
+    const std::vector<cm_byte> & buf, off_t hdr_off, const cm_byte version) {
+
+    int ret;
+
+
+    _LOCK(-1)
+    ret = this->read_chunks(buf, nullptr);
+    _UNLOCK(-1)
+
+    return (ret != 0) ? -1 : 0;
+}
+
+
+/*
+ *  NOTE: Only the header & a single chunk are held in memory at once,
+ *        a saved scan may hold as many snapshots as the memory scanned.
+ */
+
+[[nodiscard]] int sc::valscan::_write_body(std::ostream & os,
+                                           const off_t hdr_off) {
+
+    int ret;
+    std::vector<cm_byte> rec;
+    struct sc::val_file_hdr local_hdr;
+
+    cm_byte ctrl_byte;
+    off_t buf_off;
+
+
+    //lock scanner
+    _LOCK(-1)
+
+    //check the scan contains a result to serialise
+    if (this->type.has_value() == false || this->chunks.empty() == true) {
+        sc_errno = SC_ERR_NO_RESULT;
+        goto _write_body_fail;
+    }
+
+    //write the header
+    local_hdr = this->make_hdr(hdr_off);
+    os.write(reinterpret_cast<const char *>(&local_hdr), sizeof(local_hdr));
+
+    //write every chunk
+    for (auto iter = this->chunks.cbegin();
+         iter != this->chunks.cend() && os.fail() == false; ++iter) {
+
+        rec.resize(sc::_val_chunk_rec_sz(iter->get_hdr()));
+        buf_off = 0;
+
+        ret = iter->store(rec, buf_off);
+        if (ret != 0) goto _write_body_fail;
+
+        os.write(reinterpret_cast<const char *>(rec.data()), rec.size());
+    }
+
+    //write the file end byte
+    ctrl_byte = fbuf_util::_file_end;
+    os.write(reinterpret_cast<const char *>(&ctrl_byte), sizeof(ctrl_byte));
+    if (os.fail() == true) {
+        sc_errno = SC_ERR_FILE;
+        goto _write_body_fail;
+    }
+
+    _UNLOCK(-1)
+    return 0;
+
+    _write_body_fail:
+    _UNLOCK(-1)
+    return -1;
+}
+
+
+[[nodiscard]] int sc::valscan::_load_body(std::istream & is,
+                                          const off_t hdr_off,
+                                          const cm_byte version,
+                                          const mc_vm_map * map) {
+
+    int ret;
+    std::vector<cm_byte> rec;
+    struct sc::val_file_hdr local_hdr;
+    struct sc::_val_chunk_hdr chunk_hdr;
+
+    cm_byte ctrl_byte;
+    off_t buf_off;
+
+
+    //lock scanner
+    _LOCK(-1)
+
+    //read the header
+    is.read(reinterpret_cast<char *>(&local_hdr), sizeof(local_hdr));
+    if (is.fail() == true) goto _load_body_fail;
+
+    ret = this->read_hdr(local_hdr);
+    if (ret != 0) goto _load_body_fail;
+
+    //read one chunk at a time
+    for (uint32_t i = 0; i < local_hdr.chunks_num; ++i) {
+
+        //read the chunk header to find the size of the chunk
+        is.read(reinterpret_cast<char *>(&chunk_hdr), sizeof(chunk_hdr));
+        if (is.fail() == true
+            || chunk_hdr.count > sc::_val_chunk_sz
+            || chunk_hdr.vals_sz > (sc::_val_chunk_sz * sizeof(uint64_t))
+            || chunk_hdr.snap_len > (sc::_val_chunk_sz * 2))
+            goto _load_body_fail;
+
+        rec.resize(sc::_val_chunk_rec_sz(chunk_hdr));
+        std::memcpy(rec.data(), &chunk_hdr, sizeof(chunk_hdr));
+
+        is.read(reinterpret_cast<char *>(rec.data() + sizeof(chunk_hdr)),
+                rec.size() - sizeof(chunk_hdr));
+        if (is.fail() == true) goto _load_body_fail;
+
+        buf_off = 0;
+        ret = this->read_chunk(rec, buf_off, map);
+        if (ret != 0) goto _load_body_fail;
+    }
+
+    //check the file is terminated
+    is.read(reinterpret_cast<char *>(&ctrl_byte), sizeof(ctrl_byte));
+    if (is.fail() == true || ctrl_byte != fbuf_util::_file_end)
+        goto _load_body_fail;
+
+    _UNLOCK(-1)
+    return 0;
+
+    _load_body_fail:
+    this->do_reset();
+    sc_errno = SC_ERR_INVALID_FILE;
+    _UNLOCK(-1)
+    return -1;
+}
+
+
+sc::valscan::valscan()
+ : _scan(),
+   alignment(0) {}
+
+
+sc::valscan::~valscan() {}
+
+
+[[nodiscard]] int sc::valscan::reset() {
+
+    _LOCK(-1);
+    this->do_reset();
+    _UNLOCK(-1);
+
+    return 0;
+}
+
+
+[[nodiscard]] int sc::valscan::scan(sc::opt & opts,
+                                    sc::opt_val & opts_val,
+                                    sc::map_area_set & ma_set,
+                                    worker_pool & w_pool,
+                                    const cm_byte flags) {
+
+    int ret;
+    bool run_err = false;
+
+    size_t chunks_num;
+
+
+    //lock the scan
+    _LOCK(-1)
+
+    //every scan starts from an empty result
+    this->do_reset();
+
+    //lock options
+    ret = opts._lock();
+    if (ret != 0) {
+        run_err = true;
+        goto _scan_ret;
+    }
+
+    //lock valscan options
+    ret = opts_val._lock();
+    if (ret != 0) {
+        run_err = true;
+        goto _scan_unlock_opts;
+    }
+
+    //lock the map areas set
+    ret = ma_set._lock();
+    if (ret != 0) {
+        run_err = true;
+        goto _scan_unlock_opts_val;
+    }
+
+    //check all necessary options have been set
+    if (opts_val.get_type().has_value() == false
+        || opts_val.get_alignment().has_value() == false
+        || opts_val.get_alignment().value() <= 0
+        || opts.get_map() == nullptr) {
+
+        sc_errno = SC_ERR_OPT_MISSING;
+        run_err = true;
+        goto _scan_unlock_all;
+    }
+
+    //candidates are kept per chunk, an alignment can't exceed a chunk
+    if (opts_val.get_alignment().value() > (off_t) sc::_val_chunk_sz) {
+
+        sc_errno = SC_ERR_OPT_VALUE;
+        run_err = true;
+        goto _scan_unlock_all;
+    }
+
+    //check the value, if any, is the size of its type
+    if (opts_val.get_value().has_value() == true
+        && opts_val.get_value()->size()
+           != sc::val_type_sz(opts_val.get_type().value())) {
+
+        sc_errno = SC_ERR_OPT_VALUE;
+        run_err = true;
+        goto _scan_unlock_all;
+    }
+
+    //compile the value, if any, into the range to compare against
+    if (opts_val.get_value().has_value() == true) {
+
+        ret = _compile_bounds(opts_val.get_type().value(),
+                              opts_val, this->bound_lo, this->bound_hi);
+        if (ret != 0) {
+            run_err = true;
+            goto _scan_unlock_all;
+        }
+    }
+
+    //save the type & alignment for next scans
+    this->type = opts_val.get_type();
+    this->alignment = opts_val.get_alignment().value();
+
+    //one buffer per area, every area is scanned by a single worker
+    for (auto iter = ma_set.get_area_nodes().cbegin();
+         iter != ma_set.get_area_nodes().cend(); ++iter) {
+
+        this->area_chunks.emplace(*iter, std::vector<sc::_val_chunk>());
+        this->area_matches.emplace(*iter, std::vector<uintptr_t>());
+        this->area_raw.emplace(*iter, std::vector<cm_byte>());
+    }
+
+    //setup the worker pool
+    ret = w_pool._setup(opts, opts_val, *this, ma_set, flags);
+    if (ret != 0) {
+        run_err = true;
+        goto _scan_unlock_all;
+    }
+
+    //scan the selected address space once
+    ret = w_pool._single_run();
+    if (ret != 0) {
+        run_err = true;
+        goto _scan_unlock_all;
+    }
+
+    //gather & sort the candidates of every area
+    chunks_num = 0;
+    for (auto iter = this->area_chunks.cbegin();
+         iter != this->area_chunks.cend(); ++iter) {
+        chunks_num += iter->second.size();
+    }
+
+    this->chunks.reserve(chunks_num);
+    for (auto iter = this->area_chunks.begin();
+         iter != this->area_chunks.end(); ++iter) {
+
+        if (iter->second.empty() == true) continue;
+        iter->second.back().pack(this->alignment);
+
+        this->chunks.insert(this->chunks.end(),
+                            std::make_move_iterator(iter->second.begin()),
+                            std::make_move_iterator(iter->second.end()));
+    }
+    this->area_chunks.clear();
+    this->area_matches.clear();
+    this->area_raw.clear();
+    std::sort(this->chunks.begin(), this->chunks.end(),
+              [](const sc::_val_chunk & a, const sc::_val_chunk & b) {
+        return a.get_base() < b.get_base();
+    });
+
+
+    _scan_unlock_all:
+    ret = ma_set._unlock();
+    if (ret != 0) run_err = true;
+
+    _scan_unlock_opts_val:
+    ret = opts_val._unlock();
+    if (ret != 0) run_err = true;
+
+    _scan_unlock_opts:
+    ret = opts._unlock();
+    if (ret != 0) run_err = true;
+
+    _scan_ret:
+    _UNLOCK(-1)
+    return run_err ? -1 : 0;
+}
+
+
+/*
+ *  NOTE: Each candidate is read once per next scan. Chunks are read
+ *        from their first to their last candidate with a single read,
+ *        memory without candidates is never read. Chunks that can no
+ *        longer be read or that are left without candidates are dropped.
+ *
+ *        Snapshots are decompressed one chunk at a time, right before
+ *        the chunk is compared. Dense chunks that remain keep the memory
+ *        just read as their new snapshot while it compresses to less
+ *        than the values of their candidates.
+ */
+
+[[nodiscard]] int sc::valscan::next_scan(sc::opt & opts,
+                                         sc::opt_val & opts_val) {
+
+    int ret;
+    bool run_err = false;
+
+    size_t val_sz, kept, part_sz;
+    int started;
+    enum val_pred predicate;
+
+    std::vector<cm_byte> bound_lo, bound_hi, keep;
+    std::vector<struct _val_next_arg> n_args;
+    std::vector<pthread_t> thread_ids;
+
+
+    //lock the scan
+    _LOCK(-1)
+
+    //lock options
+    ret = opts._lock();
+    if (ret != 0) {
+        run_err = true;
+        goto _next_scan_ret;
+    }
+
+    //lock valscan options
+    ret = opts_val._lock();
+    if (ret != 0) {
+        run_err = true;
+        goto _next_scan_unlock_opts;
+    }
+
+    //check a session is provided
+    if (opts.get_sessions().empty() == true) {
+        sc_errno = SC_ERR_OPT_MISSING;
+        run_err = true;
+        goto _next_scan_unlock_all;
+    }
+
+    //check there are candidates left
+    if (this->type.has_value() == false || this->chunks.empty() == true) {
+        sc_errno = SC_ERR_NO_RESULT;
+        run_err = true;
+        goto _next_scan_unlock_all;
+    }
+
+    //check the predicate has the value it requires
+    val_sz = sc::val_type_sz(this->type.value());
+    predicate = opts_val.get_predicate();
+    if (predicate == VP_EQ || predicate == VP_RANGE
+        || predicate == VP_INCREASED_BY || predicate == VP_DECREASED_BY) {
+
+        if (opts_val.get_value().has_value() == false) {
+            sc_errno = SC_ERR_OPT_MISSING;
+            run_err = true;
+            goto _next_scan_unlock_all;
+        }
+
+        if (opts_val.get_value()->size() != val_sz) {
+            sc_errno = SC_ERR_OPT_VALUE;
+            run_err = true;
+            goto _next_scan_unlock_all;
+        }
+
+        ret = _compile_bounds(this->type.value(), opts_val,
+                              bound_lo, bound_hi);
+        if (ret != 0) {
+            run_err = true;
+            goto _next_scan_unlock_all;
+        }
+    }
+
+    {
+        //fetch sessions, one thread is used per session
+        const std::vector<const mc_session *> & sessions
+            = opts.get_sessions();
+
+        //chunks are kept unless a worker drops them
+        keep.assign(this->chunks.size(), true);
+
+        //divide the sorted chunks between sessions
+        part_sz = (this->chunks.size() / sessions.size()) + 1;
+        for (size_t begin = 0; begin < this->chunks.size();
+             begin += part_sz) {
+
+            struct _val_next_arg n_arg;
+
+            n_arg.chunks    = &this->chunks;
+            n_arg.begin     = begin;
+            n_arg.end       = std::min(begin + part_sz, this->chunks.size());
+            n_arg.session   = sessions[n_args.size()];
+            n_arg.type      = this->type.value();
+            n_arg.alignment = this->alignment;
+            n_arg.predicate = predicate;
+            n_arg.bound_lo  = &bound_lo;
+            n_arg.bound_hi  = &bound_hi;
+            n_arg.keep      = &keep;
+
+            n_args.push_back(n_arg);
+        }
+
+        //start a thread for every share of chunks
+        thread_ids.resize(n_args.size());
+        for (started = 0; started < (int) n_args.size(); ++started) {
+
+            ret = pthread_create(&thread_ids[started], nullptr,
+                                 _next_scan_worker, &n_args[started]);
+            if (ret != 0) {
+                sc_errno = SC_ERR_PTHREAD;
+                run_err = true;
+                break;
+            }
+        }
+
+        //wait for every started thread to finish
+        for (int i = 0; i < started; ++i) {
+
+            ret = pthread_join(thread_ids[i], nullptr);
+            if (ret != 0) {
+                sc_errno = SC_ERR_PTHREAD;
+                run_err = true;
+            }
+        }
+    }
+
+    //discard dropped chunks in a single pass
+    kept = 0;
+    for (size_t i = 0; i < this->chunks.size(); ++i) {
+
+        if (keep[i] == false) continue;
+        if (kept != i) this->chunks[kept] = std::move(this->chunks[i]);
+        ++kept;
+    }
+    this->chunks.erase(this->chunks.begin() + kept, this->chunks.end());
+
+
+    _next_scan_unlock_all:
+    ret = opts_val._unlock();
+    if (ret != 0) run_err = true;
+
+    _next_scan_unlock_opts:
+    ret = opts._unlock();
+    if (ret != 0) run_err = true;
+
+    _next_scan_ret:
+    _UNLOCK(-1)
+    return run_err ? -1 : 0;
+}
+
+
+[[nodiscard]] std::vector<uintptr_t> sc::valscan::get_addrs() const {
+
+    std::vector<uint16_t> offs;
+    std::vector<uintptr_t> addrs;
+
+
+    addrs.reserve(this->get_addrs_num());
+    for (auto iter = this->chunks.begin(); iter != this->chunks.end(); ++iter) {
+
+        iter->get_offs(offs, this->alignment);
+        for (auto off_iter = offs.begin(); off_iter != offs.end(); ++off_iter)
+            addrs.push_back(iter->get_base() + *off_iter);
+    }
+
+    return addrs;
+}
+
+
+[[nodiscard]] size_t sc::valscan::get_addrs_num() const noexcept {
+
+    size_t addrs_num = 0;
+
+
+    for (auto iter = this->chunks.begin(); iter != this->chunks.end(); ++iter)
+        addrs_num += iter->get_count();
+
+    return addrs_num;
+}
@@ -0,0 +1,201 @@
+#pragma once
+
+//standard template library
+#include <optional>
+#include <vector>
+
+//external libraries
+#include <cmore.h>
+#include <memcry.h>
+
+//local headers
+#include "scancry.h"
+
+
+
+namespace sc {
+
+//candidates are grouped by chunks of this size, aligned to their size
+const constexpr size_t _val_chunk_sz = 0x1000;
+
+//maximum number of adjacent chunks a next scan reads at once
+const constexpr size_t _val_run_chunks = 0x40;
+
+
+/*
+ *  NOTE: A chunk is saved as this header, followed by its bitmap or its
+ *        list of offsets, the previous values & the snapshot. A bitmap
+ *        of `words` 64bit words is saved for dense chunks, otherwise
+ *        `count` 16bit offsets are saved.
+ */
+
+struct _val_chunk_hdr {
+
+    uint64_t base;
+    uint32_t count;
+    uint32_t vals_sz;
+    uint32_t snap_len;
+    uint16_t phase;
+    uint16_t words;
+    uint16_t snap_off;
+    uint16_t snap_sz;
+};
+
+
+//size of a saved chunk, including its header
+[[nodiscard]] size_t _val_chunk_rec_sz(
+                        const struct _val_chunk_hdr & hdr) noexcept;
+
+
+/*
+ *  NOTE: A chunk holds the candidates of a value scan that fall inside
+ *        one `_val_chunk_sz` sized block of memory, along with the
+ *        value each candidate held in the last scan. Candidates are
+ *        kept as a sorted list of offsets from the chunk base. Once a
+ *        bitmap with one bit per aligned position is smaller than the
+ *        list, it is used instead. The previous values are stored in
+ *        address order for either form.
+ *
+ *        Dense chunks may instead keep a compressed snapshot of the
+ *        memory spanning their candidates. Every position of a scan
+ *        without an initial value is a candidate, so its chunks always
+ *        start out with a snapshot.
+ */
+
+class _val_chunk {
+
+    _SC_DBG_PRIVATE:
+        //[attributes]
+        uintptr_t base;
+        uint32_t count;
+
+        //dense form, offset of the first aligned position & a bitmap
+        uint16_t phase;
+        std::vector<uint64_t> bitmap;
+
+        //sparse form
+        std::vector<uint16_t> offs;
+
+        //previous value of every candidate
+        std::vector<cm_byte> vals;
+
+        //or a compressed snapshot of the memory at `snap_off`
+        std::vector<cm_byte> snap;
+        uint16_t snap_off;
+        uint16_t snap_sz;
+
+    public:
+        //[methods]
+        _val_chunk(const uintptr_t base);
+
+        //append a candidate above every existing candidate
+        void push(const uint16_t off,
+                  const cm_byte * val, const size_t val_sz);
+
+        //switch to the smaller form
+        void pack(const off_t alignment);
+
+        //replace the candidates & their values
+        void assign(const std::vector<uint16_t> & offs,
+                    std::vector<cm_byte> & vals, const off_t alignment);
+
+        //make every aligned position a candidate & snapshot the memory
+        void snapshot(const uint16_t phase, const size_t pos_num,
+                      const off_t alignment,
+                      const cm_byte * raw, const size_t raw_sz);
+
+        //replace the values with a snapshot if it is smaller
+        void compress(const uint16_t off,
+                      const cm_byte * raw, const size_t raw_sz);
+
+        //get the offset of every candidate
+        void get_offs(std::vector<uint16_t> & offs,
+                      const off_t alignment) const;
+
+        //get the previous value of every candidate from the snapshot
+        [[nodiscard]] int get_snap_vals(const std::vector<uint16_t> & offs,
+                                        const size_t val_sz,
+                                        std::vector<cm_byte> & vals,
+                                        std::vector<cm_byte> & raw) const;
+
+        //save & load the chunk as a record of a file
+        [[nodiscard]] struct _val_chunk_hdr get_hdr() const noexcept;
+        [[nodiscard]] int store(const std::vector<cm_byte> & buf,
+                                off_t & buf_off) const;
+        [[nodiscard]] int load(const std::vector<cm_byte> & buf,
+                               off_t & buf_off, const size_t val_sz,
+                               const off_t alignment);
+
+        //getters & setters
+        [[nodiscard]] uintptr_t get_base() const noexcept;
+        [[nodiscard]] size_t get_count() const noexcept;
+        [[nodiscard]] bool is_dense() const noexcept;
+        [[nodiscard]] bool has_snap() const noexcept;
+        [[nodiscard]] const std::vector<cm_byte> & get_vals() const noexcept;
+};
+
+
+/*
+ *  NOTE: The following run the kernels of a value scan on a single type
+ *        chosen at runtime. Other scans that compare typed values, e.g.
+ *        the fields of a structure scan, use them as well.
+ */
+
+//get the closed range `[lo, hi]` the predicate of a value compares against
+[[nodiscard]] int _val_compile_bounds(
+                        const enum val_type type,
+                        const std::vector<cm_byte> & value,
+                        const enum val_pred predicate,
+                        const std::optional<std::vector<cm_byte>> & value_hi,
+                        const enum val_round round,
+                        const std::optional<double> epsilon,
+                        std::vector<cm_byte> & lo, std::vector<cm_byte> & hi);
+
+//find the positions of a buffer span holding a value inside `[lo, hi]`
+void _val_match_span(const enum val_type type,
+                     const cm_byte * buf, const size_t pos_num,
+                     const off_t alignment,
+                     const std::vector<cm_byte> & lo,
+                     const std::vector<cm_byte> & hi,
+                     const uintptr_t addr,
+                     std::vector<uintptr_t> & matches);
+
+//test if the value at `pos` lies inside `[lo, hi]`
+[[nodiscard]] bool _val_in_range(const enum val_type type,
+                                 const cm_byte * pos,
+                                 const std::vector<cm_byte> & lo,
+                                 const std::vector<cm_byte> & hi);
+
+
+//state passed to a single next scan thread
+struct _val_next_arg {
+
+    //[members]
+    std::vector<_val_chunk> * chunks;
+
+    size_t begin;
+    size_t end;
+
+    const mc_session * session;
+    enum val_type type;
+    off_t alignment;
+    enum val_pred predicate;
+    const std::vector<cm_byte> * bound_lo;
+    const std::vector<cm_byte> * bound_hi;
+
+    std::vector<cm_byte> * keep;
+};
+
+
+//buffers reused by a next scan thread for every chunk
+struct _val_next_bufs {
+
+    //[members]
+    std::vector<uint16_t> new_offs;
+    std::vector<cm_byte> new_vals;
+    std::vector<cm_byte> snap_vals;
+    std::vector<cm_byte> snap_raw;
+};
+
+
+}; //namespace sc
@@ -0,0 +1,880 @@
+//standard template library
+#include <optional>
+#include <memory>
+#include <vector>
+#include <atomic>
+#include <algorithm>
+
+//C standard library
+#include <cstring>
+#include <ctime>
+#include <cerrno>
+
+//external libraries
+#include <cmore.h>
+#include <memcry.h>
+#include <pthread.h>
+
+//local headers
+#include "scancry.h"
+#include "watch.hh"
+#include "batch_read.hh"
+#include "error.hh"
+
+
+
+      /* =============== *
+ ===== *  C++ INTERFACE  * =====
+       * =============== */
+
+/*
+ *  --- [INTERNAL] ---
+ */
+
+//marks an entry that does not perform a read at this depth level
+const constexpr size_t _watch_no_read = SIZE_MAX;
+
+const constexpr long _nsec_per_sec = 1000000000;
+
+
+//check an interval is a positive time
+[[nodiscard]] _SC_DBG_STATIC _SC_DBG_INLINE
+bool _is_interval_valid(const struct timespec & interval) {
+
+    if (interval.tv_sec < 0 || interval.tv_nsec < 0
+        || interval.tv_nsec >= _nsec_per_sec) return false;
+
+    return interval.tv_sec != 0 || interval.tv_nsec != 0;
+}
+
+
+//advance a time by an interval
+_SC_DBG_STATIC _SC_DBG_INLINE
+void _advance_time(struct timespec & time, const struct timespec & interval) {
+
+    time.tv_sec += interval.tv_sec;
+    time.tv_nsec += interval.tv_nsec;
+
+    if (time.tv_nsec >= _nsec_per_sec) {
+        time.tv_sec += 1;
+        time.tv_nsec -= _nsec_per_sec;
+    }
+
+    return;
+}
+
+
+//check if a time is before another
+[[nodiscard]] _SC_DBG_STATIC _SC_DBG_INLINE
+bool _is_before(const struct timespec & a, const struct timespec & b) {
+
+    if (a.tv_sec != b.tv_sec) return a.tv_sec < b.tv_sec;
+    return a.tv_nsec < b.tv_nsec;
+}
+
+
+//entry point of the refresh thread
+_SC_DBG_STATIC void * _watch_thread(void * arg) {
+
+    //typecast argument
+    sc::watch_list * w_list = (sc::watch_list *) arg;
+
+    w_list->_run();
+    return nullptr;
+}
+
+
+
+/*
+ *  --- [WATCH_BUFFER | PUBLIC] ---
+ */
+
+sc::_watch_buffer::_watch_buffer()
+ : frames{{0, {}}, {0, {}}, {0, {}}},
+   middle(1),
+   back(0),
+   front(2) {}
+
+
+[[nodiscard]] struct sc::watch_frame & sc::_watch_buffer::get_back() noexcept {
+
+    return this->frames[this->back];
+}
+
+
+void sc::_watch_buffer::publish() noexcept {
+
+    //hand the filled frame to the reader, take the middle frame to fill
+    this->back = this->middle.exchange(this->back | _watch_fresh,
+                                       std::memory_order_acq_rel)
+                 & _watch_idx_mask;
+
+    return;
+}
+
+
+[[nodiscard]] const struct sc::watch_frame &
+    sc::_watch_buffer::acquire() noexcept {
+
+    //take the middle frame only if it was published since the last call
+    if (this->middle.load(std::memory_order_relaxed) & _watch_fresh) {
+        this->front = this->middle.exchange(this->front,
+                                            std::memory_order_acq_rel)
+                      & _watch_idx_mask;
+    }
+
+    return this->frames[this->front];
+}
+
+
+void sc::_watch_buffer::clear() {
+
+    for (int i = 0; i < 3; ++i) {
+        this->frames[i].seq = 0;
+        this->frames[i].values.clear();
+    }
+    this->middle.store(1, std::memory_order_relaxed);
+    this->back = 0;
+    this->front = 2;
+
+    return;
+}
+
+
+
+/*
+ *  --- [WATCH_STATE | PUBLIC] ---
+ */
+
+sc::_watch_state::_watch_state()
+ : running(false),
+   stopping(false),
+   stop_mutex(PTHREAD_MUTEX_INITIALIZER),
+   opts_p(nullptr),
+   session(nullptr),
+   addr_width(AW64),
+   interval{0, 0},
+   freeze_mutex(PTHREAD_MUTEX_INITIALIZER),
+   freeze_dirty(false),
+   seq(0) {
+
+    pthread_condattr_t attr;
+
+
+    //wait on the same clock the refreshes are paced with
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&this->stop_cond, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+
+sc::_watch_state::~_watch_state() {
+
+    pthread_cond_destroy(&this->stop_cond);
+    pthread_mutex_destroy(&this->stop_mutex);
+    pthread_mutex_destroy(&this->freeze_mutex);
+}
+
+
+
+/*
+ *  --- [WATCH_LIST | PRIVATE] ---
+ */
+
+[[nodiscard]] ssize_t sc::watch_list::add_entry(
+    struct _watch_entry && entry) {
+
+    int ret;
+
+
+    _LOCK(-1)
+
+    //the value must fit an entry
+    if (entry.sz == 0 || entry.sz > sc::watch_val_max_sz) {
+        sc_errno = SC_ERR_OPT_VALUE;
+        goto _add_entry_fail;
+    }
+
+    ret = pthread_mutex_lock(&this->state_p->freeze_mutex);
+    if (ret != 0) {
+        sc_errno = SC_ERR_PTHREAD;
+        goto _add_entry_fail;
+    }
+
+    if (entry.chain.has_value() == true)
+        this->max_len = std::max(this->max_len,
+                                 entry.chain->get_offsets().size());
+    this->entries.push_back(std::move(entry));
+
+    //every entry starts thawed
+    this->state_p->pending.emplace_back(std::nullopt);
+    this->state_p->freeze_dirty.store(true, std::memory_order_release);
+
+    pthread_mutex_unlock(&this->state_p->freeze_mutex);
+
+    _UNLOCK(-1)
+    return this->entries.size() - 1;
+
+    _add_entry_fail:
+    _UNLOCK(-1)
+    return -1;
+}
+
+
+/*
+ *  NOTE: Chains are followed one depth level at a time like chain
+ *        verification in `ptrscan.cc`, reading the pointers of every
+ *        chain at the same level together.
+ */
+
+void sc::watch_list::resolve(const mc_session * session,
+                             const enum addr_width addr_width) {
+
+    _watch_state & st = *this->state_p;
+
+
+    //start every chain at its object
+    st.addrs.resize(this->entries.size());
+    st.alive.assign(this->entries.size(), true);
+    st.read_idxs.resize(this->entries.size());
+
+    for (size_t i = 0; i < this->entries.size(); ++i) {
+
+        const struct _watch_entry & entry = this->entries[i];
+
+        st.addrs[i] = (entry.chain.has_value() == true)
+                      ? MC_GET_NODE_OBJ(entry.chain->get_obj_node().value())
+                            ->start_addr
+                      : entry.addr;
+    }
+
+    //for every depth level
+    for (size_t lvl = 0; lvl < this->max_len; ++lvl) {
+
+        st.reader.clear();
+
+        //queue a read for every chain that dereferences this level
+        for (size_t i = 0; i < this->entries.size(); ++i) {
+
+            st.read_idxs[i] = _watch_no_read;
+            if (st.alive[i] == false
+                || this->entries[i].chain.has_value() == false) continue;
+
+            const std::vector<off_t> & offs
+                = this->entries[i].chain->get_offsets();
+            if (lvl >= (offs.size() - 1)) continue;
+
+            st.read_idxs[i] = st.reader.add(st.addrs[i] + offs[lvl]);
+        }
+
+        //read every queued pointer at once
+        st.reader.read_ptrs(session, addr_width, st.ptrs, st.ok);
+
+        //advance every chain
+        for (size_t i = 0; i < this->entries.size(); ++i) {
+
+            if (st.alive[i] == false
+                || this->entries[i].chain.has_value() == false) continue;
+
+            const std::vector<off_t> & offs
+                = this->entries[i].chain->get_offsets();
+            if (lvl >= offs.size()) continue;
+
+            //do not dereference the last offset
+            if (lvl == (offs.size() - 1)) {
+                st.addrs[i] += offs[lvl];
+            } else {
+                st.addrs[i] = st.ptrs[st.read_idxs[i]];
+                st.alive[i] = st.ok[st.read_idxs[i]];
+            }
+        }
+    } //end for every depth level
+
+    return;
+}
+
+
+void sc::watch_list::write_freezes(const mc_session * session) {
+
+    int ret;
+    _watch_state & st = *this->state_p;
+
+
+    //take the freezes set since the last refresh
+    if (st.freeze_dirty.exchange(false, std::memory_order_acq_rel) == true) {
+
+        ret = pthread_mutex_lock(&st.freeze_mutex);
+        if (ret == 0) {
+            st.frozen = st.pending;
+            pthread_mutex_unlock(&st.freeze_mutex);
+        } else {
+            st.freeze_dirty.store(true, std::memory_order_release);
+        }
+    }
+
+    //a failed write shows up as the value read back
+    for (size_t i = 0; i < st.frozen.size(); ++i) {
+
+        if (st.frozen[i].has_value() == false || st.alive[i] == false)
+            continue;
+
+        ret = mc_write(session, st.addrs[i],
+                       st.frozen[i]->data(), st.frozen[i]->size());
+    }
+
+    return;
+}
+
+
+void sc::watch_list::read_values(const mc_session * session) {
+
+    _watch_state & st = *this->state_p;
+
+
+    //queue a read of every resolved entry
+    st.reader.clear();
+    for (size_t i = 0; i < this->entries.size(); ++i) {
+
+        st.read_idxs[i] = (st.alive[i] == true)
+                          ? st.reader.add(st.addrs[i], this->entries[i].sz)
+                          : _watch_no_read;
+    }
+
+    st.reader.read(session, sc::watch_val_max_sz, st.bytes, st.ok);
+
+    //fill & publish the next frame
+    struct sc::watch_frame & frame = this->buffer_p->get_back();
+    frame.values.resize(this->entries.size());
+
+    for (size_t i = 0; i < this->entries.size(); ++i) {
+
+        struct sc::watch_value & value = frame.values[i];
+
+        value.addr = (st.alive[i] == true) ? st.addrs[i] : 0x0;
+        value.ok = (st.read_idxs[i] != _watch_no_read)
+                   && (st.ok[st.read_idxs[i]] == true);
+
+        if (value.ok == true) {
+            std::memcpy(value.bytes,
+                        st.bytes.data()
+                        + (st.read_idxs[i] * sc::watch_val_max_sz),
+                        sc::watch_val_max_sz);
+        } else {
+            std::memset(value.bytes, 0, sc::watch_val_max_sz);
+        }
+    }
+
+    frame.seq = ++st.seq;
+    this->buffer_p->publish();
+
+    return;
+}
+
+
+void sc::watch_list::do_refresh(const mc_session * session,
+                                const enum addr_width addr_width) {
+
+    this->resolve(session, addr_width);
+    this->write_freezes(session);
+    this->read_values(session);
+
+    return;
+}
+
+
+void sc::watch_list::do_reset() {
+
+    this->entries.clear();
+    this->max_len = 0;
+    this->buffer_p->clear();
+
+    pthread_mutex_lock(&this->state_p->freeze_mutex);
+    this->state_p->pending.clear();
+    this->state_p->frozen.clear();
+    this->state_p->freeze_dirty.store(false, std::memory_order_release);
+    pthread_mutex_unlock(&this->state_p->freeze_mutex);
+
+    this->state_p->seq = 0;
+
+    return;
+}
+
+
+
+/*
+ *  --- [WATCH_LIST | PUBLIC] ---
+ */
+
+/*
+ *  NOTE: Refreshes are paced against the monotonic clock. A refresh
+ *        that runs past its deadline is followed immediately by the
+ *        next one; refreshes are never queued up to catch up.
+ */
+
+void sc::watch_list::_run() {
+
+    int ret;
+    struct timespec next, now;
+
+    _watch_state & st = *this->state_p;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &next);
+
+    pthread_mutex_lock(&st.stop_mutex);
+    while (st.stopping == false) {
+
+        pthread_mutex_unlock(&st.stop_mutex);
+        this->do_refresh(st.session, st.addr_width);
+
+        //find the deadline of the next refresh
+        _advance_time(next, st.interval);
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        if (_is_before(next, now) == true) next = now;
+
+        //sleep until the deadline, or until stopped
+        ret = 0;
+        pthread_mutex_lock(&st.stop_mutex);
+        while (st.stopping == false && ret != ETIMEDOUT) {
+            ret = pthread_cond_timedwait(&st.stop_cond, &st.stop_mutex, &next);
+        }
+    }
+    pthread_mutex_unlock(&st.stop_mutex);
+
+    return;
+}
+
+
+sc::watch_list::watch_list()
+ : _lockable(),
+   max_len(0),
+   buffer_p(std::make_unique<sc::_watch_buffer>()),
+   state_p(std::make_unique<sc::_watch_state>()) {}
+
+
+sc::watch_list::~watch_list() {
+
+    int ret;
+
+
+    if (this->state_p->running == true) {
+        ret = this->stop();
+        if (ret != 0) print_warning("Failed to stop a watch list thread.");
+    }
+}
+
+
+[[nodiscard]] int sc::watch_list::reset() {
+
+    _LOCK(-1)
+    this->do_reset();
+    _UNLOCK(-1)
+
+    return 0;
+}
+
+
+[[nodiscard]] ssize_t sc::watch_list::add_addr(const uintptr_t addr,
+                                               const enum val_type type) {
+
+    return this->add_entry(
+        {std::nullopt, addr, type, sc::val_type_sz(type)});
+}
+
+
+[[nodiscard]] ssize_t sc::watch_list::add_chain(const ptrscan_chain & chain,
+                                                const enum val_type type) {
+
+    std::optional<const cm_lst_node *> obj_node = chain.get_obj_node();
+
+
+    //the chain must start at an object of the map
+    if (obj_node.has_value() == false || obj_node.value() == nullptr
+        || chain.get_offsets().empty() == true) {
+
+        sc_errno = SC_ERR_WATCH_ENTRY;
+        return -1;
+    }
+
+    return this->add_entry({chain, 0x0, type, sc::val_type_sz(type)});
+}
+
+
+/*
+ *  NOTE: Entries only change while the list is stopped, so the index
+ *        can be checked without locking the list.
+ */
+
+[[nodiscard]] int sc::watch_list::set_freeze(
+    const size_t idx, const std::optional<std::vector<cm_byte>> & value) {
+
+    int ret;
+
+
+    if (idx >= this->entries.size()) {
+        sc_errno = SC_ERR_WATCH_ENTRY;
+        return -1;
+    }
+
+    if (value.has_value() == true
+        && value->size() != this->entries[idx].sz) {
+
+        sc_errno = SC_ERR_OPT_VALUE;
+        return -1;
+    }
+
+    //hand the freeze to the next refresh
+    ret = pthread_mutex_lock(&this->state_p->freeze_mutex);
+    if (ret != 0) {
+        sc_errno = SC_ERR_PTHREAD;
+        return -1;
+    }
+
+    this->state_p->pending[idx] = value;
+    this->state_p->freeze_dirty.store(true, std::memory_order_release);
+
+    pthread_mutex_unlock(&this->state_p->freeze_mutex);
+
+    return 0;
+}
+
+
+[[nodiscard]] int sc::watch_list::refresh(sc::opt & opts) {
+
+    int ret;
+    bool run_err = false;
+
+
+    //lock the watch list
+    _LOCK(-1)
+
+    //lock options
+    ret = opts._lock();
+    if (ret != 0) {
+        run_err = true;
+        goto _refresh_ret;
+    }
+
+    //a session is necessary to read the target
+    if (opts.get_sessions().empty() == true) {
+        sc_errno = SC_ERR_OPT_NOSESSION;
+        run_err = true;
+        goto _refresh_unlock_opts;
+    }
+
+    //read through the target's PID if it is known
+    this->state_p->reader.set_pid(opts.get_pid());
+    this->do_refresh(opts.get_sessions()[0], opts.addr_width);
+
+    _refresh_unlock_opts:
+    ret = opts._unlock();
+    if (ret != 0) run_err = true;
+
+    _refresh_ret:
+    _UNLOCK(-1)
+    return run_err ? -1 : 0;
+}
+
+
+/*
+ *  NOTE: The list & `opts` stay locked until `stop()` is called.
+ */
+
+[[nodiscard]] int sc::watch_list::start(sc::opt & opts,
+                                        const struct timespec & interval) {
+
+    int ret;
+
+    _watch_state & st = *this->state_p;
+
+
+    //lock the watch list
+    _LOCK(-1)
+
+    //check the interval is usable
+    if (_is_interval_valid(interval) == false) {
+        sc_errno = SC_ERR_OPT_INTERVAL;
+        goto _start_fail;
+    }
+
+    //lock options
+    ret = opts._lock();
+    if (ret != 0) goto _start_fail;
+
+    //a session is necessary to read the target
+    if (opts.get_sessions().empty() == true) {
+        sc_errno = SC_ERR_OPT_NOSESSION;
+        goto _start_unlock_opts;
+    }
+
+    //setup the thread
+    st.opts_p = &opts;
+    st.session = opts.get_sessions()[0];
+    st.addr_width = opts.addr_width;
+    st.reader.set_pid(opts.get_pid());
+    st.interval = interval;
+    st.stopping = false;
+
+    ret = pthread_create(&st.thread, nullptr, _watch_thread, this);
+    if (ret != 0) {
+        sc_errno = SC_ERR_PTHREAD;
+        goto _start_unlock_opts;
+    }
+    st.running = true;
+
+    return 0;
+
+    _start_unlock_opts:
+    ret = opts._unlock();
+
+    _start_fail:
+    _UNLOCK(-1)
+    return -1;
+}
+
+
+[[nodiscard]] int sc::watch_list::stop() {
+
+    int ret;
+    bool run_err = false;
+
+    _watch_state & st = *this->state_p;
+
+
+    //stopping a stopped list does nothing
+    if (st.running == false) return 0;
+
+    //wake the thread & wait for it to exit
+    pthread_mutex_lock(&st.stop_mutex);
+    st.stopping = true;
+    pthread_cond_signal(&st.stop_cond);
+    pthread_mutex_unlock(&st.stop_mutex);
+
+    ret = pthread_join(st.thread, nullptr);
+    if (ret != 0) {
+        sc_errno = SC_ERR_PTHREAD;
+        run_err = true;
+    }
+    st.running = false;
+
+    //release options & the watch list
+    ret = st.opts_p->_unlock();
+    if (ret != 0) run_err = true;
+    st.opts_p = nullptr;
+
+    _UNLOCK(-1)
+    return run_err ? -1 : 0;
+}
+
+
+[[nodiscard]] const struct sc::watch_frame &
+    sc::watch_list::get_frame() noexcept {
+
+    return this->buffer_p->acquire();
+}
+
+
+[[nodiscard]] size_t sc::watch_list::get_entries_num() const noexcept {
+
+    return this->entries.size();
+}
+
+
+[[nodiscard]] bool sc::watch_list::is_running() const noexcept {
+
+    return this->state_p->running;
+}
+
+
+
+      /* ============= *
+ ===== *  C INTERFACE  * =====
+       * ============= */
+
+/*
+ *  --- [EXTERNAL] ---
+ */
+
+sc_watch_list sc_new_watch_list() {
+
+    try {
+        return new sc::watch_list();
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return nullptr;
+    }
+}
+
+
+int sc_del_watch_list(sc_watch_list w_list) {
+
+    //cast opaque handle into class
+    sc::watch_list * w = static_cast<sc::watch_list *>(w_list);
+
+    try {
+        delete w;
+        return 0;
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+int sc_watch_list_reset(sc_watch_list w_list) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::watch_list * w = static_cast<sc::watch_list *>(w_list);
+
+    try {
+        ret = w->reset();
+        return (ret != 0) ? -1 : 0;
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+ssize_t sc_watch_list_add_addr(sc_watch_list w_list, const uintptr_t addr,
+                               const enum sc_val_type type) {
+
+    //cast opaque handle into class
+    sc::watch_list * w = static_cast<sc::watch_list *>(w_list);
+
+    try {
+        //convert C enum to C++ & perform the add
+        return w->add_addr(addr, static_cast<enum sc::val_type>(type));
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+int sc_watch_list_set_freeze(sc_watch_list w_list, const size_t idx,
+                             const cm_byte * value, const size_t value_sz) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::watch_list * w = static_cast<sc::watch_list *>(w_list);
+
+    try {
+        if (value == nullptr) {
+            ret = w->set_freeze(idx, std::nullopt);
+        } else {
+            ret = w->set_freeze(
+                idx, std::vector<cm_byte>(value, value + value_sz));
+        }
+        return (ret != 0) ? -1 : 0;
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+int sc_watch_list_refresh(sc_watch_list w_list, sc_opt opts) {
+
+    int ret;
+
+
+    //cast opaque handles into classes
+    sc::watch_list * w = static_cast<sc::watch_list *>(w_list);
+    sc::opt * o = static_cast<sc::opt *>(opts);
+
+    try {
+        ret = w->refresh(*o);
+        return (ret != 0) ? -1 : 0;
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+int sc_watch_list_start(sc_watch_list w_list, sc_opt opts,
+                        const struct timespec * interval) {
+
+    int ret;
+
+
+    //cast opaque handles into classes
+    sc::watch_list * w = static_cast<sc::watch_list *>(w_list);
+    sc::opt * o = static_cast<sc::opt *>(opts);
+
+    try {
+        if (interval == nullptr) {
+            sc_errno = SC_ERR_OPT_INTERVAL;
+            return -1;
+        }
+
+        ret = w->start(*o, *interval);
+        return (ret != 0) ? -1 : 0;
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+int sc_watch_list_stop(sc_watch_list w_list) {
+
+    int ret;
+
+
+    //cast opaque handle into class
+    sc::watch_list * w = static_cast<sc::watch_list *>(w_list);
+
+    try {
+        ret = w->stop();
+        return (ret != 0) ? -1 : 0;
+
+    } catch (const std::exception & excp) {
+        exception_sc_errno(excp);
+        return -1;
+    }
+}
+
+
+uint64_t sc_watch_list_get_frame(sc_watch_list w_list,
+                                 sc_watch_value * values) {
+
+    //cast opaque handle into class
+    sc::watch_list * w = static_cast<sc::watch_list *>(w_list);
+
+    const struct sc::watch_frame & frame = w->get_frame();
+
+    //convert every value to C
+    for (size_t i = 0; i < frame.values.size(); ++i) {
+
+        values[i].addr = frame.values[i].addr;
+        values[i].ok = frame.values[i].ok;
+        std::memcpy(values[i].bytes, frame.values[i].bytes,
+                    SC_WATCH_VAL_MAX_SZ);
+    }
+
+    return frame.seq;
+}
+
+
+size_t sc_watch_list_get_entries_num(const sc_watch_list w_list) {
+
+    //cast opaque handle into class
+    sc::watch_list * w = static_cast<sc::watch_list *>(w_list);
+
+    return w->get_entries_num();
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+//standard template library
+#include <optional>
+#include <vector>
+#include <atomic>
+
+//C standard library
+#include <ctime>
+
+//external libraries
+#include <cmore.h>
+#include <memcry.h>
+#include <pthread.h>
+
+//local headers
+#include "scancry.h"
+#include "batch_read.hh"
+
+
+
+namespace sc {
+
+/*
+ *  NOTE: A triple buffer holds three frames. The thread refreshing a
+ *        watch list owns the back frame & the reader owns the front
+ *        frame. The middle frame is swapped with either of them in a
+ *        single atomic exchange; `_watch_fresh` marks a middle frame
+ *        the reader has not taken yet. Neither side ever waits, & a
+ *        reader that falls behind skips straight to the latest frame.
+ */
+
+const constexpr cm_byte _watch_idx_mask = 0x3;
+const constexpr cm_byte _watch_fresh    = 0x4;
+
+
+class _watch_buffer {
+
+    _SC_DBG_PRIVATE:
+        //[attributes]
+        struct watch_frame frames[3];
+        std::atomic<cm_byte> middle;
+        cm_byte back;
+        cm_byte front;
+
+    public:
+        //[methods]
+        _watch_buffer();
+
+        //writer: the frame to fill & publishing it
+        [[nodiscard]] struct watch_frame & get_back() noexcept;
+        void publish() noexcept;
+
+        //reader: the latest published frame
+        [[nodiscard]] const struct watch_frame & acquire() noexcept;
+
+        //discard every frame, only while neither side is active
+        void clear();
+};
+
+
+//thread, freezes & scratch space of a watch list
+class _watch_state {
+
+    public:
+        //[attributes]
+        //refresh thread, `stopping` is guarded by `stop_mutex`
+        pthread_t thread;
+        bool running;
+        bool stopping;
+        pthread_mutex_t stop_mutex;
+        pthread_cond_t stop_cond;
+
+        sc::opt * opts_p;
+        const mc_session * session;
+        enum addr_width addr_width;
+        struct timespec interval;
+
+        //freezes set by the user, taken by the next refresh
+        pthread_mutex_t freeze_mutex;
+        std::atomic<bool> freeze_dirty;
+        std::vector<std::optional<std::vector<cm_byte>>> pending;
+        std::vector<std::optional<std::vector<cm_byte>>> frozen;
+
+        //scratch space of a refresh
+        _batch_reader reader;
+        std::vector<uintptr_t> addrs;
+        std::vector<cm_byte> alive;
+        std::vector<size_t> read_idxs;
+        std::vector<uintptr_t> ptrs;
+        std::vector<cm_byte> ok;
+        std::vector<cm_byte> bytes;
+        uint64_t seq;
+
+        //[methods]
+        _watch_state();
+        ~_watch_state();
+};
+
+
+}; //namespace sc
+
@@ -18,6 +18,10 @@ const constexpr useconds_t thread_wait_usec_time = 100000;
 
 //test files
 const constexpr char * test_file = "testfile.sc";
+const constexpr char * test_filter_file = "testfile_filter.sc";
+const constexpr char * test_ckpt_file = "testfile.ckpt";
+const constexpr char * test_spill_file = "testfile.spill";
+const constexpr char * test_merge_file = "testfile_merge.sc";
 
 
 extern bool use_colour;
@@ -49,6 +49,70 @@ void add_c_opt_ptr(doctest::Context & context) {
 }
 
 
+//add C++ interface `opt_val` class tests
+void add_cc_opt_val(doctest::Context & context) {
+    _add_filters(test_cc_opt_val_subtests,
+                 test_cc_opt_val_subtests_num, context);
+    return;
+}
+
+
+//add C interface `opt_val` class tests
+void add_c_opt_val(doctest::Context & context) {
+    _add_filters(test_c_opt_val_subtests,
+                 test_c_opt_val_subtests_num, context);
+    return;
+}
+
+
+//add C++ interface `opt_ptn` class tests
+void add_cc_opt_ptn(doctest::Context & context) {
+    _add_filters(test_cc_opt_ptn_subtests,
+                 test_cc_opt_ptn_subtests_num, context);
+    return;
+}
+
+
+//add C interface `opt_ptn` class tests
+void add_c_opt_ptn(doctest::Context & context) {
+    _add_filters(test_c_opt_ptn_subtests,
+                 test_c_opt_ptn_subtests_num, context);
+    return;
+}
+
+
+//add C++ interface `opt_str` class tests
+void add_cc_opt_str(doctest::Context & context) {
+    _add_filters(test_cc_opt_str_subtests,
+                 test_cc_opt_str_subtests_num, context);
+    return;
+}
+
+
+//add C interface `opt_str` class tests
+void add_c_opt_str(doctest::Context & context) {
+    _add_filters(test_c_opt_str_subtests,
+                 test_c_opt_str_subtests_num, context);
+    return;
+}
+
+
+//add C++ interface `opt_struct` class tests
+void add_cc_opt_struct(doctest::Context & context) {
+    _add_filters(test_cc_opt_struct_subtests,
+                 test_cc_opt_struct_subtests_num, context);
+    return;
+}
+
+
+//add C interface `opt_struct` class tests
+void add_c_opt_struct(doctest::Context & context) {
+    _add_filters(test_c_opt_struct_subtests,
+                 test_c_opt_struct_subtests_num, context);
+    return;
+}
+
+
 //add C++ interface `map_area_set` tests
 void add_cc_map_area_set(doctest::Context & context) {
     _add_filters(test_cc_map_area_set_subtests,
@@ -111,3 +175,51 @@ void add_c_ptrscan(doctest::Context & context) {
                  test_c_ptrscan_subtests_num, context);
     return;
 }
+
+
+//add C++ interface `valscan` tests
+void add_cc_valscan(doctest::Context & context) {
+    _add_filters(test_cc_valscan_subtests,
+                 test_cc_valscan_subtests_num, context);
+    return;
+}
+
+
+//add C++ interface `ptnscan` tests
+void add_cc_ptnscan(doctest::Context & context) {
+    _add_filters(test_cc_ptnscan_subtests,
+                 test_cc_ptnscan_subtests_num, context);
+    return;
+}
+
+
+//add C++ interface `strscan` tests
+void add_cc_strscan(doctest::Context & context) {
+    _add_filters(test_cc_strscan_subtests,
+                 test_cc_strscan_subtests_num, context);
+    return;
+}
+
+
+//add C++ interface `structscan` tests
+void add_cc_structscan(doctest::Context & context) {
+    _add_filters(test_cc_structscan_subtests,
+                 test_cc_structscan_subtests_num, context);
+    return;
+}
+
+
+//add C++ interface `watch_list` tests
+void add_cc_watch(doctest::Context & context) {
+    _add_filters(test_cc_watch_subtests,
+                 test_cc_watch_subtests_num, context);
+    return;
+}
+
+
+//add C interface `watch_list` tests
+void add_c_watch(doctest::Context & context) {
+    _add_filters(test_c_watch_subtests,
+                 test_c_watch_subtests_num, context);
+    return;
+}
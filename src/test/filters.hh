@@ -9,7 +9,7 @@
  */
 
 //C++ interface opt class tests
-inline const constexpr int test_cc_opt_subtests_num = 13;
+inline const constexpr int test_cc_opt_subtests_num = 14;
 inline const constexpr char * test_cc_opt_subtests[] = {
     "test_cc_opt",
     "test_cc_opt_file_path_out",
@@ -23,12 +23,13 @@ inline const constexpr char * test_cc_opt_subtests[] = {
     "test_cc_opt_omit_addr_range",
     "test_cc_opt_exclusive_addr_range",
     "test_cc_opt_access",
+    "test_cc_opt_pid",
     "test_cc_opt_reset"
 };
 
 
 //C interface opt class tests
-inline const constexpr int test_c_opt_subtests_num = 13;
+inline const constexpr int test_c_opt_subtests_num = 14;
 inline const constexpr char * test_c_opt_subtests[] = {
     "test_c_sc_opt",
     "test_c_sc_opt_file_path_out",
@@ -43,12 +44,13 @@ inline const constexpr char * test_c_opt_subtests[] = {
     "test_c_sc_opt_omit_addr_range",
     "test_c_sc_opt_exclusive_addr_range",
     "test_c_sc_opt_access",
+    "test_c_sc_opt_pid",
     "test_c_sc_opt_reset"
 };
 
 
 //C++ interface opt_ptr class tests
-inline const constexpr int test_cc_opt_ptr_subtests_num = 9;
+inline const constexpr int test_cc_opt_ptr_subtests_num = 19;
 inline const constexpr char * test_cc_opt_ptr_subtests[] = {
     "test_cc_opt_ptr",
     "test_cc_opt_ptr_target_addr",
@@ -58,12 +60,22 @@ inline const constexpr char * test_cc_opt_ptr_subtests[] = {
     "test_cc_opt_ptr_static_areas",
     "test_cc_opt_ptr_preset_offsets",
     "test_cc_opt_ptr_smart_scan",
+    "test_cc_opt_ptr_target_addrs",
+    "test_cc_opt_ptr_max_chains",
+    "test_cc_opt_ptr_max_level_nodes",
+    "test_cc_opt_ptr_max_children",
+    "test_cc_opt_ptr_bidirectional",
+    "test_cc_opt_ptr_checkpoint_path",
+    "test_cc_opt_ptr_spill_path",
+    "test_cc_opt_ptr_max_neg_off",
+    "test_cc_opt_ptr_prefer_static",
+    "test_cc_opt_ptr_max_array_run",
     "test_cc_opt_ptr_reset"
 };
 
 
 //C interface opt_ptr class tests
-inline const constexpr int test_c_opt_ptr_subtests_num = 9;
+inline const constexpr int test_c_opt_ptr_subtests_num = 19;
 inline const constexpr char * test_c_opt_ptr_subtests[] = {
     "test_c_sc_opt_ptr",
     "test_c_sc_opt_ptr_target_addr",
@@ -73,10 +85,115 @@ inline const constexpr char * test_c_opt_ptr_subtests[] = {
     "test_c_sc_opt_ptr_static_areas",
     "test_c_sc_opt_ptr_preset_offsets",
     "test_c_sc_opt_ptr_smart_scan",
+    "test_c_sc_opt_ptr_target_addrs",
+    "test_c_sc_opt_ptr_max_chains",
+    "test_c_sc_opt_ptr_max_level_nodes",
+    "test_c_sc_opt_ptr_max_children",
+    "test_c_sc_opt_ptr_bidirectional",
+    "test_c_sc_opt_ptr_checkpoint_path",
+    "test_c_sc_opt_ptr_spill_path",
+    "test_c_sc_opt_ptr_max_neg_off",
+    "test_c_sc_opt_ptr_prefer_static",
+    "test_c_sc_opt_ptr_max_array_run",
     "test_c_sc_opt_ptr_reset"
 };
 
 
+//C++ interface opt_val class tests
+inline const constexpr int test_cc_opt_val_subtests_num = 9;
+inline const constexpr char * test_cc_opt_val_subtests[] = {
+    "test_cc_opt_val",
+    "test_cc_opt_val_type",
+    "test_cc_opt_val_alignment",
+    "test_cc_opt_val_value",
+    "test_cc_opt_val_predicate",
+    "test_cc_opt_val_value_hi",
+    "test_cc_opt_val_round",
+    "test_cc_opt_val_epsilon",
+    "test_cc_opt_val_reset"
+};
+
+
+//C interface opt_val class tests
+inline const constexpr int test_c_opt_val_subtests_num = 9;
+inline const constexpr char * test_c_opt_val_subtests[] = {
+    "test_c_sc_opt_val",
+    "test_c_sc_opt_val_type",
+    "test_c_sc_opt_val_alignment",
+    "test_c_sc_opt_val_value",
+    "test_c_sc_opt_val_predicate",
+    "test_c_sc_opt_val_value_hi",
+    "test_c_sc_opt_val_round",
+    "test_c_sc_opt_val_epsilon",
+    "test_c_sc_opt_val_reset"
+};
+
+
+//C++ interface opt_ptn class tests
+inline const constexpr int test_cc_opt_ptn_subtests_num = 6;
+inline const constexpr char * test_cc_opt_ptn_subtests[] = {
+    "test_cc_opt_ptn",
+    "test_cc_opt_ptn_pattern",
+    "test_cc_opt_ptn_mask",
+    "test_cc_opt_ptn_pattern_str",
+    "test_cc_opt_ptn_reset",
+    "test_cc_opt_ptn_signatures"
+};
+
+
+//C interface opt_ptn class tests
+inline const constexpr int test_c_opt_ptn_subtests_num = 5;
+inline const constexpr char * test_c_opt_ptn_subtests[] = {
+    "test_c_sc_opt_ptn",
+    "test_c_sc_opt_ptn_pattern",
+    "test_c_sc_opt_ptn_mask",
+    "test_c_sc_opt_ptn_pattern_str",
+    "test_c_sc_opt_ptn_reset"
+};
+
+
+//C++ interface opt_str class tests
+inline const constexpr int test_cc_opt_str_subtests_num = 6;
+inline const constexpr char * test_cc_opt_str_subtests[] = {
+    "test_cc_opt_str",
+    "test_cc_opt_str_str",
+    "test_cc_opt_str_encodings",
+    "test_cc_opt_str_case_insensitive",
+    "test_cc_opt_str_null_term",
+    "test_cc_opt_str_reset"
+};
+
+
+//C interface opt_str class tests
+inline const constexpr int test_c_opt_str_subtests_num = 4;
+inline const constexpr char * test_c_opt_str_subtests[] = {
+    "test_c_sc_opt_str",
+    "test_c_sc_opt_str_str",
+    "test_c_sc_opt_str_encodings",
+    "test_c_sc_opt_str_reset"
+};
+
+
+//C++ interface opt_struct class tests
+inline const constexpr int test_cc_opt_struct_subtests_num = 4;
+inline const constexpr char * test_cc_opt_struct_subtests[] = {
+    "test_cc_opt_struct",
+    "test_cc_opt_struct_fields",
+    "test_cc_opt_struct_alignment",
+    "test_cc_opt_struct_reset"
+};
+
+
+//C interface opt_struct class tests
+inline const constexpr int test_c_opt_struct_subtests_num = 4;
+inline const constexpr char * test_c_opt_struct_subtests[] = {
+    "test_c_sc_opt_struct",
+    "test_c_sc_opt_struct_fields",
+    "test_c_sc_opt_struct_alignment",
+    "test_c_sc_opt_struct_reset"
+};
+
+
 //C++ interface map_area_set class tests
 inline const constexpr int test_cc_map_area_set_subtests_num = 6;
 inline const constexpr char * test_cc_map_area_set_subtests[] = {
@@ -120,11 +237,12 @@ inline const constexpr char * test_c_worker_pool_subtests[] = {
 
 
 //C++ interface serialiser tests
-inline const constexpr int test_cc_serialiser_subtests_num = 3;
+inline const constexpr int test_cc_serialiser_subtests_num = 4;
 inline const constexpr char * test_cc_serialiser_subtests[] = {
     "test_cc_serialiser",
     "test_cc_serialiser_save_load_scan",
-    "test_cc_serialiser_read_headers"
+    "test_cc_serialiser_read_headers",
+    "test_cc_serialiser_no_result"
 };
 
 
@@ -138,13 +256,26 @@ inline const constexpr char * test_c_serialiser_subtests[] = {
 
 
 //C++ interface ptrscan tests
-inline const constexpr int test_cc_ptrscan_subtests_num = 5;
+inline const constexpr int test_cc_ptrscan_subtests_num = 18;
 inline const constexpr char * test_cc_ptrscan_subtests[] = {
     "test_cc_ptrscan",
     "test_cc_ptrscan_scan",
     "test_cc_ptrscan_scan_threaded",
     "test_cc_ptrscan_save_load",
     "test_cc_ptrscan_verify",
+    "test_cc_ptrscan_multi_target",
+    "test_cc_ptrscan_filter",
+    "test_cc_ptrscan_limits",
+    "test_cc_ptrscan_bidirectional",
+    "test_cc_ptrscan_checkpoint",
+    "test_cc_ptrscan_spill",
+    "test_cc_ptrscan_neg_offsets",
+    "test_cc_ptrscan_stability",
+    "test_cc_ptrscan_intersect",
+    "test_cc_ptrscan_pruning_policies",
+    "test_cc_ptrscan_ptr_index",
+    "test_cc_ptrscan_obj_index",
+    "test_cc_ptrscan_pathnames"
 };
 
 
@@ -159,6 +290,77 @@ inline const constexpr char * test_c_ptrscan_subtests[] = {
 
 
 
+//C++ interface valscan tests
+inline const constexpr int test_cc_valscan_subtests_num = 10;
+inline const constexpr char * test_cc_valscan_subtests[] = {
+    "test_cc_valscan",
+    "test_cc_valscan_scan",
+    "test_cc_valscan_types",
+    "test_cc_valscan_bad_opts",
+    "test_cc_valscan_next_scan",
+    "test_cc_valscan_candidate_sets",
+    "test_cc_valscan_unknown_value",
+    "test_cc_valscan_ranges",
+    "test_cc_valscan_save_load",
+    "test_cc_valscan_alignment"
+};
+
+
+//C++ interface ptnscan tests
+inline const constexpr int test_cc_ptnscan_subtests_num = 7;
+inline const constexpr char * test_cc_ptnscan_subtests[] = {
+    "test_cc_ptnscan",
+    "test_cc_ptnscan_scan",
+    "test_cc_ptnscan_buffer_seam",
+    "test_cc_ptnscan_nibbles",
+    "test_cc_ptnscan_bad_opts",
+    "test_cc_ptnscan_signatures",
+    "test_cc_ptnscan_save_load"
+};
+
+
+//C++ interface strscan tests
+inline const constexpr int test_cc_strscan_subtests_num = 5;
+inline const constexpr char * test_cc_strscan_subtests[] = {
+    "test_cc_strscan",
+    "test_cc_strscan_scan",
+    "test_cc_strscan_case_insensitive",
+    "test_cc_strscan_bad_opts",
+    "test_cc_strscan_save_load"
+};
+
+
+//C++ interface structscan tests
+inline const constexpr int test_cc_structscan_subtests_num = 5;
+inline const constexpr char * test_cc_structscan_subtests[] = {
+    "test_cc_structscan",
+    "test_cc_structscan_scan",
+    "test_cc_structscan_ptr_fields",
+    "test_cc_structscan_ranges",
+    "test_cc_structscan_bad_opts"
+};
+
+
+//C++ interface watch list tests
+inline const constexpr int test_cc_watch_subtests_num = 5;
+inline const constexpr char * test_cc_watch_subtests[] = {
+    "test_cc_watch",
+    "test_cc_watch_refresh",
+    "test_cc_watch_freeze",
+    "test_cc_watch_thread",
+    "test_cc_watch_bad_opts"
+};
+
+
+//C interface watch list tests
+inline const constexpr int test_c_watch_subtests_num = 2;
+inline const constexpr char * test_c_watch_subtests[] = {
+    "test_c_watch",
+    "test_c_watch_wrappers"
+};
+
+
+
 /*
  *  --- [FILTER FUNCTIONS] ---
  */
@@ -169,6 +371,18 @@ void add_c_opt(doctest::Context & context);
 void add_cc_opt_ptr(doctest::Context & context);
 void add_c_opt_ptr(doctest::Context & context);
 
+void add_cc_opt_val(doctest::Context & context);
+void add_c_opt_val(doctest::Context & context);
+
+void add_cc_opt_ptn(doctest::Context & context);
+void add_c_opt_ptn(doctest::Context & context);
+
+void add_cc_opt_str(doctest::Context & context);
+void add_c_opt_str(doctest::Context & context);
+
+void add_cc_opt_struct(doctest::Context & context);
+void add_c_opt_struct(doctest::Context & context);
+
 void add_cc_map_area_set(doctest::Context & context);
 void add_c_map_area_set(doctest::Context & context);
 
@@ -180,3 +394,14 @@ void add_c_serialiser(doctest::Context & context);
 
 void add_cc_ptrscan(doctest::Context & context);
 void add_c_ptrscan(doctest::Context & context);
+
+void add_cc_valscan(doctest::Context & context);
+
+void add_cc_ptnscan(doctest::Context & context);
+
+void add_cc_strscan(doctest::Context & context);
+
+void add_cc_structscan(doctest::Context & context);
+
+void add_cc_watch(doctest::Context & context);
+void add_c_watch(doctest::Context & context);
@@ -24,22 +24,36 @@
 
 
 //tests bitmask
-const constexpr uint16_t cc_opt_test          = 1 << 0;
-const constexpr uint16_t c_opt_test           = 1 << 1;
-const constexpr uint16_t cc_opt_ptrscan_test  = 1 << 2;
-const constexpr uint16_t c_opt_ptrscan_test   = 1 << 3;
-const constexpr uint16_t cc_map_area_set_test = 1 << 4;
-const constexpr uint16_t c_map_area_set_test  = 1 << 5;
-const constexpr uint16_t cc_worker_pool_test  = 1 << 6;
-const constexpr uint16_t c_worker_pool_test   = 1 << 7;
-const constexpr uint16_t cc_serialiser_test   = 1 << 8;
-const constexpr uint16_t c_serialiser_test    = 1 << 9;
-const constexpr uint16_t cc_ptrscan_test      = 1 << 10;
-const constexpr uint16_t c_ptrscan_test       = 1 << 11;
+const constexpr uint32_t cc_opt_test          = 1 << 0;
+const constexpr uint32_t c_opt_test           = 1 << 1;
+const constexpr uint32_t cc_opt_ptrscan_test  = 1 << 2;
+const constexpr uint32_t c_opt_ptrscan_test   = 1 << 3;
+const constexpr uint32_t cc_map_area_set_test = 1 << 4;
+const constexpr uint32_t c_map_area_set_test  = 1 << 5;
+const constexpr uint32_t cc_worker_pool_test  = 1 << 6;
+const constexpr uint32_t c_worker_pool_test   = 1 << 7;
+const constexpr uint32_t cc_serialiser_test   = 1 << 8;
+const constexpr uint32_t c_serialiser_test    = 1 << 9;
+const constexpr uint32_t cc_ptrscan_test      = 1 << 10;
+const constexpr uint32_t c_ptrscan_test       = 1 << 11;
+const constexpr uint32_t cc_opt_valscan_test  = 1 << 12;
+const constexpr uint32_t c_opt_valscan_test   = 1 << 13;
+const constexpr uint32_t cc_valscan_test      = 1 << 14;
+const constexpr uint32_t cc_opt_ptnscan_test  = 1 << 15;
+const constexpr uint32_t c_opt_ptnscan_test   = 1 << 16;
+const constexpr uint32_t cc_ptnscan_test      = 1 << 17;
+const constexpr uint32_t cc_opt_strscan_test  = 1 << 18;
+const constexpr uint32_t c_opt_strscan_test   = 1 << 19;
+const constexpr uint32_t cc_strscan_test      = 1 << 20;
+const constexpr uint32_t cc_opt_structscan_test = 1 << 21;
+const constexpr uint32_t c_opt_structscan_test  = 1 << 22;
+const constexpr uint32_t cc_structscan_test     = 1 << 23;
+const constexpr uint32_t cc_watch_test          = 1 << 24;
+const constexpr uint32_t c_watch_test           = 1 << 25;
 
 
 //determine which tests to run
-static uint16_t _get_test_mode(int argc, char ** argv) {
+static uint32_t _get_test_mode(int argc, char ** argv) {
 
     const struct option long_opts[] = {
         {"colour", no_argument, NULL, 'c'},
@@ -56,14 +70,28 @@ static uint16_t _get_test_mode(int argc, char ** argv) {
         {"c-serialiser", no_argument, NULL, 'R'},
         {"cc-ptrscan", no_argument, NULL, 'q'},
         {"c-ptrscan", no_argument, NULL, 'Q'},
+        {"cc-opt_val", no_argument, NULL, 'v'},
+        {"c-opt_val", no_argument, NULL, 'V'},
+        {"cc-valscan", no_argument, NULL, 'l'},
+        {"cc-opt_ptn", no_argument, NULL, 't'},
+        {"c-opt_ptn", no_argument, NULL, 'T'},
+        {"cc-ptnscan", no_argument, NULL, 'n'},
+        {"cc-opt_str", no_argument, NULL, 'x'},
+        {"c-opt_str", no_argument, NULL, 'X'},
+        {"cc-strscan", no_argument, NULL, 'g'},
+        {"cc-opt_struct", no_argument, NULL, 'k'},
+        {"c-opt_struct", no_argument, NULL, 'K'},
+        {"cc-structscan", no_argument, NULL, 'u'},
+        {"cc-watch", no_argument, NULL, 'h'},
+        {"c-watch", no_argument, NULL, 'H'},
         {0,0,0,0}
     };
 
     int opt;
-    uint16_t test_mask = 0;
+    uint32_t test_mask = 0;
 
     
-    while((opt = getopt_long(argc, argv, "caoOpPsSwWrRqQ", long_opts, NULL)) != -1 && opt != 0) {
+    while((opt = getopt_long(argc, argv, "caoOpPsSwWrRqQvVltTnxXgkKuhH", long_opts, NULL)) != -1 && opt != 0) {
 
         //determine parsed argument
         switch (opt) {
@@ -73,7 +101,7 @@ static uint16_t _get_test_mode(int argc, char ** argv) {
                 break;
 
             case 'a':
-                test_mask = UINT16_MAX;
+                test_mask = UINT32_MAX;
                 break;
 
             case 'o':
@@ -123,6 +151,62 @@ static uint16_t _get_test_mode(int argc, char ** argv) {
             case 'Q':
                 test_mask |= c_ptrscan_test;
                 break;
+
+            case 'v':
+                test_mask |= cc_opt_valscan_test;
+                break;
+
+            case 'V':
+                test_mask |= c_opt_valscan_test;
+                break;
+
+            case 'l':
+                test_mask |= cc_valscan_test;
+                break;
+
+            case 't':
+                test_mask |= cc_opt_ptnscan_test;
+                break;
+
+            case 'T':
+                test_mask |= c_opt_ptnscan_test;
+                break;
+
+            case 'n':
+                test_mask |= cc_ptnscan_test;
+                break;
+
+            case 'x':
+                test_mask |= cc_opt_strscan_test;
+                break;
+
+            case 'X':
+                test_mask |= c_opt_strscan_test;
+                break;
+
+            case 'g':
+                test_mask |= cc_strscan_test;
+                break;
+
+            case 'k':
+                test_mask |= cc_opt_structscan_test;
+                break;
+
+            case 'K':
+                test_mask |= c_opt_structscan_test;
+                break;
+
+            case 'u':
+                test_mask |= cc_structscan_test;
+                break;
+
+            case 'h':
+                test_mask |= cc_watch_test;
+                break;
+
+            case 'H':
+                test_mask |= c_watch_test;
+                break;
         }
     }
 
@@ -131,7 +215,7 @@ static uint16_t _get_test_mode(int argc, char ** argv) {
 
 
 //run unit tests
-static void _run_unit_tests(uint16_t test_mask) {
+static void _run_unit_tests(uint32_t test_mask) {
 
     int ret;
     doctest::Context context;
@@ -150,6 +234,20 @@ static void _run_unit_tests(uint16_t test_mask) {
     if (test_mask & c_serialiser_test) add_c_serialiser(context);
     if (test_mask & cc_ptrscan_test) add_cc_ptrscan(context);
     if (test_mask & c_ptrscan_test) add_c_ptrscan(context);
+    if (test_mask & cc_opt_valscan_test) add_cc_opt_val(context);
+    if (test_mask & c_opt_valscan_test)  add_c_opt_val(context);
+    if (test_mask & cc_valscan_test) add_cc_valscan(context);
+    if (test_mask & cc_opt_ptnscan_test) add_cc_opt_ptn(context);
+    if (test_mask & c_opt_ptnscan_test)  add_c_opt_ptn(context);
+    if (test_mask & cc_ptnscan_test) add_cc_ptnscan(context);
+    if (test_mask & cc_opt_strscan_test) add_cc_opt_str(context);
+    if (test_mask & c_opt_strscan_test)  add_c_opt_str(context);
+    if (test_mask & cc_strscan_test) add_cc_strscan(context);
+    if (test_mask & cc_opt_structscan_test) add_cc_opt_struct(context);
+    if (test_mask & c_opt_structscan_test)  add_c_opt_struct(context);
+    if (test_mask & cc_structscan_test) add_cc_structscan(context);
+    if (test_mask & cc_watch_test) add_cc_watch(context);
+    if (test_mask & c_watch_test)  add_c_watch(context);
 
     //run selected tests
     ret = context.run();
@@ -165,7 +263,7 @@ int main(int argc, char ** argv) {
     use_colour = false;
 
     //setup & run tests
-    uint16_t test_mask = _get_test_mode(argc, argv);
+    uint32_t test_mask = _get_test_mode(argc, argv);
     _run_unit_tests(test_mask);
     
     return 0;
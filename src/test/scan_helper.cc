@@ -167,12 +167,12 @@ void _scan_helper::hexdump(cm_byte * buf, size_t sz) {
 
 [[nodiscard]] int _scan_helper::_fixture_scan::_process_body(
     const std::vector<cm_byte> & buf, off_t hdr_off,
-    const mc_vm_map & map) {
+    const cm_byte version, const mc_vm_map & map) {
 
     int ret;
 
     //call into the shallow handler
-    ret = this->_read_body(buf, hdr_off);
+    ret = this->_read_body(buf, hdr_off, version);
     CHECK_EQ(ret, 0);
     
     return 0;
@@ -180,7 +180,7 @@ void _scan_helper::hexdump(cm_byte * buf, size_t sz) {
 
 
 [[nodiscard]] int _scan_helper::_fixture_scan::_read_body(
-    const std::vector<cm_byte> & buf, off_t hdr_off) {
+    const std::vector<cm_byte> & buf, off_t hdr_off, const cm_byte version) {
 
     int ret;
     struct sc::ptr_file_hdr * ptrscan_hdr;
@@ -58,9 +58,10 @@ class _fixture_scan : public sc::_scan {
                 std::vector<cm_byte> & buf, off_t hdr_off);
         /* internal */ [[nodiscard]] virtual int _process_body(
                 const std::vector<cm_byte> & buf, off_t hdr_off,
-                const mc_vm_map & map);
+                const cm_byte version, const mc_vm_map & map);
         /* internal */ [[nodiscard]] virtual int _read_body(
-                const std::vector<cm_byte> & buf, off_t hdr_off);
+                const std::vector<cm_byte> & buf, off_t hdr_off,
+                const cm_byte version);
 
         _fixture_scan() : expected_byte(0), read_off(0), mod(1) {}
         void set_mod(int mod) { this->mod = mod; }
@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
+#include <uchar.h>
 #include <fcntl.h>
 #include <signal.h>
 
@@ -133,6 +134,9 @@ void map_pattern_files() {
 //main
 int main(int argc, char ** argv) {
 
+    //UTF-16 preset string, kept out of `.data` to not shift the globals
+    const char16_t * title = u"Unit Target";
+
     //check correct number of args is provided (quiet -Wunused-parameter)
     if (argc != 2) return -1;
 
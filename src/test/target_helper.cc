@@ -101,6 +101,23 @@ pid_t _target_helper::start_target() {
 }
 
 
+void _target_helper::change_target(pid_t pid) {
+
+    int ret;
+
+
+    //the target replies with SIGUSR1 once its players are modified
+    target_state = _target_helper::UNINIT;
+
+    ret = kill(pid, SIGUSR1);
+    CHECK_EQ(ret, 0);
+
+    while (target_state == _target_helper::UNINIT) {}
+
+    return;
+}
+
+
 void _target_helper::end_target(pid_t pid) {
 
     int ret;
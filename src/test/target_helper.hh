@@ -35,6 +35,7 @@ const constexpr size_t pattern_2_sz = 0x2000;
 //target helpers
 int clean_targets();
 pid_t start_target();
+void change_target(pid_t pid);
 void end_target(pid_t pid);
 
 }
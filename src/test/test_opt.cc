@@ -388,8 +388,19 @@ TEST_CASE(test_cc_opt_subtests[0]) {
     } //end test
 
 
-    //test 12: reset
+    //test 12: set & get `pid`
     SUBCASE(test_cc_opt_subtests[12]) {
+        title(CC, "opt", "Set & get `pid`");
+
+        std::optional<pid_t> pid = getpid();
+        _cc_opt_val_test<sc::opt, pid_t>(o, pid,
+                    &sc::opt::set_pid, &sc::opt::get_pid);
+
+    } //end test
+
+
+    //test 13: reset
+    SUBCASE(test_cc_opt_subtests[13]) {
 
         /*
          *  TODO Implement.
@@ -556,642 +567,1883 @@ TEST_CASE(test_cc_opt_ptr_subtests[0]) {
     } //end test
 
 
-    //test 8: reset
+    //test 8: set & get `target_addrs`
     SUBCASE(test_cc_opt_ptr_subtests[8]) {
+        title(CC, "opt_ptr", "Set & get `target_addrs`");
 
-        //TODO: Implement.
+        std::vector<uintptr_t> target_addrs = {
+            0x1000,
+            0x2000,
+            0x3000
+        };
 
-    }
+        _cc_vector_test<sc::opt_ptr, uintptr_t>(
+                            o, target_addrs,
+                            &sc::opt_ptr::set_target_addrs,
+                            &sc::opt_ptr::get_target_addrs);
 
-    return;
+    } //end test
 
-} //end TEST_CASE 
 
+    //test 9: set & get `max_chains`
+    SUBCASE(test_cc_opt_ptr_subtests[9]) {
+        title(CC, "opt_ptr", "Set & get `max_chains`");
 
+        _cc_opt_val_test<sc::opt_ptr, size_t>(
+                            o, 0x100,
+                            &sc::opt_ptr::set_max_chains,
+                            &sc::opt_ptr::get_max_chains);
 
+    } //end test
 
-      /* =================== * 
- ===== *  C INTERFACE TESTS  * =====
-       * =================== */
 
-/*
- *  --- [HELPERS] ---
- */
+    //test 10: set & get `max_level_nodes`
+    SUBCASE(test_cc_opt_ptr_subtests[10]) {
+        title(CC, "opt_ptr", "Set & get `max_level_nodes`");
 
-//test setting & getting a value
-template <typename O, typename T>
-static void _c_val_test(void * o, T v,
-                        int (* set)(O o, const T v),
-                        T (* get)(const O o),
-                        std::optional<
-                            std::function<bool(T v_1, T v_2)>> compare_fn) {
-                            
-    int ret;
-    T ret_val;
+        _cc_opt_val_test<sc::opt_ptr, size_t>(
+                            o, 0x100,
+                            &sc::opt_ptr::set_max_level_nodes,
+                            &sc::opt_ptr::get_max_level_nodes);
 
+    } //end test
 
-    /* first test: typical use-case */
 
-    //call setter
-    ret = (*set)(o, v);
-    CHECK_EQ(ret, 0);
+    //test 11: set & get `max_children`
+    SUBCASE(test_cc_opt_ptr_subtests[11]) {
+        title(CC, "opt_ptr", "Set & get `max_children`");
 
-    //call getter again to assert the attribute was set
-    ret_val = (*get)(o);
-    if (compare_fn.has_value() == true) {
-        compare_fn.value()(ret_val, v);
-    } else {
-        CHECK(ret_val == v);
-    }
+        _cc_opt_val_test<sc::opt_ptr, size_t>(
+                            o, 0x10,
+                            &sc::opt_ptr::set_max_children,
+                            &sc::opt_ptr::get_max_children);
 
-    //cleanup before next test
-    sc_errno = 0;
+    } //end test
 
-    return;
-}
 
+    //test 12: set & get `bidirectional`
+    SUBCASE(test_cc_opt_ptr_subtests[12]) {
+        title(CC, "opt_ptr", "Set & get `bidirectional`");
 
-//test setting & getting an optional
-template <typename O, typename T>
-static void _c_opt_test(void * o, T v, T v_nullopt,
-                        int (* set)(O o, const T v),
-                        T (* get)(const O o),
-                        std::optional<
-                            std::function<bool(T v_1, T v_2)>> compare_fn) {
-  
-    int ret;
-    T ret_opt;
+        _cc_val_test<sc::opt_ptr, bool>(
+                            o, true,
+                            &sc::opt_ptr::set_bidirectional,
+                            &sc::opt_ptr::get_bidirectional);
 
+    } //end test
 
-    /* first test: typical use-case */
 
-    //call getter before attribute is set
-    ret_opt = (*get)(o);
-    CHECK_EQ(ret_opt, v_nullopt);
+    //test 13: set & get `checkpoint_path`
+    SUBCASE(test_cc_opt_ptr_subtests[13]) {
+        title(CC, "opt_ptr", "Set & get `checkpoint_path`");
 
-    //call setter
-    ret = (*set)(o, v);
-    CHECK_EQ(ret, 0);
+        std::optional<std::string> path  = "/foo/bar";
+        _cc_opt_ref_test<sc::opt_ptr, std::string>(
+            o, path, &sc::opt_ptr::set_checkpoint_path,
+            &sc::opt_ptr::get_checkpoint_path);
 
-    //call getter again to assert the attribute was set
-    ret_opt = (*get)(o);
-    if (compare_fn.has_value() == true) {
-        compare_fn.value()(ret_opt, v);
-    } else {
-        CHECK(ret_opt == v);
-    }
+    } //end test
 
-    //cleanup before next test
-    sc_errno = 0;
 
+    //test 14: set & get `spill_path`
+    SUBCASE(test_cc_opt_ptr_subtests[14]) {
+        title(CC, "opt_ptr", "Set & get `spill_path`");
 
-    /* second test: reset optional back to nullopt */
+        std::optional<std::string> path  = "/foo/bar";
+        _cc_opt_ref_test<sc::opt_ptr, std::string>(
+            o, path, &sc::opt_ptr::set_spill_path,
+            &sc::opt_ptr::get_spill_path);
 
-    //call setter with this attribute's nullopt C equivalent
-    ret = (*set)(o, v_nullopt);
-    CHECK_EQ(ret, 0);
+    } //end test
 
-    //try to get the attribute to check it's been set to nullopt correctly
-    ret_opt = (*get)(o);
-    CHECK_EQ(ret_opt, v_nullopt);
-    CHECK_EQ(sc_errno, SC_ERR_OPT_EMPTY);
 
-    return;
-}
+    //test 15: set & get `max_neg_off`
+    SUBCASE(test_cc_opt_ptr_subtests[15]) {
+        title(CC, "opt_ptr", "Set & get `max_neg_off`");
 
+        _cc_opt_val_test<sc::opt_ptr, off_t>(
+                            o, 0x40,
+                            &sc::opt_ptr::set_max_neg_off,
+                            &sc::opt_ptr::get_max_neg_off);
 
-//test setting & getting an optional vector attribute
-template <typename O, typename T>
-static void _c_vector_test(void * o, T * a, int a_len,
-                           int (* set)(O o, const cm_vct * v),
-                           int (* get)(const O o, cm_vct * v),
-                            std::optional<
-                                std::function<bool(T v_1, T v_2)>> compare_fn) {
+    } //end test
 
-    int ret;
 
-    T entry;
-    cm_vct vct_1, vct_2;
+    //test 16: set & get `prefer_static`
+    SUBCASE(test_cc_opt_ptr_subtests[16]) {
+        title(CC, "opt_ptr", "Set & get `prefer_static`");
 
+        _cc_val_test<sc::opt_ptr, bool>(
+                            o, true,
+                            &sc::opt_ptr::set_prefer_static,
+                            &sc::opt_ptr::get_prefer_static);
 
-    //construct a CMore vector to pass to the C interface call
-    ret = cm_new_vct(&vct_1, sizeof(T));
-    CHECK_EQ(ret, 0);
+    } //end test
+
+
+    //test 17: set & get `max_array_run`
+    SUBCASE(test_cc_opt_ptr_subtests[17]) {
+        title(CC, "opt_ptr", "Set & get `max_array_run`");
+
+        _cc_opt_val_test<sc::opt_ptr, size_t>(
+                            o, 0x4,
+                            &sc::opt_ptr::set_max_array_run,
+                            &sc::opt_ptr::get_max_array_run);
+
+    } //end test
+
+
+    //test 18: reset
+    SUBCASE(test_cc_opt_ptr_subtests[18]) {
+
+        //TODO: Implement.
 
-    //populate the newly created CMore vector
-    for (int i = 0; i < a_len; ++i) {
-        ret = cm_vct_apd(&vct_1, &a[i]);
-        CHECK_EQ(ret, 0);
     }
 
+    return;
 
-    /* first test: typical use-case */
+} //end TEST_CASE 
 
-    //try to get the unset optional
-    ret = get(o, &vct_2);
-    CHECK_EQ(ret, -1);
-    CHECK_EQ(sc_errno, SC_ERR_OPT_EMPTY);
 
-    //fill the optional with the previously constructed CMore vector
-    ret = set(o, &vct_1);
-    CHECK_EQ(ret, 0);
 
-    //call the getter again
-    ret = get(o, &vct_2);
-    CHECK_EQ(ret, 0);
-    CHECK_EQ(vct_2.len, a_len);
 
-    //check each element from the returned CMore vector is correct
-    for (int i = 0; i < a_len; ++i) {
-    
-        ret = cm_vct_get(&vct_2, i, &entry);
-        CHECK_EQ(ret, 0);
+/*
+ *  --- [TESTS - OPT_VAL] ---
+ */
 
-        if (compare_fn.has_value() == true) {
-            compare_fn.value()(entry, a[i]);
-        } else {
-            CHECK(std::memcmp(&entry, &a[i], sizeof(entry)) == 0);
-        }
-    } //end for
+TEST_CASE(test_cc_opt_val_subtests[0]) {
 
-    //cleanup before next test
-    cm_del_vct(&vct_2);
-    sc_errno = 0;
+    int ret;
 
 
-    /* second test: reset optional back to nullopt */
+    //test 0: construct opt_val classes
 
-    //call setter with this attribute's nullopt C equivalent
-    ret = set(o, nullptr);
-    CHECK_EQ(ret, 0);
+    //call regular constructor
+    sc::opt_val o;
 
-    //try to get the attribute to check it's been set to nullopt correctly
-    ret = get(o, &vct_2);
-    CHECK_EQ(ret, -1);
-    CHECK_EQ(sc_errno, SC_ERR_OPT_EMPTY);
+    //apply lock to check copy & move constructors reset it
+    ret = o._lock();
+    CHECK_EQ(ret, 0);
 
-    //cleanup
-    cm_del_vct(&vct_1);
+    //call copy & move constructors
+    sc::opt_val o_copy(o);
+    CHECK_EQ(o_copy._get_lock(), false);
+    sc::opt_val o_move(std::move(o));
+    CHECK_EQ(o_move._get_lock(), false);
 
-    return;
-}
+    //reset lock
+    ret = o._unlock();
+    CHECK_EQ(ret, 0);
 
 
-/*
- *  --- [TESTS - OPT] ---
- */
+    //test 1: set & get `type`
+    SUBCASE(test_cc_opt_val_subtests[1]) {
+        title(CC, "opt_val", "Set & get `type`");
 
-TEST_CASE(test_c_opt_subtests[0]) {
+        _cc_opt_val_test<sc::opt_val, enum sc::val_type>(
+                            o, sc::VT_F32,
+                            &sc::opt_val::set_type,
+                            &sc::opt_val::get_type);
 
-    int ret;
-    sc_opt o, o_copy;
+    } //end test
 
 
-    //test 0: create sc_opts
+    //test 2: set & get `alignment`
+    SUBCASE(test_cc_opt_val_subtests[2]) {
+        title(CC, "opt_val", "Set & get `alignment`");
 
-    //call constructor
-    o = sc_new_opt(test_c_addr_width);
-    REQUIRE_NE(o, nullptr);
+        _cc_opt_val_test<sc::opt_val, off_t>(
+                            o, 0x4,
+                            &sc::opt_val::set_alignment,
+                            &sc::opt_val::get_alignment);
 
-    //call copy constructor
-    o_copy = sc_copy_opt(o);
-    REQUIRE_NE(o_copy, nullptr);
+    } //end test
 
 
-    //test 1: set & get `file_path_out`
-    SUBCASE(test_c_opt_subtests[1]) {
-        title(C, "sc_opt", "Set & get `file_path_out`");
+    //test 3: set & get `value`
+    SUBCASE(test_cc_opt_val_subtests[3]) {
+        title(CC, "opt_val", "Set & get `value`");
 
-        const char * path = "/foo/bar";
+        std::vector<cm_byte> v = {0x64, 0x00, 0x00, 0x00};
+        _cc_vector_test<sc::opt_val, cm_byte>(
+            o, v, &sc::opt_val::set_value, &sc::opt_val::get_value);
 
-        _c_opt_test<sc_opt, const char *>(
-                            o, path, nullptr,
-                            sc_opt_set_file_path_out,
-                            sc_opt_get_file_path_out,
-                            [](const char * s_1, const char * s_2) -> bool {
-                                
-                                std::string stl_s_1(s_1 == nullptr ? "" : s_1);
-                                std::string stl_s_2(s_2 == nullptr ? "" : s_2);
-                                return stl_s_1 == stl_s_2;
-                            });
     } //end test
 
 
-    //test 2: set & get `file_path_in`
-    SUBCASE(test_c_opt_subtests[2]) {
-        title(C, "sc_opt", "Set & get `file_path_in`");
+    //test 4: set & get `predicate`
+    SUBCASE(test_cc_opt_val_subtests[4]) {
+        title(CC, "opt_val", "Set & get `predicate`");
 
-        const char * path = "/foo/bar";
+        _cc_val_test<sc::opt_val, enum sc::val_pred>(
+                            o, sc::VP_INCREASED_BY,
+                            &sc::opt_val::set_predicate,
+                            &sc::opt_val::get_predicate);
+
+    } //end test
 
-        _c_opt_test<sc_opt, const char *>(
-                            o, path, nullptr,
-                            sc_opt_set_file_path_in,
-                            sc_opt_get_file_path_in,
-                            [](const char * s_1, const char * s_2) -> bool {
-                                std::string stl_s_1(s_1 == nullptr ? "" : s_1);
-                                std::string stl_s_2(s_2 == nullptr ? "" : s_2);
-                                return stl_s_1 == stl_s_2;
-                            });
+
+    //test 5: set & get `value_hi`
+    SUBCASE(test_cc_opt_val_subtests[5]) {
+        title(CC, "opt_val", "Set & get `value_hi`");
+
+        std::vector<cm_byte> v = {0xC8, 0x00, 0x00, 0x00};
+        _cc_vector_test<sc::opt_val, cm_byte>(
+            o, v, &sc::opt_val::set_value_hi, &sc::opt_val::get_value_hi);
 
     } //end test
 
 
-    //test 3: set & get `sessions`
-    SUBCASE(test_c_opt_subtests[3]) {
-        title(C, "sc_opt", "Set & get `sessions`");
+    //test 6: set & get `round`
+    SUBCASE(test_cc_opt_val_subtests[6]) {
+        title(CC, "opt_val", "Set & get `round`");
 
-        /*
-         *  Test implemented directly.
-         */
+        _cc_val_test<sc::opt_val, enum sc::val_round>(
+                            o, sc::VR_TRUNC,
+                            &sc::opt_val::set_round,
+                            &sc::opt_val::get_round);
 
-        cm_lst_node * a[3] = {
-            (cm_lst_node *) 0x10101010,
-            (cm_lst_node *) 0x20202020,
-            (cm_lst_node *) 0x30303030
-        };
+    } //end test
 
-        cm_lst_node * s;
-        cm_vct vct_1, vct_2;
 
+    //test 7: set & get `epsilon`
+    SUBCASE(test_cc_opt_val_subtests[7]) {
+        title(CC, "opt_val", "Set & get `epsilon`");
 
-        //construct a CMore vector to pass to the C interface call
-        ret = cm_new_vct(&vct_1, sizeof(cm_lst_node *));
-        CHECK_EQ(ret, 0);
+        _cc_opt_val_test<sc::opt_val, double>(
+                            o, 0.25,
+                            &sc::opt_val::set_epsilon,
+                            &sc::opt_val::get_epsilon);
 
-        //populate the newly created CMore vector
-        for (int i = 0; i < 3; ++i) {
-            ret = cm_vct_apd(&vct_1, &a[i]);
-            CHECK_EQ(ret, 0);
-        }
+    } //end test
 
 
-        /* first test: typical use-case */
+    //test 8: reset
+    SUBCASE(test_cc_opt_val_subtests[8]) {
+        title(CC, "opt_val", "Reset");
 
-        //try to get sessions before they are set
-        ret = sc_opt_get_sessions(o, &vct_2);
-        CHECK_EQ(ret, 0);
-        cm_del_vct(&vct_2);
+        std::vector<cm_byte> v = {0x64, 0x00};
 
-        //fill sessions with the previously constructed CMore optional
-        ret = sc_opt_set_sessions(o, &vct_1);
+        //set every option
+        ret = o.set_type(sc::VT_I16);
         CHECK_EQ(ret, 0);
-
-        //call the getter again & assert
-        ret = sc_opt_get_sessions(o, &vct_2);
+        ret = o.set_alignment(0x2);
         CHECK_EQ(ret, 0);
-        CHECK_EQ(vct_2.len, 3);
-    
-        //check each element from the returned CMore vector is correct
-        for (int i = 0; i < 3; ++i) {
-        
-            ret = cm_vct_get(&vct_2, i, &s);
-            CHECK_EQ(ret, 0);
-            CHECK_EQ(s, a[i]);
+        ret = o.set_value(v);
+        CHECK_EQ(ret, 0);
+        ret = o.set_predicate(sc::VP_RANGE);
+        CHECK_EQ(ret, 0);
+        ret = o.set_value_hi(v);
+        CHECK_EQ(ret, 0);
+        ret = o.set_round(sc::VR_ROUND);
+        CHECK_EQ(ret, 0);
+        ret = o.set_epsilon(0.5);
+        CHECK_EQ(ret, 0);
+
+        //reset & check every option is unset
+        ret = o.reset();
+        CHECK_EQ(ret, 0);
+
+        CHECK_EQ(o.get_type().has_value(), false);
+        CHECK_EQ(o.get_alignment().has_value(), false);
+        CHECK_EQ(o.get_value().has_value(), false);
+        CHECK_EQ(o.get_predicate(), sc::VP_EQ);
+        CHECK_EQ(o.get_value_hi().has_value(), false);
+        CHECK_EQ(o.get_round(), sc::VR_NONE);
+        CHECK_EQ(o.get_epsilon().has_value(), false);
+
+    } //end test
+
+    return;
+
+} //end TEST_CASE 
+
+
+TEST_CASE(test_cc_opt_ptn_subtests[0]) {
+
+    int ret;
+
+
+    //test 0: construct opt_ptn classes
+
+    //call regular constructor
+    sc::opt_ptn o;
+
+    //apply lock to check copy & move constructors reset it
+    ret = o._lock();
+    CHECK_EQ(ret, 0);
+
+    //call copy & move constructors
+    sc::opt_ptn o_copy(o);
+    CHECK_EQ(o_copy._get_lock(), false);
+    sc::opt_ptn o_move(std::move(o));
+    CHECK_EQ(o_move._get_lock(), false);
+
+    //reset lock
+    ret = o._unlock();
+    CHECK_EQ(ret, 0);
+
+
+    //test 1: set & get `pattern`
+    SUBCASE(test_cc_opt_ptn_subtests[1]) {
+        title(CC, "opt_ptn", "Set & get `pattern`");
+
+        std::vector<cm_byte> v = {0x48, 0x8B, 0x05, 0xC3};
+        _cc_vector_test<sc::opt_ptn, cm_byte>(
+            o, v, &sc::opt_ptn::set_pattern, &sc::opt_ptn::get_pattern);
+
+    } //end test
+
+
+    //test 2: set & get `mask`
+    SUBCASE(test_cc_opt_ptn_subtests[2]) {
+        title(CC, "opt_ptn", "Set & get `mask`");
+
+        std::vector<cm_byte> v = {0xFF, 0xFF, 0x00, 0x0F};
+        _cc_vector_test<sc::opt_ptn, cm_byte>(
+            o, v, &sc::opt_ptn::set_mask, &sc::opt_ptn::get_mask);
+
+    } //end test
+
+
+    //test 3: set `pattern` & `mask` from a string
+    SUBCASE(test_cc_opt_ptn_subtests[3]) {
+        title(CC, "opt_ptn", "Set `pattern` & `mask` from a string");
+
+        std::vector<cm_byte> pattern = {0x48, 0x8B, 0x00, 0x05, 0xA0, 0x00};
+        std::vector<cm_byte> mask    = {0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x00};
+
+
+        /* first test: typical use-case */
+
+        ret = o.set_pattern_str("48 8b ?? ?5 A? ?");
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(o.get_pattern().value(), pattern);
+        CHECK_EQ(o.get_mask().value(), mask);
+
+
+        /* second test: malformed strings leave the pattern as it was */
+
+        for (const char * str : {"", "4", "48 123", "zz", "48 8B ?x"}) {
+
+            ret = o.set_pattern_str(str);
+            CHECK_EQ(ret, -1);
+            CHECK_EQ(sc_errno, SC_ERR_OPT_PATTERN);
         }
+        CHECK_EQ(o.get_pattern().value(), pattern);
 
-        //cleanup before next test
-        cm_del_vct(&vct_1);
-        cm_del_vct(&vct_2);
+        //cleanup
         sc_errno = 0;
 
+    } //end test
 
-        /* second test: replace sessions with an empty vector */
 
-        //create an empty CMore vector
-        cm_new_vct(&vct_1, sizeof(cm_lst_node *));
+    //test 4: reset
+    SUBCASE(test_cc_opt_ptn_subtests[4]) {
+        title(CC, "opt_ptn", "Reset");
 
-        //call the setter, passing it the empty CMore vector
-        ret = sc_opt_set_sessions(o, &vct_1);
+        sc::ptn_set p_set;
+
+
+        //set every option
+        ret = o.set_pattern_str("48 8B ?? C3");
+        CHECK_EQ(ret, 0);
+        ret = o.set_signatures(&p_set);
         CHECK_EQ(ret, 0);
 
-        //try to get the sessions, checking the length is now 0
-        ret = sc_opt_get_sessions(o, &vct_2);
+        //reset & check every option is unset
+        ret = o.reset();
         CHECK_EQ(ret, 0);
-        CHECK_EQ(vct_2.len, 0);
 
-        //cleanup
-        cm_del_vct(&vct_1);
-        cm_del_vct(&vct_2);
-        
+        CHECK_EQ(o.get_pattern().has_value(), false);
+        CHECK_EQ(o.get_mask().has_value(), false);
+        CHECK_EQ(o.get_signatures(), nullptr);
+
     } //end test
 
 
-    //test 4: set & get `map`
-    SUBCASE(test_c_opt_subtests[4]) {
-        title(C, "sc_opt", "Set & get `map`");
+    //test 5: set & get `signatures`
+    SUBCASE(test_cc_opt_ptn_subtests[5]) {
+        title(CC, "opt_ptn", "Set & get `signatures`");
 
-        /*
-         *  NOTE: The setter signature is cast to fix constness of the
-         *        `mc_vm_map` parameter.
-         */
+        sc::ptn_set p_set;
 
-        int (* set_cast)(sc_opt opts, mc_vm_map * const)
-            = (int(*)(sc_opt opts, mc_vm_map * const)) sc_opt_set_map;
 
-        _c_val_test<sc_opt, mc_vm_map *>(o, (mc_vm_map *) 0x1337,
-            set_cast, sc_opt_get_map, std::nullopt);
-    
+        ret = o.set_signatures(&p_set);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(o.get_signatures(), &p_set);
+
+        ret = o.set_signatures(nullptr);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(o.get_signatures(), nullptr);
+
     } //end test
 
+    return;
 
-    //test 5: get `addr_width`
-    SUBCASE(test_c_opt_subtests[5]) {
-        title(C, "sc_opt", "Get `addr_width`");
+} //end TEST_CASE 
+
+
+TEST_CASE(test_cc_opt_str_subtests[0]) {
+
+    int ret;
+
+
+    //test 0: construct opt_str classes
+
+    //call regular constructor
+    sc::opt_str o;
+
+    //apply lock to check copy & move constructors reset it
+    ret = o._lock();
+    CHECK_EQ(ret, 0);
+
+    //call copy & move constructors
+    sc::opt_str o_copy(o);
+    CHECK_EQ(o_copy._get_lock(), false);
+    sc::opt_str o_move(std::move(o));
+    CHECK_EQ(o_move._get_lock(), false);
+
+    //reset lock
+    ret = o._unlock();
+    CHECK_EQ(ret, 0);
+
+
+    //test 1: set & get `str`
+    SUBCASE(test_cc_opt_str_subtests[1]) {
+        title(CC, "opt_str", "Set & get `str`");
+
+        std::optional<std::string> str = "boris";
+        _cc_opt_ref_test<sc::opt_str, std::string>(
+            o, str, &sc::opt_str::set_str, &sc::opt_str::get_str);
+
+    } //end test
+
+
+    //test 2: set & get `encodings`
+    SUBCASE(test_cc_opt_str_subtests[2]) {
+        title(CC, "opt_str", "Set & get `encodings`");
+
+        //both encodings are selected by default
+        CHECK_EQ(o.get_encodings(), sc::SE_UTF8 | sc::SE_UTF16LE);
+
+        _cc_val_test<sc::opt_str, cm_byte>(
+                            o, sc::SE_UTF16LE,
+                            &sc::opt_str::set_encodings,
+                            &sc::opt_str::get_encodings);
+
+    } //end test
+
+
+    //test 3: set & get `case_insensitive`
+    SUBCASE(test_cc_opt_str_subtests[3]) {
+        title(CC, "opt_str", "Set & get `case_insensitive`");
+
+        _cc_val_test<sc::opt_str, bool>(
+                            o, true,
+                            &sc::opt_str::set_case_insensitive,
+                            &sc::opt_str::get_case_insensitive);
+
+    } //end test
+
+
+    //test 4: set & get `null_term`
+    SUBCASE(test_cc_opt_str_subtests[4]) {
+        title(CC, "opt_str", "Set & get `null_term`");
+
+        _cc_val_test<sc::opt_str, bool>(
+                            o, true,
+                            &sc::opt_str::set_null_term,
+                            &sc::opt_str::get_null_term);
+
+    } //end test
+
+
+    //test 5: reset
+    SUBCASE(test_cc_opt_str_subtests[5]) {
+        title(CC, "opt_str", "Reset");
+
+        //set every option
+        ret = o.set_str("boris");
+        CHECK_EQ(ret, 0);
+        ret = o.set_encodings(sc::SE_UTF8);
+        CHECK_EQ(ret, 0);
+        ret = o.set_case_insensitive(true);
+        CHECK_EQ(ret, 0);
+        ret = o.set_null_term(true);
+        CHECK_EQ(ret, 0);
+
+        //reset & check every option is back to its default
+        ret = o.reset();
+        CHECK_EQ(ret, 0);
+
+        CHECK_EQ(o.get_str().has_value(), false);
+        CHECK_EQ(o.get_encodings(), sc::SE_UTF8 | sc::SE_UTF16LE);
+        CHECK_EQ(o.get_case_insensitive(), false);
+        CHECK_EQ(o.get_null_term(), false);
+
+    } //end test
+
+    return;
+
+} //end TEST_CASE 
+
+
+TEST_CASE(test_cc_opt_struct_subtests[0]) {
+
+    int ret;
+
+
+    //test 0: construct opt_struct classes
+
+    //call regular constructor
+    sc::opt_struct o;
+
+    //apply lock to check copy & move constructors reset it
+    ret = o._lock();
+    CHECK_EQ(ret, 0);
+
+    //call copy & move constructors
+    sc::opt_struct o_copy(o);
+    CHECK_EQ(o_copy._get_lock(), false);
+    sc::opt_struct o_move(std::move(o));
+    CHECK_EQ(o_move._get_lock(), false);
+
+    //reset lock
+    ret = o._unlock();
+    CHECK_EQ(ret, 0);
+
+
+    //test 1: set & get `fields`
+    SUBCASE(test_cc_opt_struct_subtests[1]) {
+        title(CC, "opt_struct", "Set & get `fields`");
+
+        std::vector<struct sc::struct_field> fields = {
+            {0x0, sc::SF_VALUE, sc::VT_I32, sc::VP_EQ,
+             {0x64, 0x00, 0x00, 0x00}, {}},
+            {0x4, sc::SF_VALUE, sc::VT_I32, sc::VP_RANGE,
+             {0x00, 0x00, 0x00, 0x00}, {0x64, 0x00, 0x00, 0x00}},
+            {0x10, sc::SF_PTR, sc::VT_U64, sc::VP_EQ, {}, {}}
+        };
+
+
+        //fields start out empty
+        CHECK_EQ(o.get_fields().empty(), true);
+
+        //set & check every field
+        ret = o.set_fields(fields);
+        CHECK_EQ(ret, 0);
+
+        REQUIRE_EQ(o.get_fields().size(), fields.size());
+        for (size_t i = 0; i < fields.size(); ++i) {
+
+            CHECK_EQ(o.get_fields()[i].off, fields[i].off);
+            CHECK_EQ(o.get_fields()[i].kind, fields[i].kind);
+            CHECK_EQ(o.get_fields()[i].type, fields[i].type);
+            CHECK_EQ(o.get_fields()[i].predicate, fields[i].predicate);
+            CHECK_EQ(o.get_fields()[i].value, fields[i].value);
+            CHECK_EQ(o.get_fields()[i].value_hi, fields[i].value_hi);
+        }
+
+    } //end test
+
+
+    //test 2: set & get `alignment`
+    SUBCASE(test_cc_opt_struct_subtests[2]) {
+        title(CC, "opt_struct", "Set & get `alignment`");
+
+        _cc_opt_val_test<sc::opt_struct, off_t>(
+                            o, 0x8,
+                            &sc::opt_struct::set_alignment,
+                            &sc::opt_struct::get_alignment);
+
+    } //end test
+
+
+    //test 3: reset
+    SUBCASE(test_cc_opt_struct_subtests[3]) {
+        title(CC, "opt_struct", "Reset");
+
+        //set every option
+        ret = o.set_fields({{0x10, sc::SF_PTR, sc::VT_U64, sc::VP_EQ, {}, {}}});
+        CHECK_EQ(ret, 0);
+        ret = o.set_alignment(0x8);
+        CHECK_EQ(ret, 0);
+
+        //reset & check every option is back to its default
+        ret = o.reset();
+        CHECK_EQ(ret, 0);
+
+        CHECK_EQ(o.get_fields().empty(), true);
+        CHECK_EQ(o.get_alignment().has_value(), false);
+
+    } //end test
+
+    return;
+
+} //end TEST_CASE 
+
+
+
+
+      /* =================== * 
+ ===== *  C INTERFACE TESTS  * =====
+       * =================== */
+
+/*
+ *  --- [HELPERS] ---
+ */
+
+//test setting & getting a value
+template <typename O, typename T>
+static void _c_val_test(void * o, T v,
+                        int (* set)(O o, const T v),
+                        T (* get)(const O o),
+                        std::optional<
+                            std::function<bool(T v_1, T v_2)>> compare_fn) {
+                            
+    int ret;
+    T ret_val;
+
+
+    /* first test: typical use-case */
+
+    //call setter
+    ret = (*set)(o, v);
+    CHECK_EQ(ret, 0);
+
+    //call getter again to assert the attribute was set
+    ret_val = (*get)(o);
+    if (compare_fn.has_value() == true) {
+        compare_fn.value()(ret_val, v);
+    } else {
+        CHECK(ret_val == v);
+    }
+
+    //cleanup before next test
+    sc_errno = 0;
+
+    return;
+}
+
+
+//test setting & getting an optional
+template <typename O, typename T>
+static void _c_opt_test(void * o, T v, T v_nullopt,
+                        int (* set)(O o, const T v),
+                        T (* get)(const O o),
+                        std::optional<
+                            std::function<bool(T v_1, T v_2)>> compare_fn) {
+  
+    int ret;
+    T ret_opt;
+
+
+    /* first test: typical use-case */
+
+    //call getter before attribute is set
+    ret_opt = (*get)(o);
+    CHECK_EQ(ret_opt, v_nullopt);
+
+    //call setter
+    ret = (*set)(o, v);
+    CHECK_EQ(ret, 0);
+
+    //call getter again to assert the attribute was set
+    ret_opt = (*get)(o);
+    if (compare_fn.has_value() == true) {
+        compare_fn.value()(ret_opt, v);
+    } else {
+        CHECK(ret_opt == v);
+    }
+
+    //cleanup before next test
+    sc_errno = 0;
+
+
+    /* second test: reset optional back to nullopt */
+
+    //call setter with this attribute's nullopt C equivalent
+    ret = (*set)(o, v_nullopt);
+    CHECK_EQ(ret, 0);
+
+    //try to get the attribute to check it's been set to nullopt correctly
+    ret_opt = (*get)(o);
+    CHECK_EQ(ret_opt, v_nullopt);
+    CHECK_EQ(sc_errno, SC_ERR_OPT_EMPTY);
+
+    return;
+}
+
+
+//test setting & getting an optional vector attribute
+template <typename O, typename T>
+static void _c_vector_test(void * o, T * a, int a_len,
+                           int (* set)(O o, const cm_vct * v),
+                           int (* get)(const O o, cm_vct * v),
+                            std::optional<
+                                std::function<bool(T v_1, T v_2)>> compare_fn) {
+
+    int ret;
+
+    T entry;
+    cm_vct vct_1, vct_2;
+
+
+    //construct a CMore vector to pass to the C interface call
+    ret = cm_new_vct(&vct_1, sizeof(T));
+    CHECK_EQ(ret, 0);
+
+    //populate the newly created CMore vector
+    for (int i = 0; i < a_len; ++i) {
+        ret = cm_vct_apd(&vct_1, &a[i]);
+        CHECK_EQ(ret, 0);
+    }
+
+
+    /* first test: typical use-case */
+
+    //try to get the unset optional
+    ret = get(o, &vct_2);
+    CHECK_EQ(ret, -1);
+    CHECK_EQ(sc_errno, SC_ERR_OPT_EMPTY);
+
+    //fill the optional with the previously constructed CMore vector
+    ret = set(o, &vct_1);
+    CHECK_EQ(ret, 0);
+
+    //call the getter again
+    ret = get(o, &vct_2);
+    CHECK_EQ(ret, 0);
+    CHECK_EQ(vct_2.len, a_len);
+
+    //check each element from the returned CMore vector is correct
+    for (int i = 0; i < a_len; ++i) {
+    
+        ret = cm_vct_get(&vct_2, i, &entry);
+        CHECK_EQ(ret, 0);
+
+        if (compare_fn.has_value() == true) {
+            compare_fn.value()(entry, a[i]);
+        } else {
+            CHECK(std::memcmp(&entry, &a[i], sizeof(entry)) == 0);
+        }
+    } //end for
+
+    //cleanup before next test
+    cm_del_vct(&vct_2);
+    sc_errno = 0;
+
+
+    /* second test: reset optional back to nullopt */
+
+    //call setter with this attribute's nullopt C equivalent
+    ret = set(o, nullptr);
+    CHECK_EQ(ret, 0);
+
+    //try to get the attribute to check it's been set to nullopt correctly
+    ret = get(o, &vct_2);
+    CHECK_EQ(ret, -1);
+    CHECK_EQ(sc_errno, SC_ERR_OPT_EMPTY);
+
+    //cleanup
+    cm_del_vct(&vct_1);
+
+    return;
+}
+
+
+/*
+ *  --- [TESTS - OPT] ---
+ */
+
+TEST_CASE(test_c_opt_subtests[0]) {
+
+    int ret;
+    sc_opt o, o_copy;
+
+
+    //test 0: create sc_opts
+
+    //call constructor
+    o = sc_new_opt(test_c_addr_width);
+    REQUIRE_NE(o, nullptr);
+
+    //call copy constructor
+    o_copy = sc_copy_opt(o);
+    REQUIRE_NE(o_copy, nullptr);
+
+
+    //test 1: set & get `file_path_out`
+    SUBCASE(test_c_opt_subtests[1]) {
+        title(C, "sc_opt", "Set & get `file_path_out`");
+
+        const char * path = "/foo/bar";
+
+        _c_opt_test<sc_opt, const char *>(
+                            o, path, nullptr,
+                            sc_opt_set_file_path_out,
+                            sc_opt_get_file_path_out,
+                            [](const char * s_1, const char * s_2) -> bool {
+                                
+                                std::string stl_s_1(s_1 == nullptr ? "" : s_1);
+                                std::string stl_s_2(s_2 == nullptr ? "" : s_2);
+                                return stl_s_1 == stl_s_2;
+                            });
+    } //end test
+
+
+    //test 2: set & get `file_path_in`
+    SUBCASE(test_c_opt_subtests[2]) {
+        title(C, "sc_opt", "Set & get `file_path_in`");
+
+        const char * path = "/foo/bar";
+
+        _c_opt_test<sc_opt, const char *>(
+                            o, path, nullptr,
+                            sc_opt_set_file_path_in,
+                            sc_opt_get_file_path_in,
+                            [](const char * s_1, const char * s_2) -> bool {
+                                std::string stl_s_1(s_1 == nullptr ? "" : s_1);
+                                std::string stl_s_2(s_2 == nullptr ? "" : s_2);
+                                return stl_s_1 == stl_s_2;
+                            });
+
+    } //end test
+
+
+    //test 3: set & get `sessions`
+    SUBCASE(test_c_opt_subtests[3]) {
+        title(C, "sc_opt", "Set & get `sessions`");
+
+        /*
+         *  Test implemented directly.
+         */
+
+        cm_lst_node * a[3] = {
+            (cm_lst_node *) 0x10101010,
+            (cm_lst_node *) 0x20202020,
+            (cm_lst_node *) 0x30303030
+        };
+
+        cm_lst_node * s;
+        cm_vct vct_1, vct_2;
+
+
+        //construct a CMore vector to pass to the C interface call
+        ret = cm_new_vct(&vct_1, sizeof(cm_lst_node *));
+        CHECK_EQ(ret, 0);
+
+        //populate the newly created CMore vector
+        for (int i = 0; i < 3; ++i) {
+            ret = cm_vct_apd(&vct_1, &a[i]);
+            CHECK_EQ(ret, 0);
+        }
+
+
+        /* first test: typical use-case */
+
+        //try to get sessions before they are set
+        ret = sc_opt_get_sessions(o, &vct_2);
+        CHECK_EQ(ret, 0);
+        cm_del_vct(&vct_2);
+
+        //fill sessions with the previously constructed CMore optional
+        ret = sc_opt_set_sessions(o, &vct_1);
+        CHECK_EQ(ret, 0);
+
+        //call the getter again & assert
+        ret = sc_opt_get_sessions(o, &vct_2);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(vct_2.len, 3);
+    
+        //check each element from the returned CMore vector is correct
+        for (int i = 0; i < 3; ++i) {
+        
+            ret = cm_vct_get(&vct_2, i, &s);
+            CHECK_EQ(ret, 0);
+            CHECK_EQ(s, a[i]);
+        }
+
+        //cleanup before next test
+        cm_del_vct(&vct_1);
+        cm_del_vct(&vct_2);
+        sc_errno = 0;
+
+
+        /* second test: replace sessions with an empty vector */
+
+        //create an empty CMore vector
+        cm_new_vct(&vct_1, sizeof(cm_lst_node *));
+
+        //call the setter, passing it the empty CMore vector
+        ret = sc_opt_set_sessions(o, &vct_1);
+        CHECK_EQ(ret, 0);
+
+        //try to get the sessions, checking the length is now 0
+        ret = sc_opt_get_sessions(o, &vct_2);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(vct_2.len, 0);
+
+        //cleanup
+        cm_del_vct(&vct_1);
+        cm_del_vct(&vct_2);
+        
+    } //end test
+
+
+    //test 4: set & get `map`
+    SUBCASE(test_c_opt_subtests[4]) {
+        title(C, "sc_opt", "Set & get `map`");
+
+        /*
+         *  NOTE: The setter signature is cast to fix constness of the
+         *        `mc_vm_map` parameter.
+         */
+
+        int (* set_cast)(sc_opt opts, mc_vm_map * const)
+            = (int(*)(sc_opt opts, mc_vm_map * const)) sc_opt_set_map;
+
+        _c_val_test<sc_opt, mc_vm_map *>(o, (mc_vm_map *) 0x1337,
+            set_cast, sc_opt_get_map, std::nullopt);
+    
+    } //end test
+
+
+    //test 5: get `addr_width`
+    SUBCASE(test_c_opt_subtests[5]) {
+        title(C, "sc_opt", "Get `addr_width`");
+
+        /*
+         *  Test implemented directly.
+         */
+
+        sc_addr_width ret_aw;
+
+        //call the getter for this const attribute
+        ret_aw = sc_opt_get_addr_width(o);
+        CHECK_EQ(ret_aw, test_c_addr_width);
+
+    } //end test
+
+
+    //test 6: set & get `omit_areas`
+    SUBCASE(test_c_opt_subtests[6]) {
+        title(C, "sc_opt", "Set & get `omit_areas`");
+
+        const cm_lst_node * a[3] = {
+            (const cm_lst_node *) 0x40404040,
+            (const cm_lst_node *) 0x50505050,
+            (const cm_lst_node *) 0x60606060
+        };
+
+        _c_vector_test<sc_opt, const cm_lst_node *>(
+            o, a, 3, sc_opt_set_omit_areas,
+            sc_opt_get_omit_areas, std::nullopt);
+
+    } //end test
+
+
+    //test 7: set & get `omit_objs`
+    SUBCASE(test_c_opt_subtests[7]) {
+        title(C, "sc_opt", "Set & get `omit_objs`");
+
+        const cm_lst_node * a[3] = {
+            (const cm_lst_node *) 0x04040404,
+            (const cm_lst_node *) 0x05050505,
+            (const cm_lst_node *) 0x06060606
+        };
+
+        _c_vector_test<sc_opt, const cm_lst_node *>(
+            o, a, 3, sc_opt_set_omit_objs,
+            sc_opt_get_omit_objs, std::nullopt);
+
+    } //end test
+
+
+    //test 8: set & get `exclusive_areas`
+    SUBCASE(test_c_opt_subtests[8]) {
+        title(C, "sc_opt", "Set & get `exclusive_areas`");
+
+        const cm_lst_node * a[3] = {
+            (const cm_lst_node *) 0x70707070,
+            (const cm_lst_node *) 0x80808080,
+            (const cm_lst_node *) 0x90909090
+        };
+
+        _c_vector_test<sc_opt, const cm_lst_node *>(
+            o, a, 3, sc_opt_set_exclusive_areas,
+            sc_opt_get_exclusive_areas, std::nullopt);
+
+    } //end test
+
+
+    //test 9: set & get `exclusive_objs`
+    SUBCASE(test_c_opt_subtests[9]) {
+        title(C, "sc_opt", "Set & get `exclusive_objs`");
+
+        const cm_lst_node * a[3] = {
+            (const cm_lst_node *) 0x07070707,
+            (const cm_lst_node *) 0x08080808,
+            (const cm_lst_node *) 0x09090909
+        };
+
+        _c_vector_test<sc_opt, const cm_lst_node *>(
+            o, a, 3, sc_opt_set_exclusive_objs,
+            sc_opt_get_exclusive_objs, std::nullopt);
+
+    } //end test
+
+
+    //test 10: set & get an `omit_addr_ranges`
+    SUBCASE(test_c_opt_subtests[10]) {
+        title(C, "sc_opt", "Set & get `omit_addr_ranges`");
+
+        sc_addr_range a[3] = {
+            {0x1000, 0x2000},
+            {0x3000, 0x4000},
+            {0x5000, 0x6000}
+        };
+
+        _c_vector_test<sc_opt, sc_addr_range>(
+            o, a, 3,
+            sc_opt_set_omit_addr_ranges,
+            sc_opt_get_omit_addr_ranges,
+            [](sc_addr_range ar_1, sc_addr_range ar_2) -> bool {
+                return (ar_1.min == ar_2.min) && (ar_1.max == ar_2.max);
+            });
+
+    } //end test
+
+
+    //test 11: set & get an `exclusive_addr_ranges`
+    SUBCASE(test_c_opt_subtests[11]) {
+        title(C, "sc_opt", "Set & get `exclusive_addr_ranges`");
+
+        sc_addr_range a[3] = {
+            {0x1000, 0x2000},
+            {0x3000, 0x4000},
+            {0x5000, 0x6000}
+        };
+
+        _c_vector_test<sc_opt, sc_addr_range>(
+            o, a, 3,
+            sc_opt_set_exclusive_addr_ranges,
+            sc_opt_get_exclusive_addr_ranges,
+            [](sc_addr_range ar_1, sc_addr_range ar_2) -> bool {
+                return (ar_1.min == ar_2.min) && (ar_1.max == ar_2.max);
+            });
+
+    } //end test
+
+
+    //test 12: set & get `access`
+    SUBCASE(test_c_opt_subtests[12]) {
+        title(C, "sc_opt", "Set & get `access`");
+
+        _c_opt_test<sc_opt, cm_byte>(
+                            o, MC_ACCESS_READ | MC_ACCESS_WRITE, -1,
+                            sc_opt_set_access, sc_opt_get_access, std::nullopt);
+      
+    } //end test
+
+
+    //test 13: set & get `pid`
+    SUBCASE(test_c_opt_subtests[13]) {
+        title(C, "sc_opt", "Set & get `pid`");
+
+        _c_opt_test<sc_opt, pid_t>(o, getpid(), -1,
+                                   sc_opt_set_pid, sc_opt_get_pid,
+                                   std::nullopt);
+
+    } //end test
+
+
+    //test 0 (cont.): destroy the options objects
+    int _ret = sc_del_opt(o);
+    CHECK_EQ(_ret, 0);
+
+    _ret = sc_del_opt(o_copy);
+    CHECK_EQ(_ret, 0);
+
+
+} //end TEST_CASE
+
+
+
+/*
+ *  --- [TESTS - OPT_PTR] ---
+ */
+
+TEST_CASE(test_c_opt_ptr_subtests[0]) {
+
+    int ret;
+    sc_opt_ptr o, o_copy;
+
+
+    //test 0: create sc_opt_ptrs
+
+    //call constructor
+    o = sc_new_opt_ptr();
+    REQUIRE_NE(o, nullptr);
+
+    //call copy constructor
+    o_copy = sc_copy_opt_ptr(o);
+    REQUIRE_NE(o_copy, nullptr);
+
+
+    //test 1: set & get `target_addr`
+    SUBCASE(test_c_opt_ptr_subtests[1]) {
+        title(C, "sc_opt_ptr", "Set & get `target_addr`");
+
+        _c_opt_test<sc_opt_ptr, uintptr_t>(
+                            o, 0x1000, 0,
+                            sc_opt_ptr_set_target_addr,
+                            sc_opt_ptr_get_target_addr,
+                            std::nullopt);
+
+    } //end test
+
+
+    //test 2: set & get `alignment`
+    SUBCASE(test_c_opt_ptr_subtests[2]) {
+
+        _c_opt_test<sc_opt_ptr, off_t>(
+                            o, 0x4, 0,
+                            sc_opt_ptr_set_alignment,
+                            sc_opt_ptr_get_alignment,
+                            std::nullopt);
+
+    } //end test
+
+
+    //test 3: set & get `max_obj_sz`
+    SUBCASE(test_c_opt_ptr_subtests[3]) {
+        title(C, "sc_opt_ptr", "Set & get `max_obj_sz`");
+
+        _c_opt_test<sc_opt_ptr, off_t>(
+                            o, 0x4, 0,
+                            sc_opt_ptr_set_max_obj_sz,
+                            sc_opt_ptr_get_max_obj_sz,
+                            std::nullopt);
+
+    } //end test
+
+
+    //test 4: set & get `max_depth`
+    SUBCASE(test_c_opt_ptr_subtests[4]) {
+        title(C, "sc_opt_ptr", "Set & get `max_depth`");
+
+        _c_opt_test<sc_opt_ptr, int>(
+                            o, 0x4, 0,
+                            sc_opt_ptr_set_max_depth,
+                            sc_opt_ptr_get_max_depth,
+                            std::nullopt);
+
+    } //end test
+
+    //test 5: set & get `static_areas`
+    SUBCASE(test_c_opt_ptr_subtests[5]) {
+        title(C, "sc_opt_ptr", "Set & get `static_areas`");
+
+        /*
+         *  NOTE: The C interface converts the STL hashmap into an
+         *        ordered CMore vector. This means the templated vector
+         *        test perfectly applicable here.
+         *
+         *        For the unordered set to be correctly sorted, it must
+         *        be able to sort nodes based on start & end addresses
+         *        of their underlying areas. For this to take place, the
+         *        below stubs are defined.
+         */
+
+        cm_lst_node * area_node_ptrs_arr[3] = {};
+        cm_lst_node area_nodes_arr[3] = {};
+        mc_vm_area areas_arr[3] = {};
+
+        //populate MemCry area stubs
+        areas_arr[0].start_addr = 0x1000; areas_arr[0].end_addr = 0x2000;
+        areas_arr[1].start_addr = 0x3000; areas_arr[1].end_addr = 0x4000;
+        areas_arr[2].start_addr = 0x5000; areas_arr[2].end_addr = 0x6000;
+
+        //populate node stubs
+        area_nodes_arr[0].data = &areas_arr[0];
+        area_nodes_arr[1].data = &areas_arr[1];
+        area_nodes_arr[2].data = &areas_arr[2];
+
+        //populate node pointers
+        area_node_ptrs_arr[0] = &area_nodes_arr[0];
+        area_node_ptrs_arr[1] = &area_nodes_arr[1];
+        area_node_ptrs_arr[2] = &area_nodes_arr[2];
+
+        _c_vector_test<sc_opt_ptr, const cm_lst_node *>(
+            o, (const cm_lst_node **) area_node_ptrs_arr,
+            3, sc_opt_ptr_set_static_areas,
+            sc_opt_ptr_get_static_areas, std::nullopt);
+
+    } //end test
+
+
+    //test 6: set & get `preset_offset`
+    SUBCASE(test_c_opt_subtests[6]) {
+        title(C, "sc_opt_ptr", "Set & get `preset_offsets`");
+
+        off_t offset_arr[3] = {
+            0x40,
+            0x80,
+            0x100
+        };
+
+        _c_vector_test<sc_opt_ptr, off_t>(
+            o, offset_arr, 3, sc_opt_ptr_set_preset_offsets,
+            sc_opt_ptr_get_preset_offsets, std::nullopt);
+
+    } //end test
+
+
+    //test 7: set & get `smart_scan`
+    SUBCASE(test_c_opt_ptr_subtests[7]) {
+        title(C, "sc_opt_ptr", "Set & get `smart_scan`");
+
+        _c_val_test<sc_opt_ptr, bool>(
+            o, true, sc_opt_ptr_set_smart_scan,
+            sc_opt_ptr_get_smart_scan, std::nullopt);
+
+    } //end test
+
+
+    //test 8: set & get `target_addrs`
+    SUBCASE(test_c_opt_ptr_subtests[8]) {
+        title(C, "sc_opt_ptr", "Set & get `target_addrs`");
+
+        uintptr_t target_arr[3] = {
+            0x1000,
+            0x2000,
+            0x3000
+        };
+
+        _c_vector_test<sc_opt_ptr, uintptr_t>(
+            o, target_arr, 3, sc_opt_ptr_set_target_addrs,
+            sc_opt_ptr_get_target_addrs, std::nullopt);
+
+    } //end test
+
+
+    //test 9: set & get `max_chains`
+    SUBCASE(test_c_opt_ptr_subtests[9]) {
+        title(C, "sc_opt_ptr", "Set & get `max_chains`");
+
+        _c_opt_test<sc_opt_ptr, size_t>(
+                            o, 0x100, 0,
+                            sc_opt_ptr_set_max_chains,
+                            sc_opt_ptr_get_max_chains,
+                            std::nullopt);
+
+    } //end test
+
+
+    //test 10: set & get `max_level_nodes`
+    SUBCASE(test_c_opt_ptr_subtests[10]) {
+        title(C, "sc_opt_ptr", "Set & get `max_level_nodes`");
+
+        _c_opt_test<sc_opt_ptr, size_t>(
+                            o, 0x100, 0,
+                            sc_opt_ptr_set_max_level_nodes,
+                            sc_opt_ptr_get_max_level_nodes,
+                            std::nullopt);
+
+    } //end test
+
+
+    //test 11: set & get `max_children`
+    SUBCASE(test_c_opt_ptr_subtests[11]) {
+        title(C, "sc_opt_ptr", "Set & get `max_children`");
+
+        _c_opt_test<sc_opt_ptr, size_t>(
+                            o, 0x10, 0,
+                            sc_opt_ptr_set_max_children,
+                            sc_opt_ptr_get_max_children,
+                            std::nullopt);
+
+    } //end test
+
+
+    //test 12: set & get `bidirectional`
+    SUBCASE(test_c_opt_ptr_subtests[12]) {
+        title(C, "sc_opt_ptr", "Set & get `bidirectional`");
+
+        _c_val_test<sc_opt_ptr, bool>(
+            o, true, sc_opt_ptr_set_bidirectional,
+            sc_opt_ptr_get_bidirectional, std::nullopt);
+
+    } //end test
+
+
+    //test 13: set & get `checkpoint_path`
+    SUBCASE(test_c_opt_ptr_subtests[13]) {
+        title(C, "sc_opt_ptr", "Set & get `checkpoint_path`");
+
+        const char * path = "/foo/bar";
+
+        _c_opt_test<sc_opt_ptr, const char *>(
+                            o, path, nullptr,
+                            sc_opt_ptr_set_checkpoint_path,
+                            sc_opt_ptr_get_checkpoint_path,
+                            [](const char * s_1, const char * s_2) -> bool {
+                                
+                                std::string stl_s_1(s_1 == nullptr ? "" : s_1);
+                                std::string stl_s_2(s_2 == nullptr ? "" : s_2);
+                                return stl_s_1 == stl_s_2;
+                            });
+
+    } //end test
+
+
+    //test 14: set & get `spill_path`
+    SUBCASE(test_c_opt_ptr_subtests[14]) {
+        title(C, "sc_opt_ptr", "Set & get `spill_path`");
+
+        const char * path = "/foo/bar";
+
+        _c_opt_test<sc_opt_ptr, const char *>(
+                            o, path, nullptr,
+                            sc_opt_ptr_set_spill_path,
+                            sc_opt_ptr_get_spill_path,
+                            [](const char * s_1, const char * s_2) -> bool {
+                                
+                                std::string stl_s_1(s_1 == nullptr ? "" : s_1);
+                                std::string stl_s_2(s_2 == nullptr ? "" : s_2);
+                                return stl_s_1 == stl_s_2;
+                            });
+
+    } //end test
+
+
+    //test 15: set & get `max_neg_off`
+    SUBCASE(test_c_opt_ptr_subtests[15]) {
+        title(C, "sc_opt_ptr", "Set & get `max_neg_off`");
+
+        _c_opt_test<sc_opt_ptr, off_t>(
+                            o, 0x40, 0,
+                            sc_opt_ptr_set_max_neg_off,
+                            sc_opt_ptr_get_max_neg_off,
+                            std::nullopt);
+
+    } //end test
+
+
+    //test 16: set & get `prefer_static`
+    SUBCASE(test_c_opt_ptr_subtests[16]) {
+        title(C, "sc_opt_ptr", "Set & get `prefer_static`");
+
+        _c_val_test<sc_opt_ptr, bool>(
+            o, true, sc_opt_ptr_set_prefer_static,
+            sc_opt_ptr_get_prefer_static, std::nullopt);
+
+    } //end test
+
+
+    //test 17: set & get `max_array_run`
+    SUBCASE(test_c_opt_ptr_subtests[17]) {
+        title(C, "sc_opt_ptr", "Set & get `max_array_run`");
+
+        _c_opt_test<sc_opt_ptr, size_t>(
+                            o, 0x4, 0,
+                            sc_opt_ptr_set_max_array_run,
+                            sc_opt_ptr_get_max_array_run,
+                            std::nullopt);
+
+    } //end test
+
+
+    //test 0 (cont.): destroy the pointer scan options objects
+    int _ret = sc_del_opt_ptr(o);
+    CHECK_EQ(_ret, 0);
+
+    _ret = sc_del_opt_ptr(o_copy);
+    CHECK_EQ(_ret, 0);
+
+
+} //end TEST_CASE
+
+
+
+/*
+ *  --- [TESTS - OPT_VAL] ---
+ */
+
+TEST_CASE(test_c_opt_val_subtests[0]) {
+
+    int ret;
+    sc_opt_val o, o_copy;
+
+
+    //test 0: create sc_opt_vals
+
+    //call constructor
+    o = sc_new_opt_val();
+    REQUIRE_NE(o, nullptr);
+
+    //call copy constructor
+    o_copy = sc_copy_opt_val(o);
+    REQUIRE_NE(o_copy, nullptr);
+
+
+    //test 1: set & get `type`
+    SUBCASE(test_c_opt_val_subtests[1]) {
+        title(C, "sc_opt_val", "Set & get `type`");
+
+        //call getter before the type is set
+        ret = sc_opt_val_get_type(o);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_OPT_EMPTY);
+
+        //call setter & assert the type was set
+        ret = sc_opt_val_set_type(o, VT_U64);
+        CHECK_EQ(ret, 0);
+
+        ret = sc_opt_val_get_type(o);
+        CHECK_EQ(ret, VT_U64);
+
+        //cleanup
+        sc_errno = 0;
+
+    } //end test
+
+
+    //test 2: set & get `alignment`
+    SUBCASE(test_c_opt_val_subtests[2]) {
+        title(C, "sc_opt_val", "Set & get `alignment`");
+
+        _c_opt_test<sc_opt_val, off_t>(
+                            o, 0x4, 0,
+                            sc_opt_val_set_alignment,
+                            sc_opt_val_get_alignment,
+                            std::nullopt);
+
+    } //end test
+
+
+    //test 3: set & get `value`
+    SUBCASE(test_c_opt_val_subtests[3]) {
+        title(C, "sc_opt_val", "Set & get `value`");
+
+        cm_byte a[4] = {0x64, 0x00, 0x00, 0x00};
+
+        _c_vector_test<sc_opt_val, cm_byte>(
+            o, a, 4, sc_opt_val_set_value,
+            sc_opt_val_get_value, std::nullopt);
+
+    } //end test
+
+
+    //test 4: set & get `predicate`
+    SUBCASE(test_c_opt_val_subtests[4]) {
+        title(C, "sc_opt_val", "Set & get `predicate`");
+
+        _c_val_test<sc_opt_val, enum sc_val_pred>(
+            o, VP_DECREASED, sc_opt_val_set_predicate,
+            sc_opt_val_get_predicate, std::nullopt);
+
+    } //end test
+
+
+    //test 5: set & get `value_hi`
+    SUBCASE(test_c_opt_val_subtests[5]) {
+        title(C, "sc_opt_val", "Set & get `value_hi`");
+
+        cm_byte a[4] = {0xC8, 0x00, 0x00, 0x00};
+
+        _c_vector_test<sc_opt_val, cm_byte>(
+            o, a, 4, sc_opt_val_set_value_hi,
+            sc_opt_val_get_value_hi, std::nullopt);
+
+    } //end test
+
+
+    //test 6: set & get `round`
+    SUBCASE(test_c_opt_val_subtests[6]) {
+        title(C, "sc_opt_val", "Set & get `round`");
+
+        _c_val_test<sc_opt_val, enum sc_val_round>(
+            o, VR_ROUND, sc_opt_val_set_round,
+            sc_opt_val_get_round, std::nullopt);
+
+    } //end test
+
+
+    //test 7: set & get `epsilon`
+    SUBCASE(test_c_opt_val_subtests[7]) {
+        title(C, "sc_opt_val", "Set & get `epsilon`");
+
+        _c_opt_test<sc_opt_val, double>(
+                            o, 0.25, 0.0,
+                            sc_opt_val_set_epsilon,
+                            sc_opt_val_get_epsilon,
+                            std::nullopt);
+
+    } //end test
+
+
+    //test 8: reset
+    SUBCASE(test_c_opt_val_subtests[8]) {
+        title(C, "sc_opt_val", "Reset");
+
+        //set the type, alignment & approximation
+        ret = sc_opt_val_set_type(o, VT_I32);
+        CHECK_EQ(ret, 0);
+        ret = sc_opt_val_set_alignment(o, 0x4);
+        CHECK_EQ(ret, 0);
+        ret = sc_opt_val_set_predicate(o, VP_UNCHANGED);
+        CHECK_EQ(ret, 0);
+        ret = sc_opt_val_set_round(o, VR_TRUNC);
+        CHECK_EQ(ret, 0);
+        ret = sc_opt_val_set_epsilon(o, 0.5);
+        CHECK_EQ(ret, 0);
+
+        //reset & check the options are unset
+        ret = sc_opt_val_reset(o);
+        CHECK_EQ(ret, 0);
+
+        CHECK_EQ(sc_opt_val_get_type(o), -1);
+        CHECK_EQ(sc_opt_val_get_alignment(o), 0);
+        CHECK_EQ(sc_opt_val_get_predicate(o), VP_EQ);
+        CHECK_EQ(sc_opt_val_get_round(o), VR_NONE);
+        CHECK_EQ(sc_opt_val_get_epsilon(o), 0.0);
+
+        //cleanup
+        sc_errno = 0;
+
+    } //end test
+
+
+    //test 0 (cont.): destroy the value scan options objects
+    int _ret = sc_del_opt_val(o);
+    CHECK_EQ(_ret, 0);
+
+    _ret = sc_del_opt_val(o_copy);
+    CHECK_EQ(_ret, 0);
+
+
+} //end TEST_CASE
+
+
+TEST_CASE(test_c_opt_ptn_subtests[0]) {
+
+    int ret;
+    sc_opt_ptn o, o_copy;
 
-        /*
-         *  Test implemented directly.
-         */
 
-        sc_addr_width ret_aw;
+    //test 0: create sc_opt_ptns
 
-        //call the getter for this const attribute
-        ret_aw = sc_opt_get_addr_width(o);
-        CHECK_EQ(ret_aw, test_c_addr_width);
+    //call constructor
+    o = sc_new_opt_ptn();
+    REQUIRE_NE(o, nullptr);
 
-    } //end test
+    //call copy constructor
+    o_copy = sc_copy_opt_ptn(o);
+    REQUIRE_NE(o_copy, nullptr);
 
 
-    //test 6: set & get `omit_areas`
-    SUBCASE(test_c_opt_subtests[6]) {
-        title(C, "sc_opt", "Set & get `omit_areas`");
+    //test 1: set & get `pattern`
+    SUBCASE(test_c_opt_ptn_subtests[1]) {
+        title(C, "sc_opt_ptn", "Set & get `pattern`");
 
-        const cm_lst_node * a[3] = {
-            (const cm_lst_node *) 0x40404040,
-            (const cm_lst_node *) 0x50505050,
-            (const cm_lst_node *) 0x60606060
-        };
+        cm_byte a[4] = {0x48, 0x8B, 0x05, 0xC3};
 
-        _c_vector_test<sc_opt, const cm_lst_node *>(
-            o, a, 3, sc_opt_set_omit_areas,
-            sc_opt_get_omit_areas, std::nullopt);
+        _c_vector_test<sc_opt_ptn, cm_byte>(
+            o, a, 4, sc_opt_ptn_set_pattern,
+            sc_opt_ptn_get_pattern, std::nullopt);
 
     } //end test
 
 
-    //test 7: set & get `omit_objs`
-    SUBCASE(test_c_opt_subtests[7]) {
-        title(C, "sc_opt", "Set & get `omit_objs`");
+    //test 2: set & get `mask`
+    SUBCASE(test_c_opt_ptn_subtests[2]) {
+        title(C, "sc_opt_ptn", "Set & get `mask`");
 
-        const cm_lst_node * a[3] = {
-            (const cm_lst_node *) 0x04040404,
-            (const cm_lst_node *) 0x05050505,
-            (const cm_lst_node *) 0x06060606
-        };
+        cm_byte a[4] = {0xFF, 0xFF, 0x00, 0x0F};
 
-        _c_vector_test<sc_opt, const cm_lst_node *>(
-            o, a, 3, sc_opt_set_omit_objs,
-            sc_opt_get_omit_objs, std::nullopt);
+        _c_vector_test<sc_opt_ptn, cm_byte>(
+            o, a, 4, sc_opt_ptn_set_mask,
+            sc_opt_ptn_get_mask, std::nullopt);
 
     } //end test
 
 
-    //test 8: set & get `exclusive_areas`
-    SUBCASE(test_c_opt_subtests[8]) {
-        title(C, "sc_opt", "Set & get `exclusive_areas`");
+    //test 3: set `pattern` & `mask` from a string
+    SUBCASE(test_c_opt_ptn_subtests[3]) {
+        title(C, "sc_opt_ptn", "Set `pattern` & `mask` from a string");
 
-        const cm_lst_node * a[3] = {
-            (const cm_lst_node *) 0x70707070,
-            (const cm_lst_node *) 0x80808080,
-            (const cm_lst_node *) 0x90909090
-        };
+        cm_byte entry;
+        cm_vct vct;
 
-        _c_vector_test<sc_opt, const cm_lst_node *>(
-            o, a, 3, sc_opt_set_exclusive_areas,
-            sc_opt_get_exclusive_areas, std::nullopt);
 
-    } //end test
+        //set a pattern with a nibble wildcard
+        ret = sc_opt_ptn_set_pattern_str(o, "48 ?B");
+        CHECK_EQ(ret, 0);
 
+        //check the mask
+        ret = sc_opt_ptn_get_mask(o, &vct);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(vct.len, 2);
 
-    //test 9: set & get `exclusive_objs`
-    SUBCASE(test_c_opt_subtests[9]) {
-        title(C, "sc_opt", "Set & get `exclusive_objs`");
+        ret = cm_vct_get(&vct, 1, &entry);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(entry, 0x0F);
+        cm_del_vct(&vct);
 
-        const cm_lst_node * a[3] = {
-            (const cm_lst_node *) 0x07070707,
-            (const cm_lst_node *) 0x08080808,
-            (const cm_lst_node *) 0x09090909
-        };
+        //reject a malformed string
+        ret = sc_opt_ptn_set_pattern_str(o, "48 ?G");
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_OPT_PATTERN);
 
-        _c_vector_test<sc_opt, const cm_lst_node *>(
-            o, a, 3, sc_opt_set_exclusive_objs,
-            sc_opt_get_exclusive_objs, std::nullopt);
+        //cleanup
+        sc_errno = 0;
 
     } //end test
 
 
-    //test 10: set & get an `omit_addr_ranges`
-    SUBCASE(test_c_opt_subtests[10]) {
-        title(C, "sc_opt", "Set & get `omit_addr_ranges`");
-
-        sc_addr_range a[3] = {
-            {0x1000, 0x2000},
-            {0x3000, 0x4000},
-            {0x5000, 0x6000}
-        };
+    //test 4: reset
+    SUBCASE(test_c_opt_ptn_subtests[4]) {
+        title(C, "sc_opt_ptn", "Reset");
 
-        _c_vector_test<sc_opt, sc_addr_range>(
-            o, a, 3,
-            sc_opt_set_omit_addr_ranges,
-            sc_opt_get_omit_addr_ranges,
-            [](sc_addr_range ar_1, sc_addr_range ar_2) -> bool {
-                return (ar_1.min == ar_2.min) && (ar_1.max == ar_2.max);
-            });
+        cm_vct vct;
 
-    } //end test
 
+        sc_ptn_set p_set = sc_new_ptn_set();
+        REQUIRE_NE(p_set, nullptr);
 
-    //test 11: set & get an `exclusive_addr_ranges`
-    SUBCASE(test_c_opt_subtests[11]) {
-        title(C, "sc_opt", "Set & get `exclusive_addr_ranges`");
 
-        sc_addr_range a[3] = {
-            {0x1000, 0x2000},
-            {0x3000, 0x4000},
-            {0x5000, 0x6000}
-        };
+        //set every option
+        ret = sc_opt_ptn_set_pattern_str(o, "48 8B ?? C3");
+        CHECK_EQ(ret, 0);
+        ret = sc_opt_ptn_set_signatures(o, p_set);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(sc_opt_ptn_get_signatures(o), p_set);
 
-        _c_vector_test<sc_opt, sc_addr_range>(
-            o, a, 3,
-            sc_opt_set_exclusive_addr_ranges,
-            sc_opt_get_exclusive_addr_ranges,
-            [](sc_addr_range ar_1, sc_addr_range ar_2) -> bool {
-                return (ar_1.min == ar_2.min) && (ar_1.max == ar_2.max);
-            });
+        //reset & check the options are unset
+        ret = sc_opt_ptn_reset(o);
+        CHECK_EQ(ret, 0);
 
-    } //end test
+        CHECK_EQ(sc_opt_ptn_get_signatures(o), nullptr);
 
+        CHECK_EQ(sc_opt_ptn_get_pattern(o, &vct), -1);
+        CHECK_EQ(sc_errno, SC_ERR_OPT_EMPTY);
+        CHECK_EQ(sc_opt_ptn_get_mask(o, &vct), -1);
+        CHECK_EQ(sc_errno, SC_ERR_OPT_EMPTY);
 
-    //test 12: set & get `access`
-    SUBCASE(test_c_opt_subtests[12]) {
-        title(C, "sc_opt", "Set & get `access`");
+        //cleanup
+        sc_errno = 0;
+        ret = sc_del_ptn_set(p_set);
+        CHECK_EQ(ret, 0);
 
-        _c_opt_test<sc_opt, cm_byte>(
-                            o, MC_ACCESS_READ | MC_ACCESS_WRITE, -1,
-                            sc_opt_set_access, sc_opt_get_access, std::nullopt);
-      
     } //end test
 
 
-    //test 0 (cont.): destroy the options objects
-    int _ret = sc_del_opt(o);
+    //test 0 (cont.): destroy the pattern scan options objects
+    int _ret = sc_del_opt_ptn(o);
     CHECK_EQ(_ret, 0);
 
-    _ret = sc_del_opt(o_copy);
+    _ret = sc_del_opt_ptn(o_copy);
     CHECK_EQ(_ret, 0);
 
 
 } //end TEST_CASE
 
 
-
-/*
- *  --- [TESTS - OPT_PTR] ---
- */
-
-TEST_CASE(test_c_opt_ptr_subtests[0]) {
+TEST_CASE(test_c_opt_str_subtests[0]) {
 
     int ret;
-    sc_opt_ptr o, o_copy;
+    sc_opt_str o, o_copy;
 
 
-    //test 0: create sc_opt_ptrs
+    //test 0: create sc_opt_strs
 
     //call constructor
-    o = sc_new_opt_ptr();
+    o = sc_new_opt_str();
     REQUIRE_NE(o, nullptr);
 
     //call copy constructor
-    o_copy = sc_copy_opt_ptr(o);
+    o_copy = sc_copy_opt_str(o);
     REQUIRE_NE(o_copy, nullptr);
 
 
-    //test 1: set & get `target_addr`
-    SUBCASE(test_c_opt_ptr_subtests[1]) {
-        title(C, "sc_opt_ptr", "Set & get `target_addr`");
+    //test 1: set & get `str`
+    SUBCASE(test_c_opt_str_subtests[1]) {
+        title(C, "sc_opt_str", "Set & get `str`");
 
-        _c_opt_test<sc_opt_ptr, uintptr_t>(
-                            o, 0x1000, 0,
-                            sc_opt_ptr_set_target_addr,
-                            sc_opt_ptr_get_target_addr,
-                            std::nullopt);
+        const char * str = "boris";
+
+        _c_opt_test<sc_opt_str, const char *>(
+                            o, str, nullptr,
+                            sc_opt_str_set_str,
+                            sc_opt_str_get_str,
+                            [](const char * s_1, const char * s_2) -> bool {
+                                std::string stl_s_1(s_1 == nullptr ? "" : s_1);
+                                std::string stl_s_2(s_2 == nullptr ? "" : s_2);
+                                return stl_s_1 == stl_s_2;
+                            });
 
     } //end test
 
 
-    //test 2: set & get `alignment`
-    SUBCASE(test_c_opt_ptr_subtests[2]) {
+    //test 2: set & get `encodings`
+    SUBCASE(test_c_opt_str_subtests[2]) {
+        title(C, "sc_opt_str", "Set & get `encodings`");
 
-        _c_opt_test<sc_opt_ptr, off_t>(
-                            o, 0x4, 0,
-                            sc_opt_ptr_set_alignment,
-                            sc_opt_ptr_get_alignment,
-                            std::nullopt);
+        _c_val_test<sc_opt_str, cm_byte>(
+            o, SE_UTF16LE, sc_opt_str_set_encodings,
+            sc_opt_str_get_encodings, std::nullopt);
 
     } //end test
 
 
-    //test 3: set & get `max_obj_sz`
-    SUBCASE(test_c_opt_ptr_subtests[3]) {
-        title(C, "sc_opt_ptr", "Set & get `max_obj_sz`");
+    //test 3: reset
+    SUBCASE(test_c_opt_str_subtests[3]) {
+        title(C, "sc_opt_str", "Reset");
 
-        _c_opt_test<sc_opt_ptr, off_t>(
-                            o, 0x4, 0,
-                            sc_opt_ptr_set_max_obj_sz,
-                            sc_opt_ptr_get_max_obj_sz,
-                            std::nullopt);
+        //set every option
+        ret = sc_opt_str_set_str(o, "boris");
+        CHECK_EQ(ret, 0);
+        ret = sc_opt_str_set_encodings(o, SE_UTF8);
+        CHECK_EQ(ret, 0);
+        ret = sc_opt_str_set_case_insensitive(o, true);
+        CHECK_EQ(ret, 0);
+        ret = sc_opt_str_set_null_term(o, true);
+        CHECK_EQ(ret, 0);
+
+        //reset & check the options are back to their defaults
+        ret = sc_opt_str_reset(o);
+        CHECK_EQ(ret, 0);
+
+        CHECK_EQ(sc_opt_str_get_str(o), nullptr);
+        CHECK_EQ(sc_errno, SC_ERR_OPT_EMPTY);
+        CHECK_EQ(sc_opt_str_get_encodings(o), SE_UTF8 | SE_UTF16LE);
+        CHECK_EQ(sc_opt_str_get_case_insensitive(o), false);
+        CHECK_EQ(sc_opt_str_get_null_term(o), false);
+
+        //cleanup
+        sc_errno = 0;
 
     } //end test
 
 
-    //test 4: set & get `max_depth`
-    SUBCASE(test_c_opt_ptr_subtests[4]) {
-        title(C, "sc_opt_ptr", "Set & get `max_depth`");
+    //test 0 (cont.): destroy the string scan options objects
+    int _ret = sc_del_opt_str(o);
+    CHECK_EQ(_ret, 0);
 
-        _c_opt_test<sc_opt_ptr, int>(
-                            o, 0x4, 0,
-                            sc_opt_ptr_set_max_depth,
-                            sc_opt_ptr_get_max_depth,
-                            std::nullopt);
+    _ret = sc_del_opt_str(o_copy);
+    CHECK_EQ(_ret, 0);
 
-    } //end test
 
-    //test 5: set & get `static_areas`
-    SUBCASE(test_c_opt_ptr_subtests[5]) {
-        title(C, "sc_opt_ptr", "Set & get `static_areas`");
+} //end TEST_CASE
 
-        /*
-         *  NOTE: The C interface converts the STL hashmap into an
-         *        ordered CMore vector. This means the templated vector
-         *        test perfectly applicable here.
-         *
-         *        For the unordered set to be correctly sorted, it must
-         *        be able to sort nodes based on start & end addresses
-         *        of their underlying areas. For this to take place, the
-         *        below stubs are defined.
-         */
 
-        cm_lst_node * area_node_ptrs_arr[3] = {};
-        cm_lst_node area_nodes_arr[3] = {};
-        mc_vm_area areas_arr[3] = {};
+TEST_CASE(test_c_opt_struct_subtests[0]) {
 
-        //populate MemCry area stubs
-        areas_arr[0].start_addr = 0x1000; areas_arr[0].end_addr = 0x2000;
-        areas_arr[1].start_addr = 0x3000; areas_arr[1].end_addr = 0x4000;
-        areas_arr[2].start_addr = 0x5000; areas_arr[2].end_addr = 0x6000;
+    int ret;
+    sc_opt_struct o, o_copy;
 
-        //populate node stubs
-        area_nodes_arr[0].data = &areas_arr[0];
-        area_nodes_arr[1].data = &areas_arr[1];
-        area_nodes_arr[2].data = &areas_arr[2];
 
-        //populate node pointers
-        area_node_ptrs_arr[0] = &area_nodes_arr[0];
-        area_node_ptrs_arr[1] = &area_nodes_arr[1];
-        area_node_ptrs_arr[2] = &area_nodes_arr[2];
+    //test 0: create sc_opt_structs
 
-        _c_vector_test<sc_opt_ptr, const cm_lst_node *>(
-            o, (const cm_lst_node **) area_node_ptrs_arr,
-            3, sc_opt_ptr_set_static_areas,
-            sc_opt_ptr_get_static_areas, std::nullopt);
+    //call constructor
+    o = sc_new_opt_struct();
+    REQUIRE_NE(o, nullptr);
 
-    } //end test
+    //call copy constructor
+    o_copy = sc_copy_opt_struct(o);
+    REQUIRE_NE(o_copy, nullptr);
 
 
-    //test 6: set & get `preset_offset`
-    SUBCASE(test_c_opt_subtests[6]) {
-        title(C, "sc_opt_ptr", "Set & get `preset_offsets`");
+    //test 1: add fields
+    SUBCASE(test_c_opt_struct_subtests[1]) {
+        title(C, "sc_opt_struct", "Add fields");
 
-        off_t offset_arr[3] = {
-            0x40,
-            0x80,
-            0x100
-        };
+        cm_vct value, value_hi;
+        cm_byte lo[4] = {0x00, 0x00, 0x00, 0x00};
+        cm_byte hi[4] = {0x64, 0x00, 0x00, 0x00};
 
-        _c_vector_test<sc_opt_ptr, off_t>(
-            o, offset_arr, 3, sc_opt_ptr_set_preset_offsets,
-            sc_opt_ptr_get_preset_offsets, std::nullopt);
+
+        //build the values of the fields
+        ret = cm_new_vct(&value, sizeof(cm_byte));
+        REQUIRE_EQ(ret, 0);
+        ret = cm_new_vct(&value_hi, sizeof(cm_byte));
+        REQUIRE_EQ(ret, 0);
+
+        for (int i = 0; i < 4; ++i) {
+            ret = cm_vct_apd(&value, &lo[i]);
+            CHECK_EQ(ret, 0);
+            ret = cm_vct_apd(&value_hi, &hi[i]);
+            CHECK_EQ(ret, 0);
+        }
+
+        //fields start out empty
+        CHECK_EQ(sc_opt_struct_get_fields_num(o), 0);
+
+        //add a ranged value field, an exact value field & a pointer field
+        ret = sc_opt_struct_add_val_field(o, 0x0, VT_I32, VP_RANGE,
+                                          &value, &value_hi);
+        CHECK_EQ(ret, 0);
+        ret = sc_opt_struct_add_val_field(o, 0x4, VT_I32, VP_EQ,
+                                          &value_hi, nullptr);
+        CHECK_EQ(ret, 0);
+        ret = sc_opt_struct_add_ptr_field(o, 0x10);
+        CHECK_EQ(ret, 0);
+
+        CHECK_EQ(sc_opt_struct_get_fields_num(o), 3);
+
+        //cleanup
+        cm_del_vct(&value);
+        cm_del_vct(&value_hi);
 
     } //end test
 
 
-    //test 7: set & get `smart_scan`
-    SUBCASE(test_c_opt_ptr_subtests[7]) {
-        title(C, "sc_opt_ptr", "Set & get `smart_scan`");
+    //test 2: set & get `alignment`
+    SUBCASE(test_c_opt_struct_subtests[2]) {
+        title(C, "sc_opt_struct", "Set & get `alignment`");
 
-        _c_val_test<sc_opt_ptr, bool>(
-            o, true, sc_opt_ptr_set_smart_scan,
-            sc_opt_ptr_get_smart_scan, std::nullopt);
+        _c_opt_test<sc_opt_struct, off_t>(
+                            o, 0x8, 0,
+                            sc_opt_struct_set_alignment,
+                            sc_opt_struct_get_alignment,
+                            std::nullopt);
 
     } //end test
 
 
-    //test 0 (cont.): destroy the pointer scan options objects
-    int _ret = sc_del_opt_ptr(o);
+    //test 3: reset
+    SUBCASE(test_c_opt_struct_subtests[3]) {
+        title(C, "sc_opt_struct", "Reset");
+
+        //set every option
+        ret = sc_opt_struct_add_ptr_field(o, 0x10);
+        CHECK_EQ(ret, 0);
+        ret = sc_opt_struct_set_alignment(o, 0x8);
+        CHECK_EQ(ret, 0);
+
+        //reset & check the options are back to their defaults
+        ret = sc_opt_struct_reset(o);
+        CHECK_EQ(ret, 0);
+
+        CHECK_EQ(sc_opt_struct_get_fields_num(o), 0);
+        CHECK_EQ(sc_opt_struct_get_alignment(o), 0);
+        CHECK_EQ(sc_errno, SC_ERR_OPT_EMPTY);
+
+        //cleanup
+        sc_errno = 0;
+
+    } //end test
+
+
+    //test 0 (cont.): destroy the structure scan options objects
+    int _ret = sc_del_opt_struct(o);
     CHECK_EQ(_ret, 0);
 
-    _ret = sc_del_opt_ptr(o_copy);
+    _ret = sc_del_opt_struct(o_copy);
     CHECK_EQ(_ret, 0);
 
 
 } //end TEST_CASE
-
@@ -0,0 +1,351 @@
+//standard template library
+#include <optional>
+#include <vector>
+
+//C standard library
+#include <cstdio>
+
+//external libraries
+#include <cmore.h>
+#include <memcry.h>
+#include <doctest/doctest.h>
+
+//system headers
+#include <unistd.h>
+
+//local headers
+#include "filters.hh"
+#include "common.hh"
+#include "memcry_helper.hh"
+#include "target_helper.hh"
+
+//test target headers
+#include "../lib/scancry.h"
+
+
+      /* ===================== *
+ ===== *  C++ INTERFACE TESTS  * =====
+       * ===================== */
+
+/*
+ *  --- [HELPERS] ---
+ */
+
+/*
+ *  NOTE: Scans are restricted to the mmap'ed `pattern1.bin` file, which
+ *        holds an incrementing byte pattern in its first page followed
+ *        by a decrementing pattern in its second page.
+ */
+
+//build the expected matches: `num` addresses `step` bytes apart
+static std::vector<uintptr_t> _expected_addrs(const uintptr_t addr,
+                                              const size_t step,
+                                              const size_t num) {
+
+    std::vector<uintptr_t> addrs;
+
+
+    for (size_t i = 0; i < num; ++i) addrs.push_back(addr + (i * step));
+
+    return addrs;
+}
+
+
+
+/*
+ *  --- [TESTS] ---
+ */
+
+TEST_CASE(test_cc_ptnscan_subtests[0]) {
+
+    int ret;
+
+    pid_t pid;
+    cm_lst_node * node;
+
+    _memcry_helper::args mcry_args;
+
+
+    sc::opt opts(sc::AW64);
+    sc::opt_ptn opts_ptn;
+    sc::map_area_set ma_set;
+    sc::worker_pool wpool;
+    sc::ptnscan ptnscan;
+
+
+    /*
+     *  FIXTURE: Setup minimum options & construct a pattern scanner.
+     */
+
+    //setup a target
+    ret = _target_helper::clean_targets();
+    CHECK_EQ(ret, 0);
+
+    pid = _target_helper::start_target();
+    CHECK_NE(pid, 0);
+
+    //setup MemCry
+    _memcry_helper::setup(mcry_args, pid, 8);
+
+
+    //setup generic options
+    ret = opts.set_map(&mcry_args.map);
+    CHECK_EQ(ret, 0);
+
+    std::vector<const mc_session *> session_ptrs = {
+        &mcry_args.sessions[0]
+    };
+    ret = opts.set_sessions(session_ptrs);
+    CHECK_EQ(ret, 0);
+
+    //only scan the first pattern file
+    node = mc_get_obj_by_basename(&mcry_args.map,
+                                  _target_helper::pattern_1_basename);
+    REQUIRE_NE(node, nullptr);
+    uintptr_t base = MC_GET_NODE_OBJ(node)->start_addr;
+
+    std::vector<const cm_lst_node *> exclusive_objs = {node};
+    ret = opts.set_exclusive_objs(exclusive_objs);
+    CHECK_EQ(ret, 0);
+
+    ret = ma_set.update_set(opts);
+    CHECK_EQ(ret, 0);
+
+
+    SUBCASE(test_cc_ptnscan_subtests[1]) {
+        title(CC, "ptnscan", "Perform pattern scans");
+
+        //first test: every wrap of the incrementing pattern
+        ret = opts_ptn.set_pattern_str("FE FF 00 01");
+        CHECK_EQ(ret, 0);
+
+        ret = ptnscan.scan(opts, opts_ptn, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(ptnscan.get_addrs(), _expected_addrs(base + 0xFE, 0x100, 15));
+
+
+        //second test: nibble wildcards find the same matches
+        ret = opts_ptn.set_pattern_str("?E FF 00 0?");
+        CHECK_EQ(ret, 0);
+
+        ret = ptnscan.scan(opts, opts_ptn, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(ptnscan.get_addrs(), _expected_addrs(base + 0xFE, 0x100, 15));
+
+    } //end test
+
+
+    SUBCASE(test_cc_ptnscan_subtests[2]) {
+        title(CC, "ptnscan", "Match across read buffers");
+
+        //first test: a pattern crossing from the first page into the second
+        ret = opts_ptn.set_pattern_str(
+            "F0 F1 ?? F3 F4 F5 F6 F7 F8 F9 FA FB FC FD FE FF "
+            "FF FE FD FC FB FA F9 ?8");
+        CHECK_EQ(ret, 0);
+
+        ret = ptnscan.scan(opts, opts_ptn, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(ptnscan.get_addrs(), _expected_addrs(base + 0xFF0, 0, 1));
+
+    } //end test
+
+
+    SUBCASE(test_cc_ptnscan_subtests[3]) {
+        title(CC, "ptnscan", "Patterns without whole bytes");
+
+        //first test: only nibbles are compared
+        ret = opts_ptn.set_pattern_str("? ?1 ?2");
+        CHECK_EQ(ret, 0);
+
+        ret = ptnscan.scan(opts, opts_ptn, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(ptnscan.get_addrs(), _expected_addrs(base, 0x10, 0x100));
+
+    } //end test
+
+
+    SUBCASE(test_cc_ptnscan_subtests[4]) {
+        title(CC, "ptnscan", "Reject invalid options");
+
+        //first test: missing pattern
+        ret = ptnscan.scan(opts, opts_ptn, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_OPT_MISSING);
+
+
+        //second test: mask does not match the size of the pattern
+        ret = opts_ptn.set_pattern(std::vector<cm_byte>{0xFE, 0xFF});
+        CHECK_EQ(ret, 0);
+        ret = opts_ptn.set_mask(std::vector<cm_byte>{0xFF});
+        CHECK_EQ(ret, 0);
+
+        ret = ptnscan.scan(opts, opts_ptn, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_OPT_PATTERN);
+
+        //cleanup
+        sc_errno = 0;
+
+    } //end test
+
+
+    SUBCASE(test_cc_ptnscan_subtests[5]) {
+        title(CC, "ptnscan", "Search for a set of patterns at once");
+
+        ssize_t ptn_idx;
+        sc::ptn_set p_set, p_set_loaded;
+
+        const char * test_file = "test_file.scps";
+
+
+        //literal, buffer seam, nibbles only & missing patterns
+        for (const char * pattern_str : {
+                 "FE FF 00 01",
+                 "F0 F1 ?? F3 F4 F5 F6 F7 F8 F9 FA FB FC FD FE FF "
+                 "FF FE FD FC FB FA F9 ?8",
+                 "? ?1 ?2",
+                 "10 20 30 40"}) {
+
+            ptn_idx = p_set.add_pattern_str(pattern_str);
+            CHECK_NE(ptn_idx, -1);
+        }
+
+        ret = p_set.compile();
+        CHECK_EQ(ret, 0);
+
+
+        //first test: one scan finds the matches of every pattern
+        ret = opts_ptn.set_signatures(&p_set);
+        CHECK_EQ(ret, 0);
+
+        ret = ptnscan.scan(opts, opts_ptn, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(ptnscan.get_ptns_num(), 4);
+        CHECK_EQ(ptnscan.get_addrs(0), _expected_addrs(base + 0xFE, 0x100, 15));
+        CHECK_EQ(ptnscan.get_addrs(1), _expected_addrs(base + 0xFF0, 0, 1));
+        CHECK_EQ(ptnscan.get_addrs(2), _expected_addrs(base, 0x10, 0x100));
+        CHECK_EQ(ptnscan.get_addrs(3).empty(), true);
+
+
+        //second test: a saved set finds the same matches once loaded
+        ret = p_set.save(test_file);
+        CHECK_EQ(ret, 0);
+        CHECK_NE(access("testfile.sc.tmp", F_OK), 0);
+        ret = p_set_loaded.load(test_file);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(p_set_loaded.get_ptns_num(), 4);
+        CHECK_EQ(p_set_loaded.is_compiled(), true);
+
+        ret = opts_ptn.set_signatures(&p_set_loaded);
+        CHECK_EQ(ret, 0);
+
+        ret = ptnscan.scan(opts, opts_ptn, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(ptnscan.get_addrs(0), _expected_addrs(base + 0xFE, 0x100, 15));
+        CHECK_EQ(ptnscan.get_addrs(1), _expected_addrs(base + 0xFF0, 0, 1));
+        CHECK_EQ(ptnscan.get_addrs(2), _expected_addrs(base, 0x10, 0x100));
+        CHECK_EQ(ptnscan.get_addrs(3).empty(), true);
+
+
+        //third test: a set changed since it was compiled is rejected
+        ptn_idx = p_set_loaded.add_pattern_str("C3");
+        CHECK_EQ(ptn_idx, 4);
+
+        ret = ptnscan.scan(opts, opts_ptn, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_OPT_PATTERN);
+
+
+        //fourth test: a failed save leaves no partial file behind
+        ret = p_set.save("missing_dir/testfile.sc");
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_FILE);
+        CHECK_NE(access("missing_dir/testfile.sc.tmp", F_OK), 0);
+
+        //cleanup
+        sc_errno = 0;
+        std::remove(test_file);
+
+    } //end test
+
+
+    SUBCASE(test_cc_ptnscan_subtests[6]) {
+        title(CC, "ptnscan", "Save & load scan results");
+
+        sc::serialiser serialiser;
+        sc::ptn_set p_set;
+
+
+        ret = opts.set_file_path_out(test_file);
+        CHECK_EQ(ret, 0);
+        ret = opts.set_file_path_in(test_file);
+        CHECK_EQ(ret, 0);
+
+        //search for a matching & a missing pattern
+        for (const char * pattern_str : {"FE FF 00 01", "10 20 30 40"}) {
+            CHECK_NE(p_set.add_pattern_str(pattern_str), -1);
+        }
+        ret = p_set.compile();
+        CHECK_EQ(ret, 0);
+        ret = opts_ptn.set_signatures(&p_set);
+        CHECK_EQ(ret, 0);
+
+        ret = ptnscan.scan(opts, opts_ptn, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        ret = serialiser.save_scan(ptnscan, opts);
+        CHECK_EQ(ret, 0);
+
+
+        //first test: the file header identifies a pattern scan
+        std::optional<sc::combined_file_hdr> hdr
+            = serialiser.read_headers(test_file);
+        REQUIRE_EQ(hdr.has_value(), true);
+        CHECK_EQ(hdr->scancry_hdr.scan_type, sc::scan_type_ptn);
+        CHECK_EQ(hdr->ptn_hdr.ptns_num, 2);
+        CHECK_EQ(hdr->ptn_hdr.addrs_num, 15);
+
+
+        //second test: shallow & deep loads restore the matches of each
+        //pattern
+        for (const bool shallow : {true, false}) {
+
+            ret = serialiser.load_scan(ptnscan, opts, shallow);
+            CHECK_EQ(ret, 0);
+            CHECK_EQ(ptnscan.get_ptns_num(), 2);
+            CHECK_EQ(ptnscan.get_addrs(0),
+                     _expected_addrs(base + 0xFE, 0x100, 15));
+            CHECK_EQ(ptnscan.get_addrs(1).empty(), true);
+        }
+
+
+        //third test: a scan without matches is not saved
+        ret = ptnscan.reset();
+        CHECK_EQ(ret, 0);
+
+        ret = serialiser.save_scan(ptnscan, opts);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_NO_RESULT);
+
+        //cleanup
+        sc_errno = 0;
+        std::remove(test_file);
+
+    } //end test
+
+
+    //free workers
+    ret = wpool.free_workers();
+    CHECK_EQ(ret, 0);
+
+    //reset the map area set
+    ret = ma_set.reset();
+    CHECK_EQ(ret, 0);
+
+    //teardown MemCry
+    _memcry_helper::teardown(mcry_args);
+
+    //teardown target
+    _target_helper::end_target(pid);
+}
@@ -1,6 +1,8 @@
 //standard template library
 #include <optional>
 #include <vector>
+#include <fstream>
+#include <algorithm>
 
 //external libraries
 #include <cmore.h>
@@ -9,6 +11,7 @@
 
 //system headers
 #include <unistd.h>
+#include <sys/stat.h>
 
 //local headers
 #include "filters.hh"
@@ -19,6 +22,8 @@
 //test target headers
 #include "../lib/scancry.h"
 #include "../lib/ptrscan.hh"
+#include "../lib/ptrscan_merge.hh"
+#include "../lib/addr_index.hh"
 
 
       /* ===================== * 
@@ -559,9 +564,10 @@ TEST_CASE(test_cc_ptrscan_subtests[0]) {
         CHECK_EQ(ret, 0);
 
         //setup sessions
-        std::vector<const mc_session *> session_ptrs = {
-            &mcry_args.sessions[0]
-        };
+        std::vector<const mc_session *> session_ptrs;
+        for (auto & session : mcry_args.sessions) {
+            session_ptrs.push_back(&session);
+        }
         ret = opts.set_sessions(session_ptrs);
         CHECK_EQ(ret, 0);
 
@@ -594,6 +600,7 @@ TEST_CASE(test_cc_ptrscan_subtests[0]) {
         //display results - original
         subtitle("target - player 2's armour", "original pointer chains");
         _print_chains(chains_0);
+        size_t chains_num = chains_0.size();
 
         //save scan results
         ret = serialiser.save_scan(ptrscan, opts);
@@ -613,6 +620,1161 @@ TEST_CASE(test_cc_ptrscan_subtests[0]) {
         subtitle("target - player 2's armour", "verified pointer chains");
         _print_chains(chains_1);
 
+        //the target did not change, so every chain must remain valid
+        CHECK_EQ(chains_1.size(), chains_num);
+
+        //verify chains again, reading through the target's PID
+        ret = opts.set_pid(pid);
+        CHECK_EQ(ret, 0);
+
+        ret = ptrscan.verify(opts, opts_ptr);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(ptrscan.get_chains().size(), chains_num);
+
+        //cleanup
+        ret = opts.set_pid(std::nullopt);
+        CHECK_EQ(ret, 0);
+
+    } //end test
+
+
+    SUBCASE(test_cc_ptrscan_subtests[5]) {
+        title(CC, "ptrscan", "Scan for multiple targets at once");
+
+        //setup sessions
+        std::vector<const mc_session *> session_ptrs;
+        for (auto & session : mcry_args.sessions) {
+            session_ptrs.push_back(&session);
+        }
+        ret = opts.set_sessions(session_ptrs);
+        CHECK_EQ(ret, 0);
+
+
+        //only test: scan for player 2's armour & player 1's name together
+
+        //dump map
+        subtitle("targets - player 2's armour & player 1's name",
+                 "target memory map");
+        _memcry_helper::print_map(&mcry_args.map);
+
+        //set the target addresses
+        std::vector<off_t> offs_0 = {
+            game_off,
+            entity_off * 1,
+            stats_off,
+            armour_off
+        };
+        std::vector<off_t> offs_1 = {
+            game_off,
+            entity_off * 0
+        };
+
+        std::vector<uintptr_t> target_addrs;
+        target_addrs.push_back(_set_target(opts_ptr, mcry_args.sessions[0],
+                                           mcry_args.map, offs_0));
+        target_addrs.push_back(_set_target(opts_ptr, mcry_args.sessions[0],
+                                           mcry_args.map, offs_1));
+        ret = opts_ptr.set_target_addrs(target_addrs);
+        CHECK_EQ(ret, 0);
+
+        //perform a single scan for both targets
+        ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        //fetch & display the scan results
+        const std::vector<struct sc::ptrscan_chain> & chains
+            = ptrscan.get_chains();
+        subtitle("targets - player 2's armour & player 1's name",
+                 "pointer chains");
+        _print_chains(chains);
+
+        //check every chain leads to a target & every target is reached
+        std::vector<int> target_hits(target_addrs.size(), 0);
+        for (auto iter = chains.cbegin(); iter != chains.cend(); ++iter) {
+            REQUIRE(iter->get_target_idx() < target_addrs.size());
+            ++target_hits[iter->get_target_idx()];
+        }
+        CHECK(target_hits[0] > 0);
+        CHECK(target_hits[1] > 0);
+
+        //verify every chain against its own target
+        size_t chains_num = chains.size();
+        ret = ptrscan.verify(opts, opts_ptr);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(ptrscan.get_chains().size(), chains_num);
+
+    } //end test
+
+
+    SUBCASE(test_cc_ptrscan_subtests[6]) {
+        title(CC, "ptrscan", "Filter scan results into a new file");
+
+        //setup serialiser
+        sc::serialiser serialiser;
+
+        //setup sessions
+        std::vector<const mc_session *> session_ptrs;
+        for (auto & session : mcry_args.sessions) {
+            session_ptrs.push_back(&session);
+        }
+        ret = opts.set_sessions(session_ptrs);
+        CHECK_EQ(ret, 0);
+
+
+        //first test: filter against the original target
+
+        //set the target address to player 2's armour
+        std::vector<off_t> offs_0 = {
+            game_off,
+            entity_off * 1,
+            stats_off,
+            armour_off
+        };
+        target_addr = _set_target(opts_ptr, mcry_args.sessions[0],
+                                  mcry_args.map, offs_0);
+
+        //perform the scan
+        ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        size_t chains_num = ptrscan.get_chains().size();
+
+        //filter into a new file
+        ret = opts.set_file_path_out(test_filter_file);
+        CHECK_EQ(ret, 0);
+        ret = ptrscan.filter(opts, opts_ptr);
+        CHECK_EQ(ret, 0);
+
+        //the original chains are left untouched
+        CHECK_EQ(ptrscan.get_chains().size(), chains_num);
+
+        //every chain survives since the target did not move
+        ret = opts.set_file_path_in(test_filter_file);
+        CHECK_EQ(ret, 0);
+        ret = serialiser.load_scan(ptrscan, opts, false);
+        CHECK_EQ(ret, 0);
+
+        subtitle("target - player 2's armour", "filtered pointer chains");
+        _print_chains(ptrscan.get_chains());
+        CHECK_EQ(ptrscan.get_chains().size(), chains_num);
+
+
+        //second test: a failed write leaves no partial output behind
+        ret = opts.set_file_path_out("missing_dir/test_filter_file.sc");
+        CHECK_EQ(ret, 0);
+        ret = ptrscan.filter(opts, opts_ptr);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_FILE);
+        CHECK_NE(access("missing_dir/test_filter_file.sc.tmp", F_OK), 0);
+
+        ret = opts.set_file_path_out(test_filter_file);
+        CHECK_EQ(ret, 0);
+        CHECK_NE(access("testfile_filter.sc.tmp", F_OK), 0);
+
+
+        //third test: filter against an address no chain leads to
+        ret = opts_ptr.set_target_addr(target_addr + 0x1);
+        CHECK_EQ(ret, 0);
+
+        ret = ptrscan.filter(opts, opts_ptr);
+        CHECK_EQ(ret, 0);
+
+        ret = serialiser.load_scan(ptrscan, opts, false);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(ptrscan.get_chains().size(), 0);
+
+    } //end test
+
+
+    SUBCASE(test_cc_ptrscan_subtests[7]) {
+        title(CC, "ptrscan", "Enforce scan limits");
+
+        //setup sessions
+        std::vector<const mc_session *> session_ptrs = {
+            &mcry_args.sessions[0]
+        };
+        ret = opts.set_sessions(session_ptrs);
+        CHECK_EQ(ret, 0);
+
+        //set the target address to player 2's armour
+        std::vector<off_t> offs_0 = {
+            game_off,
+            entity_off * 1,
+            stats_off,
+            armour_off
+        };
+        target_addr = _set_target(opts_ptr, mcry_args.sessions[0],
+                                  mcry_args.map, offs_0);
+
+
+        //first test: scan without limits
+        ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        size_t chains_num = ptrscan.get_chains().size();
+        CHECK_EQ(ptrscan.get_report().is_truncated(), false);
+
+
+        //second test: scan with every limit applied
+        ret = opts_ptr.set_max_chains(1);
+        CHECK_EQ(ret, 0);
+        ret = opts_ptr.set_max_level_nodes(2);
+        CHECK_EQ(ret, 0);
+        ret = opts_ptr.set_max_children(1);
+        CHECK_EQ(ret, 0);
+
+        ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        subtitle("target - player 2's armour", "limited pointer chains");
+        _print_chains(ptrscan.get_chains());
+
+        const sc::ptrscan_report & report = ptrscan.get_report();
+        std::cout << "dropped children:    " << report.children_dropped
+                  << std::endl;
+        std::cout << "dropped level nodes: " << report.level_nodes_dropped
+                  << std::endl;
+        std::cout << "dropped chains:      " << report.chains_dropped
+                  << std::endl;
+
+        CHECK(ptrscan.get_chains().size() <= 1);
+        if (chains_num > 1) CHECK_EQ(report.is_truncated(), true);
+
+    } //end test
+
+
+    SUBCASE(test_cc_ptrscan_subtests[8]) {
+        title(CC, "ptrscan", "Bidirectional scan from static areas");
+
+        cm_lst_node * obj_node, * static_node;
+        mc_vm_obj * obj;
+        mc_vm_area * static_area;
+        uintptr_t start_addr;
+
+        //setup sessions
+        std::vector<const mc_session *> session_ptrs = {
+            &mcry_args.sessions[0]
+        };
+        ret = opts.set_sessions(session_ptrs);
+        CHECK_EQ(ret, 0);
+
+        //set the target address to player 2's armour
+        std::vector<off_t> offs_0 = {
+            game_off,
+            entity_off * 1,
+            stats_off,
+            armour_off
+        };
+        target_addr = _set_target(opts_ptr, mcry_args.sessions[0],
+                                  mcry_args.map, offs_0);
+
+
+        //first test: scan without a bidirectional search
+        ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        size_t chains_num = ptrscan.get_chains().size();
+
+
+        //second test: bidirectional search without static areas fails
+        ret = opts_ptr.set_bidirectional(true);
+        CHECK_EQ(ret, 0);
+
+        ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_OPT_MISSING);
+
+
+        //third test: only keep chains rooted in the unit target's rw- area
+        obj_node = mcry_args.map.vm_objs.head->next;
+        static_node = _get_rw_area(obj_node);
+        static_area = MC_GET_NODE_AREA(static_node);
+
+        std::vector<const cm_lst_node *> static_areas = {static_node};
+        ret = opts_ptr.set_static_areas(static_areas);
+        CHECK_EQ(ret, 0);
+
+        ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        subtitle("target - player 2's armour", "bidirectional pointer chains");
+        _print_chains(ptrscan.get_chains());
+
+        CHECK(ptrscan.get_chains().empty() == false);
+        CHECK(ptrscan.get_chains().size() <= chains_num);
+
+        //every chain must start inside the static area
+        for (auto iter = ptrscan.get_chains().cbegin();
+             iter != ptrscan.get_chains().cend(); ++iter) {
+
+            obj = MC_GET_NODE_OBJ(iter->get_obj_node().value());
+            start_addr = obj->start_addr + iter->get_offsets()[0];
+            CHECK(start_addr >= static_area->start_addr);
+            CHECK(start_addr < static_area->end_addr);
+        }
+
+        //every chain must still lead to the target
+        ret = ptrscan.verify(opts, opts_ptr);
+        CHECK_EQ(ret, 0);
+        CHECK(ptrscan.get_chains().empty() == false);
+
+    } //end test
+
+
+    SUBCASE(test_cc_ptrscan_subtests[9]) {
+        title(CC, "ptrscan", "Checkpoint & resume a scan");
+
+        //setup sessions
+        std::vector<const mc_session *> session_ptrs = {
+            &mcry_args.sessions[0]
+        };
+        ret = opts.set_sessions(session_ptrs);
+        CHECK_EQ(ret, 0);
+
+        //set the target address to player 2's armour
+        std::vector<off_t> offs_0 = {
+            game_off,
+            entity_off * 1,
+            stats_off,
+            armour_off
+        };
+        target_addr = _set_target(opts_ptr, mcry_args.sessions[0],
+                                  mcry_args.map, offs_0);
+
+        ret = opts_ptr.set_checkpoint_path(test_ckpt_file);
+        CHECK_EQ(ret, 0);
+
+
+        //first test: a completed scan removes its checkpoint
+        ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        size_t chains_num = ptrscan.get_chains().size();
+        CHECK_NE(access(test_ckpt_file, F_OK), 0);
+
+
+        //second test: resume an interrupted scan
+        #ifdef DEBUG
+        //checkpoint the first depth levels of the last scan
+        ret = ptrscan.write_checkpoint(test_ckpt_file, opts_ptr, 0);
+        CHECK_EQ(ret, 0);
+        ret = ptrscan.write_checkpoint(test_ckpt_file, opts_ptr, 1);
+        CHECK_EQ(ret, 0);
+
+        //simulate a depth level interrupted while it was written
+        std::ofstream fs(test_ckpt_file, std::ios::out
+                         | std::ios::binary | std::ios::app);
+        uint32_t nodes_num = 0x100;
+        fs.write(reinterpret_cast<const char *>(&nodes_num),
+                 sizeof(nodes_num));
+        fs.close();
+
+        //resume the scan
+        ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        subtitle("target - player 2's armour", "resumed pointer chains");
+        _print_chains(ptrscan.get_chains());
+
+        CHECK_EQ(ptrscan.get_chains().size(), chains_num);
+        CHECK_NE(access(test_ckpt_file, F_OK), 0);
+
+
+        //third test: a checkpoint of a scan with other options is rejected
+        ret = ptrscan.write_checkpoint(test_ckpt_file, opts_ptr, 0);
+        CHECK_EQ(ret, 0);
+
+        ret = opts_ptr.set_max_children(4);
+        CHECK_EQ(ret, 0);
+        ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_INVALID_FILE);
+        ret = opts_ptr.set_max_children(std::nullopt);
+        CHECK_EQ(ret, 0);
+
+        ret = opts_ptr.set_max_depth(4);
+        CHECK_EQ(ret, 0);
+        ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_INVALID_FILE);
+        ret = opts_ptr.set_max_depth(3);
+        CHECK_EQ(ret, 0);
+
+        ret = opts_ptr.set_preset_offsets(std::vector<off_t>{0x0});
+        CHECK_EQ(ret, 0);
+        ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_INVALID_FILE);
+        ret = opts_ptr.set_preset_offsets(std::nullopt);
+        CHECK_EQ(ret, 0);
+
+        //the same options still resume
+        ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(ptrscan.get_chains().size(), chains_num);
+
+
+        //fourth test: a corrupt count of the first depth level is rejected
+        for (uint32_t bad_num : {(uint32_t) 0xffffffff, (uint32_t) 0x0}) {
+
+            ret = ptrscan.write_checkpoint(test_ckpt_file, opts_ptr, 0);
+            CHECK_EQ(ret, 0);
+
+            //overwrite the count of the first record
+            std::fstream ckpt_fs(test_ckpt_file, std::ios::in
+                                 | std::ios::out | std::ios::binary);
+            ckpt_fs.seekp(sizeof(struct sc::_ptrscan_ckpt_hdr));
+            ckpt_fs.write(reinterpret_cast<const char *>(&bad_num),
+                          sizeof(bad_num));
+            ckpt_fs.close();
+
+            ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+            CHECK_EQ(ret, -1);
+            CHECK_EQ(sc_errno, SC_ERR_INVALID_FILE);
+            std::remove(test_ckpt_file);
+        }
+
+        //cleanup
+        sc_errno = 0;
+        #else
+        DOCTEST_INFO("WARNING: This test requires a debug build (`-DDEBUG`).");
+        #endif
+
+    } //end test
+
+
+    SUBCASE(test_cc_ptrscan_subtests[10]) {
+        title(CC, "ptrscan", "Spill depth levels to disk");
+
+        //setup sessions
+        std::vector<const mc_session *> session_ptrs = {
+            &mcry_args.sessions[0]
+        };
+        ret = opts.set_sessions(session_ptrs);
+        CHECK_EQ(ret, 0);
+
+        //set the target address to player 2's armour
+        std::vector<off_t> offs_0 = {
+            game_off,
+            entity_off * 1,
+            stats_off,
+            armour_off
+        };
+        target_addr = _set_target(opts_ptr, mcry_args.sessions[0],
+                                  mcry_args.map, offs_0);
+
+
+        //first test: scan in memory
+        ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        std::vector<sc::ptrscan_chain> chains = ptrscan.get_chains();
+
+
+        //second test: scan with depth levels spilled to disk
+        ret = opts_ptr.set_spill_path(test_spill_file);
+        CHECK_EQ(ret, 0);
+
+        ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        subtitle("target - player 2's armour", "spilled pointer chains");
+        _print_chains(ptrscan.get_chains());
+
+        //the same chains must be found, in the same order
+        const std::vector<sc::ptrscan_chain> & spill_chains
+            = ptrscan.get_chains();
+        CHECK_EQ(spill_chains.size(), chains.size());
+        for (size_t i = 0; i < std::min(chains.size(),
+                                        spill_chains.size()); ++i) {
+
+            CHECK_EQ(spill_chains[i].get_offsets(), chains[i].get_offsets());
+            CHECK_EQ(spill_chains[i].get_target_idx(),
+                     chains[i].get_target_idx());
+        }
+
+        //the spill file must be removed
+        CHECK_NE(access(test_spill_file, F_OK), 0);
+
+
+        //third test: a failed scan must not leave a spill file behind
+        std::ofstream spill_fs(test_spill_file, std::ios::out
+                               | std::ios::binary | std::ios::trunc);
+        spill_fs << "stale";
+        spill_fs.close();
+
+        std::ofstream ckpt_fs(test_ckpt_file, std::ios::out
+                              | std::ios::binary | std::ios::trunc);
+        ckpt_fs << "not a checkpoint";
+        ckpt_fs.close();
+
+        ret = opts_ptr.set_checkpoint_path(test_ckpt_file);
+        CHECK_EQ(ret, 0);
+
+        ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_INVALID_FILE);
+        CHECK_NE(access(test_spill_file, F_OK), 0);
+
+        std::remove(test_ckpt_file);
+        ret = opts_ptr.set_checkpoint_path(std::nullopt);
+        CHECK_EQ(ret, 0);
+        sc_errno = 0;
+
+    } //end test
+
+
+    SUBCASE(test_cc_ptrscan_subtests[11]) {
+        title(CC, "ptrscan", "Negative offsets");
+
+        //setup serialiser
+        sc::serialiser serialiser;
+
+        ret = opts.set_file_path_out(test_file);
+        CHECK_EQ(ret, 0);
+        ret = opts.set_file_path_in(test_file);
+        CHECK_EQ(ret, 0);
+
+        //setup sessions
+        std::vector<const mc_session *> session_ptrs = {
+            &mcry_args.sessions[0]
+        };
+        ret = opts.set_sessions(session_ptrs);
+        CHECK_EQ(ret, 0);
+
+        //set the target address to player 2's armour
+        std::vector<off_t> offs_0 = {
+            game_off,
+            entity_off * 1,
+            stats_off,
+            armour_off
+        };
+        target_addr = _set_target(opts_ptr, mcry_args.sessions[0],
+                                  mcry_args.map, offs_0);
+
+
+        //first test: scan without negative offsets
+        ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        size_t chains_num = ptrscan.get_chains().size();
+
+
+        //second test: widen the window above every node
+        ret = opts_ptr.set_max_neg_off(0x20);
+        CHECK_EQ(ret, 0);
+
+        ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        subtitle("target - player 2's armour", "signed pointer chains");
+        _print_chains(ptrscan.get_chains());
+
+        CHECK(ptrscan.get_chains().size() >= chains_num);
+
+        //every chain must lead to the target
+        size_t signed_num = ptrscan.get_chains().size();
+        ret = ptrscan.verify(opts, opts_ptr);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(ptrscan.get_chains().size(), signed_num);
+
+
+        //third test: signed offsets survive a save & load
+        std::vector<sc::ptrscan_chain> chains = ptrscan.get_chains();
+
+        ret = serialiser.save_scan(ptrscan, opts);
+        CHECK_EQ(ret, 0);
+        ret = serialiser.load_scan(ptrscan, opts, true);
+        CHECK_EQ(ret, 0);
+
+        const std::vector<sc::ptrscan_chain> & loaded_chains
+            = ptrscan.get_chains();
+        CHECK_EQ(loaded_chains.size(), chains.size());
+        for (size_t i = 0; i < std::min(chains.size(),
+                                        loaded_chains.size()); ++i) {
+
+            CHECK_EQ(loaded_chains[i].get_offsets(), chains[i].get_offsets());
+        }
+
+    } //end test
+
+
+    SUBCASE(test_cc_ptrscan_subtests[12]) {
+        title(CC, "ptrscan", "Chain stability");
+
+        //setup serialiser
+        sc::serialiser serialiser;
+
+        ret = opts.set_file_path_out(test_file);
+        CHECK_EQ(ret, 0);
+        ret = opts.set_file_path_in(test_file);
+        CHECK_EQ(ret, 0);
+
+        //setup sessions
+        std::vector<const mc_session *> session_ptrs = {
+            &mcry_args.sessions[0]
+        };
+        ret = opts.set_sessions(session_ptrs);
+        CHECK_EQ(ret, 0);
+
+        //set the target address to player 2's armour
+        std::vector<off_t> offs_0 = {
+            game_off,
+            entity_off * 1,
+            stats_off,
+            armour_off
+        };
+        target_addr = _set_target(opts_ptr, mcry_args.sessions[0],
+                                  mcry_args.map, offs_0);
+
+        ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        size_t chains_num = ptrscan.get_chains().size();
+        for (auto & chain : ptrscan.get_chains()) {
+            CHECK_EQ(chain.get_checks(), 0);
+            CHECK_EQ(chain.get_stability(), 0.0);
+        }
+
+
+        //first test: score twice against an unchanged target
+        ret = ptrscan.score(opts, opts_ptr);
+        CHECK_EQ(ret, 0);
+        ret = ptrscan.score(opts, opts_ptr);
+        CHECK_EQ(ret, 0);
+
+        CHECK_EQ(ptrscan.get_chains().size(), chains_num);
+        for (auto & chain : ptrscan.get_chains()) {
+            CHECK_EQ(chain.get_checks(), 2);
+            CHECK_EQ(chain.get_hits(), 2);
+        }
+
+
+        //second test: score against player 1's armour
+        std::vector<off_t> offs_1 = {
+            game_off,
+            entity_off * 0,
+            stats_off,
+            armour_off
+        };
+        target_addr = _set_target(opts_ptr, mcry_args.sessions[0],
+                                  mcry_args.map, offs_1);
+
+        ret = ptrscan.score(opts, opts_ptr);
+        CHECK_EQ(ret, 0);
+
+        ret = ptrscan.rank_stability();
+        CHECK_EQ(ret, 0);
+
+        subtitle("target - player 1's armour", "ranked pointer chains");
+        _print_chains(ptrscan.get_chains());
+
+        const std::vector<sc::ptrscan_chain> & ranked_chains
+            = ptrscan.get_chains();
+        for (size_t i = 0; i < ranked_chains.size(); ++i) {
+            CHECK_EQ(ranked_chains[i].get_checks(), 3);
+            if (i == 0) continue;
+            CHECK(ranked_chains[i - 1].get_stability()
+                  >= ranked_chains[i].get_stability());
+        }
+
+
+        //third test: counters survive a save & load
+        std::vector<sc::ptrscan_chain> chains = ptrscan.get_chains();
+
+        ret = serialiser.save_scan(ptrscan, opts);
+        CHECK_EQ(ret, 0);
+        ret = serialiser.load_scan(ptrscan, opts, false);
+        CHECK_EQ(ret, 0);
+
+        const std::vector<sc::ptrscan_chain> & loaded_chains
+            = ptrscan.get_chains();
+        CHECK_EQ(loaded_chains.size(), chains.size());
+        for (size_t i = 0; i < std::min(chains.size(),
+                                        loaded_chains.size()); ++i) {
+
+            CHECK_EQ(loaded_chains[i].get_checks(), chains[i].get_checks());
+            CHECK_EQ(loaded_chains[i].get_hits(), chains[i].get_hits());
+        }
+
+
+        //fourth test: keep only chains that always resolved
+        ret = ptrscan.prune_stability(1.0);
+        CHECK_EQ(ret, 0);
+
+        for (auto & chain : ptrscan.get_chains()) {
+            CHECK_EQ(chain.get_hits(), chain.get_checks());
+        }
+
+    } //end test
+
+
+    SUBCASE(test_cc_ptrscan_subtests[13]) {
+        title(CC, "ptrscan", "Intersect & diff scan files");
+
+        //setup serialiser
+        sc::serialiser serialiser;
+
+        //setup sessions
+        std::vector<const mc_session *> session_ptrs = {
+            &mcry_args.sessions[0]
+        };
+        ret = opts.set_sessions(session_ptrs);
+        CHECK_EQ(ret, 0);
+
+        //scan for player 2's armour
+        std::vector<off_t> offs_0 = {
+            game_off,
+            entity_off * 1,
+            stats_off,
+            armour_off
+        };
+        target_addr = _set_target(opts_ptr, mcry_args.sessions[0],
+                                  mcry_args.map, offs_0);
+
+        ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        size_t chains_num_0 = ptrscan.get_chains().size();
+
+        ret = opts.set_file_path_out(test_file);
+        CHECK_EQ(ret, 0);
+        ret = serialiser.save_scan(ptrscan, opts);
+        CHECK_EQ(ret, 0);
+
+        //scan for player 1's armour
+        std::vector<off_t> offs_1 = {
+            game_off,
+            entity_off * 0,
+            stats_off,
+            armour_off
+        };
+        target_addr = _set_target(opts_ptr, mcry_args.sessions[0],
+                                  mcry_args.map, offs_1);
+
+        ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        ret = opts.set_file_path_out(test_filter_file);
+        CHECK_EQ(ret, 0);
+        ret = serialiser.save_scan(ptrscan, opts);
+        CHECK_EQ(ret, 0);
+
+        ret = opts.set_file_path_in(test_merge_file);
+        CHECK_EQ(ret, 0);
+
+
+        //first test: a file intersected with itself is unchanged
+        ret = serialiser.intersect_scans(
+                test_file, test_file, test_merge_file);
+        CHECK_EQ(ret, 0);
+
+        ret = serialiser.load_scan(ptrscan, opts, false);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(ptrscan.get_chains().size(), chains_num_0);
+
+
+        //second test: the difference of a file with itself is empty
+        ret = serialiser.diff_scans(test_file, test_file, test_merge_file);
+        CHECK_EQ(ret, 0);
+
+        ret = serialiser.load_scan(ptrscan, opts, true);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(ptrscan.get_chains().size(), 0);
+
+
+        //third test: intersection & difference partition the first file
+        ret = serialiser.intersect_scans(
+                test_file, test_filter_file, test_merge_file);
+        CHECK_EQ(ret, 0);
+
+        ret = serialiser.load_scan(ptrscan, opts, true);
+        CHECK_EQ(ret, 0);
+        size_t intersect_num = ptrscan.get_chains().size();
+
+        subtitle("player 1 & 2's armour", "common pointer chains");
+        _print_chains(ptrscan.get_chains());
+
+        ret = serialiser.diff_scans(
+                test_file, test_filter_file, test_merge_file);
+        CHECK_EQ(ret, 0);
+
+        ret = serialiser.load_scan(ptrscan, opts, true);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(intersect_num + ptrscan.get_chains().size(), chains_num_0);
+
+        #ifdef DEBUG
+        //fourth test: force one run per chain
+        sc::_ptrscan_merge merge(1);
+        ret = merge.combine(test_file, test_filter_file,
+                            test_merge_file, sc::_merge_op_intersect);
+        CHECK_EQ(ret, 0);
+
+        ret = serialiser.load_scan(ptrscan, opts, true);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(ptrscan.get_chains().size(), intersect_num);
+
+        //fifth test: merge the runs in several passes
+        sc::_ptrscan_merge merge_passes(1, 2);
+        ret = merge_passes.combine(test_file, test_filter_file,
+                                   test_merge_file, sc::_merge_op_diff);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(merge_passes.run_paths.size(), 0);
+
+        ret = serialiser.load_scan(ptrscan, opts, true);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(intersect_num + ptrscan.get_chains().size(), chains_num_0);
+        #endif
+
+        //sixth test: a merge is only renamed into place once complete
+        CHECK_NE(access("testfile_merge.sc.tmp", F_OK), 0);
+
+        ret = mkdir("testfile_merge_dir", 0700);
+        CHECK_EQ(ret, 0);
+        ret = serialiser.intersect_scans(
+                test_file, test_filter_file, "testfile_merge_dir");
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_FILE);
+        CHECK_NE(access("testfile_merge_dir.tmp", F_OK), 0);
+        ret = rmdir("testfile_merge_dir");
+        CHECK_EQ(ret, 0);
+
+        //cleanup
+        std::remove(test_filter_file);
+        std::remove(test_merge_file);
+
+    } //end test
+
+
+    SUBCASE(test_cc_ptrscan_subtests[14]) {
+        title(CC, "ptrscan", "Pruning policies");
+
+        //setup sessions
+        std::vector<const mc_session *> session_ptrs = {
+            &mcry_args.sessions[0]
+        };
+        ret = opts.set_sessions(session_ptrs);
+        CHECK_EQ(ret, 0);
+
+        //set the target address to player 2's armour
+        std::vector<off_t> offs_0 = {
+            game_off,
+            entity_off * 1,
+            stats_off,
+            armour_off
+        };
+        target_addr = _set_target(opts_ptr, mcry_args.sessions[0],
+                                  mcry_args.map, offs_0);
+
+
+        //first test: scan without pruning policies
+        ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        size_t chains_num = ptrscan.get_chains().size();
+        CHECK_EQ(ptrscan.get_report().non_static_dropped, 0);
+        CHECK_EQ(ptrscan.get_report().array_nodes_dropped, 0);
+
+
+        //second test: prefer static areas & collapse array scans
+        ret = opts_ptr.set_prefer_static(true);
+        CHECK_EQ(ret, 0);
+        ret = opts_ptr.set_max_array_run(1);
+        CHECK_EQ(ret, 0);
+
+        ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        subtitle("target - player 2's armour", "pruned pointer chains");
+        _print_chains(ptrscan.get_chains());
+
+        const sc::ptrscan_report & report = ptrscan.get_report();
+        std::cout << "dropped non-static nodes: " << report.non_static_dropped
+                  << std::endl;
+        std::cout << "dropped array nodes:      " << report.array_nodes_dropped
+                  << std::endl;
+
+        CHECK(ptrscan.get_chains().size() <= chains_num);
+        if (ptrscan.get_chains().size() < chains_num) {
+            CHECK_EQ(report.is_truncated(), true);
+        }
+
+        //pruning must never produce invalid chains
+        size_t pruned_num = ptrscan.get_chains().size();
+        if (pruned_num != 0) {
+            ret = ptrscan.verify(opts, opts_ptr);
+            CHECK_EQ(ret, 0);
+            CHECK_EQ(ptrscan.get_chains().size(), pruned_num);
+        }
+
+    } //end test
+
+
+    SUBCASE(test_cc_ptrscan_subtests[15]) {
+        title(CC, "ptrscan", "Pointer index");
+
+        sc::ptr_index ptr_idx;
+
+        //setup sessions
+        std::vector<const mc_session *> session_ptrs = {
+            &mcry_args.sessions[0]
+        };
+        ret = opts.set_sessions(session_ptrs);
+        CHECK_EQ(ret, 0);
+
+        //locate player 2's armour & the pointer to player 2
+        std::vector<off_t> offs_0 = {
+            game_off,
+            entity_off * 1,
+            stats_off,
+            armour_off
+        };
+        target_addr = _set_target(opts_ptr, mcry_args.sessions[0],
+                                  mcry_args.map, offs_0);
+
+        cm_lst_node * area_node
+            = _get_rw_area(mcry_args.map.vm_objs.head->next);
+        mc_vm_area * area = MC_GET_NODE_AREA(area_node);
+
+        uintptr_t entity_addr = _walk_ptrchain(
+            mcry_args.sessions[0], area->start_addr,
+            {game_off, entity_off * 1, 0});
+        uintptr_t entity_ptr_addr = _walk_ptrchain(
+            mcry_args.sessions[0], area->start_addr,
+            {game_off, entity_off * 1});
+
+
+        //first test: build the index
+        ret = ptr_idx.build(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        const std::vector<sc::ptr_index_entry> & entries
+            = ptr_idx.get_entries();
+        std::cout << "indexed pointers: " << entries.size() << std::endl;
+        CHECK_NE(entries.size(), 0);
+        for (size_t i = 1; i < entries.size(); ++i) {
+            CHECK(entries[i - 1].value <= entries[i].value);
+        }
+
+
+        //second test: find who points at player 2's armour
+        std::vector<sc::ptr_index_entry> found
+            = ptr_idx.query(target_addr, 0x20);
+
+        bool has_entity_ptr = false;
+        for (auto iter = found.begin(); iter != found.end(); ++iter) {
+
+            CHECK(iter->value <= target_addr);
+            CHECK(iter->value >= (target_addr - 0x20));
+            if (iter->value == entity_addr
+                && iter->addr == entity_ptr_addr) has_entity_ptr = true;
+        }
+        CHECK_EQ(has_entity_ptr, true);
+
+        //the query must match a linear search of the index
+        size_t linear_num = std::count_if(entries.begin(), entries.end(),
+            [&](const sc::ptr_index_entry & e) {
+                return e.value <= target_addr
+                       && e.value >= (target_addr - 0x20);
+            });
+        CHECK_EQ(found.size(), linear_num);
+
+
+        //third test: refreshing unchanged memory leaves the index as is
+        size_t entries_num = entries.size();
+        ret = ptr_idx.refresh(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(ptr_idx.get_entries().size(), entries_num);
+        CHECK_EQ(ptr_idx.query(target_addr, 0x20).size(), found.size());
+
+    } //end test
+
+
+    SUBCASE(test_cc_ptrscan_subtests[16]) {
+        title(CC, "ptrscan", "Resolve chain objects through the object index");
+
+        sc::_addr_index obj_index;
+        const struct sc::_addr_index_entry * entry;
+
+        cm_lst_node * obj_node;
+        mc_vm_obj * obj;
+
+
+        //setup sessions
+        std::vector<const mc_session *> session_ptrs = {
+            &mcry_args.sessions[0]
+        };
+        ret = opts.set_sessions(session_ptrs);
+        CHECK_EQ(ret, 0);
+
+
+        //first test: every object is found by the addresses it holds
+        obj_index.build_objs(mcry_args.map);
+        const std::vector<struct sc::_addr_index_entry> & entries
+            = obj_index.get_entries();
+        CHECK_EQ(entries.size(), mcry_args.map.vm_objs.len);
+        CHECK_EQ(std::is_sorted(entries.begin(), entries.end(),
+                 [](const struct sc::_addr_index_entry & a,
+                    const struct sc::_addr_index_entry & b) {
+                     return a.start_addr < b.start_addr;
+                 }), true);
+
+        obj_node = mcry_args.map.vm_objs.head;
+        for (int i = 0; i < mcry_args.map.vm_objs.len; ++i) {
+
+            obj = MC_GET_NODE_OBJ(obj_node);
+
+            entry = obj_index.find_containing(obj->start_addr);
+            REQUIRE_NE(entry, nullptr);
+            CHECK_EQ(entry->node, obj_node);
+
+            entry = obj_index.find_containing(obj->end_addr - 1);
+            REQUIRE_NE(entry, nullptr);
+            CHECK_EQ(entry->node, obj_node);
+
+            obj_node = obj_node->next;
+        }
+
+
+        //second test: lookups that miss
+        entry = obj_index.find_preceding(entries.front().start_addr - 1);
+        CHECK_EQ(entry, nullptr);
+        entry = obj_index.find_containing(entries.front().start_addr - 1);
+        CHECK_EQ(entry, nullptr);
+
+        //past the last object, an address is only preceded by it
+        entry = obj_index.find_containing(entries.back().end_addr);
+        CHECK_EQ(entry, nullptr);
+        entry = obj_index.find_preceding(entries.back().end_addr);
+        REQUIRE_NE(entry, nullptr);
+        CHECK_EQ(entry->node, entries.back().node);
+
+
+        //third test: every chain starts in the object the index resolves
+        std::vector<off_t> offs_0 = {
+            game_off,
+            entity_off * 1,
+            stats_off,
+            armour_off
+        };
+        target_addr = _set_target(opts_ptr, mcry_args.sessions[0],
+                                  mcry_args.map, offs_0);
+
+        ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        const std::vector<struct sc::ptrscan_chain> & chains
+            = ptrscan.get_chains();
+        CHECK_NE(chains.size(), 0);
+
+        for (auto iter = chains.begin(); iter != chains.end(); ++iter) {
+
+            REQUIRE_EQ(iter->get_obj_node().has_value(), true);
+            obj = MC_GET_NODE_OBJ(iter->get_obj_node().value());
+
+            entry = obj_index.find_preceding(
+                obj->start_addr + iter->get_offsets()[0]);
+            REQUIRE_NE(entry, nullptr);
+            CHECK_EQ(entry->node, iter->get_obj_node().value());
+        }
+
+        //cleanup
+        obj_index.clear();
+        CHECK_EQ(obj_index.get_entries().size(), 0);
+        CHECK_EQ(obj_index.find_preceding(target_addr), nullptr);
+
+    } //end test
+
+
+    SUBCASE(test_cc_ptrscan_subtests[17]) {
+        title(CC, "ptrscan", "Intern chain pathnames");
+
+        int idx;
+        size_t pathnames_num;
+        mc_vm_obj * obj;
+
+        sc::serialiser serialiser;
+
+
+        //setup sessions
+        std::vector<const mc_session *> session_ptrs = {
+            &mcry_args.sessions[0]
+        };
+        ret = opts.set_sessions(session_ptrs);
+        CHECK_EQ(ret, 0);
+
+        ret = opts.set_file_path_out(test_file);
+        CHECK_EQ(ret, 0);
+        ret = opts.set_file_path_in(test_file);
+        CHECK_EQ(ret, 0);
+
+
+        //first test: every chain's pathname is interned exactly once
+        std::vector<off_t> offs_0 = {
+            game_off,
+            entity_off * 1,
+            stats_off,
+            armour_off
+        };
+        target_addr = _set_target(opts_ptr, mcry_args.sessions[0],
+                                  mcry_args.map, offs_0);
+
+        ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        CHECK_NE(ptrscan.get_chains().size(), 0);
+
+        pathnames_num = ptrscan.ser_pathnames.size();
+        CHECK_EQ(ptrscan.cache.pathname_idxs.size(), pathnames_num);
+        for (size_t i = 0; i < pathnames_num; ++i) {
+            CHECK_EQ(ptrscan.cache.pathname_idxs.at(
+                         ptrscan.ser_pathnames[i]), i);
+        }
+
+        for (auto iter = ptrscan.get_chains().begin();
+             iter != ptrscan.get_chains().end(); ++iter) {
+
+            obj = MC_GET_NODE_OBJ(iter->get_obj_node().value());
+            CHECK_EQ(ptrscan.ser_pathnames[iter->_get_obj_idx()],
+                     std::string(obj->pathname));
+        }
+
+
+        //second test: lookups that hit & miss the table
+        idx = ptrscan.get_chain_idx(ptrscan.ser_pathnames[0]);
+        CHECK_EQ(idx, 0);
+        CHECK_EQ(ptrscan.ser_pathnames.size(), pathnames_num);
+
+        idx = ptrscan.get_chain_idx("/not/a/mapped/object");
+        CHECK_EQ(idx, pathnames_num);
+        CHECK_EQ(ptrscan.ser_pathnames.size(), pathnames_num + 1);
+
+        idx = ptrscan.get_chain_idx("/not/a/mapped/object");
+        CHECK_EQ(idx, pathnames_num);
+        CHECK_EQ(ptrscan.ser_pathnames.size(), pathnames_num + 1);
+
+        ptrscan.clear_pathnames();
+        CHECK_EQ(ptrscan.ser_pathnames.size(), 0);
+        CHECK_EQ(ptrscan.cache.pathname_idxs.size(), 0);
+
+
+        //third test: loaded chains resolve their object by pathname
+        ret = ptrscan.scan(opts, opts_ptr, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        size_t chains_num = ptrscan.get_chains().size();
+
+        ret = serialiser.save_scan(ptrscan, opts);
+        CHECK_EQ(ret, 0);
+        ret = serialiser.load_scan(ptrscan, opts, false);
+        CHECK_EQ(ret, 0);
+
+        CHECK_EQ(ptrscan.get_chains().size(), chains_num);
+        for (auto iter = ptrscan.get_chains().begin();
+             iter != ptrscan.get_chains().end(); ++iter) {
+
+            REQUIRE_EQ(iter->get_obj_node().has_value(), true);
+            obj = MC_GET_NODE_OBJ(iter->get_obj_node().value());
+            CHECK_EQ(ptrscan.ser_pathnames[iter->_get_obj_idx()],
+                     std::string(obj->pathname));
+        }
+
     } //end test
 
 
@@ -5,6 +5,9 @@
 #include <cstdio>
 #include <cstring>
 
+//system headers
+#include <unistd.h>
+
 //external libraries
 #include <cmore.h>
 #include <memcry.h>
@@ -18,6 +21,7 @@
 //test target headers
 #include "../lib/scancry.h"
 #include "../lib/serialiser.hh"
+#include "../lib/ptrscan.hh"
 
 
       /* ===================== * 
@@ -86,7 +90,7 @@ TEST_CASE(test_cc_serialiser_subtests[0]) {
                          (const char *) sc::file_magic,
                          sizeof(sc::file_magic)), 0);
         CHECK_EQ(cmb_hdr->scancry_hdr.scan_type, sc::scan_type_ptr);
-        CHECK_EQ(cmb_hdr->scancry_hdr.version, sc::file_ver_0);
+        CHECK_EQ(cmb_hdr->scancry_hdr.version, sc::file_ver_cur);
 
         //assert the scan header
         CHECK_EQ(cmb_hdr->ptr_hdr.chains_num,
@@ -100,5 +104,34 @@ TEST_CASE(test_cc_serialiser_subtests[0]) {
 
     } //end test
 
+
+    //test 3: saving a scan without a result keeps the previous file
+    SUBCASE(test_cc_serialiser_subtests[3]) {
+
+        sc::ptrscan empty_scan;
+        std::optional<sc::combined_file_hdr> cmb_hdr;
+
+        ret = serialiser.save_scan(fix_scan, opts);
+        CHECK_EQ(ret, 0);
+
+        ret = serialiser.save_scan(empty_scan, opts);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_NO_RESULT);
+
+        //the previously saved file is still intact
+        cmb_hdr = serialiser.read_headers(test_file);
+        REQUIRE_EQ(cmb_hdr.has_value(), true);
+        CHECK_EQ(cmb_hdr->ptr_hdr.chains_num,
+                 _scan_helper::chains_num);
+
+        //no temporary file is left behind
+        CHECK_NE(access("test_file.sc.tmp", F_OK), 0);
+
+        //cleanup
+        ret = std::remove(test_file);
+        CHECK_EQ(ret, 0);
+
+    } //end test
+
     return;
 }
@@ -0,0 +1,371 @@
+//standard template library
+#include <optional>
+#include <vector>
+#include <string>
+#include <algorithm>
+
+//C standard library
+#include <cstdio>
+#include <cctype>
+
+//external libraries
+#include <cmore.h>
+#include <memcry.h>
+#include <doctest/doctest.h>
+
+//system headers
+#include <unistd.h>
+
+//local headers
+#include "filters.hh"
+#include "common.hh"
+#include "memcry_helper.hh"
+#include "target_helper.hh"
+
+//test target headers
+#include "../lib/scancry.h"
+
+
+      /* ===================== *
+ ===== *  C++ INTERFACE TESTS  * =====
+       * ===================== */
+
+/*
+ *  --- [HELPERS] ---
+ */
+
+/*
+ *  NOTE: `unit_target` holds the UTF-8 player names of `names` & the
+ *        UTF-16LE string "Unit Target".
+ */
+
+//check results are sorted & every result holds an ASCII string
+static void _check_matches(mc_session & session,
+                           const std::vector<struct sc::str_match> & matches,
+                           const std::string & str,
+                           const bool case_insensitive) {
+
+    int ret;
+    size_t unit_sz;
+    std::vector<cm_byte> buf;
+
+
+    CHECK_EQ(std::is_sorted(matches.begin(), matches.end(),
+                            [](const sc::str_match & a,
+                               const sc::str_match & b) {
+                                return a.addr < b.addr;
+                            }), true);
+
+    for (auto iter = matches.begin(); iter != matches.end(); ++iter) {
+
+        unit_sz = (iter->enc == sc::SE_UTF8) ? 1 : 2;
+        buf.resize(str.size() * unit_sz);
+
+        ret = mc_read(&session, iter->addr, buf.data(), buf.size());
+        CHECK_EQ(ret, 0);
+
+        for (size_t i = 0; i < str.size(); ++i) {
+
+            if (case_insensitive == true) {
+                CHECK_EQ(std::tolower(buf[i * unit_sz]), std::tolower(str[i]));
+            } else {
+                CHECK_EQ(buf[i * unit_sz], (cm_byte) str[i]);
+            }
+            if (unit_sz == 2) CHECK_EQ(buf[(i * unit_sz) + 1], 0x00);
+        }
+    }
+
+    return;
+}
+
+
+//count the results of one encoding
+static size_t _count_enc(const std::vector<struct sc::str_match> & matches,
+                         const enum sc::str_enc enc) {
+
+    return std::count_if(matches.begin(), matches.end(),
+                         [enc](const sc::str_match & m) {
+                             return m.enc == enc;
+                         });
+}
+
+
+
+/*
+ *  --- [TESTS] ---
+ */
+
+TEST_CASE(test_cc_strscan_subtests[0]) {
+
+    int ret;
+
+    pid_t pid;
+
+    _memcry_helper::args mcry_args;
+
+
+    sc::opt opts(sc::AW64);
+    sc::opt_str opts_str;
+    sc::map_area_set ma_set;
+    sc::worker_pool wpool;
+    sc::strscan strscan;
+
+
+    /*
+     *  FIXTURE: Setup minimum options & construct a string scanner.
+     */
+
+    //setup a target
+    ret = _target_helper::clean_targets();
+    CHECK_EQ(ret, 0);
+
+    pid = _target_helper::start_target();
+    CHECK_NE(pid, 0);
+
+    //setup MemCry
+    _memcry_helper::setup(mcry_args, pid, 8);
+
+
+    //setup generic options
+    ret = opts.set_map(&mcry_args.map);
+    CHECK_EQ(ret, 0);
+
+    std::vector<const mc_session *> session_ptrs = {
+        &mcry_args.sessions[0]
+    };
+    ret = opts.set_sessions(session_ptrs);
+    CHECK_EQ(ret, 0);
+
+    //setup a scan on the entire map
+    ret = ma_set.update_set(opts);
+    CHECK_EQ(ret, 0);
+
+
+    SUBCASE(test_cc_strscan_subtests[1]) {
+        title(CC, "strscan", "Perform string scans");
+
+        //first test: a player name, in the preset table & its entity
+        ret = opts_str.set_str("boris");
+        CHECK_EQ(ret, 0);
+        ret = opts_str.set_encodings(sc::SE_UTF8);
+        CHECK_EQ(ret, 0);
+
+        ret = strscan.scan(opts, opts_str, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        std::vector<struct sc::str_match> matches = strscan.get_matches();
+        std::cout << "matches: " << matches.size() << std::endl;
+        CHECK(matches.size() >= 2);
+        CHECK_EQ(_count_enc(matches, sc::SE_UTF8), matches.size());
+        _check_matches(mcry_args.sessions[0], matches, "boris", false);
+        std::vector<struct sc::str_match> name_matches = matches;
+
+
+        //second test: a UTF-16LE string, tagged with its encoding
+        ret = opts_str.set_str("Unit Target");
+        CHECK_EQ(ret, 0);
+        ret = opts_str.set_encodings(sc::SE_UTF8 | sc::SE_UTF16LE);
+        CHECK_EQ(ret, 0);
+
+        ret = strscan.scan(opts, opts_str, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        matches = strscan.get_matches();
+        CHECK(_count_enc(matches, sc::SE_UTF16LE) >= 1);
+        _check_matches(mcry_args.sessions[0], matches, "Unit Target", false);
+
+
+        //third test: null termination
+        ret = opts_str.set_null_term(true);
+        CHECK_EQ(ret, 0);
+
+        ret = strscan.scan(opts, opts_str, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        CHECK(_count_enc(strscan.get_matches(), sc::SE_UTF16LE) >= 1);
+
+        ret = opts_str.set_str("Unit Targ");
+        CHECK_EQ(ret, 0);
+
+        ret = strscan.scan(opts, opts_str, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(_count_enc(strscan.get_matches(), sc::SE_UTF16LE), 0);
+
+
+        //fourth test: threaded scans find the same results
+        std::vector<const mc_session *> threaded_session_ptrs;
+        for (int i = 0; i < 8; ++i) {
+            threaded_session_ptrs.push_back(&mcry_args.sessions[i]);
+        }
+        ret = opts.set_sessions(threaded_session_ptrs);
+        CHECK_EQ(ret, 0);
+
+        ret = opts_str.set_str("boris");
+        CHECK_EQ(ret, 0);
+        ret = opts_str.set_encodings(sc::SE_UTF8);
+        CHECK_EQ(ret, 0);
+        ret = opts_str.set_null_term(false);
+        CHECK_EQ(ret, 0);
+
+        ret = strscan.scan(opts, opts_str, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        REQUIRE_EQ(strscan.get_matches().size(), name_matches.size());
+        for (size_t i = 0; i < name_matches.size(); ++i) {
+            CHECK_EQ(strscan.get_matches()[i].addr, name_matches[i].addr);
+        }
+
+
+        //fifth test: reset
+        ret = strscan.reset();
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(strscan.get_matches().size(), 0);
+
+    } //end test
+
+
+    SUBCASE(test_cc_strscan_subtests[2]) {
+        title(CC, "strscan", "Match without regard to case");
+
+        std::vector<uintptr_t> exact_addrs, folded_addrs;
+
+
+        //first test: every exact match is also a case insensitive match
+        ret = opts_str.set_str("boris");
+        CHECK_EQ(ret, 0);
+
+        ret = strscan.scan(opts, opts_str, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        for (auto & m : strscan.get_matches()) exact_addrs.push_back(m.addr);
+
+        ret = opts_str.set_str("BoRiS");
+        CHECK_EQ(ret, 0);
+        ret = opts_str.set_case_insensitive(true);
+        CHECK_EQ(ret, 0);
+
+        ret = strscan.scan(opts, opts_str, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        for (auto & m : strscan.get_matches()) folded_addrs.push_back(m.addr);
+
+        CHECK(exact_addrs.empty() == false);
+        CHECK_EQ(std::includes(folded_addrs.begin(), folded_addrs.end(),
+                               exact_addrs.begin(), exact_addrs.end()), true);
+        _check_matches(mcry_args.sessions[0],
+                       strscan.get_matches(), "boris", true);
+
+
+        //second test: folding applies to UTF-16LE as well
+        ret = opts_str.set_str("UNIT TARGET");
+        CHECK_EQ(ret, 0);
+        ret = opts_str.set_encodings(sc::SE_UTF16LE);
+        CHECK_EQ(ret, 0);
+
+        ret = strscan.scan(opts, opts_str, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        CHECK(strscan.get_matches().empty() == false);
+        _check_matches(mcry_args.sessions[0],
+                       strscan.get_matches(), "unit target", true);
+
+    } //end test
+
+
+    SUBCASE(test_cc_strscan_subtests[3]) {
+        title(CC, "strscan", "Reject invalid options");
+
+        //first test: missing string
+        ret = strscan.scan(opts, opts_str, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_OPT_MISSING);
+
+
+        //second test: empty & malformed UTF-8 strings
+        for (const char * str : {"", "bor\xC0\xAFis", "bor\xE2\x82"}) {
+
+            ret = opts_str.set_str(str);
+            CHECK_EQ(ret, 0);
+
+            ret = strscan.scan(opts, opts_str, ma_set, wpool, 0x0);
+            CHECK_EQ(ret, -1);
+            CHECK_EQ(sc_errno, SC_ERR_OPT_STRING);
+        }
+
+
+        //third test: no encoding is selected
+        ret = opts_str.set_str("boris");
+        CHECK_EQ(ret, 0);
+        ret = opts_str.set_encodings(0x0);
+        CHECK_EQ(ret, 0);
+
+        ret = strscan.scan(opts, opts_str, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_OPT_STRING);
+
+        //cleanup
+        sc_errno = 0;
+
+    } //end test
+
+
+    SUBCASE(test_cc_strscan_subtests[4]) {
+        title(CC, "strscan", "Save & load scan results");
+
+        sc::serialiser serialiser;
+        std::vector<struct sc::str_match> matches;
+
+
+        ret = opts.set_file_path_out(test_file);
+        CHECK_EQ(ret, 0);
+        ret = opts.set_file_path_in(test_file);
+        CHECK_EQ(ret, 0);
+
+        //scan for every encoding of a string
+        ret = opts_str.set_str("Unit Target");
+        CHECK_EQ(ret, 0);
+
+        ret = strscan.scan(opts, opts_str, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        matches = strscan.get_matches();
+
+        ret = serialiser.save_scan(strscan, opts);
+        CHECK_EQ(ret, 0);
+
+
+        //first test: the file header identifies a string scan
+        std::optional<sc::combined_file_hdr> hdr
+            = serialiser.read_headers(test_file);
+        REQUIRE_EQ(hdr.has_value(), true);
+        CHECK_EQ(hdr->scancry_hdr.scan_type, sc::scan_type_str);
+        CHECK_EQ(hdr->str_hdr.matches_num, matches.size());
+
+
+        //second test: shallow & deep loads restore every match
+        for (const bool shallow : {true, false}) {
+
+            ret = serialiser.load_scan(strscan, opts, shallow);
+            CHECK_EQ(ret, 0);
+            REQUIRE_EQ(strscan.get_matches().size(), matches.size());
+
+            for (size_t i = 0; i < matches.size(); ++i) {
+                CHECK_EQ(strscan.get_matches()[i].addr, matches[i].addr);
+                CHECK_EQ(strscan.get_matches()[i].enc, matches[i].enc);
+            }
+        }
+
+        //cleanup
+        std::remove(test_file);
+
+    } //end test
+
+
+    //free workers
+    ret = wpool.free_workers();
+    CHECK_EQ(ret, 0);
+
+    //reset the map area set
+    ret = ma_set.reset();
+    CHECK_EQ(ret, 0);
+
+    //teardown MemCry
+    _memcry_helper::teardown(mcry_args);
+
+    //teardown target
+    _target_helper::end_target(pid);
+}
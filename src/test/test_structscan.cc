@@ -0,0 +1,469 @@
+//standard template library
+#include <optional>
+#include <vector>
+#include <algorithm>
+
+//C standard library
+#include <cstring>
+
+//external libraries
+#include <cmore.h>
+#include <memcry.h>
+#include <doctest/doctest.h>
+
+//system headers
+#include <unistd.h>
+
+//local headers
+#include "filters.hh"
+#include "common.hh"
+#include "memcry_helper.hh"
+#include "target_helper.hh"
+
+//test target headers
+#include "../lib/scancry.h"
+
+
+      /* ===================== *
+ ===== *  C++ INTERFACE TESTS  * =====
+       * ===================== */
+
+/*
+ *  --- [HELPERS] ---
+ */
+
+/*
+ *  NOTE: The offset of `game_off` depends on the build of `unit_target`.
+ *        If tests fail, verify this offset is correct.
+ */
+
+const constexpr off_t game_off   = 0xb0; //NOTE: Depends on build
+const constexpr off_t entity_off = sizeof(uintptr_t);
+const constexpr off_t name_off   = 0x0;
+const constexpr off_t stats_off  = 0x10;
+const constexpr off_t pos_off    = 0x18;
+const constexpr off_t health_off = 0x0;
+const constexpr off_t armour_off = 0x4;
+
+//initial health & armour of every player
+const constexpr int32_t start_stat = 100;
+
+
+//find the address of a player's entity
+static uintptr_t _get_entity_addr(mc_session & session, mc_vm_map & map,
+                                  const int player) {
+
+    int ret;
+    uintptr_t addr;
+
+    cm_lst_node * area_node = nullptr;
+    mc_vm_area * area;
+
+
+    //find the `rw-` area of the target object
+    mc_vm_obj * obj = MC_GET_NODE_OBJ(map.vm_objs.head->next);
+    for (int i = 0; i < obj->vm_area_node_ps.len; ++i) {
+
+        ret = cm_lst_get(&obj->vm_area_node_ps, i, &area_node);
+        CHECK_EQ(ret, 0);
+        area = MC_GET_NODE_AREA(area_node);
+
+        if (area->access == (MC_ACCESS_READ | MC_ACCESS_WRITE)) break;
+    }
+
+    //walk game -> entity
+    addr = area->start_addr + game_off;
+    ret = mc_read(&session, addr, (cm_byte *) &addr, sizeof(addr));
+    CHECK_EQ(ret, 0);
+
+    addr += entity_off * player;
+    ret = mc_read(&session, addr, (cm_byte *) &addr, sizeof(addr));
+    CHECK_EQ(ret, 0);
+
+    return addr;
+}
+
+
+//find the address of a player's stats or position
+static uintptr_t _get_member_addr(mc_session & session, mc_vm_map & map,
+                                  const int player, const off_t member_off) {
+
+    int ret;
+    uintptr_t addr;
+
+
+    addr = _get_entity_addr(session, map, player) + member_off;
+    ret = mc_read(&session, addr, (cm_byte *) &addr, sizeof(addr));
+    CHECK_EQ(ret, 0);
+
+    return addr;
+}
+
+
+//build a value field
+template <typename T>
+static struct sc::struct_field _val_field(const off_t off,
+                                          const enum sc::val_type type,
+                                          const T value) {
+
+    struct sc::struct_field field = {
+        off, sc::SF_VALUE, type, sc::VP_EQ,
+        std::vector<cm_byte>(sizeof(T)), {}
+    };
+
+    std::memcpy(field.value.data(), &value, sizeof(T));
+
+    return field;
+}
+
+
+//build a value field matching a range
+template <typename T>
+static struct sc::struct_field _range_field(const off_t off,
+                                            const enum sc::val_type type,
+                                            const T lo, const T hi) {
+
+    struct sc::struct_field field = _val_field<T>(off, type, lo);
+
+    field.predicate = sc::VP_RANGE;
+    field.value_hi.resize(sizeof(T));
+    std::memcpy(field.value_hi.data(), &hi, sizeof(T));
+
+    return field;
+}
+
+
+//build a pointer field
+static struct sc::struct_field _ptr_field(const off_t off) {
+
+    return {off, sc::SF_PTR, sc::VT_U64, sc::VP_EQ, {}, {}};
+}
+
+
+//check a result is present
+static bool _has_addr(const std::vector<uintptr_t> & addrs,
+                      const uintptr_t addr) {
+
+    return std::binary_search(addrs.begin(), addrs.end(), addr);
+}
+
+
+
+/*
+ *  --- [TESTS] ---
+ */
+
+TEST_CASE(test_cc_structscan_subtests[0]) {
+
+    int ret;
+
+    pid_t pid;
+
+    _memcry_helper::args mcry_args;
+
+
+    sc::opt opts(sc::AW64);
+    sc::opt_struct opts_struct;
+    sc::map_area_set ma_set;
+    sc::worker_pool wpool;
+    sc::structscan structscan;
+
+
+    /*
+     *  FIXTURE: Setup minimum options & construct a structure scanner.
+     */
+
+    //setup a target
+    ret = _target_helper::clean_targets();
+    CHECK_EQ(ret, 0);
+
+    pid = _target_helper::start_target();
+    CHECK_NE(pid, 0);
+
+    //setup MemCry
+    _memcry_helper::setup(mcry_args, pid, 8);
+
+
+    //setup generic options
+    ret = opts.set_map(&mcry_args.map);
+    CHECK_EQ(ret, 0);
+
+    std::vector<const mc_session *> session_ptrs = {
+        &mcry_args.sessions[0]
+    };
+    ret = opts.set_sessions(session_ptrs);
+    CHECK_EQ(ret, 0);
+
+    //setup a scan on the entire map
+    ret = ma_set.update_set(opts);
+    CHECK_EQ(ret, 0);
+
+
+    SUBCASE(test_cc_structscan_subtests[1]) {
+        title(CC, "structscan", "Perform structure scans");
+
+        int32_t stats[2];
+        std::vector<uintptr_t> addrs;
+
+
+        //first test: every player's stats
+        ret = opts_struct.set_fields({
+            _val_field<int32_t>(health_off, sc::VT_I32, start_stat),
+            _val_field<int32_t>(armour_off, sc::VT_I32, start_stat)
+        });
+        CHECK_EQ(ret, 0);
+        ret = opts_struct.set_alignment(0x4);
+        CHECK_EQ(ret, 0);
+
+        ret = structscan.scan(opts, opts_struct, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        addrs = structscan.get_addrs();
+        std::cout << "addrs: " << addrs.size() << std::endl;
+        CHECK_EQ(std::is_sorted(addrs.begin(), addrs.end()), true);
+
+        for (int i = 0; i < 4; ++i) {
+            CHECK_EQ(_has_addr(addrs, _get_member_addr(
+                mcry_args.sessions[0], mcry_args.map, i, stats_off)), true);
+        }
+
+        //every result holds both fields
+        for (auto iter = addrs.begin(); iter != addrs.end(); ++iter) {
+
+            ret = mc_read(&mcry_args.sessions[0],
+                          *iter, (cm_byte *) stats, sizeof(stats));
+            CHECK_EQ(ret, 0);
+            CHECK_EQ(stats[0], start_stat);
+            CHECK_EQ(stats[1], start_stat);
+        }
+
+
+        //second test: threaded scans find the same results
+        std::vector<const mc_session *> threaded_session_ptrs;
+        for (int i = 0; i < 8; ++i) {
+            threaded_session_ptrs.push_back(&mcry_args.sessions[i]);
+        }
+        ret = opts.set_sessions(threaded_session_ptrs);
+        CHECK_EQ(ret, 0);
+
+        ret = structscan.scan(opts, opts_struct, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(structscan.get_addrs(), addrs);
+
+
+        //third test: alignments that do not divide a read buffer
+        for (const off_t alignment : {0x1, 0x10}) {
+
+            ret = opts_struct.set_alignment(alignment);
+            CHECK_EQ(ret, 0);
+
+            ret = structscan.scan(opts, opts_struct, ma_set, wpool, 0x0);
+            CHECK_EQ(ret, 0);
+
+            //areas start on a page, keep results aligned to both
+            std::vector<uintptr_t> common;
+            const off_t both = std::max(alignment, (off_t) 0x4);
+            for (auto iter = structscan.get_addrs().begin();
+                 iter != structscan.get_addrs().end(); ++iter) {
+                if ((*iter % both) == 0) common.push_back(*iter);
+            }
+
+            std::vector<uintptr_t> expected;
+            for (auto iter = addrs.begin(); iter != addrs.end(); ++iter) {
+                if ((*iter % both) == 0) expected.push_back(*iter);
+            }
+            CHECK_EQ(common, expected);
+        }
+
+
+        //fourth test: reset
+        ret = structscan.reset();
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(structscan.get_addrs().size(), 0);
+
+    } //end test
+
+
+    SUBCASE(test_cc_structscan_subtests[2]) {
+        title(CC, "structscan", "Match pointer fields");
+
+        uintptr_t ptrs[2];
+        std::vector<uintptr_t> addrs;
+
+
+        //first test: every entity, by its name & members
+        ret = opts_struct.set_fields({
+            _ptr_field(stats_off),
+            _ptr_field(pos_off),
+            _range_field<cm_byte>(name_off, sc::VT_U8, 'a', 'z')
+        });
+        CHECK_EQ(ret, 0);
+        ret = opts_struct.set_alignment(0x8);
+        CHECK_EQ(ret, 0);
+
+        ret = structscan.scan(opts, opts_struct, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        addrs = structscan.get_addrs();
+        for (int i = 0; i < 4; ++i) {
+            CHECK_EQ(_has_addr(addrs, _get_entity_addr(
+                mcry_args.sessions[0], mcry_args.map, i)), true);
+        }
+
+        //every result points into the map
+        for (auto iter = addrs.begin(); iter != addrs.end(); ++iter) {
+
+            ret = mc_read(&mcry_args.sessions[0], *iter + stats_off,
+                          (cm_byte *) ptrs, sizeof(ptrs));
+            CHECK_EQ(ret, 0);
+            CHECK_NE(ptrs[0], 0);
+            CHECK_NE(ptrs[1], 0);
+        }
+
+
+        //second test: a pointer never holds a small value
+        ret = opts_struct.set_fields({
+            _ptr_field(stats_off),
+            _val_field<uint64_t>(pos_off, sc::VT_U64, 0x1)
+        });
+        CHECK_EQ(ret, 0);
+
+        ret = structscan.scan(opts, opts_struct, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        for (int i = 0; i < 4; ++i) {
+            CHECK_EQ(_has_addr(structscan.get_addrs(), _get_entity_addr(
+                mcry_args.sessions[0], mcry_args.map, i)), false);
+        }
+
+    } //end test
+
+
+    SUBCASE(test_cc_structscan_subtests[3]) {
+        title(CC, "structscan", "Match fields inside ranges");
+
+        float pos[3];
+
+
+        //first test: every position, all coordinates are below 100
+        ret = opts_struct.set_fields({
+            _range_field<float>(0x0, sc::VT_F32, 0.0f, 99.0f),
+            _range_field<float>(0x4, sc::VT_F32, 0.0f, 99.0f),
+            _range_field<float>(0x8, sc::VT_F32, 0.0f, 99.0f)
+        });
+        CHECK_EQ(ret, 0);
+        ret = opts_struct.set_alignment(0x4);
+        CHECK_EQ(ret, 0);
+
+        ret = structscan.scan(opts, opts_struct, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        for (int i = 0; i < 4; ++i) {
+            CHECK_EQ(_has_addr(structscan.get_addrs(), _get_member_addr(
+                mcry_args.sessions[0], mcry_args.map, i, pos_off)), true);
+        }
+
+        for (auto iter = structscan.get_addrs().begin();
+             iter != structscan.get_addrs().end(); ++iter) {
+
+            ret = mc_read(&mcry_args.sessions[0],
+                          *iter, (cm_byte *) pos, sizeof(pos));
+            CHECK_EQ(ret, 0);
+            for (int i = 0; i < 3; ++i) {
+                CHECK(pos[i] >= 0.0f);
+                CHECK(pos[i] <= 99.0f);
+            }
+        }
+
+
+        //second test: a range of health & an exact armour
+        ret = opts_struct.set_fields({
+            _range_field<int32_t>(health_off, sc::VT_I32, 90, 110),
+            _val_field<int32_t>(armour_off, sc::VT_I32, start_stat)
+        });
+        CHECK_EQ(ret, 0);
+
+        ret = structscan.scan(opts, opts_struct, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        for (int i = 0; i < 4; ++i) {
+            CHECK_EQ(_has_addr(structscan.get_addrs(), _get_member_addr(
+                mcry_args.sessions[0], mcry_args.map, i, stats_off)), true);
+        }
+
+    } //end test
+
+
+    SUBCASE(test_cc_structscan_subtests[4]) {
+        title(CC, "structscan", "Reject invalid options");
+
+        //first test: missing fields & alignment
+        ret = structscan.scan(opts, opts_struct, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_OPT_MISSING);
+
+        ret = opts_struct.set_fields({
+            _val_field<int32_t>(health_off, sc::VT_I32, start_stat)
+        });
+        CHECK_EQ(ret, 0);
+
+        ret = structscan.scan(opts, opts_struct, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_OPT_MISSING);
+
+
+        //second test: malformed fields
+        ret = opts_struct.set_alignment(0x4);
+        CHECK_EQ(ret, 0);
+
+        struct sc::struct_field increased
+            = _val_field<int32_t>(health_off, sc::VT_I32, start_stat);
+        increased.predicate = sc::VP_INCREASED;
+
+        const std::vector<std::vector<struct sc::struct_field>> bad_fields = {
+            {_ptr_field(stats_off), _ptr_field(pos_off)},
+            {_val_field<int32_t>(-0x4, sc::VT_I32, start_stat)},
+            {_val_field<int32_t>(0x1000, sc::VT_I32, start_stat)},
+            {increased}
+        };
+
+        for (auto iter = bad_fields.begin(); iter != bad_fields.end(); ++iter) {
+
+            ret = opts_struct.set_fields(*iter);
+            CHECK_EQ(ret, 0);
+
+            ret = structscan.scan(opts, opts_struct, ma_set, wpool, 0x0);
+            CHECK_EQ(ret, -1);
+            CHECK_EQ(sc_errno, SC_ERR_OPT_STRUCT);
+        }
+
+
+        //third test: a value of the wrong size
+        ret = opts_struct.set_fields({
+            _val_field<int16_t>(health_off, sc::VT_I32, start_stat)
+        });
+        CHECK_EQ(ret, 0);
+
+        ret = structscan.scan(opts, opts_struct, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_OPT_VALUE);
+
+        //cleanup
+        sc_errno = 0;
+
+    } //end test
+
+
+    //free workers
+    ret = wpool.free_workers();
+    CHECK_EQ(ret, 0);
+
+    //reset the map area set
+    ret = ma_set.reset();
+    CHECK_EQ(ret, 0);
+
+    //teardown MemCry
+    _memcry_helper::teardown(mcry_args);
+
+    //teardown target
+    _target_helper::end_target(pid);
+}
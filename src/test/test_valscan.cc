@@ -0,0 +1,885 @@
+//standard template library
+#include <optional>
+#include <vector>
+#include <algorithm>
+
+//C standard library
+#include <cstdio>
+#include <cstring>
+
+//external libraries
+#include <cmore.h>
+#include <memcry.h>
+#include <doctest/doctest.h>
+
+//system headers
+#include <unistd.h>
+
+//local headers
+#include "filters.hh"
+#include "common.hh"
+#include "memcry_helper.hh"
+#include "target_helper.hh"
+
+//test target headers
+#include "../lib/scancry.h"
+#include "../lib/valscan.hh"
+
+
+      /* ===================== *
+ ===== *  C++ INTERFACE TESTS  * =====
+       * ===================== */
+
+/*
+ *  --- [HELPERS] ---
+ */
+
+/*
+ *  NOTE: The offset of `game_off` depends on the build of `unit_target`.
+ *        If tests fail, verify this offset is correct.
+ */
+
+const constexpr off_t game_off   = 0xb0; //NOTE: Depends on build
+const constexpr off_t entity_off = sizeof(uintptr_t);
+const constexpr off_t stats_off  = 0x10;
+const constexpr off_t pos_off    = 0x18;
+const constexpr off_t health_off = 0x0;
+
+//initial health & armour of every player
+const constexpr int32_t start_stat = 100;
+
+
+//find the address of a player's stats or position
+static uintptr_t _get_player_addr(mc_session & session, mc_vm_map & map,
+                                  const int player, const off_t member_off) {
+
+    int ret;
+    uintptr_t addr;
+
+    cm_lst_node * area_node = nullptr;
+    mc_vm_area * area;
+
+
+    //find the `rw-` area of the target object
+    mc_vm_obj * obj = MC_GET_NODE_OBJ(map.vm_objs.head->next);
+    for (int i = 0; i < obj->vm_area_node_ps.len; ++i) {
+
+        ret = cm_lst_get(&obj->vm_area_node_ps, i, &area_node);
+        CHECK_EQ(ret, 0);
+        area = MC_GET_NODE_AREA(area_node);
+
+        if (area->access == (MC_ACCESS_READ | MC_ACCESS_WRITE)) break;
+    }
+
+    //walk game -> entity -> stats / pos
+    addr = area->start_addr + game_off;
+    ret = mc_read(&session, addr, (cm_byte *) &addr, sizeof(addr));
+    CHECK_EQ(ret, 0);
+
+    addr += entity_off * player;
+    ret = mc_read(&session, addr, (cm_byte *) &addr, sizeof(addr));
+    CHECK_EQ(ret, 0);
+
+    addr += member_off;
+    ret = mc_read(&session, addr, (cm_byte *) &addr, sizeof(addr));
+    CHECK_EQ(ret, 0);
+
+    return addr;
+}
+
+
+//set the type, alignment & value of a value scan
+template <typename T>
+static void _set_value(sc::opt_val & opts_val, const enum sc::val_type type,
+                       const off_t alignment, const T value) {
+
+    int ret;
+    std::vector<cm_byte> bytes(sizeof(T));
+
+
+    std::memcpy(bytes.data(), &value, sizeof(T));
+
+    ret = opts_val.set_type(type);
+    CHECK_EQ(ret, 0);
+    ret = opts_val.set_alignment(alignment);
+    CHECK_EQ(ret, 0);
+    ret = opts_val.set_value(bytes);
+    CHECK_EQ(ret, 0);
+
+    return;
+}
+
+
+//check results are sorted & every result holds the value
+template <typename T>
+static void _check_addrs(mc_session & session,
+                         const std::vector<uintptr_t> & addrs,
+                         const T value) {
+
+    int ret;
+    T cur;
+
+
+    CHECK_EQ(std::is_sorted(addrs.begin(), addrs.end()), true);
+
+    for (auto iter = addrs.begin(); iter != addrs.end(); ++iter) {
+
+        ret = mc_read(&session, *iter, (cm_byte *) &cur, sizeof(cur));
+        CHECK_EQ(ret, 0);
+        CHECK(std::memcmp(&cur, &value, sizeof(cur)) == 0);
+    }
+
+    return;
+}
+
+
+//check results are sorted & every result holds a value inside a range
+template <typename T>
+static void _check_range(mc_session & session,
+                         const std::vector<uintptr_t> & addrs,
+                         const T lo, const T hi) {
+
+    int ret;
+    T cur;
+
+
+    CHECK_EQ(std::is_sorted(addrs.begin(), addrs.end()), true);
+
+    for (auto iter = addrs.begin(); iter != addrs.end(); ++iter) {
+
+        ret = mc_read(&session, *iter, (cm_byte *) &cur, sizeof(cur));
+        CHECK_EQ(ret, 0);
+        CHECK(cur >= lo);
+        CHECK(cur <= hi);
+    }
+
+    return;
+}
+
+
+//check a result is present
+static bool _has_addr(const std::vector<uintptr_t> & addrs,
+                      const uintptr_t addr) {
+
+    return std::binary_search(addrs.begin(), addrs.end(), addr);
+}
+
+
+
+/*
+ *  --- [TESTS] ---
+ */
+
+TEST_CASE(test_cc_valscan_subtests[0]) {
+
+    int ret;
+
+    pid_t pid;
+
+    _memcry_helper::args mcry_args;
+
+
+    sc::opt opts(sc::AW64);
+    sc::opt_val opts_val;
+    sc::map_area_set ma_set;
+    sc::worker_pool wpool;
+    sc::valscan valscan;
+
+
+    /*
+     *  FIXTURE: Setup minimum options & construct a value scanner.
+     */
+
+    //setup a target
+    ret = _target_helper::clean_targets();
+    CHECK_EQ(ret, 0);
+
+    pid = _target_helper::start_target();
+    CHECK_NE(pid, 0);
+
+    //setup MemCry
+    _memcry_helper::setup(mcry_args, pid, 8);
+
+
+    //setup generic options
+    ret = opts.set_map(&mcry_args.map);
+    CHECK_EQ(ret, 0);
+
+    std::vector<const mc_session *> session_ptrs = {
+        &mcry_args.sessions[0]
+    };
+    ret = opts.set_sessions(session_ptrs);
+    CHECK_EQ(ret, 0);
+
+    //setup a scan on the entire map
+    ret = ma_set.update_set(opts);
+    CHECK_EQ(ret, 0);
+
+    uintptr_t health_addr = _get_player_addr(mcry_args.sessions[0],
+                                             mcry_args.map, 1, stats_off)
+                            + health_off;
+
+
+    SUBCASE(test_cc_valscan_subtests[1]) {
+        title(CC, "valscan", "Perform value scans");
+
+        //first test: scan for the health & armour of every player
+        _set_value<int32_t>(opts_val, sc::VT_I32, 4, start_stat);
+
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        std::vector<uintptr_t> addrs = valscan.get_addrs();
+        std::cout << "matches: " << addrs.size() << std::endl;
+        CHECK_EQ(valscan.get_addrs_num(), addrs.size());
+        CHECK(addrs.size() >= 8);
+        _check_addrs<int32_t>(mcry_args.sessions[0], addrs, start_stat);
+
+        CHECK_EQ(_has_addr(addrs, health_addr), true);
+        CHECK_EQ(_has_addr(addrs, health_addr + sizeof(int32_t)), true);
+
+
+        //second test: an unaligned scan finds every aligned match
+        std::vector<uintptr_t> aligned_addrs = addrs;
+        _set_value<int32_t>(opts_val, sc::VT_I32, 1, start_stat);
+
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        _check_addrs<int32_t>(mcry_args.sessions[0],
+                              valscan.get_addrs(), start_stat);
+        std::vector<uintptr_t> unaligned_addrs = valscan.get_addrs();
+        CHECK_EQ(std::includes(unaligned_addrs.begin(),
+                               unaligned_addrs.end(),
+                               aligned_addrs.begin(),
+                               aligned_addrs.end()), true);
+
+
+        //third test: threaded scans find the same results
+        std::vector<const mc_session *> threaded_session_ptrs;
+        for (int i = 0; i < 8; ++i) {
+            threaded_session_ptrs.push_back(&mcry_args.sessions[i]);
+        }
+        ret = opts.set_sessions(threaded_session_ptrs);
+        CHECK_EQ(ret, 0);
+
+        _set_value<int32_t>(opts_val, sc::VT_I32, 4, start_stat);
+
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(valscan.get_addrs(), aligned_addrs);
+
+
+        //fourth test: reset
+        ret = valscan.reset();
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(valscan.get_addrs().size(), 0);
+
+    } //end test
+
+
+    SUBCASE(test_cc_valscan_subtests[2]) {
+        title(CC, "valscan", "Scan every value type");
+
+        //first test: 8bit unaligned
+        _set_value<uint8_t>(opts_val, sc::VT_U8, 1, start_stat);
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        _check_addrs<uint8_t>(mcry_args.sessions[0],
+                              valscan.get_addrs(), start_stat);
+        CHECK_EQ(_has_addr(valscan.get_addrs(), health_addr), true);
+
+
+        //second test: 16bit
+        _set_value<int16_t>(opts_val, sc::VT_I16, 2, start_stat);
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        _check_addrs<int16_t>(mcry_args.sessions[0],
+                              valscan.get_addrs(), start_stat);
+        CHECK_EQ(_has_addr(valscan.get_addrs(), health_addr), true);
+
+
+        //third test: 64bit spanning health & armour
+        uint64_t both = ((uint64_t) start_stat << 32) | start_stat;
+        _set_value<uint64_t>(opts_val, sc::VT_U64, 4, both);
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        _check_addrs<uint64_t>(mcry_args.sessions[0],
+                               valscan.get_addrs(), both);
+        CHECK_EQ(_has_addr(valscan.get_addrs(), health_addr), true);
+
+
+        //fourth test: floating point
+        _set_value<float>(opts_val, sc::VT_F32, 4, 0.0f);
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        _check_addrs<float>(mcry_args.sessions[0],
+                            valscan.get_addrs(), 0.0f);
+
+        _set_value<double>(opts_val, sc::VT_F64, 8, 0.0);
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        _check_addrs<double>(mcry_args.sessions[0],
+                             valscan.get_addrs(), 0.0);
+
+    } //end test
+
+
+    SUBCASE(test_cc_valscan_subtests[3]) {
+        title(CC, "valscan", "Reject invalid options");
+
+        //first test: missing options
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_OPT_MISSING);
+
+
+        //second test: value does not match the size of its type
+        _set_value<int16_t>(opts_val, sc::VT_I32, 4, start_stat);
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_OPT_VALUE);
+
+
+        //third test: alignment larger than a chunk
+        _set_value<int32_t>(opts_val, sc::VT_I32,
+                            sc::_val_chunk_sz * 2, start_stat);
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_OPT_VALUE);
+
+        //cleanup
+        sc_errno = 0;
+
+    } //end test
+
+
+    SUBCASE(test_cc_valscan_subtests[4]) {
+        title(CC, "valscan", "Narrow candidates with next scans");
+
+        //first test: scan for the health & armour of every player
+        _set_value<int32_t>(opts_val, sc::VT_I32, 4, start_stat);
+
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        size_t first_num = valscan.get_addrs_num();
+
+
+        //second test: nothing changed yet
+        ret = opts_val.set_predicate(sc::VP_UNCHANGED);
+        CHECK_EQ(ret, 0);
+
+        ret = valscan.next_scan(opts, opts_val);
+        CHECK_EQ(ret, 0);
+        CHECK(valscan.get_addrs_num() <= first_num);
+        CHECK_EQ(_has_addr(valscan.get_addrs(), health_addr), true);
+
+
+        //third test: every player loses health & armour
+        _target_helper::change_target(pid);
+
+        ret = opts_val.set_predicate(sc::VP_DECREASED);
+        CHECK_EQ(ret, 0);
+
+        ret = valscan.next_scan(opts, opts_val);
+        CHECK_EQ(ret, 0);
+
+        std::vector<uintptr_t> addrs = valscan.get_addrs();
+        CHECK_EQ(_has_addr(addrs, health_addr), true);
+        CHECK_EQ(_has_addr(addrs, health_addr + sizeof(int32_t)), true);
+
+
+        //fourth test: player 2 loses 2 health & 4 armour
+        _target_helper::change_target(pid);
+
+        ret = opts_val.set_predicate(sc::VP_DECREASED_BY);
+        CHECK_EQ(ret, 0);
+        _set_value<int32_t>(opts_val, sc::VT_I32, 4, 2);
+
+        ret = valscan.next_scan(opts, opts_val);
+        CHECK_EQ(ret, 0);
+
+        addrs = valscan.get_addrs();
+        CHECK_EQ(_has_addr(addrs, health_addr), true);
+        CHECK_EQ(_has_addr(addrs, health_addr + sizeof(int32_t)), false);
+
+
+        //fifth test: compare against a known value
+        ret = opts_val.set_predicate(sc::VP_EQ);
+        CHECK_EQ(ret, 0);
+        _set_value<int32_t>(opts_val, sc::VT_I32, 4, start_stat - 4);
+
+        ret = valscan.next_scan(opts, opts_val);
+        CHECK_EQ(ret, 0);
+
+        addrs = valscan.get_addrs();
+        CHECK_EQ(_has_addr(addrs, health_addr), true);
+        _check_addrs<int32_t>(mcry_args.sessions[0], addrs, start_stat - 4);
+
+
+        //sixth test: no player gains health, every candidate is dropped
+        _target_helper::change_target(pid);
+
+        ret = opts_val.set_predicate(sc::VP_INCREASED);
+        CHECK_EQ(ret, 0);
+
+        ret = valscan.next_scan(opts, opts_val);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(_has_addr(valscan.get_addrs(), health_addr), false);
+
+
+        //seventh test: fail without candidates or with a bad operand
+        ret = valscan.reset();
+        CHECK_EQ(ret, 0);
+
+        ret = valscan.next_scan(opts, opts_val);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_NO_RESULT);
+
+        _set_value<int32_t>(opts_val, sc::VT_I32, 4, start_stat - 6);
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        ret = opts_val.set_predicate(sc::VP_INCREASED_BY);
+        CHECK_EQ(ret, 0);
+        _set_value<int16_t>(opts_val, sc::VT_I16, 2, 1);
+
+        ret = valscan.next_scan(opts, opts_val);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_OPT_VALUE);
+
+
+        //eighth test: next scans split between sessions agree
+        ret = opts_val.set_predicate(sc::VP_EQ);
+        CHECK_EQ(ret, 0);
+        _set_value<int32_t>(opts_val, sc::VT_I32, 4, start_stat - 6);
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        ret = opts_val.set_predicate(sc::VP_UNCHANGED);
+        CHECK_EQ(ret, 0);
+        ret = valscan.next_scan(opts, opts_val);
+        CHECK_EQ(ret, 0);
+        addrs = valscan.get_addrs();
+
+        std::vector<const mc_session *> threaded_session_ptrs;
+        for (int i = 0; i < 8; ++i) {
+            threaded_session_ptrs.push_back(&mcry_args.sessions[i]);
+        }
+        ret = opts.set_sessions(threaded_session_ptrs);
+        CHECK_EQ(ret, 0);
+
+        ret = opts_val.set_predicate(sc::VP_EQ);
+        CHECK_EQ(ret, 0);
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        ret = opts_val.set_predicate(sc::VP_UNCHANGED);
+        CHECK_EQ(ret, 0);
+        ret = valscan.next_scan(opts, opts_val);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(valscan.get_addrs(), addrs);
+        CHECK_EQ(_has_addr(addrs, health_addr), true);
+
+        //cleanup
+        sc_errno = 0;
+
+    } //end test
+
+
+    SUBCASE(test_cc_valscan_subtests[5]) {
+        title(CC, "valscan", "Candidate set forms");
+
+        std::vector<uint16_t> offs, ret_offs, kept_offs;
+        std::vector<cm_byte> vals;
+        const uint32_t val = 0xdeadbeef;
+
+        sc::_val_chunk chunk(0x1000);
+
+
+        //first test: every aligned position is a candidate
+        for (uint16_t off = 0; off < sc::_val_chunk_sz; off += 4) {
+            chunk.push(off, (cm_byte *) &val, sizeof(val));
+            offs.push_back(off);
+        }
+        chunk.pack(4);
+
+        CHECK_EQ(chunk.is_dense(), true);
+        CHECK_EQ(chunk.get_count(), offs.size());
+        chunk.get_offs(ret_offs, 4);
+        CHECK_EQ(ret_offs, offs);
+
+
+        //second test: few candidates survive
+        for (size_t i = 0; i < offs.size(); i += 64) {
+            kept_offs.push_back(offs[i]);
+            vals.insert(vals.end(), (cm_byte *) &val,
+                        ((cm_byte *) &val) + sizeof(val));
+        }
+        chunk.assign(kept_offs, vals, 4);
+
+        CHECK_EQ(chunk.is_dense(), false);
+        CHECK_EQ(chunk.get_count(), kept_offs.size());
+        CHECK_EQ(chunk.get_vals().size(), kept_offs.size() * sizeof(val));
+        chunk.get_offs(ret_offs, 4);
+        CHECK_EQ(ret_offs, kept_offs);
+
+
+        //third test: zeroed memory is stored in dense chunks
+        _set_value<uint8_t>(opts_val, sc::VT_U8, 1, 0);
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        size_t dense_num = 0;
+        for (auto iter = valscan.chunks.begin();
+             iter != valscan.chunks.end(); ++iter) {
+
+            CHECK(iter->get_count() != 0);
+            if (iter->is_dense() == true) ++dense_num;
+        }
+        std::cout << "dense chunks: " << dense_num << " / "
+                  << valscan.chunks.size() << std::endl;
+        CHECK_NE(dense_num, 0);
+
+    } //end test
+
+
+    SUBCASE(test_cc_valscan_subtests[6]) {
+        title(CC, "valscan", "Scan for an unknown initial value");
+
+        size_t snap_sz = 0;
+
+
+        //first test: snapshot every aligned position
+        ret = opts_val.set_type(sc::VT_I32);
+        CHECK_EQ(ret, 0);
+        ret = opts_val.set_alignment(4);
+        CHECK_EQ(ret, 0);
+
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(_has_addr(valscan.get_addrs(), health_addr), true);
+
+        for (auto iter = valscan.chunks.begin();
+             iter != valscan.chunks.end(); ++iter) {
+
+            CHECK_EQ(iter->has_snap(), true);
+            CHECK_EQ(iter->get_vals().empty(), true);
+            snap_sz += iter->snap.size();
+        }
+        std::cout << "snapshot: " << snap_sz << " / "
+                  << (valscan.chunks.size() * sc::_val_chunk_sz)
+                  << " bytes" << std::endl;
+        CHECK(snap_sz < valscan.chunks.size() * sc::_val_chunk_sz);
+
+
+        //second test: every player loses health & armour
+        _target_helper::change_target(pid);
+
+        ret = opts_val.set_predicate(sc::VP_DECREASED);
+        CHECK_EQ(ret, 0);
+
+        ret = valscan.next_scan(opts, opts_val);
+        CHECK_EQ(ret, 0);
+
+        std::vector<uintptr_t> addrs = valscan.get_addrs();
+        CHECK_EQ(_has_addr(addrs, health_addr), true);
+        CHECK_EQ(_has_addr(addrs, health_addr + sizeof(int32_t)), true);
+
+
+        //third test: nothing changed since
+        ret = opts_val.set_predicate(sc::VP_UNCHANGED);
+        CHECK_EQ(ret, 0);
+
+        ret = valscan.next_scan(opts, opts_val);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(_has_addr(valscan.get_addrs(), health_addr), true);
+
+
+        //fourth test: compare against the value player 2 is left with
+        ret = opts_val.set_predicate(sc::VP_EQ);
+        CHECK_EQ(ret, 0);
+        _set_value<int32_t>(opts_val, sc::VT_I32, 4, start_stat - 2);
+
+        ret = valscan.next_scan(opts, opts_val);
+        CHECK_EQ(ret, 0);
+
+        addrs = valscan.get_addrs();
+        CHECK_EQ(_has_addr(addrs, health_addr), true);
+        _check_addrs<int32_t>(mcry_args.sessions[0], addrs, start_stat - 2);
+
+    } //end test
+
+
+    SUBCASE(test_cc_valscan_subtests[7]) {
+        title(CC, "valscan", "Scan for ranges & approximate values");
+
+        float x;
+        std::vector<cm_byte> hi(sizeof(int32_t));
+
+        uintptr_t x_addr = _get_player_addr(mcry_args.sessions[0],
+                                            mcry_args.map, 1, pos_off);
+        ret = mc_read(&mcry_args.sessions[0],
+                      x_addr, (cm_byte *) &x, sizeof(x));
+        CHECK_EQ(ret, 0);
+
+
+        //first test: a position is never exactly a nearby value
+        _set_value<float>(opts_val, sc::VT_F32, 4, x + 0.25f);
+
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(_has_addr(valscan.get_addrs(), x_addr), false);
+
+
+        //second test: but is within epsilon of it
+        ret = opts_val.set_epsilon(0.5);
+        CHECK_EQ(ret, 0);
+
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(_has_addr(valscan.get_addrs(), x_addr), true);
+        _check_range<float>(mcry_args.sessions[0], valscan.get_addrs(),
+                            x - 0.25f, x + 0.75f);
+
+
+        //third test: & rounds or truncates to it
+        ret = opts_val.set_epsilon(std::nullopt);
+        CHECK_EQ(ret, 0);
+        ret = opts_val.set_round(sc::VR_ROUND);
+        CHECK_EQ(ret, 0);
+        _set_value<float>(opts_val, sc::VT_F32, 4, x + 0.3f);
+
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(_has_addr(valscan.get_addrs(), x_addr), true);
+        _check_range<float>(mcry_args.sessions[0], valscan.get_addrs(),
+                            x - 0.5f, x + 0.5f);
+
+        ret = opts_val.set_round(sc::VR_TRUNC);
+        CHECK_EQ(ret, 0);
+        _set_value<float>(opts_val, sc::VT_F32, 4, x + 0.7f);
+
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(_has_addr(valscan.get_addrs(), x_addr), true);
+        _check_range<float>(mcry_args.sessions[0], valscan.get_addrs(),
+                            x - 1.0f, x + 1.0f);
+
+
+        //fourth test: a range of integers, narrowed by a next scan
+        ret = opts_val.reset();
+        CHECK_EQ(ret, 0);
+        ret = opts_val.set_predicate(sc::VP_RANGE);
+        CHECK_EQ(ret, 0);
+        _set_value<int32_t>(opts_val, sc::VT_I32, 4, start_stat - 10);
+        *((int32_t *) hi.data()) = start_stat + 10;
+        ret = opts_val.set_value_hi(hi);
+        CHECK_EQ(ret, 0);
+
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(_has_addr(valscan.get_addrs(), health_addr), true);
+        _check_range<int32_t>(mcry_args.sessions[0], valscan.get_addrs(),
+                              start_stat - 10, start_stat + 10);
+
+        //player 2 loses 2 health & 4 armour
+        _target_helper::change_target(pid);
+
+        _set_value<int32_t>(opts_val, sc::VT_I32, 4, start_stat - 3);
+        *((int32_t *) hi.data()) = start_stat - 1;
+        ret = opts_val.set_value_hi(hi);
+        CHECK_EQ(ret, 0);
+
+        ret = valscan.next_scan(opts, opts_val);
+        CHECK_EQ(ret, 0);
+
+        std::vector<uintptr_t> addrs = valscan.get_addrs();
+        CHECK_EQ(_has_addr(addrs, health_addr), true);
+        CHECK_EQ(_has_addr(addrs, health_addr + sizeof(int32_t)), false);
+        _check_range<int32_t>(mcry_args.sessions[0], addrs,
+                              start_stat - 3, start_stat - 1);
+
+
+        //fifth test: missing, empty & invalid ranges
+        ret = opts_val.set_value_hi(std::nullopt);
+        CHECK_EQ(ret, 0);
+
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_OPT_MISSING);
+
+        *((int32_t *) hi.data()) = start_stat - 4;
+        ret = opts_val.set_value_hi(hi);
+        CHECK_EQ(ret, 0);
+
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_OPT_VALUE);
+
+        ret = opts_val.set_predicate(sc::VP_EQ);
+        CHECK_EQ(ret, 0);
+        ret = opts_val.set_epsilon(-1.0);
+        CHECK_EQ(ret, 0);
+        _set_value<float>(opts_val, sc::VT_F32, 4, x);
+
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_OPT_VALUE);
+
+        //cleanup
+        sc_errno = 0;
+
+    } //end test
+
+
+    SUBCASE(test_cc_valscan_subtests[8]) {
+        title(CC, "valscan", "Save & load scan results");
+
+        sc::serialiser serialiser;
+        std::vector<uintptr_t> addrs;
+
+
+        ret = opts.set_file_path_out(test_file);
+        CHECK_EQ(ret, 0);
+        ret = opts.set_file_path_in(test_file);
+        CHECK_EQ(ret, 0);
+
+        //scan for the health & armour of every player
+        _set_value<int32_t>(opts_val, sc::VT_I32, 4, start_stat);
+
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        addrs = valscan.get_addrs();
+
+        ret = serialiser.save_scan(valscan, opts);
+        CHECK_EQ(ret, 0);
+
+
+        //first test: the file header identifies a value scan
+        std::optional<sc::combined_file_hdr> hdr
+            = serialiser.read_headers(test_file);
+        REQUIRE_EQ(hdr.has_value(), true);
+        CHECK_EQ(hdr->scancry_hdr.scan_type, sc::scan_type_val);
+        CHECK_EQ(hdr->val_hdr.addrs_num, addrs.size());
+        CHECK_EQ(hdr->val_hdr.type, sc::VT_I32);
+        CHECK_EQ(hdr->val_hdr.alignment, 4);
+
+
+        //second test: shallow & deep loads restore every candidate
+        for (const bool shallow : {true, false}) {
+
+            ret = serialiser.load_scan(valscan, opts, shallow);
+            CHECK_EQ(ret, 0);
+            CHECK_EQ(valscan.get_addrs(), addrs);
+        }
+
+
+        //third test: a loaded scan continues with next scans
+        _target_helper::change_target(pid);
+
+        ret = opts_val.set_predicate(sc::VP_DECREASED_BY);
+        CHECK_EQ(ret, 0);
+        _set_value<int32_t>(opts_val, sc::VT_I32, 4, 2);
+
+        ret = valscan.next_scan(opts, opts_val);
+        CHECK_EQ(ret, 0);
+
+        addrs = valscan.get_addrs();
+        CHECK_EQ(_has_addr(addrs, health_addr), true);
+        CHECK_EQ(_has_addr(addrs, health_addr + sizeof(int32_t)), false);
+
+
+        //fourth test: a file of another scan type is rejected
+        sc::strscan strscan;
+
+        ret = serialiser.load_scan(strscan, opts, true);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_INVALID_FILE);
+
+        //cleanup
+        sc_errno = 0;
+        std::remove(test_file);
+
+    } //end test
+
+
+    SUBCASE(test_cc_valscan_subtests[9]) {
+        title(CC, "valscan", "Scan at alignments across buffer seams");
+
+        /*
+         *  NOTE: Areas start on a page boundary, so results of a scan at
+         *        a smaller alignment that are aligned to a larger one
+         *        must be exactly the results of a scan at the larger one.
+         */
+
+        auto aligned_to = [](const std::vector<uintptr_t> & addrs,
+                             const uintptr_t alignment) {
+            std::vector<uintptr_t> aligned;
+            for (auto iter = addrs.begin(); iter != addrs.end(); ++iter) {
+                if ((*iter % alignment) == 0) aligned.push_back(*iter);
+            }
+            return aligned;
+        };
+
+        //scan at the natural alignment
+        _set_value<int32_t>(opts_val, sc::VT_I32, 4, start_stat);
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        std::vector<uintptr_t> addrs_4 = valscan.get_addrs();
+
+
+        //first test: an alignment that does not divide a read buffer
+        _set_value<int32_t>(opts_val, sc::VT_I32, 16, start_stat);
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        _check_addrs<int32_t>(mcry_args.sessions[0],
+                              valscan.get_addrs(), start_stat);
+        CHECK_EQ(valscan.get_addrs(), aligned_to(addrs_4, 16));
+        CHECK_EQ(_has_addr(valscan.get_addrs(), health_addr),
+                 (health_addr % 16) == 0);
+
+
+        //second test: every byte
+        _set_value<int32_t>(opts_val, sc::VT_I32, 1, start_stat);
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+
+        _check_addrs<int32_t>(mcry_args.sessions[0],
+                              valscan.get_addrs(), start_stat);
+        CHECK_EQ(aligned_to(valscan.get_addrs(), 4), addrs_4);
+
+
+        //third test: snapshots at an alignment of 16 narrow correctly
+        ret = opts_val.set_value(std::nullopt);
+        CHECK_EQ(ret, 0);
+        ret = opts_val.set_alignment(16);
+        CHECK_EQ(ret, 0);
+
+        ret = valscan.scan(opts, opts_val, ma_set, wpool, 0x0);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(valscan.get_addrs_num() > 0, true);
+
+        _set_value<int32_t>(opts_val, sc::VT_I32, 16, start_stat);
+        ret = valscan.next_scan(opts, opts_val);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(valscan.get_addrs(), aligned_to(addrs_4, 16));
+
+    } //end test
+
+
+    //free workers
+    ret = wpool.free_workers();
+    CHECK_EQ(ret, 0);
+
+    //reset the map area set
+    ret = ma_set.reset();
+    CHECK_EQ(ret, 0);
+
+    //teardown MemCry
+    _memcry_helper::teardown(mcry_args);
+
+    //teardown target
+    _target_helper::end_target(pid);
+}
@@ -0,0 +1,606 @@
+//standard template library
+#include <optional>
+#include <vector>
+
+//C standard library
+#include <cstring>
+#include <ctime>
+
+//external libraries
+#include <cmore.h>
+#include <memcry.h>
+#include <doctest/doctest.h>
+
+//system headers
+#include <unistd.h>
+
+//local headers
+#include "filters.hh"
+#include "common.hh"
+#include "memcry_helper.hh"
+#include "target_helper.hh"
+
+//test target headers
+#include "../lib/scancry.h"
+
+
+
+/*
+ *  --- [HELPERS] ---
+ */
+
+/*
+ *  NOTE: The offset of `game_off` depends on the build of `unit_target`.
+ *        If tests fail, verify this offset is correct.
+ */
+
+const constexpr off_t game_off   = 0xb0; //NOTE: Depends on build
+const constexpr off_t entity_off = sizeof(uintptr_t);
+const constexpr off_t stats_off  = 0x10;
+const constexpr off_t health_off = 0x0;
+const constexpr off_t armour_off = 0x4;
+
+//initial health & armour of every player
+const constexpr int32_t start_stat = 100;
+
+//health & armour lost by every player when the target is changed
+const constexpr int32_t value_changes[4] = {1, 2, 3, 4};
+
+//refresh interval of the watch thread
+const constexpr struct timespec watch_interval = {0, 1000000};
+
+
+//find the `rw-` area of the target object
+static mc_vm_area * _get_rw_area(mc_vm_map & map) {
+
+    int ret;
+
+    cm_lst_node * area_node = nullptr;
+    mc_vm_area * area = nullptr;
+
+
+    mc_vm_obj * obj = MC_GET_NODE_OBJ(map.vm_objs.head->next);
+    for (int i = 0; i < obj->vm_area_node_ps.len; ++i) {
+
+        ret = cm_lst_get(&obj->vm_area_node_ps, i, &area_node);
+        CHECK_EQ(ret, 0);
+        area = MC_GET_NODE_AREA(area_node);
+
+        if (area->access == (MC_ACCESS_READ | MC_ACCESS_WRITE)) break;
+    }
+
+    return area;
+}
+
+
+//find the address of a player's stats
+static uintptr_t _get_stats_addr(mc_session & session, mc_vm_map & map,
+                                 const int player) {
+
+    int ret;
+    uintptr_t addr;
+
+
+    //walk game -> entity -> stats
+    addr = _get_rw_area(map)->start_addr + game_off;
+    ret = mc_read(&session, addr, (cm_byte *) &addr, sizeof(addr));
+    CHECK_EQ(ret, 0);
+
+    addr += entity_off * player;
+    ret = mc_read(&session, addr, (cm_byte *) &addr, sizeof(addr));
+    CHECK_EQ(ret, 0);
+
+    addr += stats_off;
+    ret = mc_read(&session, addr, (cm_byte *) &addr, sizeof(addr));
+    CHECK_EQ(ret, 0);
+
+    return addr;
+}
+
+
+//build the chain game -> entity -> stats -> health of a player
+static sc::ptrscan_chain _get_health_chain(mc_vm_map & map,
+                                           const int player) {
+
+    cm_lst_node * obj_node = map.vm_objs.head->next;
+    mc_vm_obj * obj = MC_GET_NODE_OBJ(obj_node);
+
+
+    return sc::ptrscan_chain(obj_node, 0, {
+        (off_t) (_get_rw_area(map)->start_addr - obj->start_addr) + game_off,
+        entity_off * player, stats_off, health_off
+    });
+}
+
+
+//get the 32-bit value of a watched entry
+static int32_t _get_i32(const struct sc::watch_value & value) {
+
+    int32_t i32;
+
+    std::memcpy(&i32, value.bytes, sizeof(i32));
+    return i32;
+}
+
+
+//wait for the watch thread to publish a later frame
+static const struct sc::watch_frame & _wait_frame(sc::watch_list & w_list,
+                                                  const uint64_t seq) {
+
+    for (int i = 0; i < 100; ++i) {
+
+        const struct sc::watch_frame & frame = w_list.get_frame();
+        if (frame.seq > seq) return frame;
+
+        usleep(thread_wait_usec_time / 100);
+    }
+
+    return w_list.get_frame();
+}
+
+
+
+      /* ===================== *
+ ===== *  C++ INTERFACE TESTS  * =====
+       * ===================== */
+
+/*
+ *  --- [TESTS] ---
+ */
+
+TEST_CASE(test_cc_watch_subtests[0]) {
+
+    int ret;
+    ssize_t idx;
+
+    pid_t pid;
+
+    _memcry_helper::args mcry_args;
+
+
+    sc::opt opts(sc::AW64);
+    sc::watch_list w_list;
+
+
+    /*
+     *  FIXTURE: Setup minimum options & construct a watch list.
+     */
+
+    //setup a target
+    ret = _target_helper::clean_targets();
+    CHECK_EQ(ret, 0);
+
+    pid = _target_helper::start_target();
+    CHECK_NE(pid, 0);
+
+    //setup MemCry
+    _memcry_helper::setup(mcry_args, pid, 8);
+
+
+    //setup generic options
+    ret = opts.set_map(&mcry_args.map);
+    CHECK_EQ(ret, 0);
+
+    std::vector<const mc_session *> session_ptrs = {
+        &mcry_args.sessions[0]
+    };
+    ret = opts.set_sessions(session_ptrs);
+    CHECK_EQ(ret, 0);
+
+    uintptr_t stats_addr
+        = _get_stats_addr(mcry_args.sessions[0], mcry_args.map, 1);
+
+
+    SUBCASE(test_cc_watch_subtests[1]) {
+        title(CC, "watch_list", "Refresh addresses & chains");
+
+        //first test: nothing is read before the first refresh
+        idx = w_list.add_addr(stats_addr + armour_off, sc::VT_I32);
+        CHECK_EQ(idx, 0);
+        idx = w_list.add_chain(_get_health_chain(mcry_args.map, 1),
+                               sc::VT_I32);
+        CHECK_EQ(idx, 1);
+        CHECK_EQ(w_list.get_entries_num(), 2);
+
+        CHECK_EQ(w_list.get_frame().seq, 0);
+
+
+        //second test: refresh once
+        ret = w_list.refresh(opts);
+        CHECK_EQ(ret, 0);
+
+        const struct sc::watch_frame & frame = w_list.get_frame();
+        CHECK_EQ(frame.seq, 1);
+        CHECK_EQ(frame.values.size(), 2);
+
+        CHECK_EQ(frame.values[0].ok, true);
+        CHECK_EQ(frame.values[0].addr, stats_addr + armour_off);
+        CHECK_EQ(_get_i32(frame.values[0]), start_stat);
+
+        CHECK_EQ(frame.values[1].ok, true);
+        CHECK_EQ(frame.values[1].addr, stats_addr + health_off);
+        CHECK_EQ(_get_i32(frame.values[1]), start_stat);
+
+
+        //third test: refresh after the target changes
+        _target_helper::change_target(pid);
+
+        ret = w_list.refresh(opts);
+        CHECK_EQ(ret, 0);
+
+        const struct sc::watch_frame & changed_frame = w_list.get_frame();
+        CHECK_EQ(changed_frame.seq, 2);
+        CHECK_EQ(_get_i32(changed_frame.values[0]),
+                 start_stat - (value_changes[1] * 2));
+        CHECK_EQ(_get_i32(changed_frame.values[1]),
+                 start_stat - value_changes[1]);
+
+
+        //fourth test: an unmapped address fails alone
+        idx = w_list.add_addr(0x8, sc::VT_I32);
+        CHECK_EQ(idx, 2);
+
+        ret = w_list.refresh(opts);
+        CHECK_EQ(ret, 0);
+
+        const struct sc::watch_frame & bad_frame = w_list.get_frame();
+        CHECK_EQ(bad_frame.values[0].ok, true);
+        CHECK_EQ(bad_frame.values[1].ok, true);
+        CHECK_EQ(bad_frame.values[2].ok, false);
+
+
+        //fifth test: refresh again, reading through the target's PID
+        ret = opts.set_pid(pid);
+        CHECK_EQ(ret, 0);
+
+        ret = w_list.refresh(opts);
+        CHECK_EQ(ret, 0);
+
+        const struct sc::watch_frame & pid_frame = w_list.get_frame();
+        CHECK_EQ(pid_frame.values[0].ok, true);
+        CHECK_EQ(_get_i32(pid_frame.values[0]),
+                 start_stat - (value_changes[1] * 2));
+        CHECK_EQ(pid_frame.values[1].ok, true);
+        CHECK_EQ(_get_i32(pid_frame.values[1]),
+                 start_stat - value_changes[1]);
+        CHECK_EQ(pid_frame.values[2].ok, false);
+
+        ret = opts.set_pid(std::nullopt);
+        CHECK_EQ(ret, 0);
+
+
+        //sixth test: reset
+        ret = w_list.reset();
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(w_list.get_entries_num(), 0);
+        CHECK_EQ(w_list.get_frame().seq, 0);
+
+    } //end test
+
+
+    SUBCASE(test_cc_watch_subtests[2]) {
+        title(CC, "watch_list", "Freeze & thaw entries");
+
+        int32_t health;
+        const int32_t frozen_health = 500;
+
+        std::vector<cm_byte> frozen_value(sizeof(frozen_health));
+        std::memcpy(frozen_value.data(), &frozen_health,
+                    sizeof(frozen_health));
+
+
+        //first test: a frozen value is written on every refresh
+        idx = w_list.add_chain(_get_health_chain(mcry_args.map, 1),
+                               sc::VT_I32);
+        CHECK_EQ(idx, 0);
+
+        ret = w_list.set_freeze(0, frozen_value);
+        CHECK_EQ(ret, 0);
+
+        ret = w_list.refresh(opts);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(_get_i32(w_list.get_frame().values[0]), frozen_health);
+
+        _target_helper::change_target(pid);
+
+        ret = w_list.refresh(opts);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(_get_i32(w_list.get_frame().values[0]), frozen_health);
+
+        ret = mc_read(&mcry_args.sessions[0], stats_addr + health_off,
+                      (cm_byte *) &health, sizeof(health));
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(health, frozen_health);
+
+
+        //second test: a thawed value is left to change
+        ret = w_list.set_freeze(0, std::nullopt);
+        CHECK_EQ(ret, 0);
+
+        _target_helper::change_target(pid);
+
+        ret = w_list.refresh(opts);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(_get_i32(w_list.get_frame().values[0]),
+                 frozen_health - value_changes[1]);
+
+    } //end test
+
+
+    SUBCASE(test_cc_watch_subtests[3]) {
+        title(CC, "watch_list", "Refresh on a dedicated thread");
+
+        uint64_t seq;
+
+
+        //first test: the thread publishes refreshes
+        idx = w_list.add_chain(_get_health_chain(mcry_args.map, 1),
+                               sc::VT_I32);
+        CHECK_EQ(idx, 0);
+
+        ret = w_list.start(opts, watch_interval);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(w_list.is_running(), true);
+
+        const struct sc::watch_frame & frame = _wait_frame(w_list, 0);
+        CHECK_GT(frame.seq, 0);
+        CHECK_EQ(frame.values[0].ok, true);
+        CHECK_EQ(_get_i32(frame.values[0]), start_stat);
+        seq = frame.seq;
+
+        const struct sc::watch_frame & later_frame = _wait_frame(w_list, seq);
+        CHECK_GT(later_frame.seq, seq);
+
+
+        //second test: entries can not change while the thread runs
+        idx = w_list.add_addr(stats_addr + armour_off, sc::VT_I32);
+        CHECK_EQ(idx, -1);
+        CHECK_EQ(sc_errno, SC_ERR_IN_USE);
+
+        ret = w_list.refresh(opts);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_IN_USE);
+
+
+        //third test: freezes can
+        ret = w_list.set_freeze(0, std::vector<cm_byte>(sizeof(int32_t), 0));
+        CHECK_EQ(ret, 0);
+
+        //the refresh in progress may have started before the freeze
+        seq = _wait_frame(w_list, w_list.get_frame().seq).seq;
+        const struct sc::watch_frame & frozen_frame = _wait_frame(w_list, seq);
+        CHECK_EQ(_get_i32(frozen_frame.values[0]), 0);
+
+
+        //fourth test: stop the thread
+        ret = w_list.stop();
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(w_list.is_running(), false);
+
+        seq = w_list.get_frame().seq;
+        usleep(thread_wait_usec_time);
+        CHECK_EQ(w_list.get_frame().seq, seq);
+
+        //stopping a stopped list does nothing
+        ret = w_list.stop();
+        CHECK_EQ(ret, 0);
+
+        //entries can change again
+        idx = w_list.add_addr(stats_addr + armour_off, sc::VT_I32);
+        CHECK_EQ(idx, 1);
+
+        //cleanup
+        sc_errno = 0;
+
+    } //end test
+
+
+    SUBCASE(test_cc_watch_subtests[4]) {
+        title(CC, "watch_list", "Use bad options");
+
+        sc::opt empty_opts(sc::AW64);
+
+
+        //first test: intervals that are not a positive time
+        idx = w_list.add_addr(stats_addr + health_off, sc::VT_I32);
+        CHECK_EQ(idx, 0);
+
+        const struct timespec bad_intervals[3] = {
+            {0, 0}, {-1, 0}, {0, 1000000000}
+        };
+
+        for (int i = 0; i < 3; ++i) {
+            ret = w_list.start(opts, bad_intervals[i]);
+            CHECK_EQ(ret, -1);
+            CHECK_EQ(sc_errno, SC_ERR_OPT_INTERVAL);
+            CHECK_EQ(w_list.is_running(), false);
+        }
+
+
+        //second test: no sessions
+        ret = w_list.refresh(empty_opts);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_OPT_NOSESSION);
+
+        ret = w_list.start(empty_opts, watch_interval);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_OPT_NOSESSION);
+        CHECK_EQ(w_list.is_running(), false);
+
+
+        //third test: a chain without an object or offsets
+        sc::ptrscan_chain no_offsets(mcry_args.map.vm_objs.head->next, 0, {});
+        idx = w_list.add_chain(no_offsets, sc::VT_I32);
+        CHECK_EQ(idx, -1);
+        CHECK_EQ(sc_errno, SC_ERR_WATCH_ENTRY);
+
+        sc::ptrscan_chain no_obj(nullptr, 0, {0x0});
+        idx = w_list.add_chain(no_obj, sc::VT_I32);
+        CHECK_EQ(idx, -1);
+        CHECK_EQ(sc_errno, SC_ERR_WATCH_ENTRY);
+
+
+        //fourth test: bad freezes
+        ret = w_list.set_freeze(1, std::vector<cm_byte>(sizeof(int32_t), 0));
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_WATCH_ENTRY);
+
+        ret = w_list.set_freeze(0, std::vector<cm_byte>(sizeof(int16_t), 0));
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_OPT_VALUE);
+
+        CHECK_EQ(w_list.get_entries_num(), 1);
+
+        //cleanup
+        sc_errno = 0;
+
+    } //end test
+
+
+    //teardown MemCry
+    _memcry_helper::teardown(mcry_args);
+
+    //teardown target
+    _target_helper::end_target(pid);
+}
+
+
+
+      /* =================== *
+ ===== *  C INTERFACE TESTS  * =====
+       * =================== */
+
+/*
+ *  --- [TESTS] ---
+ */
+
+TEST_CASE(test_c_watch_subtests[0]) {
+
+    int ret;
+    ssize_t idx;
+    uint64_t seq;
+
+    pid_t pid;
+
+    _memcry_helper::args mcry_args;
+
+    cm_vct sessions;
+    mc_session * session_p;
+
+
+    /*
+     *  FIXTURE: Setup minimum options.
+     */
+
+    //setup a target
+    ret = _target_helper::clean_targets();
+    CHECK_EQ(ret, 0);
+
+    pid = _target_helper::start_target();
+    CHECK_NE(pid, 0);
+
+    //setup MemCry
+    _memcry_helper::setup(mcry_args, pid, 1);
+
+
+    //setup generic options
+    sc_opt opts = sc_new_opt(test_c_addr_width);
+    REQUIRE_NE(opts, nullptr);
+
+    ret = sc_opt_set_map(opts, &mcry_args.map);
+    CHECK_EQ(ret, 0);
+
+    ret = cm_new_vct(&sessions, sizeof(mc_session *));
+    CHECK_EQ(ret, 0);
+    session_p = &mcry_args.sessions[0];
+    ret = cm_vct_apd(&sessions, &session_p);
+    CHECK_EQ(ret, 0);
+
+    ret = sc_opt_set_sessions(opts, &sessions);
+    CHECK_EQ(ret, 0);
+
+    uintptr_t stats_addr
+        = _get_stats_addr(mcry_args.sessions[0], mcry_args.map, 1);
+
+
+    SUBCASE(test_c_watch_subtests[1]) {
+        title(C, "sc_watch_list", "Check C wrappers work");
+
+        int32_t frozen_health = 0;
+        sc_watch_value values[2];
+
+
+        //create a new watch list
+        sc_watch_list w_list = sc_new_watch_list();
+        REQUIRE_NE(w_list, nullptr);
+
+        idx = sc_watch_list_add_addr(w_list, stats_addr + health_off, VT_I32);
+        CHECK_EQ(idx, 0);
+        idx = sc_watch_list_add_addr(w_list, stats_addr + armour_off, VT_I32);
+        CHECK_EQ(idx, 1);
+        CHECK_EQ(sc_watch_list_get_entries_num(w_list), 2);
+
+
+        //refresh once
+        ret = sc_watch_list_refresh(w_list, opts);
+        CHECK_EQ(ret, 0);
+
+        seq = sc_watch_list_get_frame(w_list, values);
+        CHECK_EQ(seq, 1);
+        CHECK_EQ(values[0].ok, true);
+        CHECK_EQ(std::memcmp(values[0].bytes,
+                             &start_stat, sizeof(start_stat)), 0);
+        CHECK_EQ(values[1].addr, stats_addr + armour_off);
+
+
+        //freeze health & refresh on a thread
+        ret = sc_watch_list_set_freeze(w_list, 0,
+                                       (cm_byte *) &frozen_health,
+                                       sizeof(frozen_health));
+        CHECK_EQ(ret, 0);
+
+        ret = sc_watch_list_start(w_list, opts, nullptr);
+        CHECK_EQ(ret, -1);
+        CHECK_EQ(sc_errno, SC_ERR_OPT_INTERVAL);
+
+        ret = sc_watch_list_start(w_list, opts, &watch_interval);
+        CHECK_EQ(ret, 0);
+
+        usleep(thread_wait_usec_time);
+
+        ret = sc_watch_list_stop(w_list);
+        CHECK_EQ(ret, 0);
+
+        seq = sc_watch_list_get_frame(w_list, values);
+        CHECK_GT(seq, 1);
+        CHECK_EQ(std::memcmp(values[0].bytes,
+                             &frozen_health, sizeof(frozen_health)), 0);
+
+
+        //thaw health & reset
+        ret = sc_watch_list_set_freeze(w_list, 0, nullptr, 0);
+        CHECK_EQ(ret, 0);
+
+        ret = sc_watch_list_reset(w_list);
+        CHECK_EQ(ret, 0);
+        CHECK_EQ(sc_watch_list_get_entries_num(w_list), 0);
+
+        //cleanup
+        ret = sc_del_watch_list(w_list);
+        CHECK_EQ(ret, 0);
+        sc_errno = 0;
+
+    } //end test
+
+
+    //teardown options
+    ret = sc_del_opt(opts);
+    CHECK_EQ(ret, 0);
+    cm_del_vct(&sessions);
+
+    //teardown MemCry
+    _memcry_helper::teardown(mcry_args);
+
+    //teardown target
+    _target_helper::end_target(pid);
+}